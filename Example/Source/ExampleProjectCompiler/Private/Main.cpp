@@ -36,6 +36,52 @@
 	#include <Rhi/Public/DefaultAllocator.h>
 #endif
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <cctype>
+	#include <limits>
+	#include <charconv>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void printUsage(const RendererToolkit::Context& rendererToolkitContext)
+		{
+			RHI_LOG(rendererToolkitContext, INFORMATION, "Usage: ExampleProjectCompiler [-j <number> | --jobs <number>] [--shared-cache <absolute directory> [<maximum size in MiB>]] [<render target> ...]")
+			RHI_LOG(rendererToolkitContext, INFORMATION, "  -j, --jobs <number>  Number of asset compiler worker threads, 0 means one per hardware thread (default)")
+			RHI_LOG(rendererToolkitContext, INFORMATION, "  --shared-cache       Content-addressed compiled asset cache directory which can be shared by multiple machines, no size limit by default")
+			RHI_LOG(rendererToolkitContext, INFORMATION, "  <render target>      Render target to compile the assets for, e.g. \"Direct3D11_50\" (default) or \"OpenGL_440\"")
+		}
+
+		template<typename T>
+		[[nodiscard]] bool parseUnsignedInteger(const std::string& argument, T& value)
+		{
+			// The whole argument must be a decimal unsigned integer which fits into the given type
+			const char* end = argument.data() + argument.size();
+			const std::from_chars_result result = std::from_chars(argument.data(), end, value);
+			return (std::errc() == result.ec && end == result.ptr);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Platform independent program entry point              ]
@@ -53,6 +99,7 @@
 	RendererToolkit::Context rendererToolkitContext(log, assert, allocator, defaultFileManager);
 	RendererToolkit::RendererToolkitInstance rendererToolkitInstance(rendererToolkitContext);
 	RendererToolkit::IRendererToolkit* rendererToolkit = rendererToolkitInstance.getRendererToolkit();
+	int result = 0;
 	if (nullptr != rendererToolkit)
 	{
 		RendererToolkit::IProject* project = rendererToolkit->createProject();
@@ -62,7 +109,73 @@
 			// at "unrimp/Example/DataSource/Example" and the resulting compiled/baked data ends up inside e.g. "unrimp/Binary/DataPc/Example"
 			project->load("../../Example/DataSource/Example");
 
-			if (commandLineArguments.getArguments().empty())
+			// Gather the render targets, "-j <number>" or "--jobs <number>" sets the number of asset compiler worker threads (default is one per hardware thread),
+			// "--shared-cache <absolute directory> [<maximum size in MiB>]" sets a content-addressed compiled asset cache directory which can be shared by multiple machines
+			std::vector<std::string> renderTargets;
+			bool validArguments = true;
+			const CommandLineArguments::Arguments& arguments = commandLineArguments.getArguments();
+			for (size_t i = 0; i < arguments.size() && validArguments; ++i)
+			{
+				const std::string& argument = arguments[i];
+				if ("-j" == argument || "--jobs" == argument)
+				{
+					uint32_t numberOfCompilerThreads = 0;
+					if (i + 1 < arguments.size() && ::detail::parseUnsignedInteger(arguments[i + 1], numberOfCompilerThreads))
+					{
+						project->setNumberOfCompilerThreads(numberOfCompilerThreads);
+						++i;
+					}
+					else
+					{
+						RHI_LOG(rendererToolkitContext, CRITICAL, "\"%s\" must be followed by the number of asset compiler worker threads", argument.c_str())
+						validArguments = false;
+					}
+				}
+				else if ("--shared-cache" == argument)
+				{
+					if (i + 1 < arguments.size())
+					{
+						const std::string& absoluteDirectoryName = arguments[++i];
+						uint64_t maximumSizeInBytes = 0;
+
+						// An optional following argument starting with a digit is the maximum size in MiB, it must fit into 64 bit when converted into bytes
+						if (i + 1 < arguments.size() && !arguments[i + 1].empty() && std::isdigit(static_cast<unsigned char>(arguments[i + 1][0])))
+						{
+							uint64_t maximumSizeInMiB = 0;
+							if (::detail::parseUnsignedInteger(arguments[i + 1], maximumSizeInMiB) && maximumSizeInMiB <= std::numeric_limits<uint64_t>::max() / (1024 * 1024))
+							{
+								maximumSizeInBytes = maximumSizeInMiB * 1024 * 1024;
+								++i;
+							}
+							else
+							{
+								RHI_LOG(rendererToolkitContext, CRITICAL, "\"%s\" is no valid maximum shared cache size in MiB", arguments[i + 1].c_str())
+								validArguments = false;
+							}
+						}
+						if (validArguments)
+						{
+							project->setSharedCacheDirectory(absoluteDirectoryName, maximumSizeInBytes);
+						}
+					}
+					else
+					{
+						RHI_LOG(rendererToolkitContext, CRITICAL, "\"%s\" must be followed by an absolute directory name", argument.c_str())
+						validArguments = false;
+					}
+				}
+				else
+				{
+					renderTargets.push_back(argument);
+				}
+			}
+
+			if (!validArguments)
+			{
+				::detail::printUsage(rendererToolkitContext);
+				result = 1;
+			}
+			else if (renderTargets.empty())
 			{
 				//	project->compileAllAssets("Direct3D9_30");
 					project->compileAllAssets("Direct3D11_50");
@@ -72,12 +185,11 @@
 			}
 			else
 			{
-				// For now all given arguments are interpreted as render target
-				for (const std::string_view& renderTarget : commandLineArguments.getArguments())
+				// For now all remaining arguments are interpreted as render target
+				for (const std::string& renderTarget : renderTargets)
 				{
-					const std::string renderTargetString(renderTarget);
-					RHI_LOG(rendererToolkitContext, INFORMATION, "Compiling for target: \"%s\"", renderTargetString.c_str())
-					project->compileAllAssets(renderTargetString.c_str());
+					RHI_LOG(rendererToolkitContext, INFORMATION, "Compiling for target: \"%s\"", renderTarget.c_str())
+					project->compileAllAssets(renderTarget.c_str());
 					RHI_LOG(rendererToolkitContext, INFORMATION, "Compilation done")
 				}
 			}
@@ -91,8 +203,8 @@
 		delete project;
 	}
 
-	// No error
-	return 0;
+	// Done
+	return result;
 }
 
 
@@ -42,6 +42,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	#include <string>
+	#include <atomic>	// For "std::atomic<>"
 	#include <fstream>
 	#include <unordered_map>
 PRAGMA_WARNING_POP
@@ -664,7 +665,7 @@ namespace Renderer
 		AbsoluteDirectoryNames mAbsoluteBaseDirectory;	///< Absolute UTF-8 base directory, without "/" at the end
 		MountedDirectories	   mMountedDirectories;
 		#ifdef RHI_DEBUG
-			mutable int mNumberOfCurrentlyOpenedFiles = 0;	///< For leak detection
+			mutable std::atomic<int> mNumberOfCurrentlyOpenedFiles = 0;	///< For leak detection, atomic since files might be opened by multiple threads at one and the same time (e.g. resource streamer or asset compiler worker threads)
 		#endif
 
 
@@ -48,7 +48,7 @@ namespace
 			// Format
 			uint32_t formatType;
 			uint32_t formatVersion;
-			// Content
+			// Content, in case the number of compressed bytes is identical to the number of decompressed bytes the data is stored uncompressed
 			uint32_t numberOfCompressedBytes;
 			uint32_t numberOfDecompressedBytes;
 		};
@@ -131,35 +131,52 @@ namespace Renderer
 
 	void MemoryFile::decompress()
 	{
-		mDecompressedData.resize(mNumberOfDecompressedBytes);
-		[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(mCompressedData.data()), reinterpret_cast<char*>(mDecompressedData.data()), static_cast<int>(mCompressedData.size()), static_cast<int>(mNumberOfDecompressedBytes));
-		ASSERT(mNumberOfDecompressedBytes == static_cast<uint32_t>(numberOfDecompressedBytes), "Invalid number of decompressed bytes")
+		if (mCompressedData.size() == mNumberOfDecompressedBytes)
+		{
+			// Data is stored uncompressed
+			mDecompressedData.assign(mCompressedData.cbegin(), mCompressedData.cend());
+		}
+		else
+		{
+			mDecompressedData.resize(mNumberOfDecompressedBytes);
+			[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(mCompressedData.data()), reinterpret_cast<char*>(mDecompressedData.data()), static_cast<int>(mCompressedData.size()), static_cast<int>(mNumberOfDecompressedBytes));
+			ASSERT(mNumberOfDecompressedBytes == static_cast<uint32_t>(numberOfDecompressedBytes), "Invalid number of decompressed bytes")
+		}
 		mCurrentDataPointer = mDecompressedData.data();
 	}
 
-	bool MemoryFile::writeLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename) const
+	bool MemoryFile::writeLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename, bool lz4Compression) const
 	{
 		// Open file
 		IFile* file = fileManager.openFile(IFileManager::FileMode::WRITE, virtualFilename);
 		if (nullptr != file)
 		{
 			// Write file
-			const int destinationCapacity = LZ4_compressBound(static_cast<int>(mDecompressedData.size()));
-			char* destination = new char[static_cast<unsigned int>(destinationCapacity)];
+			// -> In case LZ4 compression is disabled or doesn't make the data smaller, the data is stored uncompressed (e.g. already "meshoptimizer" encoded data)
+			const int destinationCapacity = lz4Compression ? LZ4_compressBound(static_cast<int>(mDecompressedData.size())) : 0;
+			char* destination = lz4Compression ? new char[static_cast<unsigned int>(destinationCapacity)] : nullptr;
 			{
-				const int numberOfWrittenBytes = LZ4_compress_HC(reinterpret_cast<const char*>(mDecompressedData.data()), destination, static_cast<int>(mDecompressedData.size()), destinationCapacity, LZ4HC_CLEVEL_MAX);
+				const int numberOfWrittenBytes = lz4Compression ? LZ4_compress_HC(reinterpret_cast<const char*>(mDecompressedData.data()), destination, static_cast<int>(mDecompressedData.size()), destinationCapacity, LZ4HC_CLEVEL_MAX) : 0;
+				const bool compressed = (numberOfWrittenBytes > 0 && static_cast<size_t>(numberOfWrittenBytes) < mDecompressedData.size());
 
 				{ // Write down the file format header
 					::detail::FileFormatHeader fileFormatHeader;
 					fileFormatHeader.formatType				   = formatType;
 					fileFormatHeader.formatVersion			   = formatVersion;
-					fileFormatHeader.numberOfCompressedBytes   = static_cast<uint32_t>(numberOfWrittenBytes);
+					fileFormatHeader.numberOfCompressedBytes   = compressed ? static_cast<uint32_t>(numberOfWrittenBytes) : static_cast<uint32_t>(mDecompressedData.size());
 					fileFormatHeader.numberOfDecompressedBytes = static_cast<uint32_t>(mDecompressedData.size());
 					file->write(&fileFormatHeader, sizeof(::detail::FileFormatHeader));
 				}
 
-				// Write down the compressed data
-				file->write(destination, static_cast<size_t>(numberOfWrittenBytes));
+				// Write down the compressed or uncompressed data
+				if (compressed)
+				{
+					file->write(destination, static_cast<size_t>(numberOfWrittenBytes));
+				}
+				else
+				{
+					file->write(mDecompressedData.data(), mDecompressedData.size());
+				}
 			}
 			delete [] destination;
 
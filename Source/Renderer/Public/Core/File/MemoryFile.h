@@ -129,7 +129,7 @@ namespace Renderer
 		[[nodiscard]] RENDERER_API_EXPORT bool loadLz4CompressedDataFromFile(uint32_t formatType, uint32_t formatVersion, IFile& file);
 		RENDERER_API_EXPORT void setLz4CompressedDataByFile(IFile& file, uint32_t numberOfCompressedBytes, uint32_t numberOfDecompressedBytes);
 		RENDERER_API_EXPORT void decompress();
-		[[nodiscard]] RENDERER_API_EXPORT bool writeLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename) const;
+		[[nodiscard]] RENDERER_API_EXPORT bool writeLz4CompressedDataByVirtualFilename(uint32_t formatType, uint32_t formatVersion, const IFileManager& fileManager, VirtualFilename virtualFilename, bool lz4Compression = true) const;
 
 
 	//[-------------------------------------------------------]
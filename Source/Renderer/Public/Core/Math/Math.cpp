@@ -25,6 +25,12 @@
 #include "Renderer/Public/Core/File/IFile.h"
 #include "Renderer/Public/Core/File/IFileManager.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/gtc/packing.hpp>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -126,6 +132,32 @@ namespace Renderer
 		return (maximumSquaredLength > minimumSquaredLength) ? sqrt(maximumSquaredLength) : sqrt(minimumSquaredLength);
 	}
 
+	float Math::quantizeVertexPosition(const glm::vec3& position, const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition, uint16_t quantizedPosition[4])
+	{
+		const glm::vec3 extent = maximumBoundingBoxPosition - minimumBoundingBoxPosition;
+		float quantizationError = 0.0f;
+		for (glm::length_t i = 0; i < 3; ++i)
+		{
+			// Check extent in order to avoid an evil division through zero, e.g. for flat meshes
+			const float normalized = (extent[i] > 0.0f) ? glm::clamp((position[i] - minimumBoundingBoxPosition[i]) / extent[i], 0.0f, 1.0f) : 0.0f;
+			quantizedPosition[i] = static_cast<uint16_t>(normalized * 65535.0f + 0.5f);
+			quantizationError = std::max(quantizationError, std::abs(minimumBoundingBoxPosition[i] + static_cast<float>(quantizedPosition[i]) / 65535.0f * extent[i] - position[i]));
+		}
+		quantizedPosition[3] = 0;
+
+		// Done
+		return quantizationError;
+	}
+
+	float Math::quantizeTextureCoordinate(const glm::vec2& textureCoordinate, uint16_t quantizedTextureCoordinate[2])
+	{
+		const uint32_t packedTextureCoordinate = glm::packHalf2x16(textureCoordinate);
+		quantizedTextureCoordinate[0] = static_cast<uint16_t>(packedTextureCoordinate & 0xFFFFu);
+		quantizedTextureCoordinate[1] = static_cast<uint16_t>(packedTextureCoordinate >> 16u);
+		const glm::vec2 quantizationError = glm::abs(glm::unpackHalf2x16(packedTextureCoordinate) - textureCoordinate);
+		return std::max(quantizationError.x, quantizationError.y);
+	}
+
 	float Math::wrapToInterval(float value, float minimum, float maximum)
 	{
 		// Wrap as described at http://en.wikipedia.org/wiki/Wrapping_%28graphics%29
@@ -150,6 +150,38 @@ namespace Renderer
 		*/
 		[[nodiscard]] RENDERER_API_EXPORT static float calculateInnerBoundingSphereRadius(const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition);
 
+		/**
+		*  @brief
+		*    Quantize a vertex position into 16 bit unsigned normalized integers relative to the given bounding box
+		*
+		*  @param[in] position
+		*    The full precision vertex position, should be inside the given bounding box
+		*  @param[in] minimumBoundingBoxPosition
+		*    The minimum bounding box position, dequantization offset
+		*  @param[in] maximumBoundingBoxPosition
+		*    The maximum bounding box position, "maximumBoundingBoxPosition - minimumBoundingBoxPosition" is the dequantization scale
+		*  @param[out] quantizedPosition
+		*    Receives the quantized vertex position, the fourth component is unused and set to zero so the position is 8 byte aligned ("Rhi::VertexAttributeFormat::R16G16B16A16_UNORM")
+		*
+		*  @return
+		*    The maximum absolute quantization error of all components
+		*/
+		RENDERER_API_EXPORT static float quantizeVertexPosition(const glm::vec3& position, const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition, uint16_t quantizedPosition[4]);
+
+		/**
+		*  @brief
+		*    Quantize a texture coordinate into 16 bit half floats
+		*
+		*  @param[in] textureCoordinate
+		*    The full precision texture coordinate
+		*  @param[out] quantizedTextureCoordinate
+		*    Receives the quantized texture coordinate ("Rhi::VertexAttributeFormat::HALF_2")
+		*
+		*  @return
+		*    The maximum absolute quantization error of all components
+		*/
+		RENDERER_API_EXPORT static float quantizeTextureCoordinate(const glm::vec2& textureCoordinate, uint16_t quantizedTextureCoordinate[2]);
+
 		/**
 		*  @brief
 		*    Ensure that the given value is within the given interval [minimum, maximum] by wrapping the value
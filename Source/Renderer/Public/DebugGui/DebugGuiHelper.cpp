@@ -30,6 +30,8 @@
 #include "Renderer/Public/Resource/Skeleton/SkeletonResourceManager.h"
 #include "Renderer/Public/Resource/Skeleton/SkeletonResource.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorResourcePass.h"
 #include "Renderer/Public/IRenderer.h"
 
 #include <ImGui/imgui.h>
@@ -469,6 +471,18 @@ namespace Renderer
 					ImGui::TreePop();
 				}
 
+				{ // GPU memory statistics, only available if the RHI implementation manages GPU memory on its own
+					Rhi::MemoryStatistics memoryStatistics;
+					if (compositorWorkspaceInstance->getRenderer().getRhi().getMemoryStatistics(memoryStatistics) && ImGui::TreeNode("GpuMemory", "GPU memory: %s MiB", ::detail::stringFormatCommas(memoryStatistics.numberOfAllocatedBytes / (1024 * 1024), temporary)))
+					{
+						ImGui::Text("Used MiB: %s", ::detail::stringFormatCommas(memoryStatistics.numberOfUsedBytes / (1024 * 1024), temporary));
+						ImGui::Text("Memory blocks: %s", ::detail::stringFormatCommas(memoryStatistics.numberOfMemoryBlocks, temporary));
+						ImGui::Text("Sub-allocations: %s", ::detail::stringFormatCommas(memoryStatistics.numberOfSubAllocations, temporary));
+						ImGui::Text("Dedicated allocations: %s", ::detail::stringFormatCommas(memoryStatistics.numberOfDedicatedAllocations, temporary));
+						ImGui::TreePop();
+					}
+				}
+
 				// RHI and pipeline statistics
 				#ifdef RHI_STATISTICS
 				{ // RHI statistics
@@ -529,6 +543,18 @@ namespace Renderer
 					ImGui::TreePop();
 				}
 				#endif
+
+				// Compositor instance pass GPU times
+				#ifdef RENDERER_PROFILER
+					if (ImGui::TreeNode("CompositorPassGpuTimes", "Compositor pass GPU times"))
+					{
+						for (const CompositorWorkspaceInstance::CompositorInstancePassGpuTime& compositorInstancePassGpuTime : compositorWorkspaceInstance->getCompositorInstancePassGpuTimes())
+						{
+							ImGui::Text("%s: %.3f ms", compositorInstancePassGpuTime.compositorInstancePass->getCompositorResourcePass().getDebugName(), static_cast<double>(compositorInstancePassGpuTime.milliseconds));
+						}
+						ImGui::TreePop();
+					}
+				#endif
 			}
 		}
 		ImGui::End();
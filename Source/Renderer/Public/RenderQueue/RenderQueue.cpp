@@ -240,7 +240,8 @@ namespace Renderer
 		mMaximumRenderQueueIndex(maximumRenderQueueIndex),
 		mPositionOnlyPass(positionOnlyPass),
 		mTransparentPass(transparentPass),
-		mDoSort(doSort)
+		mDoSort(doSort),
+		mGpuCulling(nullptr)
 	{
 		RHI_ASSERT(mRenderer.getContext(), mMaximumRenderQueueIndex >= mMinimumRenderQueueIndex, "Invalid minimum/maximum render queue index")
 		mQueues.resize(static_cast<size_t>(mMaximumRenderQueueIndex - mMinimumRenderQueueIndex + 1));
@@ -598,12 +599,14 @@ namespace Renderer
 			bool enforcePassBufferManagerFillBuffer = true;
 
 			// Get indirect buffer
+			// -> When using GPU culling, the draw indexed arguments are written by a compute shader into the GPU culling output indirect buffer instead
 			Rhi::IIndirectBuffer* indirectBuffer = nullptr;
 			uint32_t indirectBufferOffset = 0;
 			uint8_t* indirectBufferData = nullptr;
-			if (mNumberOfDrawIndexedCalls > 0 || mNumberOfDrawCalls > 0 )
+			const uint32_t numberOfIndirectBufferBytes = ((nullptr != mGpuCulling) ? 0 : static_cast<uint32_t>(sizeof(Rhi::DrawIndexedArguments)) * mNumberOfDrawIndexedCalls) + static_cast<uint32_t>(sizeof(Rhi::DrawArguments)) * mNumberOfDrawCalls;
+			if (numberOfIndirectBufferBytes > 0)
 			{
-				IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(sizeof(Rhi::DrawIndexedArguments) * mNumberOfDrawIndexedCalls + sizeof(Rhi::DrawArguments) * mNumberOfDrawCalls);
+				IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(numberOfIndirectBufferBytes);
 				RHI_ASSERT(mRenderer.getContext(), nullptr != managedIndirectBuffer, "Invalid managed indirect buffer")
 				indirectBuffer		 = managedIndirectBuffer->indirectBuffer;
 				indirectBufferOffset = managedIndirectBuffer->indirectBufferOffset;
@@ -615,6 +618,7 @@ namespace Renderer
 			uint32_t currentDrawIndirectBufferOffset = indirectBufferOffset;
 			uint32_t currentNumberOfDraws = 0;
 			bool currentDrawIndexed = false;
+			uint32_t currentGpuCullingFirstDrawIndex = (nullptr != mGpuCulling) ? static_cast<uint32_t>(mGpuCulling->drawCandidates.size()) : 0;
 
 			// Process queues
 			for (Queue& queue : mQueues)
@@ -740,7 +744,14 @@ namespace Renderer
 							{
 								if (currentNumberOfDraws)
 								{
-									Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+									if (nullptr != mGpuCulling)
+									{
+										emitGpuCullingDrawIndexedGraphics(commandBuffer, currentGpuCullingFirstDrawIndex, currentNumberOfDraws);
+									}
+									else
+									{
+										Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+									}
 									currentNumberOfDraws = 0;
 								}
 							}
@@ -750,6 +761,10 @@ namespace Renderer
 								currentNumberOfDraws = 0;
 							}
 							currentDrawIndirectBufferOffset = indirectBufferOffset;
+							if (nullptr != mGpuCulling)
+							{
+								currentGpuCullingFirstDrawIndex = static_cast<uint32_t>(mGpuCulling->drawCandidates.size());
+							}
 						}
 
 						// Append scratch command buffer into the main command buffer
@@ -775,11 +790,29 @@ namespace Renderer
 						else if (0 != renderable.getNumberOfIndices())
 						{
 							// Sanity checks
-							RHI_ASSERT(mRenderer.getContext(), nullptr != indirectBuffer, "Invalid indirect buffer")
-							RHI_ASSERT(mRenderer.getContext(), nullptr != indirectBuffer, "Invalid indirect buffer data")
+							RHI_ASSERT(mRenderer.getContext(), nullptr != indirectBuffer || (nullptr != mGpuCulling && renderable.getDrawIndexed()), "Invalid indirect buffer")
+							RHI_ASSERT(mRenderer.getContext(), nullptr != indirectBufferData || (nullptr != mGpuCulling && renderable.getDrawIndexed()), "Invalid indirect buffer data")
 
 							// Fill indirect buffer
-							if (renderable.getDrawIndexed())
+							if (renderable.getDrawIndexed() && nullptr != mGpuCulling)
+							{
+								// Record GPU culling draw candidate, the GPU culling compute shader writes the draw indexed arguments in case the draw is visible
+								// -> The bounding sphere is stored relative to the rarely changing GPU culling world space origin instead of camera relative, this way the draw candidates of static scenes don't change when only the camera moves
+								const RenderableManager& renderableManager = renderable.getRenderableManager();
+								const Transform& transform = renderableManager.getTransform();
+								const glm::vec3 boundingSpherePosition = glm::vec3(transform.position - mGpuCulling->worldSpaceOrigin + glm::dvec3(transform.rotation * (renderableManager.getBoundingSpherePosition() * transform.scale)));
+								const uint32_t drawIndex = static_cast<uint32_t>(mGpuCulling->drawCandidates.size());
+								mGpuCulling->drawCandidates.push_back(
+								{
+									{ boundingSpherePosition.x, boundingSpherePosition.y, boundingSpherePosition.z, renderableManager.getBoundingSphereRadius() * std::max(transform.scale.x, std::max(transform.scale.y, transform.scale.z)) },
+									Rhi::DrawIndexedArguments(renderable.getNumberOfIndices(), instanceCount * renderable.getInstanceCount(), renderable.getStartIndexLocation(), 0, startInstanceLocation),
+									drawIndex,
+									currentGpuCullingFirstDrawIndex,
+									mGpuCulling->numberOfDrawCounts
+								});
+								currentDrawIndexed = true;
+							}
+							else if (renderable.getDrawIndexed())
 							{
 								// Fill indirect buffer
 								Rhi::DrawIndexedArguments* drawIndexedArguments = reinterpret_cast<Rhi::DrawIndexedArguments*>(indirectBufferData + indirectBufferOffset);
@@ -817,7 +850,14 @@ namespace Renderer
 			{
 				if (currentDrawIndexed)
 				{
-					Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+					if (nullptr != mGpuCulling)
+					{
+						emitGpuCullingDrawIndexedGraphics(commandBuffer, currentGpuCullingFirstDrawIndex, currentNumberOfDraws);
+					}
+					else
+					{
+						Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+					}
 				}
 				else
 				{
@@ -1029,6 +1069,32 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RenderQueue::emitGpuCullingDrawIndexedGraphics(Rhi::CommandBuffer& commandBuffer, uint32_t firstDrawIndex, uint32_t numberOfDraws)
+	{
+		// Sanity checks
+		RHI_ASSERT(mRenderer.getContext(), nullptr != mGpuCulling, "Invalid GPU culling")
+		RHI_ASSERT(mRenderer.getContext(), nullptr != mGpuCulling->outputIndirectBuffer, "Invalid GPU culling output indirect buffer")
+		RHI_ASSERT(mRenderer.getContext(), numberOfDraws > 0, "Invalid number of draws")
+
+		// Emit the multi-draw-indirect batch referencing the draw indexed arguments written by the GPU culling compute shader
+		const uint32_t indirectBufferOffset = static_cast<uint32_t>(sizeof(Rhi::DrawIndexedArguments)) * firstDrawIndex;
+		if (nullptr != mGpuCulling->drawCountBuffer)
+		{
+			// Visible draws are compacted, the number of visible draws is read from the draw count buffer
+			Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *mGpuCulling->outputIndirectBuffer, indirectBufferOffset, numberOfDraws, *mGpuCulling->drawCountBuffer, static_cast<uint32_t>(sizeof(uint32_t)) * mGpuCulling->numberOfDrawCounts);
+		}
+		else
+		{
+			// Culled draws have an instance count of zero
+			Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *mGpuCulling->outputIndirectBuffer, indirectBufferOffset, numberOfDraws);
+		}
+		++mGpuCulling->numberOfDrawCounts;
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "Renderer/Public/Core/Math/Math.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -90,6 +91,50 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    GPU culling draw candidate, one per indexed draw
+		*
+		*  @note
+		*    - Must match the "DrawCandidate" structure of the GPU culling compute shader (std430 layout)
+		*/
+		struct GpuCullingDrawCandidate final
+		{
+			float					  boundingSphere[4];	///< xyz = bounding sphere position relative to "Renderer::RenderQueue::GpuCulling::worldSpaceOrigin", w = bounding sphere radius (zero means unbounded, never culled)
+			Rhi::DrawIndexedArguments drawIndexedArguments;	///< Draw indexed arguments to write in case the draw is visible
+			uint32_t				  drawIndex;			///< Uncompacted index of the draw inside the output indirect buffer
+			uint32_t				  firstDrawIndex;		///< Index of the first draw of the multi-draw-indirect batch inside the output indirect buffer
+			uint32_t				  drawCountIndex;		///< Index of the multi-draw-indirect batch draw count inside the draw count buffer
+		};
+		typedef std::vector<GpuCullingDrawCandidate> GpuCullingDrawCandidates;
+
+		/**
+		*  @brief
+		*    Optional GPU culling the render queue is writing indexed draws into instead of directly emitting CPU written draw arguments
+		*
+		*  @remarks
+		*    The render queue records one draw candidate per indexed draw and emits multi-draw-indirect commands which are referencing the output
+		*    indirect buffer. It's the responsibility of the GPU culling owner to dispatch a compute shader before the recorded draw commands are
+		*    executed which is writing the draw indexed arguments of all visible draw candidates into the output indirect buffer.
+		*    - With a draw count buffer, visible draws are compacted per multi-draw-indirect batch and the batch draw count is read by the GPU
+		*    - Without a draw count buffer, culled draws are written with an instance count of zero
+		*/
+		struct GpuCulling final
+		{
+			// Set by the GPU culling owner
+			Rhi::IIndirectBuffer*	 outputIndirectBuffer = nullptr;	///< Output indirect buffer, must be able to hold the draw indexed arguments of all indexed draws, don't destroy the instance
+			Rhi::IIndirectBuffer*	 drawCountBuffer	  = nullptr;	///< Draw count buffer holding one "uint32_t" per multi-draw-indirect batch, null pointer if "Rhi::Capabilities::drawIndirectCount" is false, don't destroy the instance
+			glm::dvec3				 worldSpaceOrigin	  = glm::dvec3(0.0);	///< 64 bit world space position the draw candidate bounding spheres are relative to, keeps them in 32 bit floating point precision near the camera
+			// Filled by "Renderer::RenderQueue::fillGraphicsCommandBuffer()", cleared by the GPU culling owner
+			GpuCullingDrawCandidates drawCandidates;
+			uint32_t				 numberOfDrawCounts = 0;		///< Number of multi-draw-indirect batches
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -133,6 +178,21 @@ namespace Renderer
 			return mMaximumRenderQueueIndex;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfDrawIndexedCalls() const
+		{
+			return mNumberOfDrawIndexedCalls;
+		}
+
+		[[nodiscard]] inline GpuCulling* getGpuCulling() const
+		{
+			return mGpuCulling;
+		}
+
+		inline void setGpuCulling(GpuCulling* gpuCulling)	// Can be a null pointer to disable GPU culling, the GPU culling instance must stay valid as long as it's used by the render queue
+		{
+			mGpuCulling = gpuCulling;
+		}
+
 		void clear();
 		void addRenderablesFromRenderableManager(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows = false);
 		void fillGraphicsCommandBuffer(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
@@ -145,6 +205,7 @@ namespace Renderer
 	private:
 		explicit RenderQueue(const RenderQueue&) = delete;
 		RenderQueue& operator=(const RenderQueue&) = delete;
+		void emitGpuCullingDrawIndexedGraphics(Rhi::CommandBuffer& commandBuffer, uint32_t firstDrawIndex, uint32_t numberOfDraws);
 
 
 	//[-------------------------------------------------------]
@@ -206,6 +267,7 @@ namespace Renderer
 		bool					mPositionOnlyPass;
 		bool					mTransparentPass;
 		bool					mDoSort;
+		GpuCulling*				mGpuCulling;				///< Optional GPU culling, can be a null pointer, don't destroy the instance
 		// Scratch buffers to reduce dynamic memory allocations
 		Rhi::CommandBuffer		mScratchCommandBuffer;
 		ShaderProperties		mScratchShaderProperties;
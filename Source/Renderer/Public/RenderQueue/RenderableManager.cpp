@@ -64,6 +64,10 @@ namespace Renderer
 		mNumberOfLods(1),
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
+		mBoundingSpherePosition(0.0f, 0.0f, 0.0f),
+		mBoundingSphereRadius(0.0f),
+		mPositionDequantizationOffset(0.0f, 0.0f, 0.0f),
+		mPositionDequantizationScale(1.0f, 1.0f, 1.0f),
 		mCachedDistanceToCamera(getInvalid<float>()),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
@@ -30,6 +30,14 @@
 #include "Renderer/Public/Core/Manager.h"
 #include "Renderer/Public/RenderQueue/Renderable.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -148,6 +156,38 @@ namespace Renderer
 			mVisible = visible;
 		}
 
+		[[nodiscard]] inline const glm::vec3& getBoundingSpherePosition() const
+		{
+			return mBoundingSpherePosition;
+		}
+
+		[[nodiscard]] inline float getBoundingSphereRadius() const
+		{
+			return mBoundingSphereRadius;
+		}
+
+		inline void setBoundingSpherePositionRadius(const glm::vec3& boundingSpherePosition, float boundingSphereRadius)	// Object space bounding sphere, a radius of zero means "unbounded" and such renderables are never GPU culled
+		{
+			mBoundingSpherePosition = boundingSpherePosition;
+			mBoundingSphereRadius = boundingSphereRadius;
+		}
+
+		[[nodiscard]] inline const glm::vec3& getPositionDequantizationOffset() const
+		{
+			return mPositionDequantizationOffset;
+		}
+
+		[[nodiscard]] inline const glm::vec3& getPositionDequantizationScale() const
+		{
+			return mPositionDequantizationScale;
+		}
+
+		inline void setPositionDequantization(const glm::vec3& positionDequantizationOffset, const glm::vec3& positionDequantizationScale)	// Object space offset and scale for vertex positions quantized relative to a bounding box, folded into the instance transform so the vertex shader stays untouched, see "Renderer::MeshResource::hasQuantizedPositions()"
+		{
+			mPositionDequantizationOffset = positionDequantizationOffset;
+			mPositionDequantizationScale = positionDequantizationScale;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Cached data                                           ]
 		//[-------------------------------------------------------]
@@ -235,15 +275,19 @@ namespace Renderer
 			char		 mDebugName[256];			///< Debug name for easier renderable manager identification when debugging, contains terminating zero, first member variable by intent to see it at once during introspection (debug memory layout change is no problem here)
 		#endif
 		// Data
-		Renderables		 mRenderables;				///< Renderables, directly containing also the renderables of all LODs, each LOD has the same number of renderables
-		uint8_t			 mNumberOfLods;				///< Number of LODs, there's always at least one LOD, namely the original none reduced version
-		const Transform* mTransform;				///< Transform instance, always valid, just shared meaning doesn't own the instance so don't delete it
+		Renderables		 mRenderables;					///< Renderables, directly containing also the renderables of all LODs, each LOD has the same number of renderables
+		uint8_t			 mNumberOfLods;					///< Number of LODs, there's always at least one LOD, namely the original none reduced version
+		const Transform* mTransform;					///< Transform instance, always valid, just shared meaning doesn't own the instance so don't delete it
 		bool			 mVisible;
+		glm::vec3		 mBoundingSpherePosition;		///< Object space bounding sphere position, used by GPU culling
+		float			 mBoundingSphereRadius;			///< Object space bounding sphere radius, zero if unbounded, used by GPU culling
+		glm::vec3		 mPositionDequantizationOffset;	///< Object space vertex position dequantization offset, zero if the vertex positions aren't quantized
+		glm::vec3		 mPositionDequantizationScale;	///< Object space vertex position dequantization scale, one if the vertex positions aren't quantized
 		// Cached data
-		float			 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
-		uint8_t			 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
-		uint8_t			 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
-		bool			 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
+		float			 mCachedDistanceToCamera;		///< Cached distance to camera is updated during the culling phase
+		uint8_t			 mMinimumRenderQueueIndex;		///< The minimum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
+		uint8_t			 mMaximumRenderQueueIndex;		///< The maximum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
+		bool			 mCastShadows;					///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 
 
 	};
@@ -88,6 +88,11 @@ namespace
 			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("PipelineStateCache");
 			static constexpr uint32_t FORMAT_VERSION = 1;
 		}
+		namespace RhiPipelineCache
+		{
+			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("RhiPipelineCache");
+			static constexpr uint32_t FORMAT_VERSION = 1;
+		}
 
 
 		//[-------------------------------------------------------]
@@ -131,6 +136,54 @@ namespace
 			}
 		}
 
+		void getRhiPipelineCacheFilename(const Renderer::IRenderer& renderer, std::string& virtualDirectoryName, std::string& virtualFilename)
+		{
+			virtualDirectoryName = renderer.getFileManager().getLocalDataMountPoint();
+			virtualFilename = virtualDirectoryName + '/' + renderer.getRhi().getName() + ".pipeline_cache";
+		}
+
+		void loadRhiPipelineCache(Renderer::IRenderer& renderer)
+		{
+			// The RHI implementation validates the data against the used device and driver, outdated data is just ignored
+			std::string virtualDirectoryName;
+			std::string virtualFilename;
+			getRhiPipelineCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+			const Renderer::IFileManager& fileManager = renderer.getFileManager();
+			Renderer::MemoryFile memoryFile;
+			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(RhiPipelineCache::FORMAT_TYPE, RhiPipelineCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			{
+				memoryFile.decompress();
+				const Renderer::MemoryFile::ByteVector& byteVector = memoryFile.getByteVector();
+				if (!byteVector.empty())
+				{
+					renderer.getRhi().setPipelineCacheData(static_cast<uint32_t>(byteVector.size()), byteVector.data());
+				}
+			}
+		}
+
+		void saveRhiPipelineCache(const Renderer::IRenderer& renderer)
+		{
+			Rhi::IRhi& rhi = renderer.getRhi();
+			const uint32_t numberOfBytes = rhi.getPipelineCacheData(0, nullptr);
+			if (numberOfBytes > 0)
+			{
+				Renderer::MemoryFile memoryFile;
+				Renderer::MemoryFile::ByteVector& byteVector = memoryFile.getByteVector();
+				byteVector.resize(numberOfBytes);
+				if (rhi.getPipelineCacheData(numberOfBytes, byteVector.data()) > 0)
+				{
+					std::string virtualDirectoryName;
+					std::string virtualFilename;
+					getRhiPipelineCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+					Renderer::IFileManager& fileManager = renderer.getFileManager();
+					if (fileManager.createDirectories(virtualDirectoryName.c_str()) && !memoryFile.writeLz4CompressedDataByVirtualFilename(RhiPipelineCache::FORMAT_TYPE, RhiPipelineCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+					{
+						RHI_LOG(renderer.getContext(), CRITICAL, "The renderer failed to save the RHI pipeline cache to \"%s\"", virtualFilename.c_str())
+					}
+				}
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -346,6 +399,12 @@ namespace Renderer
 
 	void RendererImpl::loadPipelineStateObjectCache()
 	{
+		// Feed the RHI implementation specific pipeline cache (e.g. "VkPipelineCache") before any pipeline state is created so the driver can skip pipeline compilation
+		if (nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			::detail::loadRhiPipelineCache(*this);
+		}
+
 		if (mRhi->getCapabilities().shaderBytecode)
 		{
 			clearPipelineStateObjectCache();
@@ -376,6 +435,12 @@ namespace Renderer
 			mMaterialBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
 			::detail::savePipelineStateObjectCacheFile(*this, memoryFile);
 		}
+
+		// The RHI implementation specific pipeline cache is independent of the shader bytecode cache
+		if (nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			::detail::saveRhiPipelineCache(*this);
+		}
 	}
 
 
@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/CompositorNode/CompositorNodeInstance.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "Renderer/Public/Resource/CompositorNode/CompositorTarget.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorResourcePass.h"
@@ -89,7 +90,13 @@ namespace Renderer
 				}
 
 				// Let the compositor instance pass fill the command buffer
-				compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+				#ifdef RENDERER_PROFILER
+					mCompositorWorkspaceInstance.writeCompositorInstancePassTimestamp(*compositorInstancePass, true, commandBuffer);
+					compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+					mCompositorWorkspaceInstance.writeCompositorInstancePassTimestamp(*compositorInstancePass, false, commandBuffer);
+				#else
+					compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+				#endif
 			}
 
 			// Update the number of compositor instance pass execution requests and don't forget to avoid integer range overflow
@@ -106,7 +106,7 @@ namespace Renderer
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
 	protected:
-		inline CompositorNodeInstance(CompositorNodeResourceId compositorNodeResourceId, const CompositorWorkspaceInstance& compositorWorkspaceInstance) :
+		inline CompositorNodeInstance(CompositorNodeResourceId compositorNodeResourceId, CompositorWorkspaceInstance& compositorWorkspaceInstance) :
 			mCompositorNodeResourceId(compositorNodeResourceId),
 			mCompositorWorkspaceInstance(compositorWorkspaceInstance)
 		{
@@ -130,9 +130,9 @@ namespace Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		CompositorNodeResourceId		   mCompositorNodeResourceId;
-		const CompositorWorkspaceInstance& mCompositorWorkspaceInstance;
-		CompositorInstancePasses		   mCompositorInstancePasses;	///< Owns the compositor instance passes and has to destroy them if no longer needed
+		CompositorNodeResourceId	 mCompositorNodeResourceId;
+		CompositorWorkspaceInstance& mCompositorWorkspaceInstance;	///< Owner compositor workspace instance, non-constant since compositor instance pass GPU timestamp queries are written into it
+		CompositorInstancePasses	 mCompositorInstancePasses;		///< Owns the compositor instance passes and has to destroy them if no longer needed
 
 
 	};
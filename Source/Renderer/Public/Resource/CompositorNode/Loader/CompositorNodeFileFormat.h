@@ -174,6 +174,20 @@ namespace Renderer
 			struct PassDebugGui final : public PassCompute
 			{
 			};
+
+			// The material definition is not used by GPU culling, the fixed build in RHI configuration resources are used instead
+			struct PassGpuCulling final : public PassCompute
+			{
+				uint8_t				minimumRenderQueueIndex			 = 0;	///< Inclusive
+				uint8_t				maximumRenderQueueIndex			 = 255;	///< Inclusive
+				MaterialTechniqueId	sceneMaterialTechniqueId		 = getInvalid<MaterialTechniqueId>();
+				AssetId				hierarchicalDepthTextureAssetId;		///< Optional previous frame hierarchical depth buffer (aka Hi-Z map) used for occlusion culling, if invalid only frustum culling is performed
+			};
+
+			// The material definition is not used by the particles simulation, the fixed build in RHI configuration resources are used instead
+			struct PassParticles final : public PassCompute
+			{
+			};
 		#pragma pack(pop)
 
 
@@ -162,7 +162,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1CompositorNode::FORMAT_TYPE, v1CompositorNode::FORMAT_VERSION, file);
 	}
 
-	void CompositorNodeResourceLoader::onProcessing()
+	bool CompositorNodeResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -173,6 +173,9 @@ namespace Renderer
 
 		// Read in the compositor node resource
 		::detail::nodeDeserialization(mMemoryFile, compositorNodeHeader, *mCompositorNodeResource, static_cast<CompositorNodeResourceManager&>(getResourceManager()).getCompositorPassFactory());
+
+		// Done
+		return true;
 	}
 
 
@@ -36,6 +36,10 @@
 #include "Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorInstancePassShadowMap.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/DebugGui/CompositorResourcePassDebugGui.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/DebugGui/CompositorInstancePassDebugGui.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/GpuCulling/CompositorResourcePassGpuCulling.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/GpuCulling/CompositorInstancePassGpuCulling.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorResourcePassParticles.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorInstancePassParticles.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorResourcePassResolveMultisample.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorInstancePassResolveMultisample.h"
 
@@ -69,6 +73,8 @@ namespace Renderer
 			CASE_VALUE(CompositorResourcePassGenerateMipmaps)
 			CASE_VALUE(CompositorResourcePassCompute)
 			CASE_VALUE(CompositorResourcePassDebugGui)
+			CASE_VALUE(CompositorResourcePassGpuCulling)
+			CASE_VALUE(CompositorResourcePassParticles)
 		}
 
 		// Undefine helper macro
@@ -97,6 +103,8 @@ namespace Renderer
 			CASE_VALUE(CompositorResourcePassGenerateMipmaps,	 CompositorInstancePassGenerateMipmaps)
 			CASE_VALUE(CompositorResourcePassCompute,			 CompositorInstancePassCompute)
 			CASE_VALUE(CompositorResourcePassDebugGui,			 CompositorInstancePassDebugGui)
+			CASE_VALUE(CompositorResourcePassGpuCulling,		 CompositorInstancePassGpuCulling)
+			CASE_VALUE(CompositorResourcePassParticles,			 CompositorInstancePassParticles)
 		}
 
 		// Undefine helper macro
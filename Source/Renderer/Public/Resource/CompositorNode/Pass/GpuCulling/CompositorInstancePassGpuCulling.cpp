@@ -0,0 +1,460 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/GpuCulling/CompositorInstancePassGpuCulling.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/GpuCulling/CompositorResourcePassGpuCulling.h"
+#include "Renderer/Public/Resource/CompositorNode/CompositorNodeInstance.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/PassBufferManager.h"
+#include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
+#include "Renderer/Public/Resource/Texture/TextureResource.h"
+#include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/IRenderer.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_THREADS_PER_GROUP = 64;		///< Must match "local_size_x" of the GPU culling compute shaders
+		static constexpr uint32_t DRAW_CANDIDATE_GRANULARITY  = 256;	///< GPU culling buffers are grown in steps of this number of draw candidates, must be a multiple of four so the draw count buffer is a multiple of "Rhi::DrawArguments"
+		static constexpr double	  ORIGIN_REBASE_DISTANCE	  = 1024.0;	///< The draw candidate world space origin is moved to the camera once the camera is further away from it, keeps 32 bit floating point positions near the camera precise
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		// Must match "UniformBlockDynamicCs" of the GPU culling compute shaders (std140 layout)
+		struct UniformBlockDynamicCs final
+		{
+			glm::vec4 frustumPlanes[6];						///< Camera relative world space frustum planes, normals are pointing inside
+			glm::mat4 previousWorldSpaceToClipSpaceMatrix;	///< Previous camera relative world space to clip space matrix (Reversed-Z)
+			float	  hierarchicalDepthMapSize[4];			///< x = width, y = height, z = number of mipmaps, w = unused
+			uint32_t  drawConfiguration[4];					///< x = number of draw candidates, y = number of draw counts, z = compact draws, w = occlusion culling
+			uint32_t  clipSpaceConfiguration[4];			///< x = upper left origin, y = zero-to-one clip Z, zw = unused
+			float	  originRelativeCameraPosition[4];		///< xyz = camera position relative to the draw candidate world space origin, w = unused
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] glm::vec4 getRow(const glm::mat4& matrix, int index)
+		{
+			return glm::vec4(matrix[0][index], matrix[1][index], matrix[2][index], matrix[3][index]);
+		}
+
+		[[nodiscard]] glm::vec4 normalizePlane(const glm::vec4& plane)
+		{
+			return plane / glm::length(glm::vec3(plane));
+		}
+
+		// Gribb/Hartmann frustum plane extraction ("Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix")
+		void getFrustumPlanes(const glm::mat4& worldSpaceToClipSpaceMatrix, bool zeroToOneClipZ, glm::vec4 frustumPlanes[6])
+		{
+			const glm::vec4 row0 = getRow(worldSpaceToClipSpaceMatrix, 0);
+			const glm::vec4 row1 = getRow(worldSpaceToClipSpaceMatrix, 1);
+			const glm::vec4 row2 = getRow(worldSpaceToClipSpaceMatrix, 2);
+			const glm::vec4 row3 = getRow(worldSpaceToClipSpaceMatrix, 3);
+			frustumPlanes[0] = normalizePlane(row3 + row0);	// Left
+			frustumPlanes[1] = normalizePlane(row3 - row0);	// Right
+			frustumPlanes[2] = normalizePlane(row3 + row1);	// Bottom
+			frustumPlanes[3] = normalizePlane(row3 - row1);	// Top
+			frustumPlanes[4] = normalizePlane(row3 - row2);	// Near (Reversed-Z)
+			frustumPlanes[5] = normalizePlane(zeroToOneClipZ ? row2 : (row3 + row2));	// Far (Reversed-Z)
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorInstancePass methods ]
+	//[-------------------------------------------------------]
+	void CompositorInstancePassGpuCulling::onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
+	{
+		const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+
+		// Sanity check
+		RHI_ASSERT(renderer.getContext(), nullptr != renderTarget, "The GPU culling compositor instance pass needs a valid render target")
+
+		// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
+		RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, getCompositorResourcePass().getDebugName())
+
+		// Fill render queue
+		RHI_ASSERT(renderer.getContext(), nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
+		const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassGpuCulling&>(getCompositorResourcePass()).getSceneMaterialTechniqueId();
+		for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
+		{
+			mSceneRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, compositorContextData);
+		}
+		if (mSceneRenderQueue.getNumberOfDrawCalls() > 0)
+		{
+			if (nullptr != mCullComputePipelineState && mSceneRenderQueue.getNumberOfDrawIndexedCalls() > 0 && !compositorContextData.getSinglePassStereoInstancing())
+			{
+				// Fill the draw commands into a scratch command buffer since the GPU culling compute shaders have to be dispatched before them
+				// -> Reset the currently bound material blueprint resource so all graphics bindings are set again after the compute dispatches
+				prepareGpuCulling(compositorContextData, mSceneRenderQueue.getNumberOfDrawIndexedCalls());
+				mSceneRenderQueue.setGpuCulling(&mGpuCulling);
+				compositorContextData.resetCurrentlyBoundMaterialBlueprintResource();
+				mSceneRenderQueue.fillGraphicsCommandBuffer(*renderTarget, compositorContextData, mScratchCommandBuffer);
+
+				// Dispatch the GPU culling compute shaders, followed by the draw commands consuming the written draw indexed arguments
+				fillGpuCullingCommandBuffer(compositorContextData, commandBuffer);
+				if (!mScratchCommandBuffer.isEmpty())
+				{
+					mScratchCommandBuffer.appendToCommandBufferAndClear(commandBuffer);
+				}
+			}
+			else
+			{
+				// CPU culling only
+				mSceneRenderQueue.setGpuCulling(nullptr);
+				mSceneRenderQueue.fillGraphicsCommandBuffer(*renderTarget, compositorContextData, commandBuffer);
+			}
+		}
+	}
+
+	void CompositorInstancePassGpuCulling::onPostCommandBufferDispatch()
+	{
+		// Directly clear the render queue as soon as the frame rendering has been finished to avoid evil dangling pointers
+		mSceneRenderQueue.clear();
+		mGpuCulling.drawCandidates.clear();
+		mGpuCulling.numberOfDrawCounts = 0;
+
+		// Call the base implementation
+		CompositorInstancePassCompute::onPostCommandBufferDispatch();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
+	//[-------------------------------------------------------]
+	void CompositorInstancePassGpuCulling::onCompositorWorkspaceInstanceLoadingFinished()
+	{
+		// Cache render queue index range instance, we know it must exist when we're in here
+		mRenderQueueIndexRange = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderQueueIndexRangeByRenderQueueIndex(mSceneRenderQueue.getMinimumRenderQueueIndex());
+		RHI_ASSERT(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
+		RHI_ASSERT(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), mRenderQueueIndexRange->minimumRenderQueueIndex <= mSceneRenderQueue.getMinimumRenderQueueIndex(), "Invalid minimum render queue index")
+		RHI_ASSERT(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), mRenderQueueIndexRange->maximumRenderQueueIndex >= mSceneRenderQueue.getMaximumRenderQueueIndex(), "Invalid maximum render queue index")
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	CompositorInstancePassGpuCulling::CompositorInstancePassGpuCulling(const CompositorResourcePassGpuCulling& compositorResourcePassGpuCulling, const CompositorNodeInstance& compositorNodeInstance) :
+		CompositorInstancePassCompute(compositorResourcePassGpuCulling, compositorNodeInstance),
+		mSceneRenderQueue(compositorNodeInstance.getCompositorWorkspaceInstance().getRenderer().getMaterialBlueprintResourceManager().getIndirectBufferManager(), compositorResourcePassGpuCulling.getMinimumRenderQueueIndex(), compositorResourcePassGpuCulling.getMaximumRenderQueueIndex(), false, false, true),
+		mRenderQueueIndexRange(nullptr),
+		mCurrentDrawCandidateBufferIndex(0),
+		mNumberOfAllocatedDrawCandidates(0),
+		mDrawCandidatesVersion(0)
+	{
+		// GPU culling needs compute shaders and is currently only implemented for OpenGL and Vulkan, else CPU culling only is used
+		const Rhi::IRhi& rhi = compositorNodeInstance.getCompositorWorkspaceInstance().getRenderer().getRhi();
+		if (rhi.getCapabilities().computeShader && (rhi.getNameId() == Rhi::NameId::VULKAN || rhi.getNameId() == Rhi::NameId::OPENGL))
+		{
+			createFixedBuildInRhiConfigurationResources();
+		}
+	}
+
+	void CompositorInstancePassGpuCulling::createFixedBuildInRhiConfigurationResources()
+	{
+		const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+		Rhi::IRhi& rhi = renderer.getRhi();
+
+		{ // Create the root signature instance
+			// Create the root signature
+			Rhi::DescriptorRangeBuilder ranges[5];
+			ranges[0].initialize(Rhi::ResourceType::UNIFORM_BUFFER,	   0, "UniformBlockDynamicCs",		   Rhi::ShaderVisibility::COMPUTE);
+			ranges[1].initialize(Rhi::ResourceType::TEXTURE_2D,		   1, "HierarchicalDepthMap",		   Rhi::ShaderVisibility::COMPUTE);
+			ranges[2].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 2, "DrawCandidateStructuredBuffer", Rhi::ShaderVisibility::COMPUTE);
+			ranges[3].initialize(Rhi::ResourceType::INDIRECT_BUFFER,   3, "OutputIndirectBuffer",		   Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+			ranges[4].initialize(Rhi::ResourceType::INDIRECT_BUFFER,   4, "DrawCountBuffer",			   Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+
+			Rhi::RootParameterBuilder rootParameters[1];
+			rootParameters[0].initializeAsDescriptorTable(static_cast<uint32_t>(GLM_COUNTOF(ranges)), &ranges[0]);
+
+			// Setup
+			Rhi::RootSignatureBuilder rootSignatureBuilder;
+			rootSignatureBuilder.initialize(static_cast<uint32_t>(GLM_COUNTOF(rootParameters)), rootParameters, 0, nullptr, Rhi::RootSignatureFlags::NONE);
+
+			// Create the instance
+			mRootSignature = rhi.createRootSignature(rootSignatureBuilder RHI_RESOURCE_DEBUG_NAME("GPU culling"));
+		}
+
+		{ // Create the compute pipeline state objects (PSO)
+			// Get the shader source code (outsourced to keep an overview)
+			const char* clearComputeShaderSourceCode = nullptr;
+			const char* cullComputeShaderSourceCode = nullptr;
+			#include "Shader/GpuCulling_GLSL_450.h"	// For Vulkan
+			#include "Shader/GpuCulling_GLSL_430.h"	// OpenGL 4.3 is the minimum for compute shaders
+			{
+				// Error! (unsupported RHI, should have been rejected by the caller)
+				RHI_ASSERT(renderer.getContext(), false, "The RHI implementation isn't supported by GPU culling")
+			}
+
+			// Create the compute shaders
+			Rhi::IShaderLanguage& shaderLanguage = rhi.getDefaultShaderLanguage();
+			Rhi::IComputeShaderPtr clearComputeShader;
+			Rhi::IComputeShaderPtr cullComputeShader;
+			if (nullptr != clearComputeShaderSourceCode && nullptr != cullComputeShaderSourceCode)
+			{
+				clearComputeShader = shaderLanguage.createComputeShaderFromSourceCode(clearComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("GPU culling clear"));
+				cullComputeShader = shaderLanguage.createComputeShaderFromSourceCode(cullComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("GPU culling"));
+			}
+
+			// Create the compute pipeline state objects (PSO), without them GPU culling is disabled and CPU culling only is used
+			if (nullptr != clearComputeShader && nullptr != cullComputeShader)
+			{
+				mClearComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *clearComputeShader RHI_RESOURCE_DEBUG_NAME("GPU culling clear"));
+				mCullComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *cullComputeShader RHI_RESOURCE_DEBUG_NAME("GPU culling"));
+			}
+			if (nullptr == mClearComputePipelineState || nullptr == mCullComputePipelineState)
+			{
+				RHI_LOG(renderer.getContext(), CRITICAL, "Failed to create the GPU culling compute pipeline states, using CPU culling only")
+				mClearComputePipelineState = nullptr;
+				mCullComputePipelineState = nullptr;
+				return;
+			}
+		}
+
+		// Create uniform buffer instance
+		mUniformBuffer = renderer.getBufferManager().createUniformBuffer(sizeof(::detail::UniformBlockDynamicCs), nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("GPU culling"));
+
+		{ // Create sampler state instance, the hierarchical depth map is read via texel fetches
+			Rhi::SamplerState samplerState = Rhi::ISamplerState::getDefaultSamplerState();
+			samplerState.filter	  = Rhi::FilterMode::MIN_MAG_MIP_POINT;
+			samplerState.addressU = Rhi::TextureAddressMode::CLAMP;
+			samplerState.addressV = Rhi::TextureAddressMode::CLAMP;
+			mSamplerState = rhi.createSamplerState(samplerState RHI_RESOURCE_DEBUG_NAME("GPU culling"));
+		}
+
+		{ // Create the dummy hierarchical depth texture instance which is used if there's no hierarchical depth map
+			static constexpr float FAR_DEPTH = 0.0f;	// Reversed-Z
+			mDummyHierarchicalDepthTexture = renderer.getTextureManager().createTexture2D(1, 1, Rhi::TextureFormat::R32_FLOAT, &FAR_DEPTH, Rhi::TextureFlag::SHADER_RESOURCE, Rhi::TextureUsage::IMMUTABLE, 1, nullptr RHI_RESOURCE_DEBUG_NAME("GPU culling dummy hierarchical depth"));
+		}
+	}
+
+	void CompositorInstancePassGpuCulling::prepareGpuCulling(const CompositorContextData& compositorContextData, uint32_t numberOfDrawIndexedCalls)
+	{
+		// Start with a clean GPU culling draw candidate list
+		mGpuCulling.drawCandidates.clear();
+		mGpuCulling.numberOfDrawCounts = 0;
+
+		// Move the draw candidate world space origin to the camera once the camera went too far away from it
+		// -> Not done each frame, else camera movement would change all draw candidates and force an upload each frame
+		const glm::dvec3& worldSpaceCameraPosition = compositorContextData.getWorldSpaceCameraPosition();
+		if (glm::distance(worldSpaceCameraPosition, mGpuCulling.worldSpaceOrigin) > ::detail::ORIGIN_REBASE_DISTANCE)
+		{
+			mGpuCulling.worldSpaceOrigin = worldSpaceCameraPosition;
+		}
+
+		// Grow the GPU culling buffers on demand, there's at most one draw count per draw candidate
+		if (numberOfDrawIndexedCalls > mNumberOfAllocatedDrawCandidates)
+		{
+			const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+			Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+			mNumberOfAllocatedDrawCandidates = ((numberOfDrawIndexedCalls + ::detail::DRAW_CANDIDATE_GRANULARITY - 1) / ::detail::DRAW_CANDIDATE_GRANULARITY) * ::detail::DRAW_CANDIDATE_GRANULARITY;
+			for (DrawCandidateBuffer& drawCandidateBuffer : mDrawCandidateBuffers)
+			{
+				drawCandidateBuffer.structuredBufferPtr = bufferManager.createStructuredBuffer(static_cast<uint32_t>(sizeof(RenderQueue::GpuCullingDrawCandidate)) * mNumberOfAllocatedDrawCandidates, nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, sizeof(RenderQueue::GpuCullingDrawCandidate) RHI_RESOURCE_DEBUG_NAME("GPU culling draw candidates"));
+			}
+			mOutputIndirectBuffer = bufferManager.createIndirectBuffer(static_cast<uint32_t>(sizeof(Rhi::DrawIndexedArguments)) * mNumberOfAllocatedDrawCandidates, nullptr, Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS, Rhi::BufferUsage::DYNAMIC_COPY RHI_RESOURCE_DEBUG_NAME("GPU culling output"));
+
+			// The draw count buffer is always needed since it's referenced by the GPU culling compute shader, "Rhi::IndirectBufferFlag::DRAW_ARGUMENTS" is
+			// only set to satisfy the indirect buffer element type specification, the draw count buffer holds one "uint32_t" per multi-draw-indirect batch
+			mDrawCountBuffer = bufferManager.createIndirectBuffer(static_cast<uint32_t>(sizeof(uint32_t)) * mNumberOfAllocatedDrawCandidates, nullptr, Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::DRAW_ARGUMENTS, Rhi::BufferUsage::DYNAMIC_COPY RHI_RESOURCE_DEBUG_NAME("GPU culling draw count"));
+
+			// The resource groups and the uploaded draw candidates are outdated
+			for (DrawCandidateBuffer& drawCandidateBuffer : mDrawCandidateBuffers)
+			{
+				drawCandidateBuffer.resourceGroupPtr = nullptr;
+				drawCandidateBuffer.resourceGroupHierarchicalDepthTexture = nullptr;
+				drawCandidateBuffer.drawCandidatesVersion = 0;
+			}
+			mUploadedDrawCandidates.clear();
+		}
+
+		// Tell the render queue about the GPU culling buffers, without draw count support culled draws are written with an instance count of zero
+		mGpuCulling.outputIndirectBuffer = mOutputIndirectBuffer;
+		mGpuCulling.drawCountBuffer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getRhi().getCapabilities().drawIndirectCount ? mDrawCountBuffer.getPointer() : nullptr;
+	}
+
+	void CompositorInstancePassGpuCulling::fillGpuCullingCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
+	{
+		const RenderQueue::GpuCullingDrawCandidates& drawCandidates = mGpuCulling.drawCandidates;
+		if (drawCandidates.empty())
+		{
+			// Nothing to cull, the render queue didn't emit any GPU culling draws
+			return;
+		}
+		const CompositorResourcePassGpuCulling& compositorResourcePassGpuCulling = static_cast<const CompositorResourcePassGpuCulling&>(getCompositorResourcePass());
+		const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+		Rhi::IRhi& rhi = renderer.getRhi();
+		const Rhi::Capabilities& capabilities = rhi.getCapabilities();
+
+		// Get the optional previous frame hierarchical depth map
+		// TODO(co) "Renderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
+		Rhi::ITexture2D* hierarchicalDepthTexture2D = nullptr;
+		if (isValid(compositorResourcePassGpuCulling.getHierarchicalDepthTextureAssetId()))
+		{
+			const TextureResource* textureResource = renderer.getTextureResourceManager().getTextureResourceByAssetId(compositorResourcePassGpuCulling.getHierarchicalDepthTextureAssetId());
+			if (nullptr != textureResource && nullptr != textureResource->getTexturePtr() && textureResource->getTexturePtr()->getResourceType() == Rhi::ResourceType::TEXTURE_2D)
+			{
+				hierarchicalDepthTexture2D = static_cast<Rhi::ITexture2D*>(textureResource->getTexturePtr().getPointer());
+			}
+		}
+
+		// Use the next ring buffered draw candidate buffer, the GPU might still read the ones of the previous frames
+		mCurrentDrawCandidateBufferIndex = (mCurrentDrawCandidateBufferIndex + 1) % NUMBER_OF_DRAW_CANDIDATE_BUFFERS;
+		DrawCandidateBuffer& drawCandidateBuffer = mDrawCandidateBuffers[mCurrentDrawCandidateBufferIndex];
+
+		// (Re)create the resource group, if required
+		Rhi::ITexture* texture = (nullptr != hierarchicalDepthTexture2D) ? static_cast<Rhi::ITexture*>(hierarchicalDepthTexture2D) : mDummyHierarchicalDepthTexture.getPointer();
+		if (nullptr == drawCandidateBuffer.resourceGroupPtr || drawCandidateBuffer.resourceGroupHierarchicalDepthTexture != texture)
+		{
+			Rhi::IResource* resources[5] = { mUniformBuffer, texture, drawCandidateBuffer.structuredBufferPtr, mOutputIndirectBuffer, mDrawCountBuffer };
+			Rhi::ISamplerState* samplerStates[5] = { nullptr, mSamplerState, nullptr, nullptr, nullptr };
+			drawCandidateBuffer.resourceGroupPtr = mRootSignature->createResourceGroup(0, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, samplerStates RHI_RESOURCE_DEBUG_NAME("GPU culling"));
+			drawCandidateBuffer.resourceGroupHierarchicalDepthTexture = texture;
+		}
+
+		// Upload the draw candidates only if they changed, for static scenes this means they're uploaded once per draw candidate buffer
+		// -> The draw candidates are relative to a rarely changing world space origin, so camera movement usually doesn't change them
+		const size_t numberOfDrawCandidateBytes = sizeof(RenderQueue::GpuCullingDrawCandidate) * drawCandidates.size();
+		if (mUploadedDrawCandidates.size() != drawCandidates.size() || 0 != memcmp(mUploadedDrawCandidates.data(), drawCandidates.data(), numberOfDrawCandidateBytes))
+		{
+			mUploadedDrawCandidates = drawCandidates;
+			++mDrawCandidatesVersion;
+		}
+		if (drawCandidateBuffer.drawCandidatesVersion != mDrawCandidatesVersion)
+		{
+			// The ring buffered draw candidate buffer was last used "NUMBER_OF_DRAW_CANDIDATE_BUFFERS" frames ago, so it's safe to overwrite it
+			Rhi::MappedSubresource mappedSubresource;
+			if (rhi.map(*drawCandidateBuffer.structuredBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			{
+				memcpy(mappedSubresource.data, drawCandidates.data(), numberOfDrawCandidateBytes);
+
+				// Unmap the structured buffer
+				rhi.unmap(*drawCandidateBuffer.structuredBufferPtr, 0);
+				drawCandidateBuffer.drawCandidatesVersion = mDrawCandidatesVersion;
+			}
+		}
+
+		{ // Fill the uniform buffer
+			::detail::UniformBlockDynamicCs uniformBlockDynamicCs = {};
+			const bool compactDraws = (nullptr != mGpuCulling.drawCountBuffer);
+			bool occlusionCulling = false;
+
+			// Use the pass data of the material blueprint bound while filling the render queue, this way the same matrices as for rendering are used
+			const MaterialBlueprintResource* materialBlueprintResource = compositorContextData.getCurrentlyBoundMaterialBlueprintResource();
+			const PassBufferManager* passBufferManager = (nullptr != materialBlueprintResource) ? materialBlueprintResource->getPassBufferManager() : nullptr;
+			if (nullptr != passBufferManager)
+			{
+				const PassBufferManager::PassData& passData = passBufferManager->getPassData();
+				::detail::getFrustumPlanes(passData.cameraRelativeWorldSpaceToClipSpaceMatrixReversedZ[0], capabilities.zeroToOneClipZ, uniformBlockDynamicCs.frustumPlanes);
+				uniformBlockDynamicCs.previousWorldSpaceToClipSpaceMatrix = passData.previousCameraRelativeWorldSpaceToClipSpaceMatrixReversedZ[0];
+				occlusionCulling = (nullptr != hierarchicalDepthTexture2D);
+			}
+			else
+			{
+				// No pass data available, let all draws pass the frustum test
+				for (glm::vec4& frustumPlane : uniformBlockDynamicCs.frustumPlanes)
+				{
+					frustumPlane = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+				}
+			}
+			if (occlusionCulling)
+			{
+				uniformBlockDynamicCs.hierarchicalDepthMapSize[0] = static_cast<float>(hierarchicalDepthTexture2D->getWidth());
+				uniformBlockDynamicCs.hierarchicalDepthMapSize[1] = static_cast<float>(hierarchicalDepthTexture2D->getHeight());
+				uniformBlockDynamicCs.hierarchicalDepthMapSize[2] = static_cast<float>(Rhi::ITexture::getNumberOfMipmaps(hierarchicalDepthTexture2D->getWidth(), hierarchicalDepthTexture2D->getHeight()));
+			}
+			uniformBlockDynamicCs.drawConfiguration[0] = static_cast<uint32_t>(drawCandidates.size());
+			uniformBlockDynamicCs.drawConfiguration[1] = mGpuCulling.numberOfDrawCounts;
+			uniformBlockDynamicCs.drawConfiguration[2] = compactDraws ? 1u : 0u;
+			uniformBlockDynamicCs.drawConfiguration[3] = occlusionCulling ? 1u : 0u;
+			uniformBlockDynamicCs.clipSpaceConfiguration[0] = capabilities.upperLeftOrigin ? 1u : 0u;
+			uniformBlockDynamicCs.clipSpaceConfiguration[1] = capabilities.zeroToOneClipZ ? 1u : 0u;
+			{ // The shader makes the draw candidates camera relative, calculate the camera position relative to their origin using 64 bit so only the small difference is stored as 32 bit
+				const glm::vec3 originRelativeCameraPosition = glm::vec3(compositorContextData.getWorldSpaceCameraPosition() - mGpuCulling.worldSpaceOrigin);
+				uniformBlockDynamicCs.originRelativeCameraPosition[0] = originRelativeCameraPosition.x;
+				uniformBlockDynamicCs.originRelativeCameraPosition[1] = originRelativeCameraPosition.y;
+				uniformBlockDynamicCs.originRelativeCameraPosition[2] = originRelativeCameraPosition.z;
+			}
+			Rhi::Command::CopyUniformBufferData::create(commandBuffer, *mUniformBuffer, &uniformBlockDynamicCs, sizeof(::detail::UniformBlockDynamicCs));
+		}
+
+		// Set the used compute root signature
+		Rhi::Command::SetComputeRootSignature::create(commandBuffer, mRootSignature);
+
+		// Reset the draw counts, only needed when compacting draws
+		if (nullptr != mGpuCulling.drawCountBuffer)
+		{
+			Rhi::Command::SetComputePipelineState::create(commandBuffer, mClearComputePipelineState);
+			Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 0, drawCandidateBuffer.resourceGroupPtr);
+			Rhi::Command::DispatchCompute::create(commandBuffer, (mGpuCulling.numberOfDrawCounts + ::detail::NUMBER_OF_THREADS_PER_GROUP - 1) / ::detail::NUMBER_OF_THREADS_PER_GROUP, 1, 1);
+		}
+
+		// Cull the draw candidates and write the draw indexed arguments
+		Rhi::Command::SetComputePipelineState::create(commandBuffer, mCullComputePipelineState);
+		Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 0, drawCandidateBuffer.resourceGroupPtr);
+		Rhi::Command::DispatchCompute::create(commandBuffer, (static_cast<uint32_t>(drawCandidates.size()) + ::detail::NUMBER_OF_THREADS_PER_GROUP - 1) / ::detail::NUMBER_OF_THREADS_PER_GROUP, 1, 1);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,165 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/Compute/CompositorInstancePassCompute.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class CompositorResourcePassGpuCulling;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Compositor instance pass GPU culling
+	*
+	*  @remarks
+	*    The scene render queue records a draw candidate per indexed draw instead of writing the draw indexed arguments on the CPU. The
+	*    draw candidate bounding spheres are stored in world space and uploaded only when they changed, so static scenes only upload them
+	*    once per ring buffered draw candidate buffer, independent of camera movement. Before the recorded
+	*    multi-draw-indirect commands, two compute shaders are dispatched: The first one resets the draw counts, the second one culls each
+	*    draw candidate against the view frustum and the previous frame hierarchical depth map and writes the draw indexed arguments of
+	*    the visible draws. If the RHI supports draw count buffers, visible draws are compacted per multi-draw-indirect batch, else culled
+	*    draws are written with an instance count of zero.
+	*
+	*  @note
+	*    - The CPU culling done when filling the render queue is still active, GPU culling is done on top of it
+	*    - Occlusion culling is using the previous frame hierarchical depth map, so disoccluded draws might show up one frame late
+	*    - Single pass stereo rendering via instancing isn't supported by GPU culling, CPU culling is used in this case
+	*/
+	class CompositorInstancePassGpuCulling final : public CompositorInstancePassCompute
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class CompositorPassFactory;	// The only one allowed to create instances of this class
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_DRAW_CANDIDATE_BUFFERS = 3;	///< Number of ring buffered draw candidate structured buffers, must cover the number of frames the GPU might still be reading from a draw candidate buffer
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorInstancePass methods ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
+		virtual void onPostCommandBufferDispatch() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual void onCompositorWorkspaceInstanceLoadingFinished() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct DrawCandidateBuffer final
+		{
+			Rhi::IStructuredBufferPtr structuredBufferPtr;
+			Rhi::IResourceGroupPtr	  resourceGroupPtr;
+			const Rhi::ITexture*	  resourceGroupHierarchicalDepthTexture = nullptr;	///< Hierarchical depth texture the resource group was created with, used for change detection only, don't destroy the instance
+			uint32_t				  drawCandidatesVersion = 0;						///< Version of "mUploadedDrawCandidates" inside the structured buffer, 0 if there's none
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		CompositorInstancePassGpuCulling(const CompositorResourcePassGpuCulling& compositorResourcePassGpuCulling, const CompositorNodeInstance& compositorNodeInstance);
+
+		inline virtual ~CompositorInstancePassGpuCulling() override
+		{
+			// Nothing here
+		}
+
+		explicit CompositorInstancePassGpuCulling(const CompositorInstancePassGpuCulling&) = delete;
+		CompositorInstancePassGpuCulling& operator=(const CompositorInstancePassGpuCulling&) = delete;
+		void createFixedBuildInRhiConfigurationResources();
+		void prepareGpuCulling(const CompositorContextData& compositorContextData, uint32_t numberOfDrawIndexedCalls);
+		void fillGpuCullingCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		RenderQueue												  mSceneRenderQueue;
+		const CompositorWorkspaceInstance::RenderQueueIndexRange* mRenderQueueIndexRange;	///< Cached render queue index range instance, can be a null pointer, don't destroy the instance
+		RenderQueue::GpuCulling									  mGpuCulling;
+		// Fixed build in RHI configuration resources, only valid if GPU culling is supported
+		Rhi::IRootSignaturePtr									  mRootSignature;
+		Rhi::IComputePipelineStatePtr							  mClearComputePipelineState;
+		Rhi::IComputePipelineStatePtr							  mCullComputePipelineState;
+		Rhi::IUniformBufferPtr									  mUniformBuffer;
+		Rhi::ISamplerStatePtr									  mSamplerState;
+		Rhi::ITexturePtr										  mDummyHierarchicalDepthTexture;	///< Bound if there's no hierarchical depth map, occlusion culling is disabled in this case
+		// Dynamic resources, grown on demand
+		DrawCandidateBuffer										  mDrawCandidateBuffers[NUMBER_OF_DRAW_CANDIDATE_BUFFERS];	///< Ring buffered since the GPU might still read the draw candidate buffer of a previous frame
+		uint32_t												  mCurrentDrawCandidateBufferIndex;
+		Rhi::IIndirectBufferPtr									  mOutputIndirectBuffer;
+		Rhi::IIndirectBufferPtr									  mDrawCountBuffer;				///< Only valid if "Rhi::Capabilities::drawIndirectCount" is true
+		uint32_t												  mNumberOfAllocatedDrawCandidates;
+		RenderQueue::GpuCullingDrawCandidates					  mUploadedDrawCandidates;		///< CPU copy of the latest uploaded draw candidates, used to detect whether or not an upload is needed
+		uint32_t												  mDrawCandidatesVersion;		///< Incremented each time "mUploadedDrawCandidates" changes
+		Rhi::CommandBuffer										  mScratchCommandBuffer;		///< Scratch command buffer receiving the draw commands since the GPU culling compute shaders have to be dispatched before them
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,69 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/GpuCulling/CompositorResourcePassGpuCulling.h"
+#include "Renderer/Public/Resource/CompositorNode/Loader/CompositorNodeFileFormat.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorResourcePass methods ]
+	//[-------------------------------------------------------]
+	void CompositorResourcePassGpuCulling::deserialize([[maybe_unused]] uint32_t numberOfBytes, const uint8_t* data)
+	{
+		// Sanity check
+		ASSERT(sizeof(v1CompositorNode::PassGpuCulling) == numberOfBytes, "Invalid number of bytes")
+
+		// Call the base implementation, there are no material properties
+		CompositorResourcePassCompute::deserialize(sizeof(v1CompositorNode::PassCompute), data);
+
+		// Read data
+		const v1CompositorNode::PassGpuCulling* passGpuCulling = reinterpret_cast<const v1CompositorNode::PassGpuCulling*>(data);
+		mMinimumRenderQueueIndex		 = passGpuCulling->minimumRenderQueueIndex;
+		mMaximumRenderQueueIndex		 = passGpuCulling->maximumRenderQueueIndex;
+		mSceneMaterialTechniqueId		 = passGpuCulling->sceneMaterialTechniqueId;
+		mHierarchicalDepthTextureAssetId = passGpuCulling->hierarchicalDepthTextureAssetId;
+
+		// Sanity check
+		ASSERT(mMaximumRenderQueueIndex >= mMinimumRenderQueueIndex, "Invalid maximum render queue index")
+	}
+
+	bool CompositorResourcePassGpuCulling::getRenderQueueIndexRange(uint8_t& minimumRenderQueueIndex, uint8_t& maximumRenderQueueIndex) const
+	{
+		// This compositor resource pass has a render queue range defined
+		minimumRenderQueueIndex = mMinimumRenderQueueIndex;
+		maximumRenderQueueIndex = mMaximumRenderQueueIndex;
+		return true;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,160 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/Compute/CompositorResourcePassCompute.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Compositor resource pass GPU culling
+	*
+	*  @remarks
+	*    GPU-driven alternative to the compositor resource pass scene: Renders the scene, but the draw indexed arguments of the
+	*    multi-draw-indirect batches are written by a compute shader which is culling each draw against the view frustum and
+	*    optionally against the previous frame hierarchical depth buffer. The compute shader is dispatched by the pass itself,
+	*    the fixed build in RHI configuration resources are used for this.
+	*
+	*    JSON example:
+	*    "GpuCulling":
+	*    {
+	*        "MinimumRenderQueueIndex": "0",
+	*        "MaximumRenderQueueIndex": "253",
+	*        "MaterialTechnique": "Forward",
+	*        "HierarchicalDepthTexture": "Example/Texture/Dynamic/HierarchicalDepthStencilRenderTarget"
+	*    }
+	*
+	*  @note
+	*    - Requires compute shader support as well as OpenGL or Vulkan, else it's behaving just like a compositor resource pass scene
+	*    - Must be the first pass rendering into its compositor target since compute shaders can't be dispatched inside a render pass
+	*    - The hierarchical depth buffer must not yet have been updated for the current frame when the pass is executed
+	*/
+	class CompositorResourcePassGpuCulling final : public CompositorResourcePassCompute
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class CompositorPassFactory;	// The only one allowed to create instances of this class
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t TYPE_ID = STRING_ID("GpuCulling");
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline uint8_t getMinimumRenderQueueIndex() const	///< Inclusive
+		{
+			return mMinimumRenderQueueIndex;
+		}
+
+		[[nodiscard]] inline uint8_t getMaximumRenderQueueIndex() const	///< Inclusive
+		{
+			return mMaximumRenderQueueIndex;
+		}
+
+		[[nodiscard]] inline MaterialTechniqueId getSceneMaterialTechniqueId() const
+		{
+			return mSceneMaterialTechniqueId;
+		}
+
+		[[nodiscard]] inline AssetId getHierarchicalDepthTextureAssetId() const
+		{
+			return mHierarchicalDepthTextureAssetId;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorResourcePass methods ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline virtual CompositorPassTypeId getTypeId() const override
+		{
+			return TYPE_ID;
+		}
+
+		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
+		[[nodiscard]] virtual bool getRenderQueueIndexRange(uint8_t& minimumRenderQueueIndex, uint8_t& maximumRenderQueueIndex) const override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		inline explicit CompositorResourcePassGpuCulling(const CompositorTarget& compositorTarget) :
+			CompositorResourcePassCompute(compositorTarget, false),
+			mMinimumRenderQueueIndex(0),
+			mMaximumRenderQueueIndex(255),
+			mSceneMaterialTechniqueId(getInvalid<MaterialTechniqueId>())
+		{
+			// Nothing here
+		}
+
+		inline virtual ~CompositorResourcePassGpuCulling() override
+		{
+			// Nothing here
+		}
+
+		explicit CompositorResourcePassGpuCulling(const CompositorResourcePassGpuCulling&) = delete;
+		CompositorResourcePassGpuCulling& operator=(const CompositorResourcePassGpuCulling&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint8_t				mMinimumRenderQueueIndex;			///< Inclusive
+		uint8_t				mMaximumRenderQueueIndex;			///< Inclusive
+		MaterialTechniqueId	mSceneMaterialTechniqueId;			///< Material technique used for rendering the scene
+		AssetId				mHierarchicalDepthTextureAssetId;	///< Optional previous frame hierarchical depth buffer (aka Hi-Z map), if invalid only frustum culling is performed
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,251 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifdef RHI_VULKAN
+if (rhi.getNameId() == Rhi::NameId::VULKAN)
+{
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// One compute shader invocation per multi-draw-indirect batch draw count
+clearComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Rhi::DrawIndexedArguments"
+struct DrawIndexedArguments
+{
+	uint indexCountPerInstance;
+	uint instanceCount;
+	uint startIndexLocation;
+	int  baseVertexLocation;
+	uint startInstanceLocation;
+};
+
+// Same layout as "Renderer::RenderQueue::GpuCullingDrawCandidate"
+struct DrawCandidate
+{
+	vec4				 boundingSphere;	// xyz = bounding sphere position relative to the draw candidate origin, w = bounding sphere radius (zero means unbounded)
+	DrawIndexedArguments drawIndexedArguments;
+	uint				 drawIndex;
+	uint				 firstDrawIndex;
+	uint				 drawCountIndex;
+};
+
+// Uniforms
+layout(std140, set = 0, binding = 0) uniform UniformBlockDynamicCs
+{
+	vec4  FrustumPlanes[6];						// Camera relative world space frustum planes, normals are pointing inside
+	mat4  PreviousWorldSpaceToClipSpaceMatrix;	// Previous camera relative world space to clip space matrix (Reversed-Z)
+	vec4  HierarchicalDepthMapSize;				// xy = hierarchical depth map size, z = number of hierarchical depth map mipmaps, w = unused
+	uvec4 DrawConfiguration;					// x = number of draw candidates, y = number of draw counts, z = compact draws, w = occlusion culling
+	uvec4 ClipSpaceConfiguration;				// x = upper left origin, y = zero-to-one clip Z
+	vec4  OriginRelativeCameraPosition;			// xyz = camera position relative to the draw candidate origin, the camera relative matrices and planes are relative to the camera, w = unused
+};
+layout(set = 0, binding = 1) uniform sampler2D HierarchicalDepthMap;	// Previous frame hierarchical depth map, minimum depth (Reversed-Z: farthest depth) per texel
+
+// Input
+layout(std430, set = 0, binding = 2) readonly buffer DrawCandidateStructuredBuffer
+{
+	DrawCandidate DrawCandidates[];
+};
+
+// Output
+layout(std430, set = 0, binding = 3) writeonly buffer OutputIndirectBuffer
+{
+	DrawIndexedArguments OutputDrawIndexedArguments[];
+};
+layout(std430, set = 0, binding = 4) buffer DrawCountBuffer
+{
+	uint DrawCounts[];
+};
+
+// Programs
+layout (local_size_x = 64) in;
+void main()
+{
+	// Reset the draw count of each multi-draw-indirect batch
+	uint drawCountIndex = gl_GlobalInvocationID.x;
+	if (drawCountIndex < DrawConfiguration.y)
+	{
+		DrawCounts[drawCountIndex] = 0u;
+	}
+}
+)";
+
+// One compute shader invocation per draw candidate
+cullComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Rhi::DrawIndexedArguments"
+struct DrawIndexedArguments
+{
+	uint indexCountPerInstance;
+	uint instanceCount;
+	uint startIndexLocation;
+	int  baseVertexLocation;
+	uint startInstanceLocation;
+};
+
+// Same layout as "Renderer::RenderQueue::GpuCullingDrawCandidate"
+struct DrawCandidate
+{
+	vec4				 boundingSphere;	// xyz = bounding sphere position relative to the draw candidate origin, w = bounding sphere radius (zero means unbounded)
+	DrawIndexedArguments drawIndexedArguments;
+	uint				 drawIndex;
+	uint				 firstDrawIndex;
+	uint				 drawCountIndex;
+};
+
+// Uniforms
+layout(std140, set = 0, binding = 0) uniform UniformBlockDynamicCs
+{
+	vec4  FrustumPlanes[6];						// Camera relative world space frustum planes, normals are pointing inside
+	mat4  PreviousWorldSpaceToClipSpaceMatrix;	// Previous camera relative world space to clip space matrix (Reversed-Z)
+	vec4  HierarchicalDepthMapSize;				// xy = hierarchical depth map size, z = number of hierarchical depth map mipmaps, w = unused
+	uvec4 DrawConfiguration;					// x = number of draw candidates, y = number of draw counts, z = compact draws, w = occlusion culling
+	uvec4 ClipSpaceConfiguration;				// x = upper left origin, y = zero-to-one clip Z
+	vec4  OriginRelativeCameraPosition;			// xyz = camera position relative to the draw candidate origin, the camera relative matrices and planes are relative to the camera, w = unused
+};
+layout(set = 0, binding = 1) uniform sampler2D HierarchicalDepthMap;	// Previous frame hierarchical depth map, minimum depth (Reversed-Z: farthest depth) per texel
+
+// Input
+layout(std430, set = 0, binding = 2) readonly buffer DrawCandidateStructuredBuffer
+{
+	DrawCandidate DrawCandidates[];
+};
+
+// Output
+layout(std430, set = 0, binding = 3) writeonly buffer OutputIndirectBuffer
+{
+	DrawIndexedArguments OutputDrawIndexedArguments[];
+};
+layout(std430, set = 0, binding = 4) buffer DrawCountBuffer
+{
+	uint DrawCounts[];
+};
+
+// Functions
+bool IsVisible(vec4 boundingSphere)
+{
+	// A bounding sphere radius of zero means unbounded, never cull such draws
+	if (boundingSphere.w <= 0.0)
+	{
+		return true;
+	}
+
+	// The draw candidates are stored relative to a rarely changing origin so they don't change when only the camera moves, make them camera relative
+	boundingSphere.xyz -= OriginRelativeCameraPosition.xyz;
+
+	// Frustum culling
+	for (int i = 0; i < 6; ++i)
+	{
+		if (dot(FrustumPlanes[i].xyz, boundingSphere.xyz) + FrustumPlanes[i].w < -boundingSphere.w)
+		{
+			return false;
+		}
+	}
+
+	// Occlusion culling against the previous frame hierarchical depth map
+	if (0u != DrawConfiguration.w)
+	{
+		// Project the corners of the bounding sphere box into texture space
+		vec2 minimumTexCoord = vec2(1.0, 1.0);
+		vec2 maximumTexCoord = vec2(0.0, 0.0);
+		float nearestDepth = 0.0;
+		for (int i = 0; i < 8; ++i)
+		{
+			vec3 corner = boundingSphere.xyz + boundingSphere.w * vec3(((i & 1) != 0) ? 1.0 : -1.0, ((i & 2) != 0) ? 1.0 : -1.0, ((i & 4) != 0) ? 1.0 : -1.0);
+			vec4 clipSpacePosition = PreviousWorldSpaceToClipSpaceMatrix * vec4(corner, 1.0);
+			if (clipSpacePosition.w <= 0.0)
+			{
+				// The bounding sphere box is crossing the near plane
+				return true;
+			}
+			vec3 normalizedDeviceSpacePosition = clipSpacePosition.xyz / clipSpacePosition.w;
+			vec2 texCoord = normalizedDeviceSpacePosition.xy * vec2(0.5, (0u != ClipSpaceConfiguration.x) ? -0.5 : 0.5) + 0.5;
+			minimumTexCoord = min(minimumTexCoord, texCoord);
+			maximumTexCoord = max(maximumTexCoord, texCoord);
+			nearestDepth = max(nearestDepth, (0u != ClipSpaceConfiguration.y) ? normalizedDeviceSpacePosition.z : (normalizedDeviceSpacePosition.z * 0.5 + 0.5));
+		}
+		minimumTexCoord = clamp(minimumTexCoord, 0.0, 1.0);
+		maximumTexCoord = clamp(maximumTexCoord, 0.0, 1.0);
+
+		// Select the mipmap at which the projected box is covering at most 2x2 texels
+		vec2 extent = (maximumTexCoord - minimumTexCoord) * HierarchicalDepthMapSize.xy;
+		int mipmap = clamp(int(ceil(log2(max(max(extent.x, extent.y), 1.0)))), 0, int(HierarchicalDepthMapSize.z) - 1);
+		ivec2 mipmapSize = textureSize(HierarchicalDepthMap, mipmap);
+		ivec2 minimumTexel = clamp(ivec2(minimumTexCoord * vec2(mipmapSize)), ivec2(0, 0), mipmapSize - 1);
+		ivec2 maximumTexel = clamp(ivec2(maximumTexCoord * vec2(mipmapSize)), ivec2(0, 0), mipmapSize - 1);
+		float farthestDepth = min(min(texelFetch(HierarchicalDepthMap, minimumTexel, mipmap).r, texelFetch(HierarchicalDepthMap, ivec2(maximumTexel.x, minimumTexel.y), mipmap).r),
+								  min(texelFetch(HierarchicalDepthMap, ivec2(minimumTexel.x, maximumTexel.y), mipmap).r, texelFetch(HierarchicalDepthMap, maximumTexel, mipmap).r));
+
+		// Reversed-Z: The draw is occluded if its nearest depth is farther away as the farthest occluder depth
+		if (nearestDepth < farthestDepth)
+		{
+			return false;
+		}
+	}
+
+	// The draw is visible
+	return true;
+}
+
+// Programs
+layout (local_size_x = 64) in;
+void main()
+{
+	uint drawCandidateIndex = gl_GlobalInvocationID.x;
+	if (drawCandidateIndex < DrawConfiguration.x)
+	{
+		DrawCandidate drawCandidate = DrawCandidates[drawCandidateIndex];
+		bool visible = IsVisible(drawCandidate.boundingSphere);
+		if (0u != DrawConfiguration.z)
+		{
+			// Compact the visible draws of the multi-draw-indirect batch, the draw count is read by the GPU
+			if (visible)
+			{
+				uint outputIndex = drawCandidate.firstDrawIndex + atomicAdd(DrawCounts[drawCandidate.drawCountIndex], 1u);
+				OutputDrawIndexedArguments[outputIndex] = drawCandidate.drawIndexedArguments;
+			}
+		}
+		else
+		{
+			// No draw count support, culled draws are written with an instance count of zero
+			DrawIndexedArguments drawIndexedArguments = drawCandidate.drawIndexedArguments;
+			if (!visible)
+			{
+				drawIndexedArguments.instanceCount = 0u;
+			}
+			OutputDrawIndexedArguments[drawCandidate.drawIndex] = drawIndexedArguments;
+		}
+	}
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+else
+#endif
@@ -0,0 +1,340 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorInstancePassParticles.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorResourcePassParticles.h"
+#include "Renderer/Public/Resource/CompositorNode/CompositorNodeInstance.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "Renderer/Public/Resource/Scene/Item/Particles/ParticlesSceneItem.h"
+#include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/IRenderer.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_PARTICLES_THREADS_PER_GROUP  = 256;	///< Must match "local_size_x" of the particles compute shaders
+		static constexpr uint32_t NUMBER_OF_PARTICLES_LOCAL_SORT_ENTRIES	= NUMBER_OF_PARTICLES_THREADS_PER_GROUP * 2;	///< Number of sort entries a local sort work group is sorting inside shared memory, each thread is responsible for two sort entries
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		// Must match "UniformBlockDynamicCs" of the particles compute shaders (std140 layout)
+		struct ParticlesUniformBlockDynamicCs final
+		{
+			float	 emitterExtentsDeltaTime[4];	///< xyz = half size of the object space emitter box, w = simulation step time in seconds
+			float	 minimumVelocityLifetime[4];	///< xyz = minimum object space particle start velocity, w = minimum particle lifetime in seconds
+			float	 maximumVelocityLifetime[4];	///< xyz = maximum object space particle start velocity, w = maximum particle lifetime in seconds
+			float	 gravityDrag[4];				///< xyz = object space acceleration, w = velocity damping factor of the simulation step
+			float	 startColor[4];
+			float	 endColor[4];
+			float	 cameraPosition[4];				///< xyz = object space camera position, w = unused
+			float	 sizes[4];						///< x = particle start size, y = particle end size, zw = unused
+			uint32_t configuration[4];				///< x = maximum number of particles, y = number of particles to emit, z = random seed, w = number of sort entries (zero if sorting is disabled)
+		};
+
+		// Must match the sort entry of the particles compute shaders (std430 layout)
+		struct SortEntry final
+		{
+			float	 key;	///< Squared object space camera distance, negative for dead particles
+			uint32_t particleIndex;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] uint32_t getNextPowerOfTwo(uint32_t value)
+		{
+			uint32_t powerOfTwo = 1;
+			while (powerOfTwo < value)
+			{
+				powerOfTwo <<= 1;
+			}
+			return powerOfTwo;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorInstancePass methods ]
+	//[-------------------------------------------------------]
+	void CompositorInstancePassParticles::onFillCommandBuffer([[maybe_unused]] const Rhi::IRenderTarget* renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
+	{
+		if (nullptr != mGatherComputePipelineState)
+		{
+			// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
+			RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), commandBuffer, getCompositorResourcePass().getDebugName())
+
+			// Dispatch the pending simulation steps of the visible particles scene items, they were prepared inside "Renderer::ISceneItem::onExecuteOnRendering()"
+			for (const ISceneItem* sceneItem : getCompositorNodeInstance().getCompositorWorkspaceInstance().getExecuteOnRenderingSceneItems())
+			{
+				if (sceneItem->getSceneItemTypeId() == ParticlesSceneItem::TYPE_ID)
+				{
+					const ParticlesSceneItem& particlesSceneItem = static_cast<const ParticlesSceneItem&>(*sceneItem);
+					if (particlesSceneItem.mGpuSimulation.pending && particlesSceneItem.getMaximumNumberOfParticles() > 0 && nullptr != particlesSceneItem.mStructuredBufferPtr)
+					{
+						fillParticlesCommandBuffer(particlesSceneItem, commandBuffer);
+					}
+				}
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	CompositorInstancePassParticles::CompositorInstancePassParticles(const CompositorResourcePassParticles& compositorResourcePassParticles, const CompositorNodeInstance& compositorNodeInstance) :
+		CompositorInstancePassCompute(compositorResourcePassParticles, compositorNodeInstance)
+	{
+		// The GPU simulation needs compute shaders and is currently only implemented for OpenGL and Vulkan, else the particles are simulated on the CPU
+		const Rhi::IRhi& rhi = compositorNodeInstance.getCompositorWorkspaceInstance().getRenderer().getRhi();
+		if (rhi.getCapabilities().computeShader && (rhi.getNameId() == Rhi::NameId::VULKAN || rhi.getNameId() == Rhi::NameId::OPENGL))
+		{
+			createFixedBuildInRhiConfigurationResources();
+		}
+	}
+
+	void CompositorInstancePassParticles::createFixedBuildInRhiConfigurationResources()
+	{
+		const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+		Rhi::IRhi& rhi = renderer.getRhi();
+
+		{ // Create the root signature instance
+			// Create the root signature: The first descriptor table is per particles scene item, the second one per bitonic sort step
+			Rhi::DescriptorRangeBuilder ranges[6];
+			ranges[0].initialize(Rhi::ResourceType::UNIFORM_BUFFER,	   0, "UniformBlockDynamicCs",		Rhi::ShaderVisibility::COMPUTE);
+			ranges[1].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 1, "SimulationStructuredBuffer", Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+			ranges[2].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 2, "SortStructuredBuffer",		Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+			ranges[3].initialize(Rhi::ResourceType::STRUCTURED_BUFFER, 3, "ParticleStructuredBuffer",	Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+			ranges[4].initialize(Rhi::ResourceType::INDIRECT_BUFFER,   4, "IndirectBuffer",				Rhi::ShaderVisibility::COMPUTE, Rhi::DescriptorRangeType::UAV);
+			ranges[5].initialize(Rhi::ResourceType::UNIFORM_BUFFER,	   5, "UniformBlockSortCs",			Rhi::ShaderVisibility::COMPUTE);
+
+			Rhi::RootParameterBuilder rootParameters[2];
+			rootParameters[0].initializeAsDescriptorTable(5, &ranges[0]);
+			rootParameters[1].initializeAsDescriptorTable(1, &ranges[5]);
+
+			// Setup
+			Rhi::RootSignatureBuilder rootSignatureBuilder;
+			rootSignatureBuilder.initialize(static_cast<uint32_t>(GLM_COUNTOF(rootParameters)), rootParameters, 0, nullptr, Rhi::RootSignatureFlags::NONE);
+
+			// Create the instance
+			mRootSignature = rhi.createRootSignature(rootSignatureBuilder RHI_RESOURCE_DEBUG_NAME("Particles"));
+		}
+
+		{ // Create the compute pipeline state objects (PSO)
+			// Get the shader source code (outsourced to keep an overview)
+			const char* resetComputeShaderSourceCode = nullptr;
+			const char* simulateComputeShaderSourceCode = nullptr;
+			const char* sortLocalComputeShaderSourceCode = nullptr;
+			const char* sortGlobalComputeShaderSourceCode = nullptr;
+			const char* gatherComputeShaderSourceCode = nullptr;
+			#include "Shader/Particles_GLSL_450.h"	// For Vulkan
+			#include "Shader/Particles_GLSL_430.h"	// OpenGL 4.3 is the minimum for compute shaders
+			{
+				// Error! (unsupported RHI, should have been rejected by the caller)
+				RHI_ASSERT(renderer.getContext(), false, "The RHI implementation isn't supported by the particles GPU simulation")
+			}
+
+			// Create the compute shaders
+			Rhi::IShaderLanguage& shaderLanguage = rhi.getDefaultShaderLanguage();
+			Rhi::IComputeShaderPtr resetComputeShader;
+			Rhi::IComputeShaderPtr simulateComputeShader;
+			Rhi::IComputeShaderPtr sortLocalComputeShader;
+			Rhi::IComputeShaderPtr sortGlobalComputeShader;
+			Rhi::IComputeShaderPtr gatherComputeShader;
+			if (nullptr != resetComputeShaderSourceCode && nullptr != simulateComputeShaderSourceCode && nullptr != sortLocalComputeShaderSourceCode && nullptr != sortGlobalComputeShaderSourceCode && nullptr != gatherComputeShaderSourceCode)
+			{
+				resetComputeShader = shaderLanguage.createComputeShaderFromSourceCode(resetComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("Particles reset"));
+				simulateComputeShader = shaderLanguage.createComputeShaderFromSourceCode(simulateComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("Particles simulate"));
+				sortLocalComputeShader = shaderLanguage.createComputeShaderFromSourceCode(sortLocalComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("Particles sort local"));
+				sortGlobalComputeShader = shaderLanguage.createComputeShaderFromSourceCode(sortGlobalComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("Particles sort global"));
+				gatherComputeShader = shaderLanguage.createComputeShaderFromSourceCode(gatherComputeShaderSourceCode, nullptr RHI_RESOURCE_DEBUG_NAME("Particles gather"));
+			}
+
+			// Create the compute pipeline state objects (PSO), without them the particles are simulated on the CPU
+			if (nullptr != resetComputeShader && nullptr != simulateComputeShader && nullptr != sortLocalComputeShader && nullptr != sortGlobalComputeShader && nullptr != gatherComputeShader)
+			{
+				mResetComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *resetComputeShader RHI_RESOURCE_DEBUG_NAME("Particles reset"));
+				mSimulateComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *simulateComputeShader RHI_RESOURCE_DEBUG_NAME("Particles simulate"));
+				mSortLocalComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *sortLocalComputeShader RHI_RESOURCE_DEBUG_NAME("Particles sort local"));
+				mSortGlobalComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *sortGlobalComputeShader RHI_RESOURCE_DEBUG_NAME("Particles sort global"));
+				mGatherComputePipelineState = rhi.createComputePipelineState(*mRootSignature, *gatherComputeShader RHI_RESOURCE_DEBUG_NAME("Particles gather"));
+			}
+			if (nullptr == mResetComputePipelineState || nullptr == mSimulateComputePipelineState || nullptr == mSortLocalComputePipelineState || nullptr == mSortGlobalComputePipelineState || nullptr == mGatherComputePipelineState)
+			{
+				RHI_LOG(renderer.getContext(), CRITICAL, "Failed to create the particles compute pipeline states, simulating the particles on the CPU")
+				mResetComputePipelineState = nullptr;
+				mSimulateComputePipelineState = nullptr;
+				mSortLocalComputePipelineState = nullptr;
+				mSortGlobalComputePipelineState = nullptr;
+				mGatherComputePipelineState = nullptr;
+			}
+		}
+	}
+
+	const CompositorInstancePassParticles::SortStep& CompositorInstancePassParticles::getSortStep(uint32_t sortStepIndex, uint32_t k, uint32_t j)
+	{
+		// The sort steps are always requested in the same order, so only the next not yet existing sort step can be requested
+		if (sortStepIndex == mSortSteps.size())
+		{
+			const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+			const uint32_t uniformBlockSortCs[4] = { k, j, 0, 0 };	// Must match "UniformBlockSortCs" of the particles sort compute shaders (std140 layout)
+			SortStep sortStep;
+			sortStep.uniformBuffer = renderer.getBufferManager().createUniformBuffer(sizeof(uniformBlockSortCs), uniformBlockSortCs, Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("Particles sort step"));
+			Rhi::IResource* resources[1] = { sortStep.uniformBuffer };
+			sortStep.resourceGroup = mRootSignature->createResourceGroup(1, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Particles sort step"));
+			mSortSteps.push_back(sortStep);
+		}
+		RHI_ASSERT(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), sortStepIndex < mSortSteps.size(), "Invalid sort step index")
+		return mSortSteps[sortStepIndex];
+	}
+
+	void CompositorInstancePassParticles::fillParticlesCommandBuffer(const ParticlesSceneItem& particlesSceneItem, Rhi::CommandBuffer& commandBuffer)
+	{
+		const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
+		Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+		ParticlesSceneItem::GpuSimulation& gpuSimulation = particlesSceneItem.mGpuSimulation;
+		const ParticlesSceneItem::EmitterProperties& emitterProperties = particlesSceneItem.getEmitterProperties();
+		const uint32_t maximumNumberOfParticles = particlesSceneItem.getMaximumNumberOfParticles();
+
+		// The bitonic sort needs a power of two number of sort entries which is a multiple of the local sort entries, padding sort entries are dead
+		const uint32_t numberOfSortEntries = emitterProperties.sortParticles ? ::detail::getNextPowerOfTwo(std::max(maximumNumberOfParticles, ::detail::NUMBER_OF_PARTICLES_LOCAL_SORT_ENTRIES)) : 0;
+
+		// Create the simulation resources of the particles scene item, if required
+		if (nullptr == gpuSimulation.simulationStructuredBuffer)
+		{
+			// All particles start dead, age equal to lifetime
+			const std::vector<uint8_t> simulationData(sizeof(ParticlesSceneItem::ParticleSimulationDataStruct) * maximumNumberOfParticles, 0);
+			gpuSimulation.simulationStructuredBuffer = bufferManager.createStructuredBuffer(static_cast<uint32_t>(simulationData.size()), simulationData.data(), Rhi::BufferFlag::UNORDERED_ACCESS, Rhi::BufferUsage::DYNAMIC_COPY, sizeof(ParticlesSceneItem::ParticleSimulationDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles simulation"));
+			gpuSimulation.sortStructuredBuffer = bufferManager.createStructuredBuffer(static_cast<uint32_t>(sizeof(::detail::SortEntry)) * std::max(numberOfSortEntries, maximumNumberOfParticles), nullptr, Rhi::BufferFlag::UNORDERED_ACCESS, Rhi::BufferUsage::DYNAMIC_COPY, sizeof(::detail::SortEntry) RHI_RESOURCE_DEBUG_NAME("Particles sort"));
+			gpuSimulation.uniformBuffer = bufferManager.createUniformBuffer(sizeof(::detail::ParticlesUniformBlockDynamicCs), nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Particles"));
+			gpuSimulation.resourceGroup = nullptr;
+		}
+		if (nullptr == gpuSimulation.resourceGroup || gpuSimulation.resourceGroupRootSignature != mRootSignature.getPointer())
+		{
+			Rhi::IResource* resources[5] = { gpuSimulation.uniformBuffer, gpuSimulation.simulationStructuredBuffer, gpuSimulation.sortStructuredBuffer, particlesSceneItem.mStructuredBufferPtr, particlesSceneItem.mIndirectBufferPtr };
+			gpuSimulation.resourceGroup = mRootSignature->createResourceGroup(0, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Particles"));
+			gpuSimulation.resourceGroupRootSignature = mRootSignature;
+		}
+
+		{ // Fill the uniform buffer
+			const float deltaTime = gpuSimulation.deltaTime;
+			const ::detail::ParticlesUniformBlockDynamicCs uniformBlockDynamicCs =
+			{
+				{ emitterProperties.emitterExtents.x, emitterProperties.emitterExtents.y, emitterProperties.emitterExtents.z, deltaTime },
+				{ emitterProperties.minimumVelocity.x, emitterProperties.minimumVelocity.y, emitterProperties.minimumVelocity.z, emitterProperties.minimumLifetime },
+				{ emitterProperties.maximumVelocity.x, emitterProperties.maximumVelocity.y, emitterProperties.maximumVelocity.z, emitterProperties.maximumLifetime },
+				{ emitterProperties.gravity.x, emitterProperties.gravity.y, emitterProperties.gravity.z, std::exp(-emitterProperties.drag * deltaTime) },
+				{ emitterProperties.startColor.r, emitterProperties.startColor.g, emitterProperties.startColor.b, emitterProperties.startColor.a },
+				{ emitterProperties.endColor.r, emitterProperties.endColor.g, emitterProperties.endColor.b, emitterProperties.endColor.a },
+				{ gpuSimulation.objectSpaceCameraPosition.x, gpuSimulation.objectSpaceCameraPosition.y, gpuSimulation.objectSpaceCameraPosition.z, 0.0f },
+				{ emitterProperties.startSize, emitterProperties.endSize, 0.0f, 0.0f },
+				{ maximumNumberOfParticles, gpuSimulation.numberOfParticlesToEmit, gpuSimulation.randomSeed, numberOfSortEntries }
+			};
+			Rhi::Command::CopyUniformBufferData::create(commandBuffer, *gpuSimulation.uniformBuffer, &uniformBlockDynamicCs, sizeof(::detail::ParticlesUniformBlockDynamicCs));
+		}
+
+		// Set the used compute root signature and the resource group of the particles scene item
+		Rhi::Command::SetComputeRootSignature::create(commandBuffer, mRootSignature);
+		Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 0, gpuSimulation.resourceGroup);
+
+		// Reset the draw arguments and the emission counter
+		Rhi::Command::SetComputePipelineState::create(commandBuffer, mResetComputePipelineState);
+		Rhi::Command::DispatchCompute::create(commandBuffer, 1, 1, 1);
+
+		// Simulate and emit the particles, also writes the sort entries including the padding sort entries
+		Rhi::Command::SetComputePipelineState::create(commandBuffer, mSimulateComputePipelineState);
+		Rhi::Command::DispatchCompute::create(commandBuffer, (std::max(maximumNumberOfParticles, numberOfSortEntries) + ::detail::NUMBER_OF_PARTICLES_THREADS_PER_GROUP - 1) / ::detail::NUMBER_OF_PARTICLES_THREADS_PER_GROUP, 1, 1);
+
+		// Bitonic sort of the sort entries by descending camera distance, dead particles end up at the back
+		if (numberOfSortEntries > 0)
+		{
+			const uint32_t numberOfSortGroups = numberOfSortEntries / ::detail::NUMBER_OF_PARTICLES_LOCAL_SORT_ENTRIES;
+			uint32_t sortStepIndex = 0;
+
+			// Sort blocks of local sort entries inside shared memory
+			Rhi::Command::SetComputePipelineState::create(commandBuffer, mSortLocalComputePipelineState);
+			Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 1, getSortStep(sortStepIndex++, 0, 0).resourceGroup);
+			Rhi::Command::DispatchCompute::create(commandBuffer, numberOfSortGroups, 1, 1);
+
+			// Merge the sorted blocks: Compare distances larger than the local sort entries inside the global memory, the rest inside shared memory
+			for (uint32_t k = ::detail::NUMBER_OF_PARTICLES_LOCAL_SORT_ENTRIES << 1; k <= numberOfSortEntries; k <<= 1)
+			{
+				Rhi::Command::SetComputePipelineState::create(commandBuffer, mSortGlobalComputePipelineState);
+				for (uint32_t j = k >> 1; j >= ::detail::NUMBER_OF_PARTICLES_LOCAL_SORT_ENTRIES; j >>= 1)
+				{
+					Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 1, getSortStep(sortStepIndex++, k, j).resourceGroup);
+					Rhi::Command::DispatchCompute::create(commandBuffer, numberOfSortGroups, 1, 1);
+				}
+				Rhi::Command::SetComputePipelineState::create(commandBuffer, mSortLocalComputePipelineState);
+				Rhi::Command::SetComputeResourceGroup::create(commandBuffer, 1, getSortStep(sortStepIndex++, k, 0).resourceGroup);
+				Rhi::Command::DispatchCompute::create(commandBuffer, numberOfSortGroups, 1, 1);
+			}
+		}
+
+		// Write the render data of the alive particles in sorted order
+		Rhi::Command::SetComputePipelineState::create(commandBuffer, mGatherComputePipelineState);
+		Rhi::Command::DispatchCompute::create(commandBuffer, (maximumNumberOfParticles + ::detail::NUMBER_OF_PARTICLES_THREADS_PER_GROUP - 1) / ::detail::NUMBER_OF_PARTICLES_THREADS_PER_GROUP, 1, 1);
+
+		// The simulation step has been dispatched
+		gpuSimulation.pending = false;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,153 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/Compute/CompositorInstancePassCompute.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class ParticlesSceneItem;
+	class CompositorResourcePassParticles;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Compositor instance pass particles
+	*
+	*  @remarks
+	*    For each visible particles scene item with a pending simulation step, the following compute shaders are dispatched:
+	*    - Reset: Resets the indirect draw arguments and the emission counter
+	*    - Simulate: Integrates the alive particles, dead particle slots claim the particles to emit via an atomic counter, the
+	*      alive particles are counted via an atomic instance count increment and written as sort entries
+	*    - Sort: Optional bitonic sort of the sort entries by descending camera distance, the sort steps which fit into a work
+	*      group are done inside shared memory, only the remaining steps are done inside the global memory
+	*    - Gather: Writes the render data of the alive particles in sorted order, so the vertex shader can keep using the
+	*      instance index as particle index
+	*    The CPU is never reading back any particle data, the number of alive particles is consumed by the indirect draw.
+	*/
+	class CompositorInstancePassParticles final : public CompositorInstancePassCompute
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class CompositorPassFactory;	// The only one allowed to create instances of this class
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline bool isGpuSimulationSupported() const
+		{
+			return (nullptr != mGatherComputePipelineState);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorInstancePass methods ]
+	//[-------------------------------------------------------]
+	public:
+		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct SortStep final
+		{
+			Rhi::IUniformBufferPtr uniformBuffer;
+			Rhi::IResourceGroupPtr resourceGroup;
+		};
+		typedef std::vector<SortStep> SortSteps;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		CompositorInstancePassParticles(const CompositorResourcePassParticles& compositorResourcePassParticles, const CompositorNodeInstance& compositorNodeInstance);
+
+		inline virtual ~CompositorInstancePassParticles() override
+		{
+			// Nothing here
+		}
+
+		explicit CompositorInstancePassParticles(const CompositorInstancePassParticles&) = delete;
+		CompositorInstancePassParticles& operator=(const CompositorInstancePassParticles&) = delete;
+		void createFixedBuildInRhiConfigurationResources();
+		[[nodiscard]] const SortStep& getSortStep(uint32_t sortStepIndex, uint32_t k, uint32_t j);
+		void fillParticlesCommandBuffer(const ParticlesSceneItem& particlesSceneItem, Rhi::CommandBuffer& commandBuffer);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// Fixed build in RHI configuration resources, only valid if GPU simulation is supported
+		Rhi::IRootSignaturePtr		  mRootSignature;
+		Rhi::IComputePipelineStatePtr mResetComputePipelineState;
+		Rhi::IComputePipelineStatePtr mSimulateComputePipelineState;
+		Rhi::IComputePipelineStatePtr mSortLocalComputePipelineState;
+		Rhi::IComputePipelineStatePtr mSortGlobalComputePipelineState;
+		Rhi::IComputePipelineStatePtr mGatherComputePipelineState;
+		SortSteps					  mSortSteps;	///< Immutable bitonic sort step uniform buffers, created on demand, the sort steps of smaller sort sizes are a prefix of the sort steps of larger sort sizes
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,116 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/CompositorNode/Pass/Compute/CompositorResourcePassCompute.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Compositor resource pass particles
+	*
+	*  @remarks
+	*    Simulates, sorts and compacts the particles of all visible particles scene items by using compute shaders. The compute shaders
+	*    are dispatched by the pass itself, the fixed build in RHI configuration resources are used for this. The results are written
+	*    into the structured buffer and indirect buffer of the particles scene items, which are rendered by a later scene pass.
+	*
+	*    JSON example:
+	*    "Particles":
+	*    {
+	*        "Name": "Particles simulation"
+	*    }
+	*
+	*  @note
+	*    - Requires compute shader support as well as OpenGL or Vulkan, else the particles scene items are simulated on the CPU
+	*    - Must be the first pass rendering into its compositor target since compute shaders can't be dispatched inside a render pass
+	*/
+	class CompositorResourcePassParticles final : public CompositorResourcePassCompute
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class CompositorPassFactory;	// The only one allowed to create instances of this class
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t TYPE_ID = STRING_ID("Particles");
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Renderer::ICompositorResourcePass methods ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline virtual CompositorPassTypeId getTypeId() const override
+		{
+			return TYPE_ID;
+		}
+
+		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		inline explicit CompositorResourcePassParticles(const CompositorTarget& compositorTarget) :
+			CompositorResourcePassCompute(compositorTarget, false)
+		{
+			// Nothing here
+		}
+
+		inline virtual ~CompositorResourcePassParticles() override
+		{
+			// Nothing here
+		}
+
+		explicit CompositorResourcePassParticles(const CompositorResourcePassParticles&) = delete;
+		CompositorResourcePassParticles& operator=(const CompositorResourcePassParticles&) = delete;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,385 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Shader start                                          ]
+//[-------------------------------------------------------]
+#ifdef RHI_VULKAN
+if (rhi.getNameId() == Rhi::NameId::VULKAN)
+{
+
+
+//[-------------------------------------------------------]
+//[ Compute shader source code                            ]
+//[-------------------------------------------------------]
+// Resets the draw arguments and the emission counter, single compute shader invocation
+resetComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Rhi::DrawArguments": [0] = vertex count per instance, [1] = instance count = number of alive particles, [2] = start vertex, [3] = start instance
+// -> [4] = number of emitted particles, not used for drawing
+layout(std430, set = 0, binding = 4) buffer IndirectBuffer
+{
+	uint DrawArguments[];
+};
+
+// Programs
+layout (local_size_x = 1) in;
+void main()
+{
+	DrawArguments[0] = 6u;	// Six vertices per particle
+	DrawArguments[1] = 0u;
+	DrawArguments[2] = 0u;
+	DrawArguments[3] = 0u;
+	DrawArguments[4] = 0u;
+}
+)";
+
+// One compute shader invocation per particle or sort entry, whichever number is greater
+simulateComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Renderer::ParticlesSceneItem::ParticleSimulationDataStruct"
+struct ParticleSimulationData
+{
+	vec4 PositionAge;		// Object space particle xyz-position, w = particle age in seconds
+	vec4 VelocityLifetime;	// Object space particle xyz-velocity in meter per second, w = particle lifetime in seconds, particles with an age equal or greater as their lifetime are dead
+};
+
+// Same layout as "Renderer::ParticlesSceneItem::ParticleDataStruct"
+struct ParticleData
+{
+	vec4 PositionSize;	// Object space particle xyz-position, w = particle size
+	vec4 Color;			// Linear space RGB particle color and opacity
+};
+
+struct SortEntry
+{
+	float Key;	// Squared object space camera distance, negative for dead particles
+	uint  ParticleIndex;
+};
+
+// Uniforms
+layout(std140, set = 0, binding = 0) uniform UniformBlockDynamicCs
+{
+	vec4  EmitterExtentsDeltaTime;	// xyz = half size of the object space emitter box, w = simulation step time in seconds
+	vec4  MinimumVelocityLifetime;	// xyz = minimum object space particle start velocity, w = minimum particle lifetime in seconds
+	vec4  MaximumVelocityLifetime;	// xyz = maximum object space particle start velocity, w = maximum particle lifetime in seconds
+	vec4  GravityDrag;				// xyz = object space acceleration, w = velocity damping factor of the simulation step
+	vec4  StartColor;
+	vec4  EndColor;
+	vec4  CameraPosition;			// xyz = object space camera position, w = unused
+	vec4  Sizes;					// x = particle start size, y = particle end size, zw = unused
+	uvec4 Configuration;			// x = maximum number of particles, y = number of particles to emit, z = random seed, w = number of sort entries (zero if sorting is disabled)
+};
+layout(std430, set = 0, binding = 1) buffer SimulationStructuredBuffer
+{
+	ParticleSimulationData Particles[];
+};
+layout(std430, set = 0, binding = 2) buffer SortStructuredBuffer
+{
+	SortEntry SortEntries[];
+};
+layout(std430, set = 0, binding = 3) writeonly buffer ParticleStructuredBuffer
+{
+	ParticleData RenderParticles[];
+};
+
+// Same layout as "Rhi::DrawArguments": [0] = vertex count per instance, [1] = instance count = number of alive particles, [2] = start vertex, [3] = start instance
+// -> [4] = number of emitted particles, not used for drawing
+layout(std430, set = 0, binding = 4) buffer IndirectBuffer
+{
+	uint DrawArguments[];
+};
+
+// PCG hash (see "Hash Functions for GPU Rendering" - http://www.jcgt.org/published/0009/03/02/ ), same as used by "Renderer::ParticlesSceneItem"
+uint hash(uint value)
+{
+	uint state = value * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+float random01(inout uint seed)
+{
+	seed = hash(seed);
+	return float(seed & 0x00FFFFFFu) * (1.0 / 16777216.0);
+}
+
+// Programs
+layout (local_size_x = 256) in;
+void main()
+{
+	uint index = gl_GlobalInvocationID.x;
+	uint maximumNumberOfParticles = Configuration.x;
+	uint numberOfParticlesToEmit = Configuration.y;
+	uint numberOfSortEntries = Configuration.w;
+	if (index < maximumNumberOfParticles)
+	{
+		float deltaTime = EmitterExtentsDeltaTime.w;
+		vec4 positionAge = Particles[index].PositionAge;
+		vec4 velocityLifetime = Particles[index].VelocityLifetime;
+
+		// Integrate the alive particle
+		bool alive = false;
+		if (positionAge.w < velocityLifetime.w)
+		{
+			velocityLifetime.xyz = (velocityLifetime.xyz + GravityDrag.xyz * deltaTime) * GravityDrag.w;
+			positionAge.xyz += velocityLifetime.xyz * deltaTime;
+			positionAge.w += deltaTime;
+			alive = (positionAge.w < velocityLifetime.w);
+		}
+
+		// Dead particle slots claim the particles to emit, the non-atomic read avoids atomic contention as soon as all particles have been emitted
+		if (!alive && DrawArguments[4] < numberOfParticlesToEmit && atomicAdd(DrawArguments[4], 1u) < numberOfParticlesToEmit)
+		{
+			uint seed = hash(Configuration.z ^ hash(index));
+			positionAge = vec4((vec3(random01(seed), random01(seed), random01(seed)) * 2.0 - 1.0) * EmitterExtentsDeltaTime.xyz, 0.0);
+			velocityLifetime.xyz = mix(MinimumVelocityLifetime.xyz, MaximumVelocityLifetime.xyz, vec3(random01(seed), random01(seed), random01(seed)));
+			velocityLifetime.w = mix(MinimumVelocityLifetime.w, MaximumVelocityLifetime.w, random01(seed));
+			alive = true;
+		}
+		Particles[index].PositionAge = positionAge;
+		Particles[index].VelocityLifetime = velocityLifetime;
+
+		// Count the alive particles and write the sort entries: Either one per particle slot for sorting, or compacted
+		if (alive)
+		{
+			uint aliveIndex = atomicAdd(DrawArguments[1], 1u);
+			if (numberOfSortEntries > 0u)
+			{
+				vec3 cameraToParticle = positionAge.xyz - CameraPosition.xyz;
+				SortEntries[index] = SortEntry(dot(cameraToParticle, cameraToParticle), index);
+			}
+			else
+			{
+				SortEntries[aliveIndex] = SortEntry(0.0, index);
+			}
+		}
+		else if (numberOfSortEntries > 0u)
+		{
+			SortEntries[index] = SortEntry(-1.0, index);
+		}
+	}
+	else if (index < numberOfSortEntries)
+	{
+		// Padding sort entry
+		SortEntries[index] = SortEntry(-1.0, 0u);
+	}
+}
+)";
+
+// Bitonic sort steps with a compare distance below the number of sort entries per work group, done inside shared memory
+// -> "SortStep.x" = 0: Sort each block of 512 sort entries
+// -> "SortStep.x" > 0: Merge step of the given bitonic sequence size, all compare distances from 256 down to 1
+// -> Descending order, so the farthest particles are drawn first and dead particles end up at the back
+sortLocalComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+struct SortEntry
+{
+	float Key;	// Squared object space camera distance, negative for dead particles
+	uint  ParticleIndex;
+};
+
+// Uniforms
+layout(std430, set = 0, binding = 2) buffer SortStructuredBuffer
+{
+	SortEntry SortEntries[];
+};
+layout(std140, set = 1, binding = 0) uniform UniformBlockSortCs
+{
+	uvec4 SortStep;	// x = bitonic sequence size, y = compare distance, zw = unused
+};
+
+// Shared memory
+shared SortEntry LocalSortEntries[512];
+
+// Programs
+void compareAndSwap(uint localIndex, uint compareDistance, uint sequenceSize, uint globalOffset)
+{
+	uint i = ((localIndex & ~(compareDistance - 1u)) << 1u) | (localIndex & (compareDistance - 1u));
+	uint l = i | compareDistance;
+	bool descending = (((globalOffset + i) & sequenceSize) == 0u);
+	SortEntry left = LocalSortEntries[i];
+	SortEntry right = LocalSortEntries[l];
+	if (descending ? (left.Key < right.Key) : (left.Key > right.Key))
+	{
+		LocalSortEntries[i] = right;
+		LocalSortEntries[l] = left;
+	}
+}
+
+layout (local_size_x = 256) in;
+void main()
+{
+	uint localIndex = gl_LocalInvocationID.x;
+	uint globalOffset = gl_WorkGroupID.x * 512u;
+
+	// Load the sort entries into shared memory
+	LocalSortEntries[localIndex] = SortEntries[globalOffset + localIndex];
+	LocalSortEntries[localIndex + 256u] = SortEntries[globalOffset + localIndex + 256u];
+	memoryBarrierShared();
+	barrier();
+
+	// Sort
+	uint sequenceSize = SortStep.x;
+	if (0u == sequenceSize)
+	{
+		for (uint k = 2u; k <= 512u; k <<= 1u)
+		{
+			for (uint j = k >> 1u; j > 0u; j >>= 1u)
+			{
+				compareAndSwap(localIndex, j, k, globalOffset);
+				memoryBarrierShared();
+				barrier();
+			}
+		}
+	}
+	else
+	{
+		for (uint j = 256u; j > 0u; j >>= 1u)
+		{
+			compareAndSwap(localIndex, j, sequenceSize, globalOffset);
+			memoryBarrierShared();
+			barrier();
+		}
+	}
+
+	// Store the sort entries
+	SortEntries[globalOffset + localIndex] = LocalSortEntries[localIndex];
+	SortEntries[globalOffset + localIndex + 256u] = LocalSortEntries[localIndex + 256u];
+}
+)";
+
+// Single bitonic sort step with a compare distance of at least the number of sort entries per local sort work group, one compute shader invocation per compared pair
+sortGlobalComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+struct SortEntry
+{
+	float Key;	// Squared object space camera distance, negative for dead particles
+	uint  ParticleIndex;
+};
+
+// Uniforms
+layout(std430, set = 0, binding = 2) buffer SortStructuredBuffer
+{
+	SortEntry SortEntries[];
+};
+layout(std140, set = 1, binding = 0) uniform UniformBlockSortCs
+{
+	uvec4 SortStep;	// x = bitonic sequence size, y = compare distance, zw = unused
+};
+
+// Programs
+layout (local_size_x = 256) in;
+void main()
+{
+	uint index = gl_GlobalInvocationID.x;
+	uint sequenceSize = SortStep.x;
+	uint compareDistance = SortStep.y;
+	uint i = ((index & ~(compareDistance - 1u)) << 1u) | (index & (compareDistance - 1u));
+	uint l = i | compareDistance;
+	bool descending = ((i & sequenceSize) == 0u);
+	SortEntry left = SortEntries[i];
+	SortEntry right = SortEntries[l];
+	if (descending ? (left.Key < right.Key) : (left.Key > right.Key))
+	{
+		SortEntries[i] = right;
+		SortEntries[l] = left;
+	}
+}
+)";
+
+// One compute shader invocation per particle, writes the render data of the alive particles in sorted order
+gatherComputeShaderSourceCode = R"(#version 450 core	// OpenGL 4.5
+
+// Same layout as "Renderer::ParticlesSceneItem::ParticleSimulationDataStruct"
+struct ParticleSimulationData
+{
+	vec4 PositionAge;		// Object space particle xyz-position, w = particle age in seconds
+	vec4 VelocityLifetime;	// Object space particle xyz-velocity in meter per second, w = particle lifetime in seconds, particles with an age equal or greater as their lifetime are dead
+};
+
+// Same layout as "Renderer::ParticlesSceneItem::ParticleDataStruct"
+struct ParticleData
+{
+	vec4 PositionSize;	// Object space particle xyz-position, w = particle size
+	vec4 Color;			// Linear space RGB particle color and opacity
+};
+
+struct SortEntry
+{
+	float Key;	// Squared object space camera distance, negative for dead particles
+	uint  ParticleIndex;
+};
+
+// Uniforms
+layout(std140, set = 0, binding = 0) uniform UniformBlockDynamicCs
+{
+	vec4  EmitterExtentsDeltaTime;	// xyz = half size of the object space emitter box, w = simulation step time in seconds
+	vec4  MinimumVelocityLifetime;	// xyz = minimum object space particle start velocity, w = minimum particle lifetime in seconds
+	vec4  MaximumVelocityLifetime;	// xyz = maximum object space particle start velocity, w = maximum particle lifetime in seconds
+	vec4  GravityDrag;				// xyz = object space acceleration, w = velocity damping factor of the simulation step
+	vec4  StartColor;
+	vec4  EndColor;
+	vec4  CameraPosition;			// xyz = object space camera position, w = unused
+	vec4  Sizes;					// x = particle start size, y = particle end size, zw = unused
+	uvec4 Configuration;			// x = maximum number of particles, y = number of particles to emit, z = random seed, w = number of sort entries (zero if sorting is disabled)
+};
+layout(std430, set = 0, binding = 1) buffer SimulationStructuredBuffer
+{
+	ParticleSimulationData Particles[];
+};
+layout(std430, set = 0, binding = 2) buffer SortStructuredBuffer
+{
+	SortEntry SortEntries[];
+};
+layout(std430, set = 0, binding = 3) writeonly buffer ParticleStructuredBuffer
+{
+	ParticleData RenderParticles[];
+};
+
+// Same layout as "Rhi::DrawArguments": [0] = vertex count per instance, [1] = instance count = number of alive particles, [2] = start vertex, [3] = start instance
+// -> [4] = number of emitted particles, not used for drawing
+layout(std430, set = 0, binding = 4) buffer IndirectBuffer
+{
+	uint DrawArguments[];
+};
+
+// Programs
+layout (local_size_x = 256) in;
+void main()
+{
+	uint index = gl_GlobalInvocationID.x;
+	if (index < DrawArguments[1])
+	{
+		ParticleSimulationData particle = Particles[SortEntries[index].ParticleIndex];
+		float normalizedAge = clamp(particle.PositionAge.w / particle.VelocityLifetime.w, 0.0, 1.0);
+		RenderParticles[index].PositionSize = vec4(particle.PositionAge.xyz, mix(Sizes.x, Sizes.y, normalizedAge));
+		RenderParticles[index].Color = mix(StartColor, EndColor, normalizedAge);
+	}
+}
+)";
+
+
+//[-------------------------------------------------------]
+//[ Shader end                                            ]
+//[-------------------------------------------------------]
+}
+else
+#endif
@@ -43,6 +43,7 @@
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
+#include "Renderer/Public/Resource/SkeletonAnimation/SkeletonAnimationResourceManager.h"
 #include "Renderer/Public/Core/IProfiler.h"
 #include "Renderer/Public/Core/Renderer/FramebufferManager.h"
 #include "Renderer/Public/Core/Renderer/RenderTargetTextureManager.h"
@@ -78,12 +79,17 @@ namespace Renderer
 		mFramebufferManagerInitialized(false),
 		mExecutionRenderTarget(nullptr),
 		mCompositorInstancePassShadowMap(nullptr)
+		#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+			, mCurrentQueryFrameIndex(0),
+			mQueryFrames{}
+		#endif
 		#ifdef RHI_STATISTICS
-			, mPipelineStatisticsQueryPoolPtr((renderer.getRhi().getNameId() == Rhi::NameId::OPENGL && strstr(renderer.getRhi().getCapabilities().deviceName, "AMD ") != nullptr) ? nullptr : renderer.getRhi().createQueryPool(Rhi::QueryType::PIPELINE_STATISTICS, 2 RHI_RESOURCE_DEBUG_NAME("Compositor workspace instance"))),	// TODO(co) When using OpenGL "GL_ARB_pipeline_statistics_query" features, "glCopyImageSubData()" will horribly stall/freeze on Windows using AMD Radeon 18.12.2 (tested on 16 December 2018). No issues with NVIDIA GeForce game ready driver 417.35 (release data 12/12/2018).
-			mPreviousCurrentPipelineStatisticsQueryIndex(getInvalid<uint32_t>()),
-			mCurrentPipelineStatisticsQueryIndex(0),
+			, mPipelineStatisticsQueryPoolPtr((renderer.getRhi().getNameId() == Rhi::NameId::OPENGL && strstr(renderer.getRhi().getCapabilities().deviceName, "AMD ") != nullptr) ? nullptr : renderer.getRhi().createQueryPool(Rhi::QueryType::PIPELINE_STATISTICS, NUMBER_OF_QUERY_FRAMES RHI_RESOURCE_DEBUG_NAME("Compositor workspace instance"))),	// TODO(co) When using OpenGL "GL_ARB_pipeline_statistics_query" features, "glCopyImageSubData()" will horribly stall/freeze on Windows using AMD Radeon 18.12.2 (tested on 16 December 2018). No issues with NVIDIA GeForce game ready driver 417.35 (release data 12/12/2018).
 			mPipelineStatisticsQueryResult{}
 		#endif
+		#ifdef RENDERER_PROFILER
+			, mNumberOfTimestampQueriesPerFrame(0)
+		#endif
 	{
 		renderer.getCompositorWorkspaceResourceManager().loadCompositorWorkspaceResourceByAssetId(compositorWorkspaceAssetId, mCompositorWorkspaceResourceId, this);
 	}
@@ -223,11 +229,8 @@ namespace Renderer
 						graphicsDebugger.startFrameCapture((renderTarget.getResourceType() == Rhi::ResourceType::SWAP_CHAIN) ? static_cast<Rhi::ISwapChain&>(renderTarget).getNativeWindowHandle() : NULL_HANDLE);
 					}
 				#endif
-				#ifdef RHI_STATISTICS
-					if (nullptr != mPipelineStatisticsQueryPoolPtr)
-					{
-						Rhi::Command::ResetAndBeginQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
-					}
+				#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+					beginQueryFrame();
 				#endif
 
 				const CompositorContextData compositorContextData(this, cameraSceneItem, singlePassStereoInstancing, lightSceneItem, mCompositorInstancePassShadowMap);
@@ -243,6 +246,9 @@ namespace Renderer
 						sceneItem->onExecuteOnRendering(renderTarget, compositorContextData, mCommandBuffer);
 					}
 
+					// Evaluate the skeleton animations which became visible again, multi-threaded and before their skeletons are used for filling the command buffer
+					mRenderer.getSkeletonAnimationResourceManager().evaluateUnculledSkeletonAnimationControllers();
+
 					// Fill the light buffer manager
 					materialBlueprintResourceManager.getLightBufferManager().fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), cameraSceneItem->getSceneResource(), mCommandBuffer);
 				}
@@ -264,11 +270,8 @@ namespace Renderer
 					materialBlueprintResourceManager.onPreCommandBufferDispatch();
 
 					// Dispatch command buffer to the RHI implementation
-					#ifdef RHI_STATISTICS
-						if (nullptr != mPipelineStatisticsQueryPoolPtr)
-						{
-							Rhi::Command::EndQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
-						}
+					#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+						endQueryFrame();
 					#endif
 					mCommandBuffer.dispatchToRhi(rhi);
 
@@ -305,19 +308,10 @@ namespace Renderer
 				static_cast<Rhi::ISwapChain&>(renderTarget).present();
 			}
 
-			// Pipeline statistics query pool
-			#ifdef RHI_STATISTICS
-				if (nullptr != mPipelineStatisticsQueryPoolPtr)
-				{
-					// We explicitly wait if the previous result isn't available yet to avoid
-					// "D3D11 WARNING: ID3D10Query::Begin: Begin is being invoked on a Query, where the previous results have not been obtained with GetData. This is valid; but unusual. The previous results are being abandoned, and new Query results will be generated. [ EXECUTION WARNING #408: QUERY_BEGIN_ABANDONING_PREVIOUS_RESULTS]"
-					if (isValid(mPreviousCurrentPipelineStatisticsQueryIndex) && !rhi.getQueryPoolResults(*mPipelineStatisticsQueryPoolPtr, sizeof(Rhi::PipelineStatisticsQueryResult), reinterpret_cast<uint8_t*>(&mPipelineStatisticsQueryResult), mPreviousCurrentPipelineStatisticsQueryIndex, 1, 0, Rhi::QueryResultFlags::WAIT))
-					{
-						mPipelineStatisticsQueryResult = {};
-					}
-					mPreviousCurrentPipelineStatisticsQueryIndex = mCurrentPipelineStatisticsQueryIndex;
-					mCurrentPipelineStatisticsQueryIndex = (0 == mCurrentPipelineStatisticsQueryIndex) ? 1u : 0u;
-				}
+			// Asynchronous queries: Read back whatever is available without waiting and advance the query frame ring buffer
+			#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+				readBackQueryResults();
+				mCurrentQueryFrameIndex = (mCurrentQueryFrameIndex + 1) % NUMBER_OF_QUERY_FRAMES;
 			#endif
 
 			// Release reference from the render target
@@ -454,6 +448,11 @@ namespace Renderer
 			{
 				compositorNodeInstance->compositorWorkspaceInstanceLoadingFinished();
 			}
+
+			// Now that the number of compositor instance passes is known, create the timestamp query pool
+			#ifdef RENDERER_PROFILER
+				createTimestampQueryPool();
+			#endif
 		}
 	}
 
@@ -471,6 +470,19 @@ namespace Renderer
 		mRenderQueueIndexRanges.clear();
 		mCompositorInstancePassShadowMap = nullptr;
 
+		// Forget about timestamp queries referencing the compositor instance passes
+		#ifdef RENDERER_PROFILER
+			for (QueryFrame& queryFrame : mQueryFrames)
+			{
+				queryFrame.timestampQueriesPending = false;
+				queryFrame.timestampQueriesOverflow = false;
+				queryFrame.timestampCompositorInstancePasses.clear();
+			}
+			mCompositorInstancePassGpuTimes.clear();
+			mTimestampQueryPoolPtr = nullptr;
+			mNumberOfTimestampQueriesPerFrame = 0;
+		#endif
+
 		// Destroy framebuffers and render target textures
 		destroyFramebuffersAndRenderTargetTextures(true);
 	}
@@ -552,6 +564,145 @@ namespace Renderer
 		}
 	}
 
+	#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+		void CompositorWorkspaceInstance::beginQueryFrame()
+		{
+			QueryFrame& queryFrame = mQueryFrames[mCurrentQueryFrameIndex];
+
+			// In case the GPU is more than "Renderer::CompositorWorkspaceInstance::NUMBER_OF_QUERY_FRAMES" frames behind, the results of this query frame are still pending
+			// -> We don't wait for the results and we don't reuse the queries either since this would abandon the previous results, see e.g.
+			//    "D3D11 WARNING: ID3D10Query::Begin: Begin is being invoked on a Query, where the previous results have not been obtained with GetData. This is valid; but unusual. The previous results are being abandoned, and new Query results will be generated. [ EXECUTION WARNING #408: QUERY_BEGIN_ABANDONING_PREVIOUS_RESULTS]"
+			// -> Instead, there just won't be new query results for the current frame
+			#ifdef RHI_STATISTICS
+				if (nullptr != mPipelineStatisticsQueryPoolPtr && !queryFrame.pipelineStatisticsQueryPending)
+				{
+					Rhi::Command::ResetAndBeginQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentQueryFrameIndex);
+				}
+			#endif
+			#ifdef RENDERER_PROFILER
+				if (nullptr != mTimestampQueryPoolPtr && !queryFrame.timestampQueriesPending)
+				{
+					// Must be done outside of a render pass, so do it once for the whole query frame before the compositor instance passes are executed
+					Rhi::Command::ResetQueryPool::create(mCommandBuffer, *mTimestampQueryPoolPtr, mCurrentQueryFrameIndex * mNumberOfTimestampQueriesPerFrame, mNumberOfTimestampQueriesPerFrame);
+					queryFrame.timestampQueriesOverflow = false;
+					queryFrame.timestampCompositorInstancePasses.clear();
+				}
+			#endif
+		}
+
+		void CompositorWorkspaceInstance::endQueryFrame()
+		{
+			QueryFrame& queryFrame = mQueryFrames[mCurrentQueryFrameIndex];
+			#ifdef RHI_STATISTICS
+				if (nullptr != mPipelineStatisticsQueryPoolPtr && !queryFrame.pipelineStatisticsQueryPending)
+				{
+					Rhi::Command::EndQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentQueryFrameIndex);
+					queryFrame.pipelineStatisticsQueryPending = true;
+				}
+			#endif
+			#ifdef RENDERER_PROFILER
+				if (nullptr != mTimestampQueryPoolPtr && !queryFrame.timestampQueriesPending && !queryFrame.timestampCompositorInstancePasses.empty())
+				{
+					queryFrame.timestampQueriesPending = true;
+				}
+			#endif
+		}
+
+		void CompositorWorkspaceInstance::readBackQueryResults()
+		{
+			// Start with the oldest query frame so the latest available results win
+			Rhi::IRhi& rhi = mRenderer.getRhi();
+			for (uint32_t i = 1; i <= NUMBER_OF_QUERY_FRAMES; ++i)
+			{
+				const uint32_t queryFrameIndex = (mCurrentQueryFrameIndex + i) % NUMBER_OF_QUERY_FRAMES;
+				QueryFrame& queryFrame = mQueryFrames[queryFrameIndex];
+
+				// Pipeline statistics query
+				#ifdef RHI_STATISTICS
+					if (queryFrame.pipelineStatisticsQueryPending)
+					{
+						Rhi::PipelineStatisticsQueryResult pipelineStatisticsQueryResult;
+						if (rhi.getQueryPoolResults(*mPipelineStatisticsQueryPoolPtr, sizeof(Rhi::PipelineStatisticsQueryResult), reinterpret_cast<uint8_t*>(&pipelineStatisticsQueryResult), queryFrameIndex, 1, 0, 0))
+						{
+							mPipelineStatisticsQueryResult = pipelineStatisticsQueryResult;
+							queryFrame.pipelineStatisticsQueryPending = false;
+						}
+					}
+				#endif
+
+				// Timestamp queries
+				#ifdef RENDERER_PROFILER
+					if (queryFrame.timestampQueriesPending)
+					{
+						const uint32_t numberOfCompositorInstancePasses = static_cast<uint32_t>(queryFrame.timestampCompositorInstancePasses.size());
+						const uint32_t numberOfQueries = numberOfCompositorInstancePasses * 2;
+						mTimestampQueryResults.resize(numberOfQueries);
+						if (rhi.getQueryPoolResults(*mTimestampQueryPoolPtr, static_cast<uint32_t>(sizeof(uint64_t) * numberOfQueries), reinterpret_cast<uint8_t*>(mTimestampQueryResults.data()), queryFrameIndex * mNumberOfTimestampQueriesPerFrame, numberOfQueries, sizeof(uint64_t), 0))
+						{
+							mCompositorInstancePassGpuTimes.resize(numberOfCompositorInstancePasses);
+							for (uint32_t passIndex = 0; passIndex < numberOfCompositorInstancePasses; ++passIndex)
+							{
+								const uint64_t beginNanoseconds = mTimestampQueryResults[passIndex * 2];
+								const uint64_t endNanoseconds = mTimestampQueryResults[passIndex * 2 + 1];
+								CompositorInstancePassGpuTime& compositorInstancePassGpuTime = mCompositorInstancePassGpuTimes[passIndex];
+								compositorInstancePassGpuTime.compositorInstancePass = queryFrame.timestampCompositorInstancePasses[passIndex];
+								compositorInstancePassGpuTime.milliseconds = (endNanoseconds > beginNanoseconds) ? static_cast<float>(static_cast<double>(endNanoseconds - beginNanoseconds) * 1.0e-6) : 0.0f;
+							}
+							queryFrame.timestampQueriesPending = false;
+						}
+					}
+				#endif
+			}
+		}
+	#endif
+
+	#ifdef RENDERER_PROFILER
+		void CompositorWorkspaceInstance::createTimestampQueryPool()
+		{
+			// Two timestamp queries per compositor instance pass
+			mNumberOfTimestampQueriesPerFrame = 0;
+			for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+			{
+				mNumberOfTimestampQueriesPerFrame += static_cast<uint32_t>(compositorNodeInstance->mCompositorInstancePasses.size()) * 2;
+			}
+			if (mNumberOfTimestampQueriesPerFrame > 0)
+			{
+				mTimestampQueryPoolPtr = mRenderer.getRhi().createQueryPool(Rhi::QueryType::TIMESTAMP, mNumberOfTimestampQueriesPerFrame * NUMBER_OF_QUERY_FRAMES RHI_RESOURCE_DEBUG_NAME("Compositor workspace instance"));
+				mTimestampQueryResults.reserve(mNumberOfTimestampQueriesPerFrame);
+			}
+		}
+
+		void CompositorWorkspaceInstance::writeCompositorInstancePassTimestamp(const ICompositorInstancePass& compositorInstancePass, bool begin, Rhi::CommandBuffer& commandBuffer)
+		{
+			QueryFrame& queryFrame = mQueryFrames[mCurrentQueryFrameIndex];
+			if (nullptr != mTimestampQueryPoolPtr && !queryFrame.timestampQueriesPending)
+			{
+				// A compositor instance pass can be executed multiple times per frame (e.g. once per render target layer), so the
+				// timestamp queries can run out: Don't write outside of the query frame range, just stop measuring for this frame
+				if (queryFrame.timestampQueriesOverflow)
+				{
+					return;
+				}
+				if (begin)
+				{
+					if (queryFrame.timestampCompositorInstancePasses.size() * 2 >= mNumberOfTimestampQueriesPerFrame)
+					{
+						RHI_LOG_ONCE(mRenderer.getContext(), WARNING, "The compositor workspace instance ran out of timestamp queries (%u per frame), compositor instance pass GPU times are incomplete", mNumberOfTimestampQueriesPerFrame)
+						queryFrame.timestampQueriesOverflow = true;
+						return;
+					}
+					queryFrame.timestampCompositorInstancePasses.push_back(&compositorInstancePass);
+				}
+				else
+				{
+					RHI_ASSERT(mRenderer.getContext(), !queryFrame.timestampCompositorInstancePasses.empty() && queryFrame.timestampCompositorInstancePasses.back() == &compositorInstancePass, "Compositor instance pass timestamp queries mismatch")
+				}
+				const uint32_t queryIndex = mCurrentQueryFrameIndex * mNumberOfTimestampQueriesPerFrame + static_cast<uint32_t>(queryFrame.timestampCompositorInstancePasses.size() - 1) * 2 + (begin ? 0u : 1u);
+				Rhi::Command::WriteTimestampQuery::create(commandBuffer, *mTimestampQueryPoolPtr, queryIndex);
+			}
+		}
+	#endif
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
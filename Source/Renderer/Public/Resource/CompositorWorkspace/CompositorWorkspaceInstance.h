@@ -82,10 +82,17 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class CompositorNodeInstance;	// Needs to write compositor instance pass GPU timestamp queries
+
+
 	//[-------------------------------------------------------]
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
+		static constexpr uint32_t NUMBER_OF_QUERY_FRAMES = 4;	///< Number of frames asynchronous queries are ring buffered over, results are read back latently as soon as they're available without stalling the CPU
 		typedef std::vector<RenderableManager*> RenderableManagers;
 		typedef std::vector<CompositorNodeInstance*> CompositorNodeInstances;
 
@@ -102,6 +109,15 @@ namespace Renderer
 		};
 		typedef std::vector<RenderQueueIndexRange> RenderQueueIndexRanges;
 
+		#ifdef RENDERER_PROFILER
+			struct CompositorInstancePassGpuTime final
+			{
+				const ICompositorInstancePass* compositorInstancePass;	///< Compositor instance pass the GPU time was measured for, always valid, don't destroy the instance
+				float						   milliseconds;			///< Measured GPU time in milliseconds
+			};
+			typedef std::vector<CompositorInstancePassGpuTime> CompositorInstancePassGpuTimes;
+		#endif
+
 
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
@@ -152,18 +168,30 @@ namespace Renderer
 			return mExecutionRenderTarget;
 		}
 
+		[[nodiscard]] inline const std::vector<ISceneItem*>& getExecuteOnRenderingSceneItems() const	// Only valid during compositor workspace instance execution
+		{
+			return mExecuteOnRenderingSceneItems;
+		}
+
 		[[nodiscard]] inline const Rhi::CommandBuffer& getCommandBuffer() const
 		{
 			return mCommandBuffer;
 		}
 
 		#ifdef RHI_STATISTICS
-			[[nodiscard]] inline const Rhi::PipelineStatisticsQueryResult& getPipelineStatisticsQueryResult() const
+			[[nodiscard]] inline const Rhi::PipelineStatisticsQueryResult& getPipelineStatisticsQueryResult() const	// Latest available pipeline statistics query result, usually a few frames old
 			{
 				return mPipelineStatisticsQueryResult;
 			}
 		#endif
 
+		#ifdef RENDERER_PROFILER
+			[[nodiscard]] inline const CompositorInstancePassGpuTimes& getCompositorInstancePassGpuTimes() const	// Latest available per compositor instance pass GPU times, usually a few frames old
+			{
+				return mCompositorInstancePassGpuTimes;
+			}
+		#endif
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -183,6 +211,15 @@ namespace Renderer
 		void createFramebuffersAndRenderTargetTextures(const Rhi::IRenderTarget& mainRenderTarget);
 		void destroyFramebuffersAndRenderTargetTextures(bool clearManagers = false);
 		void clearRenderQueueIndexRangesRenderableManagers();
+		#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+			void beginQueryFrame();
+			void endQueryFrame();
+			void readBackQueryResults();
+		#endif
+		#ifdef RENDERER_PROFILER
+			void createTimestampQueryPool();
+			void writeCompositorInstancePassTimestamp(const ICompositorInstancePass& compositorInstancePass, bool begin, Rhi::CommandBuffer& commandBuffer);
+		#endif
 
 
 	//[-------------------------------------------------------]
@@ -205,11 +242,26 @@ namespace Renderer
 		std::vector<ISceneItem*>		 mExecuteOnRenderingSceneItems;			///< Scene items which requested an execute call on rendering, no duplicates allowed
 		Rhi::CommandBuffer				 mCommandBuffer;						///< RHI command buffer
 		CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;		///< Can be a null pointer, don't destroy the instance
+		#if defined(RHI_STATISTICS) || defined(RENDERER_PROFILER)
+			struct QueryFrame final
+			{
+				bool pipelineStatisticsQueryPending;	///< "true" if the pipeline statistics query of this frame wasn't read back, yet
+				bool timestampQueriesPending;			///< "true" if the timestamp queries of this frame weren't read back, yet
+				bool timestampQueriesOverflow;			///< "true" if there were more compositor instance pass executions during this frame than timestamp queries, the remaining passes aren't measured
+				std::vector<const ICompositorInstancePass*> timestampCompositorInstancePasses;	///< Compositor instance passes which received a begin and end timestamp query during this frame, in order, don't destroy the instances
+			};
+			uint32_t   mCurrentQueryFrameIndex;					///< Current ring buffer index inside "mQueryFrames", the oldest frame follows
+			QueryFrame mQueryFrames[NUMBER_OF_QUERY_FRAMES];
+		#endif
 		#ifdef RHI_STATISTICS
-			Rhi::IQueryPoolPtr				   mPipelineStatisticsQueryPoolPtr;					///< Double buffered asynchronous pipeline statistics query pool, can be a null pointer
-			uint32_t						   mPreviousCurrentPipelineStatisticsQueryIndex;	///< Can be "Renderer::getInvalid<uint32_t>()"
-			uint32_t						   mCurrentPipelineStatisticsQueryIndex;			///< Toggles between 0 or 1
-			Rhi::PipelineStatisticsQueryResult mPipelineStatisticsQueryResult;					///< Due to double buffered asynchronous pipeline statistics query pool, this is the pipeline statistics query result of the previous frame
+			Rhi::IQueryPoolPtr				   mPipelineStatisticsQueryPoolPtr;	///< Ring buffered asynchronous pipeline statistics query pool with one query per query frame, can be a null pointer
+			Rhi::PipelineStatisticsQueryResult mPipelineStatisticsQueryResult;	///< Latest pipeline statistics query result which was available without waiting
+		#endif
+		#ifdef RENDERER_PROFILER
+			Rhi::IQueryPoolPtr			   mTimestampQueryPoolPtr;						///< Ring buffered asynchronous timestamp query pool with "mNumberOfTimestampQueriesPerFrame" queries per query frame, can be a null pointer
+			uint32_t					   mNumberOfTimestampQueriesPerFrame;			///< Two timestamp queries (begin and end) per compositor instance pass
+			std::vector<uint64_t>		   mTimestampQueryResults;						///< Temporary timestamp query results in nanoseconds, to avoid reallocations
+			CompositorInstancePassGpuTimes mCompositorInstancePassGpuTimes;			///< Latest per compositor instance pass GPU times which were available without waiting
 		#endif
 
 
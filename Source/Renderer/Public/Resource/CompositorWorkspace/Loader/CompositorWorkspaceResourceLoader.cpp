@@ -88,7 +88,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1CompositorWorkspace::FORMAT_TYPE, v1CompositorWorkspace::FORMAT_VERSION, file);
 	}
 
-	void CompositorWorkspaceResourceLoader::onProcessing()
+	bool CompositorWorkspaceResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -100,6 +100,9 @@ namespace Renderer
 
 		// Read in the compositor workspace resource nodes
 		::detail::nodesDeserialization(mMemoryFile, *mCompositorWorkspaceResource);
+
+		// Done
+		return true;
 	}
 
 
@@ -166,8 +166,11 @@ namespace Renderer
 		/**
 		*  @brief
 		*    Asynchronous called when the resource loader has to perform internal in-memory data processing
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
 		*/
-		virtual void onProcessing() = 0;
+		[[nodiscard]] virtual bool onProcessing() = 0;
 
 		/**
 		*  @brief
@@ -52,7 +52,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1Material::FORMAT_TYPE, v1Material::FORMAT_VERSION, file);
 	}
 
-	void MaterialResourceLoader::onProcessing()
+	bool MaterialResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -90,6 +90,9 @@ namespace Renderer
 			// Unusual border case but still valid to have a material which doesn't have any material properties
 			sortedPropertyVector.clear();
 		}
+
+		// Done
+		return true;
 	}
 
 	bool MaterialResourceLoader::onDispatch()
@@ -57,6 +57,24 @@ namespace
 		#undef DEFINE_CONSTANT
 
 
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] bool isBindlessTextureHandleReference(const Renderer::MaterialBlueprintResource::UniformBuffer& materialUniformBuffer, Renderer::MaterialPropertyId materialPropertyId)
+		{
+			for (const Renderer::MaterialProperty& uniformBufferElementProperty : materialUniformBuffer.uniformBufferElementProperties)
+			{
+				if (Renderer::MaterialProperty::Usage::MATERIAL_REFERENCE == uniformBufferElementProperty.getUsage() &&
+					Renderer::MaterialPropertyValue::ValueType::INTEGER_2 == uniformBufferElementProperty.getValueType() &&
+					uniformBufferElementProperty.getReferenceValue() == materialPropertyId)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -79,7 +97,8 @@ namespace Renderer
 		mMaterialTechniqueId(materialTechniqueId),
 		mMaterialBlueprintResourceId(materialBlueprintResourceId),
 		mStructuredBufferRootParameterIndex(~0u),
-		mSerializedGraphicsPipelineStateHash(getInvalid<uint32_t>())
+		mSerializedGraphicsPipelineStateHash(getInvalid<uint32_t>()),
+		mBindlessTextures(false)
 	{
 		MaterialBufferManager* materialBufferManager = getMaterialBufferManager();
 		if (nullptr != materialBufferManager)
@@ -138,6 +157,58 @@ namespace Renderer
 		fillCommandBuffer(renderer, resourceGroupRootParameterIndex, resourceGroup);
 	}
 
+	bool MaterialTechnique::getBindlessTextureHandle(const IRenderer& renderer, MaterialPropertyId materialPropertyId, uint64_t& bindlessTextureHandle)
+	{
+		const Textures& textures = getTextures(renderer);
+		if (mBindlessTextures)
+		{
+			const size_t numberOfTextures = textures.size();
+			for (size_t i = 0; i < numberOfTextures; ++i)
+			{
+				const Texture& texture = textures[i];
+				if (texture.materialProperty.getMaterialPropertyId() == materialPropertyId)
+				{
+					// Due to background texture loading, some textures might not be ready, yet
+					const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
+					TextureResource* textureResource = textureResourceManager.tryGetById(texture.textureResourceId);
+					if (nullptr == textureResource)
+					{
+						// Maybe it's a dynamically created texture like a shadow map created by "Renderer::CompositorInstancePassShadowMap"
+						textureResource = textureResourceManager.getTextureResourceByAssetId(texture.materialProperty.getTextureAssetIdValue());
+						if (nullptr != textureResource)
+						{
+							// We need to get informed in case the texture gets changed in order to update the bindless texture handle accordantly
+							// -> Textures known while gathering the textures are already connected, see "Renderer::MaterialTechnique::getTextures()"
+							mTextures[i].textureResourceId = textureResource->getId();
+							textureResource->connectResourceListener(*this);
+						}
+					}
+					bindlessTextureHandle = 0;
+					if (nullptr != textureResource && nullptr != textureResource->getTexturePtr())
+					{
+						// Get sampler state, if there's one (e.g. texel fetch instead of sampling might be used)
+						const MaterialBlueprintResource* materialBlueprintResource = renderer.getMaterialBlueprintResourceManager().tryGetById(mMaterialBlueprintResourceId);
+						RHI_ASSERT(renderer.getContext(), nullptr != materialBlueprintResource, "Invalid material blueprint resource")
+						Rhi::ISamplerState* samplerState = nullptr;
+						const uint32_t samplerStateIndex = materialBlueprintResource->getTextures()[i].samplerStateIndex;
+						if (isValid(samplerStateIndex))
+						{
+							RHI_ASSERT(renderer.getContext(), samplerStateIndex < materialBlueprintResource->getSamplerStates().size(), "Invalid sampler state index")
+							samplerState = materialBlueprintResource->getSamplerStates()[samplerStateIndex].samplerStatePtr;
+						}
+
+						// Ask the RHI for the bindless texture handle
+						bindlessTextureHandle = renderer.getRhi().getBindlessTextureHandle(*textureResource->getTexturePtr(), samplerState);
+					}
+					return true;
+				}
+			}
+		}
+
+		// No bindless texture handle
+		return false;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -145,6 +216,12 @@ namespace Renderer
 	void MaterialTechnique::onLoadingStateChange(const Renderer::IResource&)
 	{
 		makeResourceGroupDirty();
+
+		// Bindless texture handles are stored inside the material uniform buffer, so it needs to be updated
+		if (mBindlessTextures)
+		{
+			scheduleForShaderUniformUpdate();
+		}
 	}
 
 
@@ -198,6 +275,28 @@ namespace Renderer
 					// Insert texture
 					mTextures.push_back(texture);
 				}
+
+				// Use bindless textures if the "GlobalBindlessTexture" shader path is enabled and the material blueprint references all textures via bindless texture handles
+				// -> In this case the textures don't need to be bound via a resource group which also removes resource group changes between draw calls
+				const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = materialBlueprintResource->getMaterialUniformBuffer();
+				mBindlessTextures = (!mTextures.empty() && nullptr != materialUniformBuffer && renderer.getMaterialBlueprintResourceManager().getGlobalMaterialProperties().getPropertyById(STRING_ID("GlobalBindlessTexture"))->getBooleanValue());
+				for (size_t i = 0; i < numberOfTextures && mBindlessTextures; ++i)
+				{
+					mBindlessTextures = ::detail::isBindlessTextureHandleReference(*materialUniformBuffer, mTextures[i].materialProperty.getMaterialPropertyId());
+				}
+				if (mBindlessTextures)
+				{
+					// We need to get informed in case a texture gets changed in order to update the bindless texture handle accordantly
+					// -> Connect once in here instead of each time a bindless texture handle is requested
+					for (const Texture& texture : mTextures)
+					{
+						TextureResource* textureResource = textureResourceManager.tryGetById(texture.textureResourceId);
+						if (nullptr != textureResource)
+						{
+							textureResource->connectResourceListener(*this);
+						}
+					}
+				}
 			}
 		}
 		return mTextures;
@@ -312,7 +411,7 @@ namespace Renderer
 	{
 		// Set textures
 		const Textures& textures = getTextures(renderer);
-		if (textures.empty())
+		if (textures.empty() || mBindlessTextures)
 		{
 			if (nullptr != mStructuredBufferPtr)
 			{
@@ -187,6 +187,26 @@ namespace Renderer
 		*/
 		void fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup);
 
+		/**
+		*  @brief
+		*    Return the bindless texture handle of the texture referenced by the given material property
+		*
+		*  @param[in] renderer
+		*    Renderer to use
+		*  @param[in] materialPropertyId
+		*    ID of the texture material property
+		*  @param[out] bindlessTextureHandle
+		*    Receives the bindless texture handle, can be 0 if the texture isn't ready, yet
+		*
+		*  @return
+		*    "true" if the material technique uses bindless textures and the material property references one of its textures, else "false"
+		*
+		*  @note
+		*    - Bindless textures are used if the RHI supports them and the material blueprint references each texture material property by a
+		*      "MATERIAL_REFERENCE" material uniform buffer element of value type "INTEGER_2", in this case no texture resource group is created
+		*/
+		[[nodiscard]] bool getBindlessTextureHandle(const IRenderer& renderer, MaterialPropertyId materialPropertyId, uint64_t& bindlessTextureHandle);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -278,6 +298,7 @@ namespace Renderer
 		Textures					mTextures;
 		uint32_t					mSerializedGraphicsPipelineStateHash;	///< FNV1a hash of "Rhi::SerializedGraphicsPipelineState"
 		Rhi::IResourceGroupPtr		mResourceGroup;							///< Resource group, can be a null pointer
+		bool						mBindlessTextures;						///< Are the textures accessed via bindless texture handles stored inside the material uniform buffer? Only valid after the textures have been gathered.
 
 
 	};
@@ -243,7 +243,18 @@ namespace Renderer
 					{
 						// Figure out the material property value
 						const MaterialProperty* materialProperty = materialResource.getPropertyById(uniformBufferElementProperty.getReferenceValue());
-						if (nullptr != materialProperty)
+						if (MaterialPropertyValue::ValueType::INTEGER_2 == uniformBufferElementProperty.getValueType() && nullptr != materialProperty && MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID == materialProperty->getValueType())
+						{
+							// Bindless texture handle, an "uvec2" inside the shader
+							// -> Zero if the material technique doesn't use bindless textures, the shader then samples the texture resource group instead and never reads the handle
+							uint64_t bindlessTextureHandle = 0;
+							if (!static_cast<MaterialTechnique*>(materialBufferSlot)->getBindlessTextureHandle(mRenderer, uniformBufferElementProperty.getReferenceValue(), bindlessTextureHandle))
+							{
+								bindlessTextureHandle = 0;
+							}
+							memcpy(scratchBufferPointer, &bindlessTextureHandle, sizeof(uint64_t));
+						}
+						else if (nullptr != materialProperty)
 						{
 							// TODO(co) Error handling: Usage mismatch, value type mismatch etc.
 							memcpy(scratchBufferPointer, materialProperty->getData(), valueTypeNumberOfBytes);
@@ -253,7 +253,9 @@ namespace Renderer
 		{ // Fill the texture buffer
 			{ // "POSITION_ROTATION_SCALE"-semantic
 				// xyz position adjusted for camera relative rendering: While we're using a 64 bit world space position in general, for relative positions 32 bit are sufficient
-				const glm::vec3 position = objectSpaceToWorldSpaceTransform.position - worldSpaceCameraPosition;
+				// -> Quantized vertex positions are dequantized by folding the bounding box offset and extent into the instance position and scale, see "Renderer::MeshResource::hasQuantizedPositions()"
+				const RenderableManager& renderableManager = renderable.getRenderableManager();
+				const glm::vec3 position = glm::vec3(objectSpaceToWorldSpaceTransform.position - worldSpaceCameraPosition) + objectSpaceToWorldSpaceTransform.rotation * (renderableManager.getPositionDequantizationOffset() * objectSpaceToWorldSpaceTransform.scale);
 				memcpy(mCurrentTextureBufferPointer, glm::value_ptr(position), sizeof(float) * 3);
 				mCurrentTextureBufferPointer += 4;
 
@@ -264,7 +266,8 @@ namespace Renderer
 				mCurrentTextureBufferPointer += 4;
 
 				// xyz scale
-				memcpy(mCurrentTextureBufferPointer, glm::value_ptr(objectSpaceToWorldSpaceTransform.scale), sizeof(float) * 3);
+				const glm::vec3 scale = objectSpaceToWorldSpaceTransform.scale * renderableManager.getPositionDequantizationScale();
+				memcpy(mCurrentTextureBufferPointer, glm::value_ptr(scale), sizeof(float) * 3);
 				mCurrentTextureBufferPointer += 4;
 			}
 
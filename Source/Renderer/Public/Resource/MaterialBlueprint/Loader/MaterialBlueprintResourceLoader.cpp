@@ -54,7 +54,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1MaterialBlueprint::FORMAT_TYPE, v1MaterialBlueprint::FORMAT_VERSION, file);
 	}
 
-	void MaterialBlueprintResourceLoader::onProcessing()
+	bool MaterialBlueprintResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -284,6 +284,9 @@ namespace Renderer
 		{
 			createRhiResources();
 		}
+
+		// Done
+		return true;
 	}
 
 	bool MaterialBlueprintResourceLoader::onDispatch()
@@ -105,7 +105,7 @@ namespace Renderer
 			return true;
 		}
 
-		virtual void onProcessing() override;
+		[[nodiscard]] virtual bool onProcessing() override;
 		[[nodiscard]] virtual bool onDispatch() override;
 		[[nodiscard]] virtual bool isFullyLoaded() override;
 
@@ -363,6 +363,11 @@ namespace Renderer
 		// Update at once to have all managed global material properties known from the start
 		update();
 		mGlobalMaterialProperties.setPropertyById(STRING_ID("GlobalNumberOfMultisamples"), MaterialPropertyValue::fromInteger(0), MaterialProperty::Usage::SHADER_COMBINATION);
+		{ // Bindless textures: There's only a "GL_ARB_bindless_texture" shader path, Vulkan descriptor indexing isn't supported, so the shader path is gated off for all other RHI implementations
+			// -> Material techniques check this global material property as well, so shaders and uploaded material uniform buffer data always agree
+			const bool bindlessTexture = (capabilities.bindlessTexture && Rhi::NameId::OPENGL == renderer.getRhi().getNameId());
+			mGlobalMaterialProperties.setPropertyById(STRING_ID("GlobalBindlessTexture"), MaterialPropertyValue::fromBoolean(bindlessTexture), MaterialProperty::Usage::SHADER_COMBINATION);
+		}
 	}
 
 	MaterialBlueprintResourceManager::~MaterialBlueprintResourceManager()
@@ -56,9 +56,10 @@ namespace Renderer
 	// Mesh file format content:
 	// - File format header
 	// - Mesh header
-	// - Vertex and index buffer data (directly containing also the index data of all LODs)
+	// - Vertex and index buffer data (directly containing also the index data of all LODs), optionally encoded using the "meshoptimizer" vertex and index buffer codecs
 	// - Vertex array attribute definitions
 	// - Sub-meshes and LODs
+	// - Optional meshlets
 	// - Optional skeleton
 	namespace v1Mesh
 	{
@@ -68,7 +69,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("Mesh");
-		static constexpr uint32_t FORMAT_VERSION = 9;
+		static constexpr uint32_t FORMAT_VERSION = 13;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -86,9 +87,15 @@ namespace Renderer
 				uint32_t numberOfIndices;
 				uint8_t  numberOfVertexAttributes;
 				bool	 hasPositionOnlyIndices;
+				bool	 hasQuantizedPositions;							// Positions are unsigned normalized 16-bit relative to the bounding box
+				uint32_t numberOfEncodedVertexBufferBytes;				// Zero if the vertex buffer isn't encoded, else number of bytes of the "meshoptimizer" encoded vertex buffer ("meshopt_encodeVertexBuffer()")
+				uint32_t numberOfEncodedIndexBufferBytes;				// Zero if the index buffer isn't encoded, else number of bytes of the "meshoptimizer" encoded index buffer ("meshopt_encodeIndexBuffer()")
+				uint32_t numberOfEncodedPositionOnlyIndexBufferBytes;	// Zero if the position-only index buffer isn't encoded, else number of bytes of the "meshoptimizer" encoded position-only index buffer ("meshopt_encodeIndexBuffer()")
 				// Sub-meshes and LODs
 				uint16_t numberOfSubMeshes;
 				uint8_t  numberOfLods;	// There's always at least one LOD, namely the original none reduced version
+				// Optional meshlets
+				uint32_t numberOfMeshlets;
 				// Optional skeleton
 				uint8_t  numberOfBones;
 			};
@@ -98,6 +105,22 @@ namespace Renderer
 				AssetId  materialAssetId;
 				uint32_t startIndexLocation;
 				uint32_t numberOfIndices;
+				uint32_t startMeshletIndex = 0;	// Only valid if the mesh has meshlets
+				uint32_t numberOfMeshlets  = 0;	// Zero if the mesh has no meshlets
+			};
+
+			// Keep this in sync with "Renderer::Meshlet", the triangles of a meshlet are stored as a continuous range inside the index buffer
+			struct Meshlet final
+			{
+				uint32_t  startIndexLocation;
+				uint32_t  numberOfIndices;
+				// Bounding sphere, useful for frustum and occlusion culling
+				glm::vec3 boundingSpherePosition;
+				float	  boundingSphereRadius;
+				// Normal cone, useful for backface culling
+				glm::vec3 coneApex;
+				glm::vec3 coneAxis;
+				float	  coneCutoff;	// cos(angle/2)
 			};
 		#pragma pack(pop)
 
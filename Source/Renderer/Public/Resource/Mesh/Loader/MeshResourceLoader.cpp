@@ -39,6 +39,8 @@ PRAGMA_WARNING_PUSH
 	#include <glm/glm.hpp>
 PRAGMA_WARNING_POP
 
+#include <meshoptimizer/meshoptimizer.h>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -56,7 +58,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1Mesh::FORMAT_TYPE, v1Mesh::FORMAT_VERSION, file);
 	}
 
-	void MeshResourceLoader::onProcessing()
+	bool MeshResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -78,6 +80,7 @@ namespace Renderer
 		mMeshResource->setNumberOfVertices(meshHeader.numberOfVertices);
 		mMeshResource->setNumberOfIndices(meshHeader.numberOfIndices);
 		mMeshResource->setNumberOfLods(meshHeader.numberOfLods);
+		mMeshResource->setQuantizedPositions(meshHeader.hasQuantizedPositions);
 
 		{ // Read in the vertex buffer
 			// Allocate memory for the local vertex buffer data
@@ -89,8 +92,20 @@ namespace Renderer
 				mVertexBufferData = new uint8_t[mNumberOfVertexBufferDataBytes];
 			}
 
-			// Read in the vertex buffer
-			mMemoryFile.read(mVertexBufferData, mNumberOfUsedVertexBufferDataBytes);
+			// Read in the vertex buffer, decode it in case it's "meshoptimizer" encoded
+			if (0 != meshHeader.numberOfEncodedVertexBufferBytes)
+			{
+				const uint8_t* encodedData = readEncodedData(meshHeader.numberOfEncodedVertexBufferBytes);
+				if (0 != meshopt_decodeVertexBuffer(mVertexBufferData, meshHeader.numberOfVertices, meshHeader.numberOfBytesPerVertex, encodedData, meshHeader.numberOfEncodedVertexBufferBytes))
+				{
+					RHI_LOG(mRenderer.getContext(), CRITICAL, "The renderer failed to decode the meshoptimizer encoded vertex buffer of mesh asset \"%s\"", getAsset().virtualFilename)
+					return false;
+				}
+			}
+			else
+			{
+				mMemoryFile.read(mVertexBufferData, mNumberOfUsedVertexBufferDataBytes);
+			}
 		}
 
 		// Read in the index buffer
@@ -106,8 +121,20 @@ namespace Renderer
 				mIndexBufferData = new uint8_t[mNumberOfIndexBufferDataBytes];
 			}
 
-			// Read in the index buffer
-			mMemoryFile.read(mIndexBufferData, mNumberOfUsedIndexBufferDataBytes);
+			// Read in the index buffer, decode it in case it's "meshoptimizer" encoded
+			if (0 != meshHeader.numberOfEncodedIndexBufferBytes)
+			{
+				const uint8_t* encodedData = readEncodedData(meshHeader.numberOfEncodedIndexBufferBytes);
+				if (0 != meshopt_decodeIndexBuffer(mIndexBufferData, meshHeader.numberOfIndices, mNumberOfUsedIndexBufferDataBytes / meshHeader.numberOfIndices, encodedData, meshHeader.numberOfEncodedIndexBufferBytes))
+				{
+					RHI_LOG(mRenderer.getContext(), CRITICAL, "The renderer failed to decode the meshoptimizer encoded index buffer of mesh asset \"%s\"", getAsset().virtualFilename)
+					return false;
+				}
+			}
+			else
+			{
+				mMemoryFile.read(mIndexBufferData, mNumberOfUsedIndexBufferDataBytes);
+			}
 		}
 
 		// Read in the position-only index buffer
@@ -124,8 +151,20 @@ namespace Renderer
 					mPositionOnlyIndexBufferData = new uint8_t[mNumberOfPositionOnlyIndexBufferDataBytes];
 				}
 
-				// Read in the position-only index buffer
-				mMemoryFile.read(mPositionOnlyIndexBufferData, mNumberOfUsedPositionOnlyIndexBufferDataBytes);
+				// Read in the position-only index buffer, decode it in case it's "meshoptimizer" encoded
+				if (0 != meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes)
+				{
+					const uint8_t* encodedData = readEncodedData(meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes);
+					if (0 != meshopt_decodeIndexBuffer(mPositionOnlyIndexBufferData, meshHeader.numberOfIndices, mNumberOfUsedPositionOnlyIndexBufferDataBytes / meshHeader.numberOfIndices, encodedData, meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes))
+					{
+						RHI_LOG(mRenderer.getContext(), CRITICAL, "The renderer failed to decode the meshoptimizer encoded position-only index buffer of mesh asset \"%s\"", getAsset().virtualFilename)
+						return false;
+					}
+				}
+				else
+				{
+					mMemoryFile.read(mPositionOnlyIndexBufferData, mNumberOfUsedPositionOnlyIndexBufferDataBytes);
+				}
 			}
 		}
 		else
@@ -153,6 +192,19 @@ namespace Renderer
 		}
 		mMemoryFile.read(mSubMeshes, sizeof(v1Mesh::SubMesh) * mNumberOfUsedSubMeshes);
 
+		// Read in optional meshlets
+		mNumberOfUsedMeshlets = meshHeader.numberOfMeshlets;
+		if (mNumberOfUsedMeshlets > 0)
+		{
+			if (mNumberOfMeshlets < mNumberOfUsedMeshlets)
+			{
+				mNumberOfMeshlets = mNumberOfUsedMeshlets;
+				delete [] mMeshlets;
+				mMeshlets = new v1Mesh::Meshlet[mNumberOfMeshlets];
+			}
+			mMemoryFile.read(mMeshlets, sizeof(v1Mesh::Meshlet) * mNumberOfUsedMeshlets);
+		}
+
 		// Read in optional skeleton
 		mNumberOfBones = meshHeader.numberOfBones;
 		if (mNumberOfBones > 0)
@@ -168,6 +220,9 @@ namespace Renderer
 		{
 			createVertexArrays();
 		}
+
+		// Done
+		return true;
 	}
 
 	bool MeshResourceLoader::onDispatch()
@@ -195,9 +250,21 @@ namespace Renderer
 				subMesh.setMaterialResourceId(materialResourceId);
 				subMesh.setStartIndexLocation(v1SubMesh.startIndexLocation);
 				subMesh.setNumberOfIndices(v1SubMesh.numberOfIndices);
+				subMesh.setMeshletRange(v1SubMesh.startMeshletIndex, v1SubMesh.numberOfMeshlets);
 
-				// Sanity check
+				// Sanity checks
 				RHI_ASSERT(mRenderer.getContext(), isValid(subMesh.getMaterialResourceId()), "Invalid sub mesh material resource ID")
+				RHI_ASSERT(mRenderer.getContext(), v1SubMesh.startMeshletIndex + v1SubMesh.numberOfMeshlets <= mNumberOfUsedMeshlets, "Invalid sub mesh meshlet range")
+			}
+		}
+
+		{ // Optional meshlets, the file format meshlet layout is identical to the runtime meshlet layout
+			static_assert(sizeof(v1Mesh::Meshlet) == sizeof(Meshlet), "Meshlet file format and runtime layout mismatch");
+			Meshlets& meshlets = mMeshResource->getMeshlets();
+			meshlets.resize(mNumberOfUsedMeshlets);
+			if (mNumberOfUsedMeshlets > 0)
+			{
+				memcpy(meshlets.data(), mMeshlets, sizeof(Meshlet) * mNumberOfUsedMeshlets);
 			}
 		}
 
@@ -254,6 +321,9 @@ namespace Renderer
 		mBufferManager(renderer.getBufferManager()),
 		mVertexArray(nullptr),
 		mPositionOnlyVertexArray(nullptr),
+		// Temporary "meshoptimizer" encoded vertex or index buffer
+		mNumberOfEncodedDataBytes(0),
+		mEncodedData(nullptr),
 		// Temporary vertex buffer
 		mNumberOfVertexBufferDataBytes(0),
 		mNumberOfUsedVertexBufferDataBytes(0),
@@ -275,6 +345,10 @@ namespace Renderer
 		mNumberOfSubMeshes(0),
 		mNumberOfUsedSubMeshes(0),
 		mSubMeshes(nullptr),
+		// Optional temporary meshlets
+		mNumberOfMeshlets(0),
+		mNumberOfUsedMeshlets(0),
+		mMeshlets(nullptr),
 		// Optional temporary skeleton
 		mNumberOfBones(0),
 		mSkeletonData(nullptr)
@@ -284,14 +358,31 @@ namespace Renderer
 
 	MeshResourceLoader::~MeshResourceLoader()
 	{
+		delete [] mEncodedData;
 		delete [] mVertexBufferData;
 		delete [] mIndexBufferData;
 		delete [] mPositionOnlyIndexBufferData;
 		delete [] mVertexAttributes;
 		delete [] mSubMeshes;
+		delete [] mMeshlets;
 		delete [] mSkeletonData;	// In case the mesh resource loaded was never dispatched
 	}
 
+	const uint8_t* MeshResourceLoader::readEncodedData(uint32_t numberOfEncodedBytes)
+	{
+		// Allocate memory for the local encoded data, reused for all encoded vertex and index buffers
+		if (mNumberOfEncodedDataBytes < numberOfEncodedBytes)
+		{
+			mNumberOfEncodedDataBytes = numberOfEncodedBytes;
+			delete [] mEncodedData;
+			mEncodedData = new uint8_t[mNumberOfEncodedDataBytes];
+		}
+
+		// Read in the encoded data
+		mMemoryFile.read(mEncodedData, numberOfEncodedBytes);
+		return mEncodedData;
+	}
+
 	void MeshResourceLoader::createVertexArrays()
 	{
 		// Create the vertex buffer object (VBO)
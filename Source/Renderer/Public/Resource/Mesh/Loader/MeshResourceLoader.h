@@ -45,6 +45,7 @@ namespace Renderer
 	namespace v1Mesh
 	{
 		struct SubMesh;
+		struct Meshlet;
 	}
 }
 
@@ -103,7 +104,7 @@ namespace Renderer
 			return true;
 		}
 
-		virtual void onProcessing() override;
+		[[nodiscard]] virtual bool onProcessing() override;
 		[[nodiscard]] virtual bool onDispatch() override;
 
 
@@ -115,6 +116,7 @@ namespace Renderer
 		virtual ~MeshResourceLoader() override;
 		explicit MeshResourceLoader(const MeshResourceLoader&) = delete;
 		MeshResourceLoader& operator=(const MeshResourceLoader&) = delete;
+		[[nodiscard]] const uint8_t* readEncodedData(uint32_t numberOfEncodedBytes);
 		void createVertexArrays();
 
 
@@ -129,6 +131,10 @@ namespace Renderer
 		Rhi::IVertexArray* mPositionOnlyVertexArray;
 		MemoryFile		   mMemoryFile;
 
+		// Temporary "meshoptimizer" encoded vertex or index buffer, decoded during processing
+		uint32_t mNumberOfEncodedDataBytes;
+		uint8_t* mEncodedData;
+
 		// Temporary vertex buffer
 		uint32_t mNumberOfVertexBufferDataBytes;
 		uint32_t mNumberOfUsedVertexBufferDataBytes;
@@ -155,6 +161,11 @@ namespace Renderer
 		uint32_t		 mNumberOfUsedSubMeshes;
 		v1Mesh::SubMesh* mSubMeshes;
 
+		// Optional temporary meshlets
+		uint32_t		 mNumberOfMeshlets;
+		uint32_t		 mNumberOfUsedMeshlets;
+		v1Mesh::Meshlet* mMeshlets;
+
 		// Optional temporary skeleton
 		uint8_t  mNumberOfBones;
 		uint8_t* mSkeletonData;
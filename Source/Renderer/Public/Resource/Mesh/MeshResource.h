@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/IResource.h"
 #include "Renderer/Public/Resource/Mesh/SubMesh.h"
+#include "Renderer/Public/Resource/Mesh/Meshlet.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -71,6 +72,7 @@ namespace Renderer
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
 	typedef std::vector<SubMesh> SubMeshes;
+	typedef std::vector<Meshlet> Meshlets;
 	typedef uint32_t			 MeshResourceId;		///< POD mesh resource identifier
 	typedef uint32_t			 SkeletonResourceId;	///< POD skeleton resource identifier
 
@@ -179,6 +181,16 @@ namespace Renderer
 			mPositionOnlyVertexArray = positionOnlyVertexArray;
 		}
 
+		[[nodiscard]] inline bool hasQuantizedPositions() const
+		{
+			return mQuantizedPositions;
+		}
+
+		inline void setQuantizedPositions(bool quantizedPositions)
+		{
+			mQuantizedPositions = quantizedPositions;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Sub-meshes and LODs                                   ]
 		//[-------------------------------------------------------]
@@ -202,6 +214,19 @@ namespace Renderer
 			mNumberOfLods = numberOfLods;
 		}
 
+		//[-------------------------------------------------------]
+		//[ Optional meshlets                                     ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline const Meshlets& getMeshlets() const
+		{
+			return mMeshlets;
+		}
+
+		[[nodiscard]] inline Meshlets& getMeshlets()
+		{
+			return mMeshlets;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Optional skeleton                                     ]
 		//[-------------------------------------------------------]
@@ -229,6 +254,7 @@ namespace Renderer
 			// Vertex and index data
 			mNumberOfVertices(0),
 			mNumberOfIndices(0),
+			mQuantizedPositions(false),
 			// Sub-meshes and LODs
 			mNumberOfLods(0),
 			// Optional skeleton
@@ -249,6 +275,7 @@ namespace Renderer
 			ASSERT(nullptr == mVertexArray.getPointer(), "Invalid vertex array")
 			ASSERT(nullptr == mPositionOnlyVertexArray.getPointer(), "Invalid position only vertex array")
 			ASSERT(mSubMeshes.empty(), "Invalid sub-meshes")
+			ASSERT(mMeshlets.empty(), "Invalid meshlets")
 			ASSERT(isInvalid(mSkeletonResourceId), "Invalid skeleton resource ID")
 		}
 
@@ -270,6 +297,7 @@ namespace Renderer
 			ASSERT(nullptr == mVertexArray.getPointer(), "Invalid vertex array")
 			ASSERT(nullptr == mPositionOnlyVertexArray.getPointer(), "Invalid position only vertex array")
 			ASSERT(mSubMeshes.empty(), "Invalid sub-meshes")
+			ASSERT(mMeshlets.empty(), "Invalid meshlets")
 			ASSERT(isInvalid(mSkeletonResourceId), "Invalid skeleton resource ID")
 
 			// Call base implementation
@@ -293,8 +321,10 @@ namespace Renderer
 			mNumberOfIndices = 0;
 			mVertexArray = nullptr;
 			mPositionOnlyVertexArray = nullptr;
+			mQuantizedPositions = false;
 			mSubMeshes.clear();
 			mNumberOfIndices = 0;
+			mMeshlets.clear();
 			setInvalid(mSkeletonResourceId);
 
 			// Call base implementation
@@ -316,9 +346,12 @@ namespace Renderer
 		uint32_t			 mNumberOfIndices;			///< Number of indices
 		Rhi::IVertexArrayPtr mVertexArray;				///< Vertex array object (VAO), can be a null pointer, directly containing also the index data of all LODs
 		Rhi::IVertexArrayPtr mPositionOnlyVertexArray;	///< Optional position-only vertex array object (VAO) which can reduce the number of processed vertices up to half, can be a null pointer, can be used for position-only rendering (e.g. shadow map rendering) using the same vertex data that the original vertex array object (VAO) uses, directly containing also the index data of all LODs
+		bool				 mQuantizedPositions;		///< If "true", the vertex positions are unsigned normalized 16-bit relative to the bounding box and need to be dequantized via "position = minimumBoundingBoxPosition + quantizedPosition * (maximumBoundingBoxPosition - minimumBoundingBoxPosition)", the mesh scene item folds this into the instance transform
 		// Sub-meshes and LODs
 		SubMeshes			 mSubMeshes;			///< Sub-meshes, directly containing also the sub-meshes of all LODs, each LOD has the same number of sub-meshes
 		uint8_t				 mNumberOfLods;			///< Number of LODs, there's always at least one LOD, namely the original none reduced version
+		// Optional meshlets
+		Meshlets			 mMeshlets;				///< Meshlets (aka clusters) for fine-grained culling, can be empty, each sub-mesh references its own meshlet range
 		// Optional skeleton
 		SkeletonResourceId	 mSkeletonResourceId;	///< Resource ID of the used skeleton, can be invalid
 
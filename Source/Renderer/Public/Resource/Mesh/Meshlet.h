@@ -0,0 +1,93 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(5214)	// warning C5214: applying '*=' to an operand with a volatile qualified type is deprecated in C++20 (compiling source file E:\private\unrimp\Source\RendererToolkit\Private\AssetCompiler\TextureAssetCompiler.cpp)
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Meshlet (aka cluster) culling data
+	*
+	*  @remarks
+	*    A meshlet is a small group of triangles (by default up to 64 vertices and 124 triangles) which is stored as a continuous range inside the
+	*    mesh index buffer. Each sub-mesh of each LOD references its own meshlet range, meaning the sub-mesh can be rendered either as a whole or
+	*    meshlet by meshlet after culling them individually. Keep this in sync with "Renderer::v1Mesh::Meshlet".
+	*/
+	struct Meshlet final
+	{
+		uint32_t  startIndexLocation;	///< Start index location inside the mesh index buffer
+		uint32_t  numberOfIndices;		///< Number of indices, three indices per triangle
+		// Bounding sphere, useful for frustum and occlusion culling
+		glm::vec3 boundingSpherePosition;	///< Object space bounding sphere position
+		float	  boundingSphereRadius;		///< Object space bounding sphere radius
+		// Normal cone, useful for backface culling
+		glm::vec3 coneApex;		///< Object space normal cone apex
+		glm::vec3 coneAxis;		///< Normalized object space normal cone axis
+		float	  coneCutoff;	///< Cosine of half the normal cone angle, 1 or above means the meshlet can't be backface culled
+
+		/**
+		*  @brief
+		*    Return whether or not all triangles of the meshlet are facing away from the given camera position
+		*
+		*  @param[in] objectSpaceCameraPosition
+		*    Camera position in the object space of the mesh
+		*
+		*  @return
+		*    "true" if the whole meshlet is back-facing and can be culled, else "false"
+		*/
+		[[nodiscard]] inline bool isBackFacing(const glm::vec3& objectSpaceCameraPosition) const
+		{
+			// See "meshoptimizer" documentation of "meshopt_computeMeshletBounds()"
+			return (glm::dot(glm::normalize(coneApex - objectSpaceCameraPosition), coneAxis) >= coneCutoff);
+		}
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -61,7 +61,9 @@ namespace Renderer
 		inline SubMesh() :
 			mMaterialResourceId(getInvalid<MaterialResourceId>()),
 			mStartIndexLocation(0),
-			mNumberOfIndices(0)
+			mNumberOfIndices(0),
+			mStartMeshletIndex(0),
+			mNumberOfMeshlets(0)
 		{
 			// Nothing here
 		}
@@ -69,7 +71,9 @@ namespace Renderer
 		inline SubMesh(MaterialResourceId materialResourceId, uint32_t startIndexLocation, uint32_t numberOfIndices) :
 			mMaterialResourceId(materialResourceId),
 			mStartIndexLocation(startIndexLocation),
-			mNumberOfIndices(numberOfIndices)
+			mNumberOfIndices(numberOfIndices),
+			mStartMeshletIndex(0),
+			mNumberOfMeshlets(0)
 		{
 			// Nothing here
 		}
@@ -77,7 +81,9 @@ namespace Renderer
 		inline explicit SubMesh(const SubMesh& subMesh) :
 			mMaterialResourceId(subMesh.mMaterialResourceId),
 			mStartIndexLocation(subMesh.mStartIndexLocation),
-			mNumberOfIndices(subMesh.mNumberOfIndices)
+			mNumberOfIndices(subMesh.mNumberOfIndices),
+			mStartMeshletIndex(subMesh.mStartMeshletIndex),
+			mNumberOfMeshlets(subMesh.mNumberOfMeshlets)
 		{
 			// Nothing here
 		}
@@ -92,6 +98,8 @@ namespace Renderer
 			mMaterialResourceId	= subMesh.mMaterialResourceId;
 			mStartIndexLocation = subMesh.mStartIndexLocation;
 			mNumberOfIndices	= subMesh.mNumberOfIndices;
+			mStartMeshletIndex	= subMesh.mStartMeshletIndex;
+			mNumberOfMeshlets	= subMesh.mNumberOfMeshlets;
 
 			// Done
 			return *this;
@@ -127,6 +135,22 @@ namespace Renderer
 			mNumberOfIndices = numberOfIndices;
 		}
 
+		[[nodiscard]] inline uint32_t getStartMeshletIndex() const
+		{
+			return mStartMeshletIndex;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfMeshlets() const
+		{
+			return mNumberOfMeshlets;
+		}
+
+		inline void setMeshletRange(uint32_t startMeshletIndex, uint32_t numberOfMeshlets)
+		{
+			mStartMeshletIndex = startMeshletIndex;
+			mNumberOfMeshlets = numberOfMeshlets;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -135,6 +159,8 @@ namespace Renderer
 		MaterialResourceId mMaterialResourceId;	///< Material resource ID, can be set to invalid value
 		uint32_t		   mStartIndexLocation;
 		uint32_t		   mNumberOfIndices;
+		uint32_t		   mStartMeshletIndex;	///< Index of the first meshlet inside "Renderer::MeshResource::getMeshlets()", only valid if there are meshlets
+		uint32_t		   mNumberOfMeshlets;	///< Number of meshlets, zero if the mesh has no meshlets
 
 
 	};
@@ -330,7 +330,11 @@ namespace Renderer
 				processingMutexLock.unlock();
 
 				// Do the work
-				loadRequest.resourceLoader->onProcessing();
+				if (!loadRequest.resourceLoader->onProcessing())
+				{
+					// Resource streamer stage: 3. Synchronous dispatch to finish off the failed loading attempt
+					loadRequest.loadingFailed = true;
+				}
 
 				{ // Push the load request into the queue of the next resource streamer pipeline stage
 				  // -> Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
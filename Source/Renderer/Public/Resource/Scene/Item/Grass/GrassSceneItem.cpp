@@ -18,14 +18,111 @@
 \*********************************************************/
 
 
+
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/Grass/GrassSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Loader/SceneFileFormat.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/Material/MaterialResource.h"
+#include "Renderer/Public/Core/Math/Frustum.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'uint32_t' to 'int32_t', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <algorithm>
+	#include <cstring>	// For "memcpy()"
+	#include <limits>
+	#include <cmath>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t GRASS_LOD_PARAMETERS_PROPERTY_ID		   = STRING_ID("GrassLodParameters");	///< x = LOD distance, y = maximum distance, z = minimum density factor, w = fade distance
+		static constexpr uint32_t NUMBER_OF_VERTICES_PER_GRASS			   = 12;	///< Two crossed quads
+		static constexpr uint32_t NUMBER_OF_VERTICES_PER_SINGLE_QUAD_GRASS = 6;		///< One quad, used for distant grass
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		// PCG hash (see "Hash Functions for GPU Rendering" - http://www.jcgt.org/published/0009/03/02/ ), deterministic so the same scene always results in the same grass
+		[[nodiscard]] uint32_t grassHash(uint32_t value)
+		{
+			const uint32_t state = value * 747796405u + 2891336453u;
+			const uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+			return (word >> 22u) ^ word;
+		}
+
+		[[nodiscard]] float grassRandom01(uint32_t& seed)
+		{
+			seed = grassHash(seed);
+			return static_cast<float>(seed & 0x00FFFFFFu) * (1.0f / 16777216.0f);
+		}
+
+		template <typename TYPE>
+		[[nodiscard]] float sampleGrassMapBilinear(const std::vector<TYPE>& map, uint32_t width, uint32_t height, float u, float v)
+		{
+			// Texel centers, clamp to edge
+			const float x = std::clamp(u * static_cast<float>(width) - 0.5f, 0.0f, static_cast<float>(width - 1));
+			const float y = std::clamp(v * static_cast<float>(height) - 0.5f, 0.0f, static_cast<float>(height - 1));
+			const uint32_t x0 = static_cast<uint32_t>(x);
+			const uint32_t y0 = static_cast<uint32_t>(y);
+			const uint32_t x1 = std::min(x0 + 1, width - 1);
+			const uint32_t y1 = std::min(y0 + 1, height - 1);
+			const float fractionX = x - static_cast<float>(x0);
+			const float fractionY = y - static_cast<float>(y0);
+			const float top = glm::mix(static_cast<float>(map[y0 * width + x0]), static_cast<float>(map[y0 * width + x1]), fractionX);
+			const float bottom = glm::mix(static_cast<float>(map[y1 * width + x0]), static_cast<float>(map[y1 * width + x1]), fractionX);
+			return glm::mix(top, bottom, fractionY);
+		}
+
+		[[nodiscard]] bool isBoxInsideFrustum(const Renderer::Frustum& frustum, const glm::vec3& minimumPosition, const glm::vec3& maximumPosition)
+		{
+			// Positive vertex test: The box is outside if the box corner furthest along the plane normal is behind a plane
+			for (const Renderer::Plane& plane : frustum.planes)
+			{
+				const glm::vec3 positiveVertex((plane.normal.x >= 0.0f) ? maximumPosition.x : minimumPosition.x,
+											   (plane.normal.y >= 0.0f) ? maximumPosition.y : minimumPosition.y,
+											   (plane.normal.z >= 0.0f) ? maximumPosition.z : minimumPosition.z);
+				if (glm::dot(plane.normal, positiveVertex) + plane.d < 0.0f)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -37,6 +134,66 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ISceneItem methods           ]
 	//[-------------------------------------------------------]
+	void GrassSceneItem::deserialize(uint32_t numberOfBytes, const uint8_t* data)
+	{
+		// Sanity check
+		RHI_ASSERT(getContext(), sizeof(v1Scene::GrassItem) <= numberOfBytes, "Invalid number of bytes")
+		const v1Scene::GrassItem* grassItem = reinterpret_cast<const v1Scene::GrassItem*>(data);
+
+		// Read data
+		mGrassProperties.extents			  = glm::vec2(grassItem->extents[0], grassItem->extents[1]);
+		mGrassProperties.chunkSize			  = grassItem->chunkSize;
+		mGrassProperties.density			  = grassItem->density;
+		mGrassProperties.minimumSize		  = grassItem->minimumSize;
+		mGrassProperties.maximumSize		  = grassItem->maximumSize;
+		mGrassProperties.color				  = glm::vec3(grassItem->color[0], grassItem->color[1], grassItem->color[2]);
+		mGrassProperties.colorVariation		  = grassItem->colorVariation;
+		mGrassProperties.lodDistance		  = grassItem->lodDistance;
+		mGrassProperties.maximumDistance	  = grassItem->maximumDistance;
+		mGrassProperties.minimumDensityFactor = grassItem->minimumDensityFactor;
+		mGrassProperties.fadeDistance		  = grassItem->fadeDistance;
+		mGrassProperties.singleQuadDistance	  = grassItem->singleQuadDistance;
+		mGrassProperties.heightRange		  = glm::vec2(grassItem->heightRange[0], grassItem->heightRange[1]);
+		mGrassProperties.randomSeed			  = grassItem->randomSeed;
+		mDensityMapWidth  = grassItem->densityMapWidth;
+		mDensityMapHeight = grassItem->densityMapHeight;
+		mHeightMapWidth	  = grassItem->heightMapWidth;
+		mHeightMapHeight  = grassItem->heightMapHeight;
+		uint32_t numberOfReadBytes = sizeof(v1Scene::GrassItem);
+
+		// Read the optional density and height map
+		{
+			const uint32_t numberOfDensityMapTexels = mDensityMapWidth * mDensityMapHeight;
+			RHI_ASSERT(getContext(), numberOfReadBytes + numberOfDensityMapTexels <= numberOfBytes, "Invalid number of bytes")
+			mDensityMap.resize(numberOfDensityMapTexels);
+			if (numberOfDensityMapTexels > 0)
+			{
+				memcpy(mDensityMap.data(), data + numberOfReadBytes, numberOfDensityMapTexels);
+				numberOfReadBytes += numberOfDensityMapTexels;
+			}
+		}
+		{
+			const uint32_t numberOfHeightMapTexels = mHeightMapWidth * mHeightMapHeight;
+			RHI_ASSERT(getContext(), numberOfReadBytes + sizeof(uint16_t) * numberOfHeightMapTexels <= numberOfBytes, "Invalid number of bytes")
+			mHeightMap.resize(numberOfHeightMapTexels);
+			if (numberOfHeightMapTexels > 0)
+			{
+				memcpy(mHeightMap.data(), data + numberOfReadBytes, sizeof(uint16_t) * numberOfHeightMapTexels);
+				numberOfReadBytes += static_cast<uint32_t>(sizeof(uint16_t)) * numberOfHeightMapTexels;
+			}
+		}
+
+		// Sanity checks
+		RHI_ASSERT(getContext(), mGrassProperties.extents.x > 0.0f && mGrassProperties.extents.y > 0.0f, "Invalid grass extents")
+		RHI_ASSERT(getContext(), mGrassProperties.chunkSize > 0.0f, "Invalid grass chunk size")
+		RHI_ASSERT(getContext(), mGrassProperties.density >= 0.0f, "Invalid grass density")
+		RHI_ASSERT(getContext(), mGrassProperties.minimumSize > 0.0f && mGrassProperties.minimumSize <= mGrassProperties.maximumSize, "Invalid grass size")
+		RHI_ASSERT(getContext(), mGrassProperties.lodDistance <= mGrassProperties.maximumDistance, "Invalid grass LOD distance")
+
+		// Call base implementation
+		MaterialSceneItem::deserialize(numberOfBytes - numberOfReadBytes, data + numberOfReadBytes);
+	}
+
 	const RenderableManager* GrassSceneItem::getRenderableManager() const
 	{
 		// Sanity checks
@@ -51,9 +208,57 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
-	void GrassSceneItem::onExecuteOnRendering([[maybe_unused]] const Rhi::IRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
+	void GrassSceneItem::onExecuteOnRendering(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
 	{
-		// TODO(co) Implement me
+		// Sanity check: There's one renderable per chunk
+		// -> The renderables are cleared and recreated when the material resource changes, nothing to do in between
+		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
+		if (renderables.size() != mChunks.size())
+		{
+			return;
+		}
+
+		// Culling is done for each compositor workspace instance rendering the grass since each one might use a different camera
+		// -> Camera relative object space, only grass translation is supported
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		RHI_ASSERT(getContext(), nullptr != cameraSceneItem, "Invalid camera")
+		const glm::vec3 objectSpaceToCameraRelativeOffset = glm::vec3(mRenderableManager.getTransform().position - compositorContextData.getWorldSpaceCameraPosition());
+		uint32_t renderTargetWidth = 0;
+		uint32_t renderTargetHeight = 0;
+		renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+		const Frustum frustum(cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight)) * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+
+		// TODO(co) Single pass stereo rendering: Frustum culling is skipped, see "Renderer::SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers()"
+		const bool frustumCulling = !compositorContextData.getSinglePassStereoInstancing();
+
+		// Chunk LOD: Distance based grass density, the blades of a chunk are ordered by their LOD threshold so drawing less blades just drops a prefix
+		const GrassProperties& grassProperties = mGrassProperties;
+		const float lodRange = std::max(grassProperties.maximumDistance - grassProperties.lodDistance, 0.0001f);
+		mNumberOfVisibleGrass = 0;
+		const uint32_t numberOfChunks = static_cast<uint32_t>(mChunks.size());
+		for (uint32_t chunkIndex = 0; chunkIndex < numberOfChunks; ++chunkIndex)
+		{
+			const Chunk& chunk = mChunks[chunkIndex];
+			Renderable& renderable = renderables[chunkIndex];
+			const glm::vec3 minimumPosition = chunk.minimumPosition + objectSpaceToCameraRelativeOffset;
+			const glm::vec3 maximumPosition = chunk.maximumPosition + objectSpaceToCameraRelativeOffset;
+
+			// Distance from the camera to the nearest point of the chunk bounding box
+			const float distance = glm::length(glm::clamp(glm::vec3(0.0f), minimumPosition, maximumPosition));
+			if (distance < grassProperties.maximumDistance && (!frustumCulling || ::detail::isBoxInsideFrustum(frustum, minimumPosition, maximumPosition)))
+			{
+				const float densityFactor = 1.0f - (1.0f - grassProperties.minimumDensityFactor) * glm::clamp((distance - grassProperties.lodDistance) / lodRange, 0.0f, 1.0f);
+				const uint32_t numberOfGrass = std::min(chunk.numberOfGrass, static_cast<uint32_t>(std::ceil(densityFactor * static_cast<float>(chunk.numberOfGrass))));
+				renderable.setNumberOfIndices((distance < grassProperties.singleQuadDistance) ? ::detail::NUMBER_OF_VERTICES_PER_GRASS : ::detail::NUMBER_OF_VERTICES_PER_SINGLE_QUAD_GRASS);
+				renderable.setInstanceCount(numberOfGrass);
+				mNumberOfVisibleGrass += numberOfGrass;
+			}
+			else
+			{
+				// Culled, a renderable without indices results in no draw call
+				renderable.setNumberOfIndices(0);
+			}
+		}
 	}
 
 
@@ -62,8 +267,33 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	void GrassSceneItem::initialize()
 	{
+		// Generate the grass and create the RHI resources, if not already done
+		if (mMaximumNumberOfGrass > 0 && nullptr == mStructuredBufferPtr)
+		{
+			const IRenderer& renderer = getSceneResource().getRenderer();
+			mMaximumNumberOfGrass = std::min(mMaximumNumberOfGrass, renderer.getRhi().getCapabilities().maximumStructuredBufferSize / static_cast<uint32_t>(sizeof(GrassDataStruct)));
+
+			// Generate the grass, the density and height map are no longer needed afterwards
+			std::vector<GrassDataStruct> grassData;
+			generateGrass(grassData);
+			mNumberOfGrass = static_cast<uint32_t>(grassData.size());
+			std::vector<uint8_t>().swap(mDensityMap);
+			std::vector<uint16_t>().swap(mHeightMap);
+
+			// Create the structured buffer
+			if (mNumberOfGrass > 0)
+			{
+				mStructuredBufferPtr = renderer.getBufferManager().createStructuredBuffer(sizeof(GrassDataStruct) * mNumberOfGrass, grassData.data(), Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
+			}
+			else
+			{
+				// Nothing to draw, don't try again
+				mMaximumNumberOfGrass = 0;
+			}
+		}
+
 		// Call the base implementation
-		if (mMaximumNumberOfGrass > 0)
+		if (nullptr != mStructuredBufferPtr)
 		{
 			MaterialSceneItem::initialize();
 		}
@@ -71,22 +301,31 @@ namespace Renderer
 
 	void GrassSceneItem::onMaterialResourceCreated()
 	{
-		// Setup renderable manager
+		// Setup renderable manager: One renderable per chunk, twelve vertices (two quads) per grass blade, grass blade index = vertex ID / 12 + instance ID
+		// -> The number of vertices and instances is updated by "Renderer::GrassSceneItem::onExecuteOnRendering()"
 		#ifdef RHI_DEBUG
 			const char* debugName = "Grass";
 			mRenderableManager.setDebugName(debugName);
 		#endif
 		const IRenderer& renderer = getSceneResource().getRenderer();
-		const MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
+		MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
 		const MaterialResourceId materialResourceId = getMaterialResourceId();
-		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, getInvalid<SkeletonResourceId>(), false, mIndirectBufferPtr, 0, 1 RHI_RESOURCE_DEBUG_NAME(debugName));
+		const Rhi::IVertexArrayPtr& drawIdVertexArrayPtr = renderer.getMeshResourceManager().getDrawIdVertexArrayPtr();
+		RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
+		renderables.reserve(mChunks.size());
+		for (const Chunk& chunk : mChunks)
+		{
+			renderables.emplace_back(mRenderableManager, drawIdVertexArrayPtr, materialResourceManager, materialResourceId, getInvalid<SkeletonResourceId>(), false, chunk.firstGrass * ::detail::NUMBER_OF_VERTICES_PER_GRASS, ::detail::NUMBER_OF_VERTICES_PER_GRASS, chunk.numberOfGrass RHI_RESOURCE_DEBUG_NAME(debugName));
+		}
 		mRenderableManager.updateCachedRenderablesData();
 
-		// Tell the used material resource about our structured buffer
-		for (MaterialTechnique* materialTechnique : materialResourceManager.getById(materialResourceId).getSortedMaterialTechniqueVector())
+		// Tell the used material resource about our structured buffer and the LOD parameters used for fading
+		MaterialResource& materialResource = materialResourceManager.getById(materialResourceId);
+		for (MaterialTechnique* materialTechnique : materialResource.getSortedMaterialTechniqueVector())
 		{
 			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
 		}
+		materialResource.setPropertyById(::detail::GRASS_LOD_PARAMETERS_PROPERTY_ID, MaterialPropertyValue::fromFloat4(mGrassProperties.lodDistance, mGrassProperties.maximumDistance, mGrassProperties.minimumDensityFactor, mGrassProperties.fadeDistance), MaterialProperty::Usage::SHADER_UNIFORM);
 
 		// We need "Renderer::ISceneItem::onExecuteOnRendering()" calls during runtime
 		setCallExecuteOnRendering(true);
@@ -94,54 +333,107 @@ namespace Renderer
 
 
 	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	GrassSceneItem::GrassSceneItem(SceneResource& sceneResource) :
 		MaterialSceneItem(sceneResource, false),	// TODO(co) Set bounding box
-		mMaximumNumberOfGrass(3)	// TODO(co) Make this dynamic
+		mMaximumNumberOfGrass(MAXIMUM_NUMBER_OF_GRASS),
+		mDensityMapWidth(0),
+		mDensityMapHeight(0),
+		mHeightMapWidth(0),
+		mHeightMapHeight(0),
+		mNumberOfGrass(0),
+		mNumberOfVisibleGrass(0)
 	{
 		// The RHI implementation must support structured buffers
 		const IRenderer& renderer = getSceneResource().getRenderer();
-		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize > 0)
+		if (0 == renderer.getRhi().getCapabilities().maximumStructuredBufferSize)
 		{
-			// Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			// TODO(co) Make this dynamic
-			const GrassDataStruct grassData[3] =
+			mMaximumNumberOfGrass = 0;
+			RHI_LOG_ONCE(renderer.getContext(), COMPATIBILITY_WARNING, "The renderer grass scene item needs a RHI implementation with structured buffer support")
+		}
+	}
+
+	float GrassSceneItem::getDensity(float u, float v) const
+	{
+		// Without density map the grass is uniformly distributed
+		return mDensityMap.empty() ? 1.0f : ::detail::sampleGrassMapBilinear(mDensityMap, mDensityMapWidth, mDensityMapHeight, u, v) * (1.0f / 255.0f);
+	}
+
+	float GrassSceneItem::getHeight(float u, float v) const
+	{
+		// Without height map the grass is placed on a plane
+		const glm::vec2& heightRange = mGrassProperties.heightRange;
+		return mHeightMap.empty() ? heightRange.x : glm::mix(heightRange.x, heightRange.y, ::detail::sampleGrassMapBilinear(mHeightMap, mHeightMapWidth, mHeightMapHeight, u, v) * (1.0f / 65535.0f));
+	}
+
+	void GrassSceneItem::generateGrass(std::vector<GrassDataStruct>& grassData)
+	{
+		const GrassProperties& grassProperties = mGrassProperties;
+		const glm::vec2 size = grassProperties.extents * 2.0f;
+		const uint32_t numberOfChunksX = std::max(1u, static_cast<uint32_t>(std::ceil(size.x / grassProperties.chunkSize)));
+		const uint32_t numberOfChunksZ = std::max(1u, static_cast<uint32_t>(std::ceil(size.y / grassProperties.chunkSize)));
+		grassData.reserve(static_cast<size_t>(std::min(size.x * size.y * grassProperties.density, static_cast<float>(mMaximumNumberOfGrass))));
+		mChunks.clear();
+
+		// Generate the grass chunk by chunk, the random sequence of each chunk only depends on the random seed and the chunk index
+		for (uint32_t chunkZ = 0; chunkZ < numberOfChunksZ; ++chunkZ)
+		{
+			for (uint32_t chunkX = 0; chunkX < numberOfChunksX; ++chunkX)
 			{
+				const uint32_t chunkIndex = chunkZ * numberOfChunksX + chunkX;
+				uint32_t seed = ::detail::grassHash(grassProperties.randomSeed ^ ::detail::grassHash(chunkIndex));
+
+				// Object space chunk area, border chunks might be smaller
+				const float minimumX = -grassProperties.extents.x + static_cast<float>(chunkX) * grassProperties.chunkSize;
+				const float minimumZ = -grassProperties.extents.y + static_cast<float>(chunkZ) * grassProperties.chunkSize;
+				const float maximumX = std::min(minimumX + grassProperties.chunkSize, grassProperties.extents.x);
+				const float maximumZ = std::min(minimumZ + grassProperties.chunkSize, grassProperties.extents.y);
+
+				// Rejection sampling by using the density map, the number of candidates is stochastically rounded to not lose grass inside small chunks
+				const float numberOfCandidates = (maximumX - minimumX) * (maximumZ - minimumZ) * grassProperties.density;
+				const uint32_t numberOfGrassCandidates = static_cast<uint32_t>(numberOfCandidates + ::detail::grassRandom01(seed));
+				const uint32_t firstGrass = static_cast<uint32_t>(grassData.size());
+				float minimumY = std::numeric_limits<float>::max();
+				float maximumY = std::numeric_limits<float>::lowest();
+				for (uint32_t candidate = 0; candidate < numberOfGrassCandidates && grassData.size() < mMaximumNumberOfGrass; ++candidate)
 				{
-					{ 3.0f, -1.781f, 20.0f, 0.5f },
-					{ 1.0f,  1.0f,   1.0f, 0.4f }
-				},
-				{
-					{ 5.0f, -1.781f, 19.0f, 1.0f },
-					{ 1.0f,  1.0f,   1.0f, 0.8f }
-				},
+					const float x = glm::mix(minimumX, maximumX, ::detail::grassRandom01(seed));
+					const float z = glm::mix(minimumZ, maximumZ, ::detail::grassRandom01(seed));
+					const float u = (x + grassProperties.extents.x) / size.x;
+					const float v = (z + grassProperties.extents.y) / size.y;
+					if (::detail::grassRandom01(seed) < getDensity(u, v))
+					{
+						const float y = getHeight(u, v);
+						const float grassSize = glm::mix(grassProperties.minimumSize, grassProperties.maximumSize, ::detail::grassRandom01(seed));
+						const glm::vec3 color = grassProperties.color * (1.0f - grassProperties.colorVariation * ::detail::grassRandom01(seed));
+						const float rotation = ::detail::grassRandom01(seed) * glm::two_pi<float>();
+						grassData.push_back({ { x, y, z, grassSize }, { color.r, color.g, color.b, rotation }, { 0.0f, 0.0f, 0.0f, 0.0f } });
+						minimumY = std::min(minimumY, y);
+						maximumY = std::max(maximumY, y + grassSize);
+					}
+				}
+				const uint32_t numberOfGrass = static_cast<uint32_t>(grassData.size()) - firstGrass;
+				if (0 == numberOfGrass)
 				{
-					{ 4.0f, -1.781f, 21.0f, 1.5f },
-					{ 1.0f,  1.0f,   1.0f, 1.2f }
+					// Chunks without grass don't need a renderable
+					continue;
 				}
-			};
-			Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
 
-			// Create the structured buffer
-			mStructuredBufferPtr = bufferManager.createStructuredBuffer(sizeof(GrassDataStruct) * mMaximumNumberOfGrass, grassData, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
-
-			{ // Create the indirect buffer: Twelve vertices per grass (two quads), grass index = instance index
-				const Rhi::DrawArguments drawArguments =
+				// Stratified LOD thresholds in ascending order: The grass blades are placed in random order, so every prefix of the chunk grass blades is spatially uniform distributed
+				for (uint32_t i = 0; i < numberOfGrass; ++i)
 				{
-					12,						// vertexCountPerInstance (uint32_t)
-					mMaximumNumberOfGrass,	// instanceCount (uint32_t)
-					0,						// startVertexLocation (uint32_t)
-					0						// startInstanceLocation (uint32_t)
-				};
-				mIndirectBufferPtr = bufferManager.createIndirectBuffer(sizeof(Rhi::DrawArguments), &drawArguments, Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::DRAW_ARGUMENTS, Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("Grass"));
+					grassData[firstGrass + i].LodThreshold[0] = (static_cast<float>(i) + ::detail::grassRandom01(seed)) / static_cast<float>(numberOfGrass);
+				}
+
+				// The grass blade quads reach up to the grass blade size into each horizontal direction
+				const float maximumSize = grassProperties.maximumSize;
+				mChunks.push_back({ glm::vec3(minimumX - maximumSize, minimumY, minimumZ - maximumSize), glm::vec3(maximumX + maximumSize, maximumY, maximumZ + maximumSize), firstGrass, numberOfGrass });
 			}
 		}
-		else
+		if (grassData.size() >= mMaximumNumberOfGrass)
 		{
-			mMaximumNumberOfGrass = 0;
-			RHI_LOG_ONCE(renderer.getContext(), COMPATIBILITY_WARNING, "The renderer grass scene item needs a RHI implementation with structured buffer support")
+			RHI_LOG(getContext(), COMPATIBILITY_WARNING, "The grass scene item reached the maximum number of %u grass blades, reduce the grass density or extents", mMaximumNumberOfGrass)
 		}
 	}
 
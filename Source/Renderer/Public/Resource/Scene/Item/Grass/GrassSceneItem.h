@@ -29,6 +29,18 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/MaterialSceneItem.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Generic_error_category': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Generic_error_category': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -44,8 +56,42 @@ namespace Renderer
 	*  @brief
 	*    Grass scene item
 	*
-	*  @todo
-	*    - TODO(co) Work-in-progress
+	*  @remarks
+	*    Data-driven grass placement: The object space xz-area defined by the extents is split into chunks. During initialization the
+	*    grass blades of each chunk are generated on the CPU, optionally driven by a density map and placed on top of a height map, both
+	*    baked into the scene asset by the renderer toolkit. All grass blades are stored inside a single static structured buffer, chunk
+	*    by chunk. Inside a chunk, the grass blades are ordered by their LOD threshold so a LOD is just a prefix of the chunk grass blades.
+	*
+	*    Each frame the chunks are frustum and distance culled and the number of grass blades to draw is chosen by the distance based
+	*    density factor. There's one renderable per chunk which draws twelve vertices (two quads) or six vertices (one quad) per instance,
+	*    grass blade index = vertex ID / 12 + instance ID. The draw arguments are written by the render queue into the indirect buffer
+	*    provided by "Renderer::IndirectBufferManager" so all visible chunks end up inside a single multi-draw-indirect call. Inside the
+	*    vertex shader, grass blades fade out before they're dropped by the LOD or the maximum distance, this avoids popping.
+	*
+	*    Scene JSON example:
+	*    "GrassSceneItem":
+	*    {
+	*        "Material": "Example/Blueprint/Grass/M_Grass",
+	*        "Extents": "256.0 256.0",
+	*        "ChunkSize": "16.0",
+	*        "Density": "50.0",
+	*        "Size": "0.3 0.8",
+	*        "Color": "0.6 0.8 0.4",
+	*        "ColorVariation": "0.2",
+	*        "LodDistance": "20.0",
+	*        "MaximumDistance": "150.0",
+	*        "MinimumDensityFactor": "0.05",
+	*        "FadeDistance": "10.0",
+	*        "SingleQuadDistance": "60.0",
+	*        "DensityMap": "T_GrassDensityMap.png",
+	*        "HeightMap": "T_GrassHeightMap.png",
+	*        "HeightRange": "-43.1 156.9",
+	*        "RandomSeed": "42"
+	*    }
+	*
+	*  @note
+	*    - No scene node rotation and scale is supported to keep things simple
+	*    - The grass LOD parameters are passed to the shaders using the "GrassLodParameters" material property
 	*/
 	class GrassSceneItem final : public MaterialSceneItem
 	{
@@ -62,11 +108,50 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		static constexpr uint32_t TYPE_ID = STRING_ID("GrassSceneItem");
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_GRASS = 1u << 24u;	///< Maximum number of grass blades per grass scene item, the RHI structured buffer size limit might be lower
 		struct GrassDataStruct final
 		{
 			float PositionSize[4];	// Object space grass xyz-position, w = grass size
 			float ColorRotation[4];	// Linear RGB grass color and rotation in radians
+			float LodThreshold[4];	// x = LOD threshold within [0, 1), grass blades with a threshold above the distance based density factor are dropped, yzw = unused
 		};
+		struct GrassProperties final
+		{
+			glm::vec2 extents				 = glm::vec2(8.0f, 8.0f);	///< Object space half size of the xz-area covered by grass
+			float	  chunkSize				 = 8.0f;	///< Object space edge length of a grass chunk
+			float	  density				 = 64.0f;	///< Number of grass blades per square meter at full density map value
+			float	  minimumSize			 = 0.5f;	///< Minimum grass blade size
+			float	  maximumSize			 = 1.0f;	///< Maximum grass blade size
+			glm::vec3 color					 = glm::vec3(1.0f, 1.0f, 1.0f);	///< Linear space RGB grass color
+			float	  colorVariation		 = 0.2f;	///< Random per grass blade brightness variation within [0, 1]
+			float	  lodDistance			 = 20.0f;	///< Distance at which the grass blade density starts to decrease
+			float	  maximumDistance		 = 100.0f;	///< Distance beyond which no grass is drawn at all
+			float	  minimumDensityFactor	 = 0.1f;	///< Grass blade density factor within [0, 1] reached at the maximum distance
+			float	  fadeDistance			 = 5.0f;	///< Distance over which grass blades are faded out before they're dropped
+			float	  singleQuadDistance	 = 50.0f;	///< Grass chunks beyond this distance are drawn using one instead of two quads per grass blade
+			glm::vec2 heightRange			 = glm::vec2(0.0f, 0.0f);	///< Object space y-position of the height map values zero and one, without height map the first value is used
+			uint32_t  randomSeed			 = 0;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline const GrassProperties& getGrassProperties() const
+		{
+			return mGrassProperties;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfGrass() const	///< Total number of generated grass blades, zero if grass isn't supported or not generated yet
+		{
+			return mNumberOfGrass;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfVisibleGrass() const	///< Number of grass blades drawn by the last "Renderer::ISceneItem::onExecuteOnRendering()" call
+		{
+			return mNumberOfVisibleGrass;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -78,6 +163,7 @@ namespace Renderer
 			return TYPE_ID;
 		}
 
+		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
 		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
 
 
@@ -96,6 +182,20 @@ namespace Renderer
 		virtual void onMaterialResourceCreated() override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Chunk final
+		{
+			glm::vec3 minimumPosition;	///< Object space bounding box minimum position
+			glm::vec3 maximumPosition;	///< Object space bounding box maximum position
+			uint32_t  firstGrass;		///< Index of the first grass blade of the chunk inside the structured buffer
+			uint32_t  numberOfGrass;
+		};
+		typedef std::vector<Chunk> Chunks;	///< Only chunks with at least one grass blade, chunk index = renderable index
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -109,15 +209,27 @@ namespace Renderer
 
 		explicit GrassSceneItem(const GrassSceneItem&) = delete;
 		GrassSceneItem& operator=(const GrassSceneItem&) = delete;
+		[[nodiscard]] float getDensity(float u, float v) const;
+		[[nodiscard]] float getHeight(float u, float v) const;
+		void generateGrass(std::vector<GrassDataStruct>& grassData);
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint32_t				  mMaximumNumberOfGrass;	///< Maximum number of grass
-		Rhi::IStructuredBufferPtr mStructuredBufferPtr;		///< Structured buffer the data of the individual grass ("Renderer::GrassSceneItem::GrassDataStruct")
-		Rhi::IIndirectBufferPtr   mIndirectBufferPtr;		///< Indirect buffer holding data related to the current grass "Rhi::DrawArguments" draw call
+		GrassProperties			  mGrassProperties;
+		uint32_t				  mMaximumNumberOfGrass;	///< Maximum number of grass blades after clamping to the RHI capabilities, zero if grass isn't supported
+		uint32_t				  mDensityMapWidth;			///< Zero if there's no density map
+		uint32_t				  mDensityMapHeight;		///< Zero if there's no density map
+		std::vector<uint8_t>	  mDensityMap;				///< Only valid until the grass was generated
+		uint32_t				  mHeightMapWidth;			///< Zero if there's no height map
+		uint32_t				  mHeightMapHeight;			///< Zero if there's no height map
+		std::vector<uint16_t>	  mHeightMap;				///< Only valid until the grass was generated
+		uint32_t				  mNumberOfGrass;			///< Total number of generated grass blades
+		Chunks					  mChunks;
+		Rhi::IStructuredBufferPtr mStructuredBufferPtr;		///< Structured buffer the data of the individual grass ("Renderer::GrassSceneItem::GrassDataStruct"), chunk by chunk
+		mutable uint32_t		  mNumberOfVisibleGrass;	///< Number of grass blades drawn by the last "Renderer::ISceneItem::onExecuteOnRendering()" call
 
 
 	};
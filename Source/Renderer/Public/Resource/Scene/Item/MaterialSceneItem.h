@@ -149,7 +149,7 @@ namespace Renderer
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		RenderableManager mRenderableManager;
+		mutable RenderableManager mRenderableManager;	///< Mutable since scene items might update their renderables inside the constant "Renderer::ISceneItem::onExecuteOnRendering()", e.g. the grass chunk culling
 
 
 	//[-------------------------------------------------------]
@@ -29,6 +29,7 @@
 #include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
 #include "Renderer/Public/Resource/Mesh/MeshResource.h"
 #include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -186,6 +187,15 @@ namespace Renderer
 
 				// Fill renderable manager
 				MaterialResourceManager& materialResourceManager = getSceneResource().getRenderer().getMaterialResourceManager();
+				mRenderableManager.setBoundingSpherePositionRadius(meshResource.getBoundingSpherePosition(), meshResource.getBoundingSphereRadius());
+				if (meshResource.hasQuantizedPositions())
+				{
+					mRenderableManager.setPositionDequantization(meshResource.getMinimumBoundingBoxPosition(), meshResource.getMaximumBoundingBoxPosition() - meshResource.getMinimumBoundingBoxPosition());
+				}
+				else
+				{
+					mRenderableManager.setPositionDequantization(Math::VEC3_ZERO, Math::VEC3_ONE);
+				}
 				{
 					#ifdef RHI_DEBUG
 						const char* debugName = meshResource.getDebugName();
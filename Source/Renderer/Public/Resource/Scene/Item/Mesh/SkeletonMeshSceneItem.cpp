@@ -74,6 +74,19 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::ISceneItem methods        ]
+	//[-------------------------------------------------------]
+	void SkeletonMeshSceneItem::onExecuteOnRendering([[maybe_unused]] const Rhi::IRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
+	{
+		// Only called for scene items which passed the culling, so the skeleton animation level of detail can be based on the cached distance to the camera
+		if (nullptr != mSkeletonAnimationController)
+		{
+			mSkeletonAnimationController->reportDistanceToCamera(getRenderableManager()->getCachedDistanceToCamera());
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
 	//[-------------------------------------------------------]
@@ -89,12 +102,16 @@ namespace Renderer
 					RHI_ASSERT(getContext(), nullptr == mSkeletonAnimationController, "Invalid skeleton animation controller")
 					mSkeletonAnimationController = new SkeletonAnimationController(getSceneResource().getRenderer(), static_cast<const MeshResource&>(resource).getSkeletonResourceId());
 					mSkeletonAnimationController->startSkeletonAnimationByAssetId(mSkeletonAnimationAssetId);
+
+					// We need "Renderer::ISceneItem::onExecuteOnRendering()" calls to drive the skeleton animation level of detail
+					setCallExecuteOnRendering(true);
 				}
 			}
 			else if (nullptr != mSkeletonAnimationController)
 			{
 				delete mSkeletonAnimationController;
 				mSkeletonAnimationController = nullptr;
+				setCallExecuteOnRendering(false);
 			}
 		}
 
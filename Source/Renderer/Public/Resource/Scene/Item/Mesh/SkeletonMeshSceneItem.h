@@ -87,6 +87,11 @@ namespace Renderer
 
 		[[nodiscard]] RENDERER_API_EXPORT SkeletonResourceId getSkeletonResourceId() const;
 
+		[[nodiscard]] inline SkeletonAnimationController* getSkeletonAnimationController() const	// Can be a null pointer, use it e.g. for cross-fades, blend trees and layers, don't destroy the instance
+		{
+			return mSkeletonAnimationController;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ISceneItem methods           ]
@@ -116,6 +121,13 @@ namespace Renderer
 		SkeletonMeshSceneItem& operator=(const SkeletonMeshSceneItem&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual Renderer::ISceneItem methods        ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual void onExecuteOnRendering(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) const override;
+
+
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
 	//[-------------------------------------------------------]
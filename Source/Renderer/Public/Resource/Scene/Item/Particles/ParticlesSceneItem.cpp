@@ -22,10 +22,78 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/Particles/ParticlesSceneItem.h"
+#include "Renderer/Public/Resource/Scene/Loader/SceneFileFormat.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
-#include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorResourcePassParticles.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorInstancePassParticles.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'uint32_t' to 'int32_t', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
+	PRAGMA_WARNING_DISABLE_MSVC(4530)	// warning C4530: C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5219)	// warning C5219: implicit conversion from 'const int' to 'const _Ty', possible loss of data
+	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION	// See "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+	#include <xsimd/xsimd.hpp>
+	#include <algorithm>
+	#include <numeric>
+	#include <cmath>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef xsimd::simd_type<float> float4;
+		static constexpr uint32_t SIMD_LANE_COUNT	 = static_cast<uint32_t>(float4::size);
+		static constexpr float	  MAXIMUM_DELTA_TIME = 0.1f;	///< Maximum simulation step in seconds, avoids particle bursts after frame hitches
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		// PCG hash (see "Hash Functions for GPU Rendering" - http://www.jcgt.org/published/0009/03/02/ ), the particles compute shaders are using the same hash
+		[[nodiscard]] uint32_t hash(uint32_t value)
+		{
+			const uint32_t state = value * 747796405u + 2891336453u;
+			const uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+			return (word >> 22u) ^ word;
+		}
+
+		[[nodiscard]] float random01(uint32_t& seed)
+		{
+			seed = hash(seed);
+			return static_cast<float>(seed & 0x00FFFFFFu) * (1.0f / 16777216.0f);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -37,6 +105,39 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::ISceneItem methods           ]
 	//[-------------------------------------------------------]
+	void ParticlesSceneItem::deserialize(uint32_t numberOfBytes, const uint8_t* data)
+	{
+		// Sanity check
+		RHI_ASSERT(getContext(), sizeof(v1Scene::ParticlesItem) <= numberOfBytes, "Invalid number of bytes")
+		const v1Scene::ParticlesItem* particlesItem = reinterpret_cast<const v1Scene::ParticlesItem*>(data);
+
+		// Read data
+		mEmitterProperties.maximumNumberOfParticles = particlesItem->maximumNumberOfParticles;
+		mEmitterProperties.emissionRate				= particlesItem->emissionRate;
+		mEmitterProperties.minimumLifetime			= particlesItem->minimumLifetime;
+		mEmitterProperties.maximumLifetime			= particlesItem->maximumLifetime;
+		mEmitterProperties.emitterExtents			= glm::vec3(particlesItem->emitterExtents[0], particlesItem->emitterExtents[1], particlesItem->emitterExtents[2]);
+		mEmitterProperties.minimumVelocity			= glm::vec3(particlesItem->minimumVelocity[0], particlesItem->minimumVelocity[1], particlesItem->minimumVelocity[2]);
+		mEmitterProperties.maximumVelocity			= glm::vec3(particlesItem->maximumVelocity[0], particlesItem->maximumVelocity[1], particlesItem->maximumVelocity[2]);
+		mEmitterProperties.gravity					= glm::vec3(particlesItem->gravity[0], particlesItem->gravity[1], particlesItem->gravity[2]);
+		mEmitterProperties.drag						= particlesItem->drag;
+		mEmitterProperties.startSize				= particlesItem->startSize;
+		mEmitterProperties.endSize					= particlesItem->endSize;
+		mEmitterProperties.startColor				= glm::vec4(particlesItem->startColor[0], particlesItem->startColor[1], particlesItem->startColor[2], particlesItem->startColor[3]);
+		mEmitterProperties.endColor					= glm::vec4(particlesItem->endColor[0], particlesItem->endColor[1], particlesItem->endColor[2], particlesItem->endColor[3]);
+		mEmitterProperties.sortParticles			= particlesItem->sortParticles;
+		if (mMaximumNumberOfParticles > 0)
+		{
+			mMaximumNumberOfParticles = std::min(mEmitterProperties.maximumNumberOfParticles, MAXIMUM_NUMBER_OF_PARTICLES);
+		}
+
+		// Sanity checks
+		RHI_ASSERT(getContext(), mEmitterProperties.minimumLifetime > 0.0f && mEmitterProperties.minimumLifetime <= mEmitterProperties.maximumLifetime, "Invalid particle lifetime")
+
+		// Call base implementation
+		MaterialSceneItem::deserialize(numberOfBytes - sizeof(v1Scene::ParticlesItem), data + sizeof(v1Scene::ParticlesItem));
+	}
+
 	const RenderableManager* ParticlesSceneItem::getRenderableManager() const
 	{
 		// Sanity checks
@@ -51,9 +152,47 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
-	void ParticlesSceneItem::onExecuteOnRendering([[maybe_unused]] const Rhi::IRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
+	void ParticlesSceneItem::onExecuteOnRendering([[maybe_unused]] const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, [[maybe_unused]] Rhi::CommandBuffer& commandBuffer) const
 	{
-		// TODO(co) Implement me
+		// Simulate only once per frame, the scene item might be rendered by multiple compositor workspace instances
+		const TimeManager& timeManager = getSceneResource().getRenderer().getTimeManager();
+		if (nullptr == mStructuredBufferPtr || mSimulatedFrameNumber == timeManager.getNumberOfRenderedFrames())
+		{
+			return;
+		}
+		mSimulatedFrameNumber = timeManager.getNumberOfRenderedFrames();
+		const float deltaTime = std::min(timeManager.getPastSecondsSinceLastFrame(), ::detail::MAXIMUM_DELTA_TIME);
+
+		// Object space camera position used for the back-to-front sorting, only emitter translation is supported
+		const glm::vec3 objectSpaceCameraPosition = glm::vec3(compositorContextData.getWorldSpaceCameraPosition() - mRenderableManager.getTransform().position);
+
+		// Simulate on the GPU if the compositor workspace instance has a particles compositor pass supporting it, else fall back to the CPU
+		const CompositorWorkspaceInstance* compositorWorkspaceInstance = compositorContextData.getCompositorWorkspaceInstance();
+		const ICompositorInstancePass* compositorInstancePass = (nullptr != compositorWorkspaceInstance) ? compositorWorkspaceInstance->getFirstCompositorInstancePassByCompositorPassTypeId(CompositorResourcePassParticles::TYPE_ID) : nullptr;
+		const bool gpuSimulation = (nullptr != compositorInstancePass && static_cast<const CompositorInstancePassParticles*>(compositorInstancePass)->isGpuSimulationSupported());
+		if (mGpuSimulationActive != gpuSimulation)
+		{
+			// Switching between GPU and CPU simulation restarts the particles simulation, the GPU simulation resources are recreated on demand
+			mGpuSimulation = GpuSimulation();
+			mCpuSimulation.numberOfAliveParticles = 0;
+			mEmissionAccumulator = 0.0f;
+			mGpuSimulationActive = gpuSimulation;
+		}
+		const uint32_t numberOfParticlesToEmit = getNumberOfParticlesToEmit(deltaTime);
+		if (gpuSimulation)
+		{
+			// Prepare the simulation step, it's dispatched by the particles compositor pass
+			mGpuSimulation.pending					 = true;
+			mGpuSimulation.deltaTime				 = deltaTime;
+			mGpuSimulation.numberOfParticlesToEmit	 = numberOfParticlesToEmit;
+			mGpuSimulation.randomSeed				 = ::detail::hash(++mRandomSeed);
+			mGpuSimulation.objectSpaceCameraPosition = objectSpaceCameraPosition;
+		}
+		else
+		{
+			simulateOnCpu(deltaTime, numberOfParticlesToEmit, objectSpaceCameraPosition);
+			uploadCpuSimulation();
+		}
 	}
 
 
@@ -62,6 +201,32 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	void ParticlesSceneItem::initialize()
 	{
+		// Create the RHI resources, if not already done
+		if (mMaximumNumberOfParticles > 0 && nullptr == mStructuredBufferPtr)
+		{
+			const IRenderer& renderer = getSceneResource().getRenderer();
+			const Rhi::Capabilities& capabilities = renderer.getRhi().getCapabilities();
+			Rhi::IBufferManager& bufferManager = renderer.getBufferManager();
+
+			// The GPU simulation state is the largest per particle structured buffer
+			mMaximumNumberOfParticles = std::min(mMaximumNumberOfParticles, capabilities.maximumStructuredBufferSize / static_cast<uint32_t>(sizeof(ParticleSimulationDataStruct)));
+
+			// Create the structured buffer, it's either written by the CPU simulation or by the GPU simulation
+			const uint32_t bufferFlags = capabilities.computeShader ? (Rhi::BufferFlag::SHADER_RESOURCE | Rhi::BufferFlag::UNORDERED_ACCESS) : Rhi::BufferFlag::SHADER_RESOURCE;
+			mStructuredBufferPtr = bufferManager.createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, nullptr, bufferFlags, Rhi::BufferUsage::DYNAMIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
+
+			{ // Create the indirect buffer: Six vertices per particle, particle index = instance index, no particle is alive at the beginning
+				// -> The second draw arguments are unused by the draw call and used as counters by the GPU simulation
+				const Rhi::DrawArguments drawArguments[2] =
+				{
+					Rhi::DrawArguments(6, 0, 0, 0),
+					Rhi::DrawArguments(0, 0, 0, 0)
+				};
+				const uint32_t indirectBufferFlags = capabilities.computeShader ? (Rhi::IndirectBufferFlag::UNORDERED_ACCESS | Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) : Rhi::IndirectBufferFlag::DRAW_ARGUMENTS;
+				mIndirectBufferPtr = bufferManager.createIndirectBuffer(sizeof(drawArguments), drawArguments, indirectBufferFlags, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Particles"));
+			}
+		}
+
 		// Call the base implementation
 		if (mMaximumNumberOfParticles > 0)
 		{
@@ -71,7 +236,7 @@ namespace Renderer
 
 	void ParticlesSceneItem::onMaterialResourceCreated()
 	{
-		// Setup renderable manager: Six vertices per particle, particle index = instance index
+		// Setup renderable manager: Six vertices per alive particle, particle index = instance index, the number of alive particles is read from the indirect buffer
 		#ifdef RHI_DEBUG
 			const char* debugName = "Particles";
 			mRenderableManager.setDebugName(debugName);
@@ -79,7 +244,7 @@ namespace Renderer
 		const IRenderer& renderer = getSceneResource().getRenderer();
 		const MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
 		const MaterialResourceId materialResourceId = getMaterialResourceId();
-		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, getInvalid<SkeletonResourceId>(), false, 0, 6, mMaximumNumberOfParticles RHI_RESOURCE_DEBUG_NAME(debugName));
+		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, getInvalid<SkeletonResourceId>(), false, mIndirectBufferPtr, 0, 1 RHI_RESOURCE_DEBUG_NAME(debugName));
 		mRenderableManager.updateCachedRenderablesData();
 
 		// Tell the used material resource about our structured buffer
@@ -94,62 +259,205 @@ namespace Renderer
 
 
 	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	ParticlesSceneItem::ParticlesSceneItem(SceneResource& sceneResource) :
 		MaterialSceneItem(sceneResource, false),	// TODO(co) Set bounding box
-		mMaximumNumberOfParticles(8)				// TODO(co) Make this dynamic
+		mMaximumNumberOfParticles(mEmitterProperties.maximumNumberOfParticles),
+		mSimulatedFrameNumber(getInvalid<uint64_t>()),
+		mEmissionAccumulator(0.0f),
+		mRandomSeed(0),
+		mGpuSimulationActive(false)
 	{
 		// The RHI implementation must support structured buffers
 		const IRenderer& renderer = getSceneResource().getRenderer();
-		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize > 0)
+		if (0 == renderer.getRhi().getCapabilities().maximumStructuredBufferSize)
 		{
-			// Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			// TODO(co) Make this dynamic
-			const ParticleDataStruct particlesData[8] =
+			mMaximumNumberOfParticles = 0;
+			RHI_LOG_ONCE(renderer.getContext(), COMPATIBILITY_WARNING, "The renderer particles scene item needs a RHI implementation with structured buffer support")
+		}
+	}
+
+	uint32_t ParticlesSceneItem::getNumberOfParticlesToEmit(float deltaTime) const
+	{
+		// Accumulate fractional particles so low emission rates work with high frame rates as well
+		mEmissionAccumulator += mEmitterProperties.emissionRate * deltaTime;
+		const float numberOfParticlesToEmit = std::min(std::floor(mEmissionAccumulator), static_cast<float>(mMaximumNumberOfParticles));
+		mEmissionAccumulator -= numberOfParticlesToEmit;
+		return static_cast<uint32_t>(numberOfParticlesToEmit);
+	}
+
+	void ParticlesSceneItem::simulateOnCpu(float deltaTime, uint32_t numberOfParticlesToEmit, const glm::vec3& objectSpaceCameraPosition) const
+	{
+		typedef ::detail::float4 float4;
+		CpuSimulation& cpuSimulation = mCpuSimulation;
+
+		// Allocate the structure of arrays, padded up to the SIMD lane count so the SIMD loops don't need a scalar remainder
+		const uint32_t numberOfPaddedParticles = Math::makeMultipleOf(mMaximumNumberOfParticles, ::detail::SIMD_LANE_COUNT);
+		if (cpuSimulation.age.size() != numberOfPaddedParticles)
+		{
+			for (std::vector<float>* vector : { &cpuSimulation.positionX, &cpuSimulation.positionY, &cpuSimulation.positionZ, &cpuSimulation.velocityX, &cpuSimulation.velocityY, &cpuSimulation.velocityZ, &cpuSimulation.age, &cpuSimulation.lifetime, &cpuSimulation.sortKeys })
 			{
-				{
-					{ 4.88f,  1.4f, -1.44f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ -6.2f,  1.4f, -1.44f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ 4.88f,  1.4f,   2.2f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ -6.2f,  1.4f,   2.2f, 0.5f },
-					{  1.0f,  1.0f,   1.0f, 0.3f }
-				},
-				{
-					{ -12.0f, 1.39f,  -4.0f, 1.0f },
-					{  1.0f,  0.0f,   0.0f, 1.0f }
-				},
-				{
-					{ 11.2f, 1.39f,  -4.0f, 1.0f },
-					{  0.0f,  1.0f,   0.0f, 1.0f }
-				},
-				{
-					{ -12.0f, 1.39f,   4.5f, 1.0f },
-					{  0.0f,  0.0f,   1.0f, 1.0f }
-				},
-				{
-					{ 11.2f, 1.39f,   4.5f, 1.0f },
-					{  1.0f,  1.0f,   1.0f, 1.0f }
-				}
-			};
+				vector->resize(numberOfPaddedParticles, 0.0f);
+			}
+			cpuSimulation.sortedParticleIndices.resize(numberOfPaddedParticles);
+			cpuSimulation.numberOfAliveParticles = 0;
+		}
+		float* RESTRICT positionX = cpuSimulation.positionX.data();
+		float* RESTRICT positionY = cpuSimulation.positionY.data();
+		float* RESTRICT positionZ = cpuSimulation.positionZ.data();
+		float* RESTRICT velocityX = cpuSimulation.velocityX.data();
+		float* RESTRICT velocityY = cpuSimulation.velocityY.data();
+		float* RESTRICT velocityZ = cpuSimulation.velocityZ.data();
+		float* RESTRICT age = cpuSimulation.age.data();
+		float* RESTRICT lifetime = cpuSimulation.lifetime.data();
+		uint32_t numberOfAliveParticles = cpuSimulation.numberOfAliveParticles;
 
-			// Create the structured buffer
-			mStructuredBufferPtr = renderer.getBufferManager().createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, particlesData, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::STATIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
+		{ // Integrate the alive particles, SIMD lane count particles at once
+			const float4 deltaTime4(deltaTime);
+			const float4 dragFactor(std::exp(-mEmitterProperties.drag * deltaTime));
+			const float4 gravityStepX(mEmitterProperties.gravity.x * deltaTime);
+			const float4 gravityStepY(mEmitterProperties.gravity.y * deltaTime);
+			const float4 gravityStepZ(mEmitterProperties.gravity.z * deltaTime);
+			const uint32_t numberOfPaddedAliveParticles = Math::makeMultipleOf(numberOfAliveParticles, ::detail::SIMD_LANE_COUNT);
+			for (uint32_t i = 0; i < numberOfPaddedAliveParticles; i += ::detail::SIMD_LANE_COUNT)
+			{
+				const float4 newVelocityX = (xsimd::load_unaligned(&velocityX[i]) + gravityStepX) * dragFactor;
+				const float4 newVelocityY = (xsimd::load_unaligned(&velocityY[i]) + gravityStepY) * dragFactor;
+				const float4 newVelocityZ = (xsimd::load_unaligned(&velocityZ[i]) + gravityStepZ) * dragFactor;
+				xsimd::store_unaligned(&velocityX[i], newVelocityX);
+				xsimd::store_unaligned(&velocityY[i], newVelocityY);
+				xsimd::store_unaligned(&velocityZ[i], newVelocityZ);
+				xsimd::store_unaligned(&positionX[i], xsimd::load_unaligned(&positionX[i]) + newVelocityX * deltaTime4);
+				xsimd::store_unaligned(&positionY[i], xsimd::load_unaligned(&positionY[i]) + newVelocityY * deltaTime4);
+				xsimd::store_unaligned(&positionZ[i], xsimd::load_unaligned(&positionZ[i]) + newVelocityZ * deltaTime4);
+				xsimd::store_unaligned(&age[i], xsimd::load_unaligned(&age[i]) + deltaTime4);
+			}
 		}
-		else
+
+		// Remove dead particles by moving the last alive particle into their place, the order doesn't matter since sorting is done afterwards
+		for (uint32_t i = 0; i < numberOfAliveParticles;)
 		{
-			mMaximumNumberOfParticles = 0;
-			RHI_LOG_ONCE(renderer.getContext(), COMPATIBILITY_WARNING, "The renderer particles scene item needs a RHI implementation with structured buffer support")
+			if (age[i] >= lifetime[i])
+			{
+				--numberOfAliveParticles;
+				positionX[i] = positionX[numberOfAliveParticles];
+				positionY[i] = positionY[numberOfAliveParticles];
+				positionZ[i] = positionZ[numberOfAliveParticles];
+				velocityX[i] = velocityX[numberOfAliveParticles];
+				velocityY[i] = velocityY[numberOfAliveParticles];
+				velocityZ[i] = velocityZ[numberOfAliveParticles];
+				age[i] = age[numberOfAliveParticles];
+				lifetime[i] = lifetime[numberOfAliveParticles];
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		{ // Emit new particles
+			const EmitterProperties& emitterProperties = mEmitterProperties;
+			const glm::vec3 velocityRange = emitterProperties.maximumVelocity - emitterProperties.minimumVelocity;
+			const float lifetimeRange = emitterProperties.maximumLifetime - emitterProperties.minimumLifetime;
+			const uint32_t numberOfEmittedParticles = std::min(numberOfParticlesToEmit, mMaximumNumberOfParticles - numberOfAliveParticles);
+			uint32_t seed = mRandomSeed;
+			for (uint32_t i = numberOfAliveParticles; i < numberOfAliveParticles + numberOfEmittedParticles; ++i)
+			{
+				positionX[i] = (::detail::random01(seed) * 2.0f - 1.0f) * emitterProperties.emitterExtents.x;
+				positionY[i] = (::detail::random01(seed) * 2.0f - 1.0f) * emitterProperties.emitterExtents.y;
+				positionZ[i] = (::detail::random01(seed) * 2.0f - 1.0f) * emitterProperties.emitterExtents.z;
+				velocityX[i] = emitterProperties.minimumVelocity.x + velocityRange.x * ::detail::random01(seed);
+				velocityY[i] = emitterProperties.minimumVelocity.y + velocityRange.y * ::detail::random01(seed);
+				velocityZ[i] = emitterProperties.minimumVelocity.z + velocityRange.z * ::detail::random01(seed);
+				age[i] = 0.0f;
+				lifetime[i] = emitterProperties.minimumLifetime + lifetimeRange * ::detail::random01(seed);
+			}
+			mRandomSeed = seed;
+			numberOfAliveParticles += numberOfEmittedParticles;
+			cpuSimulation.numberOfAliveParticles = numberOfAliveParticles;
+		}
+
+		// Sort the alive particles back-to-front by using the squared object space camera distance as sort key
+		uint32_t* sortedParticleIndices = cpuSimulation.sortedParticleIndices.data();
+		std::iota(sortedParticleIndices, sortedParticleIndices + numberOfAliveParticles, 0u);
+		if (mEmitterProperties.sortParticles && numberOfAliveParticles > 1)
+		{
+			float* RESTRICT sortKeys = cpuSimulation.sortKeys.data();
+			const float4 cameraPositionX(objectSpaceCameraPosition.x);
+			const float4 cameraPositionY(objectSpaceCameraPosition.y);
+			const float4 cameraPositionZ(objectSpaceCameraPosition.z);
+			const uint32_t numberOfPaddedAliveParticles = Math::makeMultipleOf(numberOfAliveParticles, ::detail::SIMD_LANE_COUNT);
+			for (uint32_t i = 0; i < numberOfPaddedAliveParticles; i += ::detail::SIMD_LANE_COUNT)
+			{
+				const float4 distanceX = xsimd::load_unaligned(&positionX[i]) - cameraPositionX;
+				const float4 distanceY = xsimd::load_unaligned(&positionY[i]) - cameraPositionY;
+				const float4 distanceZ = xsimd::load_unaligned(&positionZ[i]) - cameraPositionZ;
+				xsimd::store_unaligned(&sortKeys[i], distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ);
+			}
+			std::sort(sortedParticleIndices, sortedParticleIndices + numberOfAliveParticles, [sortKeys](uint32_t left, uint32_t right) { return (sortKeys[left] > sortKeys[right]); });
+		}
+	}
+
+	void ParticlesSceneItem::uploadCpuSimulation() const
+	{
+		typedef ::detail::float4 float4;
+		CpuSimulation& cpuSimulation = mCpuSimulation;
+		const uint32_t numberOfAliveParticles = cpuSimulation.numberOfAliveParticles;
+		Rhi::IRhi& rhi = getSceneResource().getRenderer().getRhi();
+		Rhi::MappedSubresource mappedSubresource;
+
+		// Update the structured buffer
+		if (numberOfAliveParticles > 0 && rhi.map(*mStructuredBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+		{
+			// Calculate the normalized particle age used for interpolating the particle size and color, the sort keys are no longer needed and reused
+			float* RESTRICT normalizedAge = cpuSimulation.sortKeys.data();
+			const float* RESTRICT age = cpuSimulation.age.data();
+			const float* RESTRICT lifetime = cpuSimulation.lifetime.data();
+			const float4 one(1.0f);
+			const uint32_t numberOfPaddedAliveParticles = Math::makeMultipleOf(numberOfAliveParticles, ::detail::SIMD_LANE_COUNT);
+			for (uint32_t i = 0; i < numberOfPaddedAliveParticles; i += ::detail::SIMD_LANE_COUNT)
+			{
+				// The lifetime of padding particles might be zero, clamp it to avoid divisions by zero
+				xsimd::store_unaligned(&normalizedAge[i], xsimd::min(xsimd::load_unaligned(&age[i]) / xsimd::max(xsimd::load_unaligned(&lifetime[i]), float4(1e-6f)), one));
+			}
+
+			// Write the particle render data in sorted order
+			const EmitterProperties& emitterProperties = mEmitterProperties;
+			const float sizeRange = emitterProperties.endSize - emitterProperties.startSize;
+			const glm::vec4 colorRange = emitterProperties.endColor - emitterProperties.startColor;
+			const uint32_t* sortedParticleIndices = cpuSimulation.sortedParticleIndices.data();
+			ParticleDataStruct* particleData = static_cast<ParticleDataStruct*>(mappedSubresource.data);
+			for (uint32_t i = 0; i < numberOfAliveParticles; ++i, ++particleData)
+			{
+				const uint32_t particleIndex = sortedParticleIndices[i];
+				const float t = normalizedAge[particleIndex];
+				particleData->PositionSize[0] = cpuSimulation.positionX[particleIndex];
+				particleData->PositionSize[1] = cpuSimulation.positionY[particleIndex];
+				particleData->PositionSize[2] = cpuSimulation.positionZ[particleIndex];
+				particleData->PositionSize[3] = emitterProperties.startSize + sizeRange * t;
+				particleData->Color[0] = emitterProperties.startColor.r + colorRange.r * t;
+				particleData->Color[1] = emitterProperties.startColor.g + colorRange.g * t;
+				particleData->Color[2] = emitterProperties.startColor.b + colorRange.b * t;
+				particleData->Color[3] = emitterProperties.startColor.a + colorRange.a * t;
+			}
+
+			// Unmap the structured buffer
+			rhi.unmap(*mStructuredBufferPtr, 0);
+		}
+
+		// Update the indirect buffer: Instance count = number of alive particles
+		if (rhi.map(*mIndirectBufferPtr, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+		{
+			const Rhi::DrawArguments drawArguments[2] =
+			{
+				Rhi::DrawArguments(6, numberOfAliveParticles, 0, 0),
+				Rhi::DrawArguments(0, 0, 0, 0)
+			};
+			memcpy(mappedSubresource.data, drawArguments, sizeof(drawArguments));
+
+			// Unmap the indirect buffer
+			rhi.unmap(*mIndirectBufferPtr, 0);
 		}
 	}
 
@@ -29,6 +29,18 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Item/MaterialSceneItem.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Generic_error_category': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Generic_error_category': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -44,8 +56,34 @@ namespace Renderer
 	*  @brief
 	*    Particles scene item
 	*
-	*  @todo
-	*    - TODO(co) Particles rendering part is implemented, implement GPU based particles simulation as well
+	*  @remarks
+	*    Data-driven particle emitter: The emitter properties are defined inside the scene asset. The particles are simulated once per
+	*    frame as soon as the scene item is visible. If the compositor workspace contains a particles compositor pass which supports GPU
+	*    simulation, the particles are simulated, sorted and compacted by compute shaders which also write the indirect draw arguments.
+	*    Else the particles are simulated on the CPU using SIMD and the result is uploaded into the same structured and indirect buffer.
+	*    Either way, the renderable draws six vertices per alive particle using the indirect buffer, particle index = instance index.
+	*
+	*    Scene JSON example:
+	*    "ParticlesSceneItem":
+	*    {
+	*        "Material": "Example/Blueprint/Particles/M_Particles",
+	*        "MaximumNumberOfParticles": "100000",
+	*        "EmissionRate": "20000.0",
+	*        "Lifetime": "2.0 4.0",
+	*        "EmitterExtents": "1.0 0.1 1.0",
+	*        "MinimumVelocity": "-0.5 1.0 -0.5",
+	*        "MaximumVelocity": "0.5 3.0 0.5",
+	*        "Gravity": "0.0 -1.0 0.0",
+	*        "Drag": "0.2",
+	*        "Size": "0.05 0.2",
+	*        "StartColor": "1.0 0.8 0.5 1.0",
+	*        "EndColor": "0.5 0.5 0.5 0.0",
+	*        "SortParticles": "TRUE"
+	*    }
+	*
+	*  @note
+	*    - Particles are simulated in object space, no emitter rotation and scale is supported to keep things simple
+	*    - Switching between GPU and CPU simulation restarts the particles simulation
 	*/
 	class ParticlesSceneItem final : public MaterialSceneItem
 	{
@@ -54,7 +92,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class SceneFactory;	// Needs to be able to create scene item instances
+		friend class SceneFactory;						// Needs to be able to create scene item instances
+		friend class CompositorInstancePassParticles;	// Needs to be able to access the GPU simulation data
 
 
 	//[-------------------------------------------------------]
@@ -62,11 +101,49 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		static constexpr uint32_t TYPE_ID = STRING_ID("ParticlesSceneItem");
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_PARTICLES = 1u << 20u;	///< Maximum number of particles per emitter, must be a power of two
 		struct ParticleDataStruct final
 		{
 			float PositionSize[4];	// Object space particle xyz-position, w = particle size
 			float Color[4];			// Linear space RGB particle color and opacity
 		};
+		struct ParticleSimulationDataStruct final
+		{
+			float PositionAge[4];		// Object space particle xyz-position, w = particle age in seconds
+			float VelocityLifetime[4];	// Object space particle xyz-velocity in meter per second, w = particle lifetime in seconds, particles with an age equal or greater as their lifetime are dead
+		};
+		struct EmitterProperties final
+		{
+			uint32_t  maximumNumberOfParticles = 1024;
+			float	  emissionRate			   = 64.0f;	///< Number of emitted particles per second
+			float	  minimumLifetime		   = 1.0f;	///< Minimum particle lifetime in seconds
+			float	  maximumLifetime		   = 2.0f;	///< Maximum particle lifetime in seconds
+			glm::vec3 emitterExtents		   = glm::vec3(0.5f, 0.5f, 0.5f);	///< Half size of the object space box particles are emitted in
+			glm::vec3 minimumVelocity		   = glm::vec3(-0.5f, 1.0f, -0.5f);	///< Minimum object space particle start velocity in meter per second
+			glm::vec3 maximumVelocity		   = glm::vec3(0.5f, 2.0f, 0.5f);	///< Maximum object space particle start velocity in meter per second
+			glm::vec3 gravity				   = glm::vec3(0.0f, -9.81f, 0.0f);	///< Object space acceleration in meter per second squared
+			float	  drag					   = 0.0f;	///< Linear velocity damping per second
+			float	  startSize				   = 0.1f;	///< Particle size at birth
+			float	  endSize				   = 0.1f;	///< Particle size at death
+			glm::vec4 startColor			   = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);	///< Linear space RGB particle color and opacity at birth
+			glm::vec4 endColor				   = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);	///< Linear space RGB particle color and opacity at death
+			bool	  sortParticles			   = true;	///< Sort the particles back-to-front for correct transparency
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline const EmitterProperties& getEmitterProperties() const
+		{
+			return mEmitterProperties;
+		}
+
+		[[nodiscard]] inline uint32_t getMaximumNumberOfParticles() const	///< Maximum number of particles after clamping to the RHI capabilities, zero if particles aren't supported
+		{
+			return mMaximumNumberOfParticles;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -78,6 +155,7 @@ namespace Renderer
 			return TYPE_ID;
 		}
 
+		virtual void deserialize(uint32_t numberOfBytes, const uint8_t* data) override;
 		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
 
 
@@ -96,6 +174,41 @@ namespace Renderer
 		virtual void onMaterialResourceCreated() override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		// Filled by the particles scene item, the GPU resources are owned by the particles scene item but created and used by "Renderer::CompositorInstancePassParticles"
+		struct GpuSimulation final
+		{
+			bool					  pending						= false;	///< "true" if a simulation step was prepared for the current frame and still has to be dispatched by a particles compositor pass
+			float					  deltaTime						= 0.0f;		///< Simulation step time in seconds
+			uint32_t				  numberOfParticlesToEmit		= 0;
+			uint32_t				  randomSeed					= 0;
+			glm::vec3				  objectSpaceCameraPosition		= glm::vec3(0.0f, 0.0f, 0.0f);	///< Used for the back-to-front sorting
+			Rhi::IUniformBufferPtr	  uniformBuffer;
+			Rhi::IStructuredBufferPtr simulationStructuredBuffer;	///< "Renderer::ParticlesSceneItem::ParticleSimulationDataStruct"
+			Rhi::IStructuredBufferPtr sortStructuredBuffer;			///< Sort key and particle index per particle
+			Rhi::IResourceGroupPtr	  resourceGroup;
+			const Rhi::IRootSignature* resourceGroupRootSignature	= nullptr;	///< Root signature the resource group was created with, used for change detection only, don't destroy the instance
+		};
+		// Structure of arrays used by the CPU simulation, the arrays are padded up to the SIMD lane count
+		struct CpuSimulation final
+		{
+			std::vector<float>	  positionX;
+			std::vector<float>	  positionY;
+			std::vector<float>	  positionZ;
+			std::vector<float>	  velocityX;
+			std::vector<float>	  velocityY;
+			std::vector<float>	  velocityZ;
+			std::vector<float>	  age;
+			std::vector<float>	  lifetime;
+			std::vector<float>	  sortKeys;					///< Squared object space camera distance, reused for the normalized particle age after sorting
+			std::vector<uint32_t> sortedParticleIndices;
+			uint32_t			  numberOfAliveParticles = 0;
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -109,14 +222,26 @@ namespace Renderer
 
 		explicit ParticlesSceneItem(const ParticlesSceneItem&) = delete;
 		ParticlesSceneItem& operator=(const ParticlesSceneItem&) = delete;
+		[[nodiscard]] uint32_t getNumberOfParticlesToEmit(float deltaTime) const;
+		void simulateOnCpu(float deltaTime, uint32_t numberOfParticlesToEmit, const glm::vec3& objectSpaceCameraPosition) const;
+		void uploadCpuSimulation() const;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint32_t				  mMaximumNumberOfParticles;	///< Maximum number of particles
-		Rhi::IStructuredBufferPtr mStructuredBufferPtr;			///< Structured buffer the data of the individual particles ("Renderer::ParticlesSceneItem::ParticleDataStruct")
+		EmitterProperties		  mEmitterProperties;
+		uint32_t				  mMaximumNumberOfParticles;	///< Maximum number of particles after clamping to the RHI capabilities, zero if particles aren't supported
+		Rhi::IStructuredBufferPtr mStructuredBufferPtr;			///< Structured buffer the render data of the individual alive particles ("Renderer::ParticlesSceneItem::ParticleDataStruct"), back-to-front sorted if requested
+		Rhi::IIndirectBufferPtr	  mIndirectBufferPtr;			///< Indirect buffer holding the draw arguments ("Rhi::DrawArguments"), instance count = number of alive particles, followed by GPU simulation counters
+		// Per frame simulation state, updated during "Renderer::ISceneItem::onExecuteOnRendering()"
+		mutable uint64_t		  mSimulatedFrameNumber;		///< Number of the rendered frame the particles were last simulated at, used to simulate only once per frame
+		mutable float			  mEmissionAccumulator;			///< Fractional number of particles not yet emitted
+		mutable uint32_t		  mRandomSeed;
+		mutable bool			  mGpuSimulationActive;			///< "true" if the particles are currently simulated on the GPU, else "false"
+		mutable GpuSimulation	  mGpuSimulation;
+		mutable CpuSimulation	  mCpuSimulation;
 
 
 	};
@@ -59,7 +59,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("Scene");
-		static constexpr uint32_t FORMAT_VERSION = 5;
+		static constexpr uint32_t FORMAT_VERSION = 7;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -144,9 +144,26 @@ namespace Renderer
 				MaterialData materialData;
 			};
 
-			struct GrassItem final
-			{
-				MaterialData materialData;
+			struct GrassItem final	// Followed by the optional density map ("uint8_t" per texel), the optional height map ("uint16_t" per texel) and the material data
+			{
+				float	 extents[2]				 = { 8.0f, 8.0f };	///< Object space half size of the xz-area covered by grass
+				float	 chunkSize				 = 8.0f;	///< Object space edge length of a grass chunk, chunks are the granularity of culling and drawing
+				float	 density				 = 64.0f;	///< Number of grass blades per square meter at full density map value
+				float	 minimumSize			 = 0.5f;	///< Minimum grass blade size
+				float	 maximumSize			 = 1.0f;	///< Maximum grass blade size
+				float	 color[3]				 = { 1.0f, 1.0f, 1.0f };	///< Linear space RGB grass color
+				float	 colorVariation			 = 0.2f;	///< Random per grass blade brightness variation within [0, 1]
+				float	 lodDistance			 = 20.0f;	///< Distance at which the grass blade density starts to decrease
+				float	 maximumDistance		 = 100.0f;	///< Distance beyond which no grass is drawn at all
+				float	 minimumDensityFactor	 = 0.1f;	///< Grass blade density factor within [0, 1] reached at the maximum distance
+				float	 fadeDistance			 = 5.0f;	///< Distance over which grass blades are faded out before they're dropped
+				float	 singleQuadDistance		 = 50.0f;	///< Grass chunks beyond this distance are drawn using one instead of two quads per grass blade
+				float	 heightRange[2]			 = { 0.0f, 0.0f };	///< Object space y-position of the height map values zero and one, without height map the first value is used
+				uint32_t randomSeed				 = 0;
+				uint32_t densityMapWidth		 = 0;	///< Zero if there's no density map
+				uint32_t densityMapHeight		 = 0;	///< Zero if there's no density map
+				uint32_t heightMapWidth			 = 0;	///< Zero if there's no height map
+				uint32_t heightMapHeight		 = 0;	///< Zero if there's no height map
 			};
 
 			struct TerrainItem final
@@ -154,9 +171,22 @@ namespace Renderer
 				MaterialData materialData;
 			};
 
-			struct ParticlesItem final
-			{
-				MaterialData materialData;
+			struct ParticlesItem final	// Followed by the material data, not derived by intent to be able to reuse the material item serialization 1:1
+			{
+				uint32_t maximumNumberOfParticles = 1024;
+				float	 emissionRate			  = 64.0f;	///< Number of emitted particles per second
+				float	 minimumLifetime		  = 1.0f;	///< Minimum particle lifetime in seconds
+				float	 maximumLifetime		  = 2.0f;	///< Maximum particle lifetime in seconds
+				float	 emitterExtents[3]		  = { 0.5f, 0.5f, 0.5f };	///< Half size of the object space box particles are emitted in
+				float	 minimumVelocity[3]		  = { -0.5f, 1.0f, -0.5f };	///< Minimum object space particle start velocity in meter per second
+				float	 maximumVelocity[3]		  = { 0.5f, 2.0f, 0.5f };	///< Maximum object space particle start velocity in meter per second
+				float	 gravity[3]				  = { 0.0f, -9.81f, 0.0f };	///< Object space acceleration in meter per second squared
+				float	 drag					  = 0.0f;	///< Linear velocity damping per second
+				float	 startSize				  = 0.1f;	///< Particle size at birth
+				float	 endSize				  = 0.1f;	///< Particle size at death
+				float	 startColor[4]			  = { 1.0f, 1.0f, 1.0f, 1.0f };	///< Linear space RGB particle color and opacity at birth
+				float	 endColor[4]			  = { 1.0f, 1.0f, 1.0f, 0.0f };	///< Linear space RGB particle color and opacity at death
+				bool	 sortParticles			  = true;	///< Sort the particles back-to-front for correct transparency
 			};
 		#pragma pack(pop)
 
@@ -138,7 +138,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1Scene::FORMAT_TYPE, v1Scene::FORMAT_VERSION, file);
 	}
 
-	void SceneResourceLoader::onProcessing()
+	bool SceneResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -155,6 +155,9 @@ namespace Renderer
 			// Read in the scene resource nodes
 			::detail::nodesDeserialization(mMemoryFile, *mSceneResource);
 		}
+
+		// Done
+		return true;
 	}
 
 	bool SceneResourceLoader::onDispatch()
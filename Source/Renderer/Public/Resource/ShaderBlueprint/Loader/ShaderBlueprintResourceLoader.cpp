@@ -56,7 +56,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1ShaderBlueprint::FORMAT_TYPE, v1ShaderBlueprint::FORMAT_VERSION, file);
 	}
 
-	void ShaderBlueprintResourceLoader::onProcessing()
+	bool ShaderBlueprintResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -114,6 +114,9 @@ namespace Renderer
 			mMemoryFile.read(mShaderSourceCode, shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
 			mShaderBlueprintResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
 		}
+
+		// Done
+		return true;
 	}
 
 	bool ShaderBlueprintResourceLoader::onDispatch()
@@ -56,7 +56,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1ShaderPiece::FORMAT_TYPE, v1ShaderPiece::FORMAT_VERSION, file);
 	}
 
-	void ShaderPieceResourceLoader::onProcessing()
+	bool ShaderPieceResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -79,6 +79,9 @@ namespace Renderer
 		// Read the shader piece ASCII source code
 		mMemoryFile.read(mShaderSourceCode, shaderPieceHeader.numberOfShaderSourceCodeBytes);
 		mShaderPieceResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderPieceHeader.numberOfShaderSourceCodeBytes);
+
+		// Done
+		return true;
 	}
 
 	bool ShaderPieceResourceLoader::onDispatch()
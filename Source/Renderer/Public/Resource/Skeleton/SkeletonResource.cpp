@@ -33,6 +33,48 @@ PRAGMA_WARNING_PUSH
 	#include <glm/gtx/dual_quaternion.hpp>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4061)	// warning C4061: enumerator 'rtm::mix4::b' in switch of enum 'rtm::mix4' is not explicitly handled by a case label
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'initializing': conversion from 'int' to 'uint8_t', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(5246)	// warning C5246 '<x>': the initialization of a subobject should be wrapped in braces
+	#include <rtm/matrix3x4f.h>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		// The bone matrices are affine, the GLM matrix columns are the RTM matrix axes
+		[[nodiscard]] inline rtm::matrix3x4f loadAffineBoneMatrix(const glm::mat4& matrix)
+		{
+			return rtm::matrix3x4f{ rtm::vector_load(&matrix[0].x), rtm::vector_load(&matrix[1].x), rtm::vector_load(&matrix[2].x), rtm::vector_load(&matrix[3].x) };
+		}
+
+		inline void storeAffineBoneMatrix(const rtm::matrix3x4f& matrix, glm::mat4& destination)
+		{
+			rtm::vector_store(matrix.x_axis, &destination[0].x);
+			rtm::vector_store(matrix.y_axis, &destination[1].x);
+			rtm::vector_store(matrix.z_axis, &destination[2].x);
+			rtm::vector_store(matrix.w_axis, &destination[3].x);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -63,10 +105,10 @@ namespace Renderer
 		mGlobalBoneMatrices[0] = mLocalBoneMatrices[0];
 
 		// Due to cache friendly depth-first rolled up bone hierarchy, the global parent bone pose is already up-to-date
-		// TODO(co) Ensure that in the end SIMD intrinsics in GLM are used in here
+		// -> SIMD affine matrix multiplication, RTM multiplication order is "rtm::matrix_mul(local, parentGlobal)" which is "parentGlobal * local" in GLM notation
 		for (uint8_t i = 1; i < mNumberOfBones; ++i)
 		{
-			mGlobalBoneMatrices[i] = mGlobalBoneMatrices[mBoneParentIndices[i]] * mLocalBoneMatrices[i];
+			::detail::storeAffineBoneMatrix(rtm::matrix_mul(::detail::loadAffineBoneMatrix(mLocalBoneMatrices[i]), ::detail::loadAffineBoneMatrix(mGlobalBoneMatrices[mBoneParentIndices[i]])), mGlobalBoneMatrices[i]);
 		}
 
 		/*
@@ -50,7 +50,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("SkeletonAnimation");
-		static constexpr uint32_t FORMAT_VERSION = 3;
+		static constexpr uint32_t FORMAT_VERSION = 4;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -90,9 +90,10 @@ namespace Renderer
 			return false;
 		}
 
-		inline virtual void onProcessing() override
+		[[nodiscard]] inline virtual bool onProcessing() override
 		{
 			// Nothing here
+			return true;
 		}
 
 		[[nodiscard]] inline virtual bool onDispatch() override
@@ -28,6 +28,148 @@
 #include "Renderer/Public/Resource/Skeleton/SkeletonResource.h"
 #include "Renderer/Public/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4061)	// warning C4061: enumerator 'rtm::mix4::b' in switch of enum 'rtm::mix4' is not explicitly handled by a case label
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'initializing': conversion from 'int' to 'uint8_t', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(5246)	// warning C5246 '<x>': the initialization of a subobject should be wrapped in braces
+	#include <rtm/matrix3x4f.h>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/gtx/matrix_decompose.hpp>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <algorithm>
+	#include <cmath>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void resizeBlendPose(std::vector<glm::vec4>& rotations, std::vector<glm::vec4>& translations, std::vector<glm::vec4>& scales, std::vector<float>& boneWeights, uint8_t numberOfBones)
+		{
+			rotations.resize(numberOfBones);
+			translations.resize(numberOfBones);
+			scales.resize(numberOfBones);
+			boneWeights.assign(numberOfBones, 0.0f);
+		}
+
+		// Normalized weighted accumulation: each contribution is linearly interpolated in by its share of the accumulated weight
+		void accumulateBonePose(glm::vec4& rotation, glm::vec4& translation, glm::vec4& scale, float& accumulatedWeight, const glm::vec4& sourceRotation, const glm::vec4& sourceTranslation, const glm::vec4& sourceScale, float weight)
+		{
+			if (0.0f == accumulatedWeight)
+			{
+				// First contribution, don't interpolate with undefined data
+				rotation = sourceRotation;
+				translation = sourceTranslation;
+				scale = sourceScale;
+				accumulatedWeight = weight;
+			}
+			else
+			{
+				accumulatedWeight += weight;
+				const float alpha = weight / accumulatedWeight;
+				rtm::quat_store(rtm::quat_lerp(rtm::quat_load(&rotation.x), rtm::quat_load(&sourceRotation.x), alpha), &rotation.x);
+				rtm::vector_store(rtm::vector_lerp(rtm::vector_load(&translation.x), rtm::vector_load(&sourceTranslation.x), alpha), &translation.x);
+				rtm::vector_store(rtm::vector_lerp(rtm::vector_load(&scale.x), rtm::vector_load(&sourceScale.x), alpha), &scale.x);
+			}
+		}
+
+		// Blend a bone pose over the bone pose of the layers below, bones which aren't posed by the layers below are blended over their bind pose
+		void blendBonePose(glm::vec4& rotation, glm::vec4& translation, glm::vec4& scale, float& boneWeight, const glm::vec4& sourceRotation, const glm::vec4& sourceTranslation, const glm::vec4& sourceScale, const glm::vec4& bindRotation, const glm::vec4& bindTranslation, const glm::vec4& bindScale, float alpha)
+		{
+			if (0.0f == boneWeight)
+			{
+				rotation = bindRotation;
+				translation = bindTranslation;
+				scale = bindScale;
+				boneWeight = 1.0f;
+			}
+			rtm::quat_store(rtm::quat_lerp(rtm::quat_load(&rotation.x), rtm::quat_load(&sourceRotation.x), alpha), &rotation.x);
+			rtm::vector_store(rtm::vector_lerp(rtm::vector_load(&translation.x), rtm::vector_load(&sourceTranslation.x), alpha), &translation.x);
+			rtm::vector_store(rtm::vector_lerp(rtm::vector_load(&scale.x), rtm::vector_load(&sourceScale.x), alpha), &scale.x);
+		}
+
+		// Decompose the local bone matrices into the bone poses
+		void decomposeBonePose(const glm::mat4* localBoneMatrices, uint8_t numberOfBones, std::vector<glm::vec4>& rotations, std::vector<glm::vec4>& translations, std::vector<glm::vec4>& scales, std::vector<float>& boneWeights)
+		{
+			resizeBlendPose(rotations, translations, scales, boneWeights, numberOfBones);
+			for (uint8_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
+			{
+				glm::vec3 scale;
+				glm::quat rotation;
+				glm::vec3 translation;
+				glm::vec3 skew;
+				glm::vec4 perspective;
+				glm::decompose(localBoneMatrices[boneIndex], scale, rotation, translation, skew, perspective);
+				rotations[boneIndex] = glm::vec4(rotation.x, rotation.y, rotation.z, rotation.w);
+				translations[boneIndex] = glm::vec4(translation, 0.0f);
+				scales[boneIndex] = glm::vec4(scale, 0.0f);
+				boneWeights[boneIndex] = 1.0f;
+			}
+		}
+
+		// Add the difference of a bone pose to its reference bone pose onto a bone pose
+		void addBonePose(glm::vec4& rotation, glm::vec4& translation, glm::vec4& scale, const glm::vec4& sourceRotation, const glm::vec4& sourceTranslation, const glm::vec4& sourceScale, const glm::vec4& referenceRotation, const glm::vec4& referenceTranslation, const glm::vec4& referenceScale, float alpha)
+		{
+			// RTM multiplication order is "rtm::quat_mul(a, b)" which is "b * a" in GLM notation
+			// -> The bone local delta rotation is "conjugate(reference) * source" and is applied as "rotation * delta" in GLM notation, so "source = reference * delta" holds for a full weight
+			const rtm::quatf deltaRotation = rtm::quat_mul(rtm::quat_load(&sourceRotation.x), rtm::quat_conjugate(rtm::quat_load(&referenceRotation.x)));
+			const rtm::quatf weightedDeltaRotation = rtm::quat_lerp(rtm::quat_identity(), deltaRotation, alpha);
+			rtm::quat_store(rtm::quat_normalize(rtm::quat_mul(weightedDeltaRotation, rtm::quat_load(&rotation.x))), &rotation.x);
+
+			// Translations are added, scales are multiplied
+			const rtm::vector4f deltaTranslation = rtm::vector_sub(rtm::vector_load(&sourceTranslation.x), rtm::vector_load(&referenceTranslation.x));
+			rtm::vector_store(rtm::vector_add(rtm::vector_load(&translation.x), rtm::vector_mul(deltaTranslation, alpha)), &translation.x);
+			const rtm::vector4f deltaScale = rtm::vector_div(rtm::vector_load(&sourceScale.x), rtm::vector_load(&referenceScale.x));
+			rtm::vector_store(rtm::vector_mul(rtm::vector_load(&scale.x), rtm::vector_lerp(rtm::vector_set(1.0f), deltaScale, alpha)), &scale.x);
+		}
+
+		void applyBoneMaskWeight(const Renderer::SkeletonResource& skeletonResource, uint32_t boneId, float weight, bool includeChildren, std::vector<float>& boneWeights)
+		{
+			const uint32_t boneIndex = skeletonResource.getBoneIndexByBoneId(boneId);
+			if (Renderer::isValid(boneIndex))
+			{
+				boneWeights[boneIndex] = weight;
+				if (includeChildren)
+				{
+					// Due to cache friendly depth-first rolled up bone hierarchy, the children are directly behind the bone and all of them have a parent index which isn't below the bone index
+					const uint8_t numberOfBones = skeletonResource.getNumberOfBones();
+					const uint8_t* boneParentIndices = skeletonResource.getBoneParentIndices();
+					for (uint32_t i = boneIndex + 1; i < numberOfBones && boneParentIndices[i] >= boneIndex; ++i)
+					{
+						boneWeights[i] = weight;
+					}
+				}
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -42,28 +184,109 @@ namespace Renderer
 	void SkeletonAnimationController::startSkeletonAnimationByResourceId(SkeletonAnimationResourceId skeletonAnimationResourceId)
 	{
 		clear();
-		mSkeletonAnimationResourceId = skeletonAnimationResourceId;
 		if (isValid(skeletonAnimationResourceId))
 		{
-			mRenderer.getSkeletonAnimationResourceManager().getResourceByResourceId(skeletonAnimationResourceId).connectResourceListener(*this);
+			playSkeletonAnimationByResourceId(BASE_LAYER_INDEX, skeletonAnimationResourceId);
 		}
 	}
 
 	void SkeletonAnimationController::startSkeletonAnimationByAssetId(AssetId skeletonAnimationAssetId)
 	{
 		clear();
-		mRenderer.getSkeletonAnimationResourceManager().loadSkeletonAnimationResourceByAssetId(skeletonAnimationAssetId, mSkeletonAnimationResourceId, this);
+		playSkeletonAnimationByAssetId(BASE_LAYER_INDEX, skeletonAnimationAssetId);
+	}
+
+	void SkeletonAnimationController::playSkeletonAnimationByResourceId(uint32_t layerIndex, SkeletonAnimationResourceId skeletonAnimationResourceId, float weight, float fadeDurationInSeconds)
+	{
+		// Sanity checks
+		RHI_ASSERT(mRenderer.getContext(), layerIndex < mLayers.size(), "Invalid skeleton animation controller layer index")
+		RHI_ASSERT(mRenderer.getContext(), isValid(skeletonAnimationResourceId), "Invalid skeleton animation resource ID")
+		RHI_ASSERT(mRenderer.getContext(), weight >= 0.0f, "Invalid skeleton animation weight")
+
+		// Fade to the given weight
+		SkeletonAnimation& skeletonAnimation = getOrAddSkeletonAnimation(layerIndex, skeletonAnimationResourceId);
+		skeletonAnimation.targetWeight = weight;
+		if (fadeDurationInSeconds > 0.0f)
+		{
+			skeletonAnimation.weightChangePerSecond = std::abs(weight - skeletonAnimation.weight) / fadeDurationInSeconds;
+		}
+		else
+		{
+			skeletonAnimation.weight = weight;
+			skeletonAnimation.weightChangePerSecond = 0.0f;
+		}
+	}
+
+	void SkeletonAnimationController::playSkeletonAnimationByAssetId(uint32_t layerIndex, AssetId skeletonAnimationAssetId, float weight, float fadeDurationInSeconds)
+	{
+		SkeletonAnimationResourceId skeletonAnimationResourceId = getInvalid<SkeletonAnimationResourceId>();
+		mRenderer.getSkeletonAnimationResourceManager().loadSkeletonAnimationResourceByAssetId(skeletonAnimationAssetId, skeletonAnimationResourceId, this);
+		if (isValid(skeletonAnimationResourceId))
+		{
+			playSkeletonAnimationByResourceId(layerIndex, skeletonAnimationResourceId, weight, fadeDurationInSeconds);
+		}
+	}
+
+	void SkeletonAnimationController::crossFadeToSkeletonAnimationByAssetId(uint32_t layerIndex, AssetId skeletonAnimationAssetId, float fadeDurationInSeconds)
+	{
+		// Sanity check
+		RHI_ASSERT(mRenderer.getContext(), layerIndex < mLayers.size(), "Invalid skeleton animation controller layer index")
+
+		// Fade out all skeleton animations of the layer, the skeleton animation to fade in is set afterwards and hence isn't faded out in case it's already playing
+		for (SkeletonAnimation& skeletonAnimation : mLayers[layerIndex].skeletonAnimations)
+		{
+			skeletonAnimation.targetWeight = 0.0f;
+			skeletonAnimation.weightChangePerSecond = (fadeDurationInSeconds > 0.0f) ? (skeletonAnimation.weight / fadeDurationInSeconds) : 0.0f;
+			if (fadeDurationInSeconds <= 0.0f)
+			{
+				skeletonAnimation.weight = 0.0f;
+			}
+		}
+		playSkeletonAnimationByAssetId(layerIndex, skeletonAnimationAssetId, 1.0f, fadeDurationInSeconds);
+	}
+
+	uint32_t SkeletonAnimationController::addLayer(BlendMode blendMode, float weight)
+	{
+		Layer& layer = mLayers.emplace_back();
+		layer.blendMode = blendMode;
+		layer.weight = weight;
+		return static_cast<uint32_t>(mLayers.size() - 1);
+	}
+
+	void SkeletonAnimationController::setLayerWeight(uint32_t layerIndex, float weight)
+	{
+		RHI_ASSERT(mRenderer.getContext(), layerIndex < mLayers.size(), "Invalid skeleton animation controller layer index")
+		mLayers[layerIndex].weight = weight;
+	}
+
+	void SkeletonAnimationController::setLayerBoneMaskWeight(uint32_t layerIndex, uint32_t boneId, float weight, bool includeChildren)
+	{
+		RHI_ASSERT(mRenderer.getContext(), layerIndex < mLayers.size(), "Invalid skeleton animation controller layer index")
+		Layer& layer = mLayers[layerIndex];
+		layer.boneMaskEntries.push_back({boneId, weight, includeChildren});
+		layer.boneWeights.clear();	// Resolved during the next evaluation
+	}
+
+	void SkeletonAnimationController::clearLayerBoneMask(uint32_t layerIndex)
+	{
+		RHI_ASSERT(mRenderer.getContext(), layerIndex < mLayers.size(), "Invalid skeleton animation controller layer index")
+		Layer& layer = mLayers[layerIndex];
+		layer.boneMaskEntries.clear();
+		layer.boneWeights.clear();
 	}
 
 	void SkeletonAnimationController::clear()
 	{
-		if (isValid(mSkeletonAnimationResourceId))
+		for (Layer& layer : mLayers)
 		{
-			disconnectFromResourceById(mSkeletonAnimationResourceId);
-			setInvalid(mSkeletonAnimationResourceId);
+			for (SkeletonAnimation& skeletonAnimation : layer.skeletonAnimations)
+			{
+				destroySkeletonAnimationEvaluator(skeletonAnimation);
+			}
 		}
-		destroySkeletonAnimationEvaluator();
-		mTimeInSeconds = 0.0f;
+		disconnectFromAllResources();
+		mLayers.clear();
+		mLayers.emplace_back();
 	}
 
 
@@ -72,13 +295,23 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	void SkeletonAnimationController::onLoadingStateChange(const IResource& resource)
 	{
-		if (resource.getLoadingState() == IResource::LoadingState::LOADED)
+		const bool loaded = (resource.getLoadingState() == IResource::LoadingState::LOADED);
+		for (Layer& layer : mLayers)
 		{
-			createSkeletonAnimationEvaluator();
-		}
-		else
-		{
-			destroySkeletonAnimationEvaluator();
+			for (SkeletonAnimation& skeletonAnimation : layer.skeletonAnimations)
+			{
+				if (skeletonAnimation.skeletonAnimationResourceId == resource.getId())
+				{
+					if (!loaded)
+					{
+						destroySkeletonAnimationEvaluator(skeletonAnimation);
+					}
+					else if (nullptr == skeletonAnimation.skeletonAnimationEvaluator)
+					{
+						createSkeletonAnimationEvaluator(skeletonAnimation);
+					}
+				}
+			}
 		}
 	}
 
@@ -86,60 +319,371 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	void SkeletonAnimationController::createSkeletonAnimationEvaluator()
+	SkeletonAnimationController::SkeletonAnimation& SkeletonAnimationController::getOrAddSkeletonAnimation(uint32_t layerIndex, SkeletonAnimationResourceId skeletonAnimationResourceId)
+	{
+		// Each skeleton animation is only once inside a layer
+		Layer& layer = mLayers[layerIndex];
+		for (SkeletonAnimation& skeletonAnimation : layer.skeletonAnimations)
+		{
+			if (skeletonAnimation.skeletonAnimationResourceId == skeletonAnimationResourceId)
+			{
+				return skeletonAnimation;
+			}
+		}
+
+		// Add the skeleton animation
+		SkeletonAnimation& skeletonAnimation = layer.skeletonAnimations.emplace_back();
+		skeletonAnimation.skeletonAnimationResourceId = skeletonAnimationResourceId;
+
+		// Connecting to an already connected resource does nothing, so check whether or not the skeleton animation can be evaluated right away
+		IResource& resource = mRenderer.getSkeletonAnimationResourceManager().getResourceByResourceId(skeletonAnimationResourceId);
+		resource.connectResourceListener(*this);
+		if (nullptr == skeletonAnimation.skeletonAnimationEvaluator && resource.getLoadingState() == IResource::LoadingState::LOADED)
+		{
+			createSkeletonAnimationEvaluator(skeletonAnimation);
+		}
+
+		// Done
+		return skeletonAnimation;
+	}
+
+	SkeletonAnimationController::SkeletonAnimations::iterator SkeletonAnimationController::removeSkeletonAnimation(Layer& layer, SkeletonAnimations::iterator iterator)
 	{
-		RHI_ASSERT(mRenderer.getContext(), nullptr == mSkeletonAnimationEvaluator, "No useless update calls, please")
+		const SkeletonAnimationResourceId skeletonAnimationResourceId = iterator->skeletonAnimationResourceId;
+		destroySkeletonAnimationEvaluator(*iterator);
+		iterator = layer.skeletonAnimations.erase(iterator);
+
+		// Disconnect from the skeleton animation resource, in case no other layer is using it
+		for (const Layer& currentLayer : mLayers)
+		{
+			for (const SkeletonAnimation& skeletonAnimation : currentLayer.skeletonAnimations)
+			{
+				if (skeletonAnimation.skeletonAnimationResourceId == skeletonAnimationResourceId)
+				{
+					return iterator;
+				}
+			}
+		}
+		disconnectFromResourceById(skeletonAnimationResourceId);
+
+		// Done
+		return iterator;
+	}
+
+	void SkeletonAnimationController::createSkeletonAnimationEvaluator(SkeletonAnimation& skeletonAnimation)
+	{
+		RHI_ASSERT(mRenderer.getContext(), nullptr == skeletonAnimation.skeletonAnimationEvaluator, "No useless update calls, please")
 		SkeletonAnimationResourceManager& skeletonAnimationResourceManager = mRenderer.getSkeletonAnimationResourceManager();
-		mSkeletonAnimationEvaluator = new SkeletonAnimationEvaluator(skeletonAnimationResourceManager, mSkeletonAnimationResourceId);
+		skeletonAnimation.skeletonAnimationEvaluator = new SkeletonAnimationEvaluator(skeletonAnimationResourceManager, skeletonAnimation.skeletonAnimationResourceId);
+		skeletonAnimation.boneIndices.clear();
 
-		// Register skeleton animation controller
-		skeletonAnimationResourceManager.mSkeletonAnimationControllers.push_back(this);
+		// Register skeleton animation controller as soon as there's something to evaluate
+		if (0 == mNumberOfSkeletonAnimationEvaluators)
+		{
+			skeletonAnimationResourceManager.mSkeletonAnimationControllers.push_back(this);
+		}
+		++mNumberOfSkeletonAnimationEvaluators;
 	}
 
-	void SkeletonAnimationController::destroySkeletonAnimationEvaluator()
+	void SkeletonAnimationController::destroySkeletonAnimationEvaluator(SkeletonAnimation& skeletonAnimation)
 	{
-		if (nullptr != mSkeletonAnimationEvaluator)
+		if (nullptr != skeletonAnimation.skeletonAnimationEvaluator)
 		{
-			{ // Unregister skeleton animation controller
+			// Destroy skeleton animation evaluator
+			delete skeletonAnimation.skeletonAnimationEvaluator;
+			skeletonAnimation.skeletonAnimationEvaluator = nullptr;
+			skeletonAnimation.boneIndices.clear();
+
+			// Unregister skeleton animation controller as soon as there's nothing left to evaluate
+			RHI_ASSERT(mRenderer.getContext(), mNumberOfSkeletonAnimationEvaluators > 0, "Invalid number of skeleton animation evaluators")
+			--mNumberOfSkeletonAnimationEvaluators;
+			if (0 == mNumberOfSkeletonAnimationEvaluators)
+			{
 				SkeletonAnimationResourceManager::SkeletonAnimationControllers& skeletonAnimationControllers = mRenderer.getSkeletonAnimationResourceManager().mSkeletonAnimationControllers;
 				SkeletonAnimationResourceManager::SkeletonAnimationControllers::iterator iterator = std::find(skeletonAnimationControllers.begin(), skeletonAnimationControllers.end(), this);
 				RHI_ASSERT(mRenderer.getContext(), iterator != skeletonAnimationControllers.end(), "Invalid skeleton animation controller")
 				skeletonAnimationControllers.erase(iterator);
-			}
 
-			// Destroy skeleton animation evaluator
-			delete mSkeletonAnimationEvaluator;
-			mSkeletonAnimationEvaluator = nullptr;
+				// Nothing left to evaluate for an unculled skeleton animation controller, either
+				SkeletonAnimationResourceManager::SkeletonAnimationControllers& unculledSkeletonAnimationControllers = mRenderer.getSkeletonAnimationResourceManager().mUnculledSkeletonAnimationControllers;
+				iterator = std::find(unculledSkeletonAnimationControllers.begin(), unculledSkeletonAnimationControllers.end(), this);
+				if (iterator != unculledSkeletonAnimationControllers.end())
+				{
+					unculledSkeletonAnimationControllers.erase(iterator);
+				}
+			}
 		}
 	}
 
-	void SkeletonAnimationController::update(float pastSecondsSinceLastFrame)
+	void SkeletonAnimationController::advanceTime(float pastSecondsSinceLastFrame)
 	{
 		// Sanity check
 		RHI_ASSERT(mRenderer.getContext(), pastSecondsSinceLastFrame > 0.0f, "No negative time, please")
-		RHI_ASSERT(mRenderer.getContext(), nullptr != mSkeletonAnimationEvaluator, "No useless update calls, please")
 
-		// Advance time and evaluate state
-		mTimeInSeconds += pastSecondsSinceLastFrame;
-		mSkeletonAnimationEvaluator->evaluate(mTimeInSeconds);
+		// Advance time and fade weights, remove faded out skeleton animations
+		mSecondsSinceEvaluation += pastSecondsSinceLastFrame;
+		for (Layer& layer : mLayers)
+		{
+			SkeletonAnimations::iterator iterator = layer.skeletonAnimations.begin();
+			while (iterator != layer.skeletonAnimations.end())
+			{
+				SkeletonAnimation& skeletonAnimation = *iterator;
+				skeletonAnimation.timeInSeconds += pastSecondsSinceLastFrame;
+				if (skeletonAnimation.weightChangePerSecond > 0.0f)
+				{
+					const float weightChange = skeletonAnimation.weightChangePerSecond * pastSecondsSinceLastFrame;
+					skeletonAnimation.weight = (skeletonAnimation.weight < skeletonAnimation.targetWeight) ? std::min(skeletonAnimation.weight + weightChange, skeletonAnimation.targetWeight) : std::max(skeletonAnimation.weight - weightChange, skeletonAnimation.targetWeight);
+					if (skeletonAnimation.weight == skeletonAnimation.targetWeight)
+					{
+						skeletonAnimation.weightChangePerSecond = 0.0f;
+					}
+				}
+				if (skeletonAnimation.weight <= 0.0f && skeletonAnimation.targetWeight <= 0.0f)
+				{
+					iterator = removeSkeletonAnimation(layer, iterator);
+				}
+				else
+				{
+					++iterator;
+				}
+			}
+		}
+	}
+
+	void SkeletonAnimationController::reportDistanceToCamera(float distanceToCamera)
+	{
+		if (!mReceivesDistanceToCamera)
+		{
+			mReceivesDistanceToCamera = true;
+			mMinimumDistanceToCamera = distanceToCamera;
+		}
+		else if (mMinimumDistanceToCamera > distanceToCamera)
+		{
+			mMinimumDistanceToCamera = distanceToCamera;
+		}
+
+		// The last update didn't evaluate the culled skeleton animation, let the skeleton animation resource manager evaluate it before the visible instance gets rendered
+		// -> The level of detail based on the distance to the camera is set by the next update, until then the previous one is used
+		if (mCulled)
+		{
+			mCulled = false;
+			if (mNumberOfSkeletonAnimationEvaluators > 0)
+			{
+				mRenderer.getSkeletonAnimationResourceManager().mUnculledSkeletonAnimationControllers.push_back(this);
+			}
+		}
+	}
+
+	void SkeletonAnimationController::setLod(float evaluationIntervalInSeconds, bool skipLeafBones)
+	{
+		// Switching between evaluation each update and interpolation requires a fresh pose to start with
+		if ((0.0f == mEvaluationIntervalInSeconds) != (0.0f == evaluationIntervalInSeconds))
+		{
+			mPoseOutdated = true;
+		}
+		mEvaluationIntervalInSeconds = evaluationIntervalInSeconds;
+		mSkipLeafBones = skipLeafBones;
+	}
+
+	void SkeletonAnimationController::evaluate()
+	{
+		// Sanity check
+		RHI_ASSERT(mRenderer.getContext(), mNumberOfSkeletonAnimationEvaluators > 0, "No useless update calls, please")
 
-		{ // Tell the controlled skeleton resource about the new state
-			SkeletonResource& skeletonResource = mRenderer.getSkeletonResourceManager().getById(mSkeletonResourceId);
-			const SkeletonAnimationEvaluator::BoneIds& boneIds = mSkeletonAnimationEvaluator->getBoneIds();
-			const SkeletonAnimationEvaluator::TransformMatrices& transformMatrices = mSkeletonAnimationEvaluator->getTransformMatrices();
-			glm::mat4* localBoneMatrices = skeletonResource.getLocalBoneMatrices();
-			for (size_t i = 0; i < boneIds.size(); ++i)
+		// Gather the leaf bones once, bones are leaf bones until a child references them
+		// -> The skeleton hasn't been posed by this controller yet, so this is also the moment to capture the bind pose
+		const SkeletonResource& skeletonResource = mRenderer.getSkeletonResourceManager().getById(mSkeletonResourceId);
+		const uint8_t numberOfBones = skeletonResource.getNumberOfBones();
+		if (mLeafBones.size() != numberOfBones)
+		{
+			::detail::decomposeBonePose(skeletonResource.getLocalBoneMatrices(), numberOfBones, mBindPose.rotations, mBindPose.translations, mBindPose.scales, mBindPose.boneWeights);
+			mLeafBones.assign(numberOfBones, 1);
+			const uint8_t* boneParentIndices = skeletonResource.getBoneParentIndices();
+			for (uint8_t boneIndex = 1; boneIndex < numberOfBones; ++boneIndex)
 			{
-				const uint32_t boneIndex = skeletonResource.getBoneIndexByBoneId(boneIds[i]);
-				if (isValid(boneIndex))
+				mLeafBones[boneParentIndices[boneIndex]] = 0;
+			}
+		}
+
+		// Evaluate the skeleton animations only if required by the level of detail
+		const bool interpolate = (mEvaluationIntervalInSeconds > 0.0f);
+		if (!interpolate)
+		{
+			evaluatePose(skeletonResource, 0.0f, mPose);
+			mSecondsSinceEvaluation = 0.0f;
+		}
+		else if (mPoseOutdated || mSecondsSinceEvaluation >= mTargetPoseIntervalInSeconds)
+		{
+			// The pose at the end of the last evaluation interval is the pose at the start of the new one, evaluate ahead of time to be able to interpolate
+			// -> A level of detail change only takes effect for the next target pose, the pending one stays valid for the interval it was evaluated with
+			if (mPoseOutdated)
+			{
+				evaluatePose(skeletonResource, 0.0f, mPose);
+			}
+			std::swap(mPreviousPose, mPose);
+			evaluatePose(skeletonResource, mEvaluationIntervalInSeconds, mPose);
+			mTargetPoseIntervalInSeconds = mEvaluationIntervalInSeconds;
+			mSecondsSinceEvaluation = 0.0f;
+		}
+		mPoseOutdated = false;
+
+		// Build the transform matrices of the posed bones using SIMD: translate * rotate * scale in a single step, without temporary matrices
+		const glm::vec4* RESTRICT rotations = mPose.rotations.data();
+		const glm::vec4* RESTRICT translations = mPose.translations.data();
+		const glm::vec4* RESTRICT scales = mPose.scales.data();
+		const float* RESTRICT boneWeights = mPose.boneWeights.data();
+		const float* RESTRICT previousBoneWeights = interpolate ? mPreviousPose.boneWeights.data() : nullptr;
+		const float alpha = interpolate ? std::min(mSecondsSinceEvaluation / mTargetPoseIntervalInSeconds, 1.0f) : 1.0f;
+		mTransformMatrices.resize(numberOfBones);
+		glm::mat4* RESTRICT transformMatrices = mTransformMatrices.data();
+		for (uint8_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
+		{
+			if (boneWeights[boneIndex] > 0.0f)
+			{
+				rtm::quatf rotation = rtm::quat_load(&rotations[boneIndex].x);
+				rtm::vector4f translation = rtm::vector_load(&translations[boneIndex].x);
+				rtm::vector4f scale = rtm::vector_load(&scales[boneIndex].x);
+				if (nullptr != previousBoneWeights && previousBoneWeights[boneIndex] > 0.0f)
 				{
-					localBoneMatrices[boneIndex] = transformMatrices[i];
+					// Interpolate between the evaluated poses
+					rotation = rtm::quat_lerp(rtm::quat_load(&mPreviousPose.rotations[boneIndex].x), rotation, alpha);
+					translation = rtm::vector_lerp(rtm::vector_load(&mPreviousPose.translations[boneIndex].x), translation, alpha);
+					scale = rtm::vector_lerp(rtm::vector_load(&mPreviousPose.scales[boneIndex].x), scale, alpha);
 				}
+				const rtm::matrix3x4f transformMatrix = rtm::matrix_from_qvv(rotation, translation, scale);
+				glm::mat4& destination = transformMatrices[boneIndex];
+				rtm::vector_store(transformMatrix.x_axis, &destination[0].x);
+				rtm::vector_store(transformMatrix.y_axis, &destination[1].x);
+				rtm::vector_store(transformMatrix.z_axis, &destination[2].x);
+				rtm::vector_store(rtm::vector_set_w(transformMatrix.w_axis, 1.0f), &destination[3].x);
 			}
-			skeletonResource.localToGlobalPose();
 		}
 	}
 
+	void SkeletonAnimationController::evaluatePose(const SkeletonResource& skeletonResource, float timeOffsetInSeconds, Pose& pose)
+	{
+		// Reset the blended pose, bones which aren't posed by any layer keep their current local bone matrix
+		const uint8_t numberOfBones = skeletonResource.getNumberOfBones();
+		::detail::resizeBlendPose(pose.rotations, pose.translations, pose.scales, pose.boneWeights, numberOfBones);
+		glm::vec4* RESTRICT rotations = pose.rotations.data();
+		glm::vec4* RESTRICT translations = pose.translations.data();
+		glm::vec4* RESTRICT scales = pose.scales.data();
+		float* RESTRICT boneWeights = pose.boneWeights.data();
+		const uint8_t* skippedBones = mSkipLeafBones ? mLeafBones.data() : nullptr;
+		// Evaluate and blend the layers from bottom to top
+		for (Layer& layer : mLayers)
+		{
+			if (layer.weight <= 0.0f || layer.skeletonAnimations.empty())
+			{
+				continue;
+			}
+
+			// Resolve the bone mask, if there's one
+			if (!layer.boneMaskEntries.empty() && layer.boneWeights.empty())
+			{
+				layer.boneWeights.resize(numberOfBones, 0.0f);
+				for (const BoneMaskEntry& boneMaskEntry : layer.boneMaskEntries)
+				{
+					::detail::applyBoneMaskWeight(skeletonResource, boneMaskEntry.boneId, boneMaskEntry.weight, boneMaskEntry.includeChildren, layer.boneWeights);
+				}
+			}
+			const float* boneMaskWeights = layer.boneWeights.empty() ? nullptr : layer.boneWeights.data();
+
+			// Evaluate the skeleton animations of the layer
+			if (BlendMode::OVERRIDE == layer.blendMode)
+			{
+				::detail::resizeBlendPose(mLayerPose.rotations, mLayerPose.translations, mLayerPose.scales, mLayerPose.boneWeights, numberOfBones);
+			}
+			for (SkeletonAnimation& skeletonAnimation : layer.skeletonAnimations)
+			{
+				SkeletonAnimationEvaluator* skeletonAnimationEvaluator = skeletonAnimation.skeletonAnimationEvaluator;
+				if (nullptr == skeletonAnimationEvaluator || skeletonAnimation.weight <= 0.0f)
+				{
+					continue;
+				}
+				skeletonAnimationEvaluator->evaluate(skeletonAnimation.timeInSeconds + timeOffsetInSeconds);
+
+				// Gather the skeleton bone indices once instead of searching the bone IDs each frame
+				const SkeletonAnimationEvaluator::BoneIds& boneIds = skeletonAnimationEvaluator->getBoneIds();
+				if (skeletonAnimation.boneIndices.empty())
+				{
+					skeletonAnimation.boneIndices.resize(boneIds.size());
+					for (size_t i = 0; i < boneIds.size(); ++i)
+					{
+						skeletonAnimation.boneIndices[i] = skeletonResource.getBoneIndexByBoneId(boneIds[i]);
+					}
+				}
+
+				// Blend into the layer pose respectively add onto the pose of the layers below
+				const SkeletonAnimationEvaluator::Pose& pose = skeletonAnimationEvaluator->getPose();
+				if (BlendMode::OVERRIDE == layer.blendMode)
+				{
+					for (size_t i = 0; i < boneIds.size(); ++i)
+					{
+						const uint32_t boneIndex = skeletonAnimation.boneIndices[i];
+						if (isValid(boneIndex) && (nullptr == skippedBones || 0 == skippedBones[boneIndex]))
+						{
+							::detail::accumulateBonePose(mLayerPose.rotations[boneIndex], mLayerPose.translations[boneIndex], mLayerPose.scales[boneIndex], mLayerPose.boneWeights[boneIndex], pose.rotations[i], pose.translations[i], pose.scales[i], skeletonAnimation.weight);
+						}
+					}
+				}
+				else
+				{
+					const SkeletonAnimationEvaluator::Pose& referencePose = skeletonAnimationEvaluator->getReferencePose();
+					const float weight = layer.weight * skeletonAnimation.weight;
+					for (size_t i = 0; i < boneIds.size(); ++i)
+					{
+						const uint32_t boneIndex = skeletonAnimation.boneIndices[i];
+						if (isValid(boneIndex) && boneWeights[boneIndex] > 0.0f)
+						{
+							const float alpha = (nullptr != boneMaskWeights) ? weight * boneMaskWeights[boneIndex] : weight;
+							if (alpha > 0.0f)
+							{
+								::detail::addBonePose(rotations[boneIndex], translations[boneIndex], scales[boneIndex], pose.rotations[i], pose.translations[i], pose.scales[i], referencePose.rotations[i], referencePose.translations[i], referencePose.scales[i], alpha);
+							}
+						}
+					}
+				}
+			}
+
+			// Blend the override layer pose over the pose of the layers below
+			if (BlendMode::OVERRIDE == layer.blendMode)
+			{
+				const float layerWeight = std::min(layer.weight, 1.0f);
+				for (uint8_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
+				{
+					if (mLayerPose.boneWeights[boneIndex] > 0.0f)
+					{
+						const float alpha = (nullptr != boneMaskWeights) ? layerWeight * boneMaskWeights[boneIndex] : layerWeight;
+						if (alpha > 0.0f)
+						{
+							::detail::blendBonePose(rotations[boneIndex], translations[boneIndex], scales[boneIndex], boneWeights[boneIndex], mLayerPose.rotations[boneIndex], mLayerPose.translations[boneIndex], mLayerPose.scales[boneIndex], mBindPose.rotations[boneIndex], mBindPose.translations[boneIndex], mBindPose.scales[boneIndex], alpha);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	SkeletonResource& SkeletonAnimationController::applyPose()
+	{
+		// Tell the controlled skeleton resource about the new state
+		SkeletonResource& skeletonResource = mRenderer.getSkeletonResourceManager().getById(mSkeletonResourceId);
+		glm::mat4* localBoneMatrices = skeletonResource.getLocalBoneMatrices();
+		const uint8_t numberOfBones = skeletonResource.getNumberOfBones();
+		RHI_ASSERT(mRenderer.getContext(), mTransformMatrices.size() == numberOfBones && mPose.boneWeights.size() == numberOfBones, "Skeleton animation controller pose doesn't match the skeleton, \"Renderer::SkeletonAnimationController::evaluate()\" must be called before")
+		for (uint8_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
+		{
+			if (mPose.boneWeights[boneIndex] > 0.0f)
+			{
+				localBoneMatrices[boneIndex] = mTransformMatrices[boneIndex];
+			}
+		}
+
+		// Done
+		return skeletonResource;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
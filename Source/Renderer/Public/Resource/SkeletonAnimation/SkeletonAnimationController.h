@@ -31,6 +31,25 @@
 #include "Renderer/Public/Core/GetInvalid.h"
 #include "Renderer/Public/Resource/IResourceListener.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(5214)	// warning C5214: applying '*=' to an operand with a volatile qualified type is deprecated in C++20 (compiling source file E:\private\unrimp\Source\RendererToolkit\Private\AssetCompiler\TextureAssetCompiler.cpp)
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+	#include <limits>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -38,6 +57,7 @@
 namespace Renderer
 {
 	class IRenderer;
+	class SkeletonResource;
 	class SkeletonAnimationEvaluator;
 }
 
@@ -64,12 +84,21 @@ namespace Renderer
 	*  @brief
 	*    Rigid skeleton animation controller
 	*
+	*  @remarks
+	*    The skeleton animations are organized in layers which are evaluated from bottom to top:
+	*    - Each layer can play several skeleton animations at one and the same time, the normalized weights of the skeleton animations form a blend tree
+	*    - Cross-fades are realized by fading the weights of the skeleton animations over time
+	*    - An override layer blends its pose over the pose of the layers below, an additive layer adds its skeleton animations relative to their first frame
+	*    - The influence of a layer can be restricted to parts of the skeleton by using a bone mask
+	*    Blending happens in local pose space using rotation quaternions, translations and scales, each bone is converted into a transform matrix only once.
+	*    The base layer with index "Renderer::SkeletonAnimationController::BASE_LAYER_INDEX" always exists and is an override layer.
+	*
+	*    The skeleton animation level of detail (LOD) is driven by the reported distances to the camera, see "Renderer::SkeletonAnimationResourceManager::LodSettings".
+	*
+	*  @note
+	*    - Additive layers only influence bones which have been posed by the layers below
+	*
 	*  @todo
-	*    - TODO(co) Right now only a single skeleton animation at one and the same time is supported to have something to start with.
-	*               This isn't practical, of course, and in reality one has multiple animation sources at one and the same time which
-	*               are blended together. But well, as mentioned, one has to start somewhere.
-	*    - TODO(co) Currently "Renderer::SkeletonAnimationEvaluator" is directly used, probably it makes sense to manage those
-	*               and then update all of them in parallel using multithreading
 	*    - TODO(co) It might make sense to let the skeleton animation resource manager manage skeleton animation controller instances as well
 	*/
 	class SkeletonAnimationController final : public IResourceListener
@@ -79,7 +108,20 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend class SkeletonAnimationResourceManager;	// Calls "Renderer::SkeletonAnimationController::update()"
+		friend class SkeletonAnimationResourceManager;	// Drives the skeleton animation controller updates including the level of detail, calls e.g. "Renderer::SkeletonAnimationController::evaluate()"
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t BASE_LAYER_INDEX = 0;
+
+		enum class BlendMode : uint8_t
+		{
+			OVERRIDE = 0,	///< The layer pose is blended over the pose of the layers below
+			ADDITIVE = 1	///< The difference of the layer skeleton animations to their first frame is added onto the pose of the layers below
+		};
 
 
 	//[-------------------------------------------------------]
@@ -98,9 +140,16 @@ namespace Renderer
 		inline SkeletonAnimationController(const IRenderer& renderer, SkeletonResourceId skeletonResourceId) :
 			mRenderer(renderer),
 			mSkeletonResourceId(skeletonResourceId),
-			mSkeletonAnimationResourceId(getInvalid<SkeletonAnimationResourceId>()),
-			mSkeletonAnimationEvaluator(nullptr),
-			mTimeInSeconds(0.0f)
+			mLayers(1),
+			mNumberOfSkeletonAnimationEvaluators(0),
+			mReceivesDistanceToCamera(false),
+			mMinimumDistanceToCamera(0.0f),
+			mEvaluationIntervalInSeconds(0.0f),
+			mTargetPoseIntervalInSeconds(0.0f),
+			mSecondsSinceEvaluation(0.0f),
+			mSkipLeafBones(false),
+			mPoseOutdated(true),
+			mCulled(false)
 		{
 			// Nothing here
 		}
@@ -114,12 +163,43 @@ namespace Renderer
 			clear();
 		}
 
+		/**
+		*  @brief
+		*    Return the ID of the controlled skeleton resource
+		*
+		*  @return
+		*    The ID of the controlled skeleton resource
+		*/
+		[[nodiscard]] inline SkeletonResourceId getSkeletonResourceId() const
+		{
+			return mSkeletonResourceId;
+		}
+
+		/**
+		*  @brief
+		*    Report the distance to the camera of a rendered instance using the controlled skeleton resource, drives the skeleton animation level of detail
+		*
+		*  @param[in] distanceToCamera
+		*    Distance to the camera
+		*
+		*  @note
+		*    - Usually called by "Renderer::SkeletonMeshSceneItem" for each camera rendering it, the minimum distance reported since the last update is used
+		*    - Once there has been a report, a controller without reports since the last update is considered to be culled and its skeleton animation isn't evaluated
+		*    - Reports are done during rendering, after the update. So the first report of a controller which was culled by the last update queues it for "Renderer::SkeletonAnimationResourceManager::evaluateUnculledSkeletonAnimationControllers()", else the instance would be rendered with a stale pose for one frame.
+		*    - Controllers which never received a report are always evaluated with full detail
+		*    - Must not be called concurrently to "Renderer::SkeletonAnimationResourceManager::update()"
+		*/
+		void reportDistanceToCamera(float distanceToCamera);
+
 		/**
 		*  @brief
 		*    Start skeleton animation by resource ID
 		*
 		*  @param[in] skeletonAnimationResourceId
 		*    Skeleton animation resource ID
+		*
+		*  @note
+		*    - Clears the controller and plays the given skeleton animation with full weight on the base layer
 		*/
 		void startSkeletonAnimationByResourceId(SkeletonAnimationResourceId skeletonAnimationResourceId);
 
@@ -129,12 +209,112 @@ namespace Renderer
 		*
 		*  @param[in] skeletonAnimationAssetId
 		*    Skeleton animation asset ID
+		*
+		*  @note
+		*    - Clears the controller and plays the given skeleton animation with full weight on the base layer
 		*/
 		void startSkeletonAnimationByAssetId(AssetId skeletonAnimationAssetId);
 
+		/**
+		*  @brief
+		*    Set the weight of a skeleton animation inside a layer, the skeleton animation is added to the layer if required
+		*
+		*  @param[in] layerIndex
+		*    Index of the layer to play the skeleton animation on
+		*  @param[in] skeletonAnimationResourceId
+		*    Skeleton animation resource ID
+		*  @param[in] weight
+		*    Weight to fade to, the skeleton animation is removed from the layer as soon as zero is reached
+		*  @param[in] fadeDurationInSeconds
+		*    Duration in seconds to reach the weight, zero to set the weight immediately
+		*
+		*  @note
+		*    - Within an override layer the weights are normalized, so several skeleton animations with weights form a blend tree
+		*    - Within an additive layer the weights are the strengths of the skeleton animations
+		*/
+		RENDERER_API_EXPORT void playSkeletonAnimationByResourceId(uint32_t layerIndex, SkeletonAnimationResourceId skeletonAnimationResourceId, float weight = 1.0f, float fadeDurationInSeconds = 0.0f);
+
+		/**
+		*  @brief
+		*    Set the weight of a skeleton animation inside a layer, the skeleton animation is added to the layer if required
+		*
+		*  @see
+		*    - "Renderer::SkeletonAnimationController::playSkeletonAnimationByResourceId()"
+		*/
+		RENDERER_API_EXPORT void playSkeletonAnimationByAssetId(uint32_t layerIndex, AssetId skeletonAnimationAssetId, float weight = 1.0f, float fadeDurationInSeconds = 0.0f);
+
+		/**
+		*  @brief
+		*    Cross-fade from all skeleton animations of a layer to the given skeleton animation
+		*
+		*  @param[in] layerIndex
+		*    Index of the layer to cross-fade
+		*  @param[in] skeletonAnimationAssetId
+		*    Skeleton animation asset ID to fade in with full weight
+		*  @param[in] fadeDurationInSeconds
+		*    Duration of the cross-fade in seconds
+		*/
+		RENDERER_API_EXPORT void crossFadeToSkeletonAnimationByAssetId(uint32_t layerIndex, AssetId skeletonAnimationAssetId, float fadeDurationInSeconds);
+
+		/**
+		*  @brief
+		*    Add a layer on top of the existing layers
+		*
+		*  @param[in] blendMode
+		*    Blend mode of the layer
+		*  @param[in] weight
+		*    Weight of the layer, usually between zero and one
+		*
+		*  @return
+		*    Index of the added layer
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT uint32_t addLayer(BlendMode blendMode, float weight = 1.0f);
+
+		/**
+		*  @brief
+		*    Set the weight of a layer
+		*
+		*  @param[in] layerIndex
+		*    Index of the layer
+		*  @param[in] weight
+		*    Weight of the layer, usually between zero and one
+		*/
+		RENDERER_API_EXPORT void setLayerWeight(uint32_t layerIndex, float weight);
+
+		/**
+		*  @brief
+		*    Set the bone mask weight of a bone of a layer
+		*
+		*  @param[in] layerIndex
+		*    Index of the layer
+		*  @param[in] boneId
+		*    ID of the bone ("Renderer::StringId" on bone name)
+		*  @param[in] weight
+		*    Bone mask weight between zero and one
+		*  @param[in] includeChildren
+		*    If "true", the weight is also applied to all children of the bone
+		*
+		*  @note
+		*    - As soon as a layer has a bone mask, bones which aren't part of the bone mask aren't influenced by the layer
+		*    - Bone mask weights are applied in the order they were set, so e.g. an arm can be excluded again from an upper body bone mask
+		*/
+		RENDERER_API_EXPORT void setLayerBoneMaskWeight(uint32_t layerIndex, uint32_t boneId, float weight, bool includeChildren = true);
+
+		/**
+		*  @brief
+		*    Clear the bone mask of a layer, the layer influences all bones afterwards
+		*
+		*  @param[in] layerIndex
+		*    Index of the layer
+		*/
+		RENDERER_API_EXPORT void clearLayerBoneMask(uint32_t layerIndex);
+
 		/**
 		*  @brief
 		*    Clear the controller
+		*
+		*  @note
+		*    - Removes all skeleton animations and all layers except the base layer
 		*/
 		void clear();
 
@@ -146,34 +326,169 @@ namespace Renderer
 		virtual void onLoadingStateChange(const IResource& resource) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<uint32_t>  BoneIndices;
+		typedef std::vector<float>	   BoneWeights;
+		typedef std::vector<glm::vec4> PoseComponents;	///< One pose component (rotation quaternion as xyzw, translation or scale) per skeleton bone
+
+		struct SkeletonAnimation final
+		{
+			SkeletonAnimationResourceId skeletonAnimationResourceId	= getInvalid<SkeletonAnimationResourceId>();
+			SkeletonAnimationEvaluator* skeletonAnimationEvaluator	= nullptr;	///< Skeleton animation evaluator instance, null pointer as long as the skeleton animation resource isn't loaded, destroy the instance if you no longer need it
+			BoneIndices					boneIndices;							///< Skeleton bone index per skeleton animation evaluator bone ID, invalid if the skeleton has no such bone, empty if not gathered yet
+			float						timeInSeconds				= 0.0f;
+			float						weight						= 0.0f;
+			float						targetWeight				= 0.0f;
+			float						weightChangePerSecond		= 0.0f;	///< Always positive
+		};
+		typedef std::vector<SkeletonAnimation> SkeletonAnimations;
+
+		struct BoneMaskEntry final
+		{
+			uint32_t boneId;
+			float	 weight;
+			bool	 includeChildren;
+		};
+		typedef std::vector<BoneMaskEntry> BoneMaskEntries;
+
+		struct Layer final
+		{
+			BlendMode		   blendMode = BlendMode::OVERRIDE;
+			float			   weight	 = 1.0f;
+			SkeletonAnimations skeletonAnimations;
+			BoneMaskEntries	   boneMaskEntries;
+			BoneWeights		   boneWeights;	///< Skeleton bone weights resolved from the bone mask entries, empty if there's no bone mask or it hasn't been resolved yet
+		};
+		typedef std::vector<Layer> Layers;
+
+		struct Pose final
+		{
+			PoseComponents rotations;
+			PoseComponents translations;
+			PoseComponents scales;
+			BoneWeights	   boneWeights;	///< Accumulated weight per skeleton bone, zero if the skeleton bone hasn't been posed
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
 		explicit SkeletonAnimationController(const SkeletonAnimationController&) = delete;
 		SkeletonAnimationController& operator=(const SkeletonAnimationController&) = delete;
-		void createSkeletonAnimationEvaluator();
-		void destroySkeletonAnimationEvaluator();
+		[[nodiscard]] SkeletonAnimation& getOrAddSkeletonAnimation(uint32_t layerIndex, SkeletonAnimationResourceId skeletonAnimationResourceId);
+		SkeletonAnimations::iterator removeSkeletonAnimation(Layer& layer, SkeletonAnimations::iterator iterator);
+		void createSkeletonAnimationEvaluator(SkeletonAnimation& skeletonAnimation);
+		void destroySkeletonAnimationEvaluator(SkeletonAnimation& skeletonAnimation);
 
 		/**
 		*  @brief
-		*    Update the controller
+		*    Advance the time and the weight fading of the skeleton animations, faded out skeleton animations are removed
 		*
 		*  @param[in] pastSecondsSinceLastFrame
 		*    Past seconds since last frame
+		*
+		*  @note
+		*    - Might unregister the controller from the skeleton animation resource manager, so this must not be called concurrently
+		*/
+		void advanceTime(float pastSecondsSinceLastFrame);
+
+		/**
+		*  @brief
+		*    Return the minimum distance to the camera reported since the last update and reset it for the next update
+		*
+		*  @return
+		*    The minimum distance to the camera, maximum float value if the controller is considered to be culled
+		*/
+		[[nodiscard]] inline float consumeMinimumDistanceToCamera()
+		{
+			const float minimumDistanceToCamera = mMinimumDistanceToCamera;
+			mMinimumDistanceToCamera = mReceivesDistanceToCamera ? std::numeric_limits<float>::max() : 0.0f;
+			return minimumDistanceToCamera;
+		}
+
+		/**
+		*  @brief
+		*    Set the skeleton animation level of detail
+		*
+		*  @param[in] evaluationIntervalInSeconds
+		*    Time between two skeleton animation evaluations, the pose is interpolated in between, zero to evaluate each update
+		*  @param[in] skipLeafBones
+		*    If "true", bones without children aren't animated
+		*/
+		void setLod(float evaluationIntervalInSeconds, bool skipLeafBones);
+
+		/**
+		*  @brief
+		*    Mark the skeleton animation as culled, the next "Renderer::SkeletonAnimationController::evaluate()" call evaluates it regardless of the evaluation interval
+		*/
+		inline void setCulled()
+		{
+			mPoseOutdated = true;
+			mCulled = true;
+		}
+
+		/**
+		*  @brief
+		*    Evaluate the skeleton animations if required by the level of detail and calculate the final local transform matrices
+		*
+		*  @note
+		*    - Only touches the controller itself, so different controllers can be evaluated concurrently
+		*/
+		void evaluate();
+
+		/**
+		*  @brief
+		*    Evaluate the skeleton animations and blend the layers into a local pose
+		*
+		*  @param[in] skeletonResource
+		*    Controlled skeleton resource
+		*  @param[in] timeOffsetInSeconds
+		*    Time offset in seconds added to the current skeleton animation times
+		*  @param[out] pose
+		*    Receives the blended local pose
+		*/
+		void evaluatePose(const SkeletonResource& skeletonResource, float timeOffsetInSeconds, Pose& pose);
+
+		/**
+		*  @brief
+		*    Write the evaluated local bone pose into the controlled skeleton resource
+		*
+		*  @return
+		*    The controlled skeleton resource, "Renderer::SkeletonResource::localToGlobalPose()" must be called afterwards
+		*
+		*  @note
+		*    - Controllers of different skeleton resources can apply their pose concurrently
 		*/
-		void update(float pastSecondsSinceLastFrame);
+		[[nodiscard]] SkeletonResource& applyPose();
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		const IRenderer&			mRenderer;						///< Renderer to use
-		SkeletonResourceId			mSkeletonResourceId;			///< ID of the controlled skeleton resource
-		SkeletonAnimationResourceId mSkeletonAnimationResourceId;	///< Skeleton animation resource ID, can be set to invalid value
-		SkeletonAnimationEvaluator* mSkeletonAnimationEvaluator;	///< Skeleton animation evaluator instance, can be a null pointer, destroy the instance if you no longer need it
-		float						mTimeInSeconds;					///< Time in seconds
+		const IRenderer&		mRenderer;								///< Renderer to use
+		SkeletonResourceId		mSkeletonResourceId;					///< ID of the controlled skeleton resource
+		Layers					mLayers;								///< Layers, evaluated from bottom to top, there's always at least the base layer
+		uint32_t				mNumberOfSkeletonAnimationEvaluators;	///< Number of created skeleton animation evaluators, the controller is registered at the skeleton animation resource manager as long as there's at least one
+		Pose					mPose;									///< Blended local pose of all layers, when interpolating this is the pose at the end of the evaluation interval
+		Pose					mPreviousPose;							///< Blended local pose of all layers at the start of the evaluation interval, only used when interpolating
+		Pose					mLayerPose;								///< Blended local pose of the current override layer, only a member to avoid reallocations
+		Pose					mBindPose;								///< Local pose of the skeleton before this controller posed it, partially weighted override layers over bones not posed by the layers below blend from it, empty if not captured yet
+		std::vector<glm::mat4>	mTransformMatrices;						///< Local transform matrices of the posed skeleton bones calculated at the last "Renderer::SkeletonAnimationController::evaluate()" call
+		std::vector<uint8_t>	mLeafBones;								///< Per skeleton bone: 1 if the bone has no children, else 0, empty if not gathered yet
+		// Level of detail (LOD)
+		bool					mReceivesDistanceToCamera;				///< "true" as soon as a distance to the camera has been reported
+		float					mMinimumDistanceToCamera;				///< Minimum distance to the camera reported since the last update
+		float					mEvaluationIntervalInSeconds;			///< Time between two skeleton animation evaluations, zero to evaluate each update
+		float					mTargetPoseIntervalInSeconds;			///< Evaluation interval the pending target pose "mPose" was evaluated ahead with, interpolation and the next evaluation are based on it even if the level of detail changed in between
+		float					mSecondsSinceEvaluation;				///< Seconds since the last skeleton animation evaluation
+		bool					mSkipLeafBones;							///< If "true", bones without children aren't animated
+		bool					mPoseOutdated;							///< If "true", the next "Renderer::SkeletonAnimationController::evaluate()" call evaluates the skeleton animations regardless of the evaluation interval
+		bool					mCulled;								///< If "true", the last update considered the skeleton animation to be culled, the next distance report evaluates it right away
 
 
 	};
@@ -36,9 +36,8 @@ PRAGMA_WARNING_POP
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
-	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
-	#include <glm/gtx/quaternion.hpp>
-	#include <glm/gtc/matrix_transform.hpp>
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	#include <cmath>
 PRAGMA_WARNING_POP
 
 
@@ -57,10 +56,22 @@ namespace
 		typedef acl::decompression_context<acl::default_transform_decompression_settings> AclDecompressionContext;
 
 
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void resizePose(Renderer::SkeletonAnimationEvaluator::Pose& pose, uint8_t numberOfChannels)
+		{
+			pose.rotations.resize(numberOfChannels);
+			pose.translations.resize(numberOfChannels);
+			pose.scales.resize(numberOfChannels);
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Classes                                               ]
 		//[-------------------------------------------------------]
-		struct TrackWriter final : public acl::track_writer
+		// Writes the decompressed tracks into structure of arrays (SoA) pose buffers
+		struct SoaTrackWriter final : public acl::track_writer
 		{
 
 
@@ -68,42 +79,39 @@ namespace
 			//[ Public data                                           ]
 			//[-------------------------------------------------------]
 			public:
-				rtm::quatf	  mRotation	   = rtm::quat_identity();
-				rtm::vector4f mTranslation = rtm::vector_zero();
-				rtm::vector4f mScale	   = rtm::vector_set(1.0f);
+				float* mRotations;
+				float* mTranslations;
+				float* mScales;
 
 
 			//[-------------------------------------------------------]
 			//[ Public methods                                        ]
 			//[-------------------------------------------------------]
 			public:
-				// Called by the decoder to write out a quaternion rotation value for a specified bone index
-				void RTM_SIMD_CALL write_rotation(uint32_t, rtm::quatf_arg0 rotation)
+				explicit SoaTrackWriter(Renderer::SkeletonAnimationEvaluator::Pose& pose) :
+					mRotations(&pose.rotations[0].x),
+					mTranslations(&pose.translations[0].x),
+					mScales(&pose.scales[0].x)
 				{
-					mRotation = rotation;
+					// Nothing here
 				}
 
-				// Called by the decoder to write out a translation value for a specified bone index
-				void RTM_SIMD_CALL write_translation(uint32_t, rtm::vector4f_arg0 translation)
+				// Called by the decoder to write out a quaternion rotation value for a specified bone index
+				void RTM_SIMD_CALL write_rotation(uint32_t trackIndex, rtm::quatf_arg0 rotation)
 				{
-					mTranslation = translation;
+					rtm::quat_store(rotation, mRotations + trackIndex * 4);
 				}
 
-				// Called by the decoder to write out a scale value for a specified bone index
-				void RTM_SIMD_CALL write_scale(uint32_t, rtm::vector4f_arg0 scale)
+				// Called by the decoder to write out a translation value for a specified bone index
+				void RTM_SIMD_CALL write_translation(uint32_t trackIndex, rtm::vector4f_arg0 translation)
 				{
-					mScale = scale;
+					rtm::vector_store(translation, mTranslations + trackIndex * 4);
 				}
 
-				void getTransformMatrix(glm::mat4& transformMatrix) const
+				// Called by the decoder to write out a scale value for a specified bone index, tracks without scale receive the default scale
+				void RTM_SIMD_CALL write_scale(uint32_t trackIndex, rtm::vector4f_arg0 scale)
 				{
-					// Build a transformation matrix from it
-					// TODO(co) Handle case of no scale
-					// TODO(co) Review temporary matrix instances on the C-runtime stack
-					glm::quat presentRotation(rtm::quat_get_w(mRotation), rtm::quat_get_x(mRotation), rtm::quat_get_y(mRotation), rtm::quat_get_z(mRotation));
-					glm::vec3 presentPosition(rtm::vector_get_x(mTranslation), rtm::vector_get_y(mTranslation), rtm::vector_get_z(mTranslation));
-					glm::vec3 presentScale(rtm::vector_get_x(mScale), rtm::vector_get_y(mScale), rtm::vector_get_z(mScale));
-					transformMatrix = glm::translate(Renderer::Math::MAT4_IDENTITY, presentPosition) * glm::toMat4(presentRotation) * glm::scale(Renderer::Math::MAT4_IDENTITY, presentScale);
+					rtm::vector_store(scale, mScales + trackIndex * 4);
 				}
 
 
@@ -131,11 +139,22 @@ namespace Renderer
 		mSkeletonAnimationResourceManager(skeletonAnimationResourceManager),
 		mSkeletonAnimationResourceId(skeletonAnimationResourceId)
 	{
-		mAclDecompressionContext = new ::detail::AclDecompressionContext();
+		::detail::AclDecompressionContext* aclDecompressionContext = new ::detail::AclDecompressionContext();
+		mAclDecompressionContext = aclDecompressionContext;
 		const SkeletonAnimationResource& skeletonAnimationResource = mSkeletonAnimationResourceManager.getById(mSkeletonAnimationResourceId);
-		static_cast<::detail::AclDecompressionContext*>(mAclDecompressionContext)->initialize(*reinterpret_cast<const acl::compressed_tracks*>(skeletonAnimationResource.getAclCompressedTracks().data()));
+		aclDecompressionContext->initialize(*reinterpret_cast<const acl::compressed_tracks*>(skeletonAnimationResource.getAclCompressedTracks().data()));
 		mBoneIds = skeletonAnimationResource.getBoneIds();
-		mTransformMatrices.resize(skeletonAnimationResource.getNumberOfChannels());
+		const uint8_t numberOfChannels = skeletonAnimationResource.getNumberOfChannels();
+		::detail::resizePose(mPose, numberOfChannels);
+		::detail::resizePose(mReferencePose, numberOfChannels);
+
+		// Decompress the reference pose once, it's needed when the skeleton animation is used as additive skeleton animation
+		if (numberOfChannels > 0)
+		{
+			aclDecompressionContext->seek(0.0f, acl::sample_rounding_policy::none);
+			::detail::SoaTrackWriter soaTrackWriter(mReferencePose);
+			aclDecompressionContext->decompress_tracks(soaTrackWriter);
+		}
 	}
 
 	SkeletonAnimationEvaluator::~SkeletonAnimationEvaluator()
@@ -146,22 +165,24 @@ namespace Renderer
 	void SkeletonAnimationEvaluator::evaluate(float timeInSeconds)
 	{
 		const SkeletonAnimationResource& skeletonAnimationResource = mSkeletonAnimationResourceManager.getById(mSkeletonAnimationResourceId);
-		const uint8_t numberOfChannels = skeletonAnimationResource.getNumberOfChannels();
-
-		// Decompress the ACL compressed skeleton animation tracks
-		::detail::AclDecompressionContext* aclDecompressionContext = static_cast<::detail::AclDecompressionContext*>(mAclDecompressionContext);
-		const float duration = skeletonAnimationResource.getDurationInTicks() / skeletonAnimationResource.getTicksPerSecond();
-		while (timeInSeconds > duration)
+		if (0 == skeletonAnimationResource.getNumberOfChannels())
 		{
-			timeInSeconds -= duration;
+			// Nothing to do
+			return;
 		}
-		static_cast<::detail::AclDecompressionContext*>(mAclDecompressionContext)->seek(timeInSeconds, acl::sample_rounding_policy::none);
-		::detail::TrackWriter trackWriter;
-		for (uint8_t i = 0; i < numberOfChannels; ++i)
+
+		// Map the time into the animation cycle, the time is ever-increasing so no loop in here
+		const float duration = skeletonAnimationResource.getDurationInTicks() / skeletonAnimationResource.getTicksPerSecond();
+		if (timeInSeconds > duration && duration > 0.0f)
 		{
-			aclDecompressionContext->decompress_track(i, trackWriter);
-			trackWriter.getTransformMatrix(mTransformMatrices[i]);
+			timeInSeconds = std::fmod(timeInSeconds, duration);
 		}
+
+		// Decompress all ACL compressed skeleton animation tracks at once, this shares the per-segment work between the tracks
+		::detail::AclDecompressionContext* aclDecompressionContext = static_cast<::detail::AclDecompressionContext*>(mAclDecompressionContext);
+		aclDecompressionContext->seek(timeInSeconds, acl::sample_rounding_policy::none);
+		::detail::SoaTrackWriter soaTrackWriter(mPose);
+		aclDecompressionContext->decompress_tracks(soaTrackWriter);
 	}
 
 
@@ -75,7 +75,12 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Rigid skeleton animation evaluator which calculates transformations for a given timestamp
+	*    Rigid skeleton animation evaluator which calculates the local pose for a given timestamp
+	*
+	*  @remarks
+	*    All tracks are decompressed in a single batched call into structure of arrays (SoA) pose buffers. The pose is kept
+	*    in rotation, translation and scale form so that it can be blended before it's converted into transform matrices.
+	*    Evaluators don't share any mutable state, so different evaluators can be evaluated concurrently.
 	*/
 	class SkeletonAnimationEvaluator final
 	{
@@ -86,7 +91,14 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		typedef std::vector<uint32_t>  BoneIds;
-		typedef std::vector<glm::mat4> TransformMatrices;
+		typedef std::vector<glm::vec4> PoseComponents;	///< One pose component (rotation quaternion as xyzw, translation or scale) per channel
+
+		struct Pose final
+		{
+			PoseComponents rotations;		///< Rotation quaternions as xyzw
+			PoseComponents translations;	///< Translations, w is unused
+			PoseComponents scales;			///< Scales, w is unused
+		};
 
 
 	//[-------------------------------------------------------]
@@ -112,7 +124,7 @@ namespace Renderer
 
 		/**
 		*  @brief
-		*    Evaluates the animation tracks for a given time stamp; the calculated pose can be retrieved as a array of transformation matrices afterwards by calling "Renderer::SkeletonAnimationEvaluator::getTransformMatrices()"
+		*    Evaluates the animation tracks for a given time stamp; the calculated pose can be retrieved afterwards by calling "Renderer::SkeletonAnimationEvaluator::getPose()"
 		*
 		*  @param[in] timeInSeconds
 		*    The time for which you want to evaluate the animation, in seconds. Will be mapped into the animation cycle, so it can be an arbitrary value. Best use with ever-increasing time stamps.
@@ -133,14 +145,26 @@ namespace Renderer
 
 		/**
 		*  @brief
-		*    Return the transform matrices calculated at the last "Renderer::SkeletonAnimationEvaluator::evaluate()" call
+		*    Return the local pose calculated at the last "Renderer::SkeletonAnimationEvaluator::evaluate()" call
+		*
+		*  @return
+		*    The local pose, one entry per bone ID
+		*/
+		[[nodiscard]] inline const Pose& getPose() const
+		{
+			return mPose;
+		}
+
+		/**
+		*  @brief
+		*    Return the reference pose additive skeleton animations are relative to
 		*
 		*  @return
-		*    The transform matrices
+		*    The local pose at the start of the skeleton animation, one entry per bone ID
 		*/
-		[[nodiscard]] inline const TransformMatrices& getTransformMatrices() const
+		[[nodiscard]] inline const Pose& getReferencePose() const
 		{
-			return mTransformMatrices;
+			return mReferencePose;
 		}
 
 
@@ -159,7 +183,8 @@ namespace Renderer
 		SkeletonAnimationResourceManager& mSkeletonAnimationResourceManager;	///< Skeleton animation resource manager to use
 		SkeletonAnimationResourceId		  mSkeletonAnimationResourceId;			///< Skeleton animation resource ID
 		BoneIds							  mBoneIds;								///< Bone IDs ("Renderer::StringId" on bone name)
-		TransformMatrices				  mTransformMatrices;					///< The transform matrices calculated at the last "Renderer::SkeletonAnimationEvaluator::evaluate()" call
+		Pose							  mPose;								///< The local pose calculated at the last "Renderer::SkeletonAnimationEvaluator::evaluate()" call
+		Pose							  mReferencePose;						///< The local pose at the start of the skeleton animation, used as reference by additive skeleton animations
 		void*							  mAclDecompressionContext;
 
 
@@ -25,9 +25,85 @@
 #include "Renderer/Public/Resource/SkeletonAnimation/SkeletonAnimationResource.h"
 #include "Renderer/Public/Resource/SkeletonAnimation/SkeletonAnimationController.h"
 #include "Renderer/Public/Resource/SkeletonAnimation/Loader/SkeletonAnimationResourceLoader.h"
+#include "Renderer/Public/Resource/Skeleton/SkeletonResource.h"
 #include "Renderer/Public/Resource/ResourceManagerTemplate.h"
+#include "Renderer/Public/Core/Thread/ThreadPool.h"
 #include "Renderer/Public/Core/Time/TimeManager.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <algorithm>
+	#include <functional>
+	#include <limits>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t SKELETON_ANIMATION_SPLIT_COUNT = 16;	///< Package size for each thread to work on, less items aren't worth the threading effort
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		template <typename TYPE, typename FUNCTION>
+		void parallelForEachSkeletonAnimationItem(Renderer::DefaultThreadPool& defaultThreadPool, TYPE* items, size_t itemCount, const FUNCTION& function)
+		{
+			size_t splitCount = SKELETON_ANIMATION_SPLIT_COUNT;	// Will change when maximum number of threads is reached
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (threadCount <= 1)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				for (size_t i = 0; i < itemCount; ++i)
+				{
+					function(items[i]);
+				}
+			}
+			else
+			{
+				// Multi-threaded
+				size_t threadItemIndexOffset = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					defaultThreadPool.queueTask([items, threadItemIndexOffset, numberOfItemsToProcess, &function]()
+					{
+						for (size_t i = threadItemIndexOffset; i < threadItemIndexOffset + numberOfItemsToProcess; ++i)
+						{
+							function(items[i]);
+						}
+					});
+					itemCount -= splitCount;
+					threadItemIndexOffset += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -66,6 +142,20 @@ namespace Renderer
 		setInvalid(skeletonAnimationResourceId);
 	}
 
+	void SkeletonAnimationResourceManager::evaluateUnculledSkeletonAnimationControllers()
+	{
+		if (!mUnculledSkeletonAnimationControllers.empty())
+		{
+			// Only the last controller of a skeleton resource can be marked as culled, so this is done multi-threaded
+			::detail::parallelForEachSkeletonAnimationItem(mInternalResourceManager->getRenderer().getDefaultThreadPool(), mUnculledSkeletonAnimationControllers.data(), mUnculledSkeletonAnimationControllers.size(), [](SkeletonAnimationController* skeletonAnimationController)
+			{
+				skeletonAnimationController->evaluate();
+				skeletonAnimationController->applyPose().localToGlobalPose();
+			});
+			mUnculledSkeletonAnimationControllers.clear();
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -97,12 +187,62 @@ namespace Renderer
 
 	void SkeletonAnimationResourceManager::update()
 	{
-		// Update skeleton animation controllers
-		const float pastSecondsSinceLastFrame = mInternalResourceManager->getRenderer().getTimeManager().getPastSecondsSinceLastFrame();
-		for (SkeletonAnimationController* skeletonAnimationController : mSkeletonAnimationControllers)
+		// Unculled skeleton animation controllers which weren't evaluated during rendering are evaluated by this update anyway
+		mUnculledSkeletonAnimationControllers.clear();
+		if (mSkeletonAnimationControllers.empty())
 		{
-			skeletonAnimationController->update(pastSecondsSinceLastFrame);
+			// Nothing to do
+			return;
 		}
+		const IRenderer& renderer = mInternalResourceManager->getRenderer();
+
+		// Advance the time of the skeleton animation controllers, backwards since a controller which faded out all of its skeleton animations unregisters itself
+		const float pastSecondsSinceLastFrame = renderer.getTimeManager().getPastSecondsSinceLastFrame();
+		for (size_t i = mSkeletonAnimationControllers.size(); i > 0; --i)
+		{
+			mSkeletonAnimationControllers[i - 1]->advanceTime(pastSecondsSinceLastFrame);
+		}
+
+		// Several skeleton animation controllers might control the same skeleton resource, in which case the last registered controller
+		// determines the pose and there's no point in evaluating the other ones (they still advance their time to stay in sync), the
+		// level of detail of the skeleton resource is determined by the closest rendered instance
+		mEvaluatedSkeletonAnimationControllers = mSkeletonAnimationControllers;
+		std::stable_sort(mEvaluatedSkeletonAnimationControllers.begin(), mEvaluatedSkeletonAnimationControllers.end(),
+			[](const SkeletonAnimationController* left, const SkeletonAnimationController* right) { return (left->getSkeletonResourceId() < right->getSkeletonResourceId()); }
+			);
+		size_t numberOfEvaluatedSkeletonAnimationControllers = 0;
+		float minimumDistanceToCamera = std::numeric_limits<float>::max();
+		for (size_t i = 0; i < mEvaluatedSkeletonAnimationControllers.size(); ++i)
+		{
+			SkeletonAnimationController* skeletonAnimationController = mEvaluatedSkeletonAnimationControllers[i];
+			minimumDistanceToCamera = std::min(minimumDistanceToCamera, skeletonAnimationController->consumeMinimumDistanceToCamera());
+			if (i + 1 == mEvaluatedSkeletonAnimationControllers.size() || skeletonAnimationController->getSkeletonResourceId() != mEvaluatedSkeletonAnimationControllers[i + 1]->getSkeletonResourceId())
+			{
+				if (minimumDistanceToCamera == std::numeric_limits<float>::max())
+				{
+					// Culled, evaluate as soon as it's visible again
+					skeletonAnimationController->setCulled();
+				}
+				else
+				{
+					// Level of detail: the evaluation interval increases linearly with the distance to the camera
+					const float distanceRange = mLodSettings.minimumEvaluationRateDistance - mLodSettings.fullEvaluationRateDistance;
+					const float lodFactor = (distanceRange > 0.0f) ? std::clamp((minimumDistanceToCamera - mLodSettings.fullEvaluationRateDistance) / distanceRange, 0.0f, 1.0f) : ((minimumDistanceToCamera > mLodSettings.fullEvaluationRateDistance) ? 1.0f : 0.0f);
+					skeletonAnimationController->setLod(lodFactor / mLodSettings.minimumEvaluationRate, minimumDistanceToCamera > mLodSettings.skipLeafBonesDistance);
+					mEvaluatedSkeletonAnimationControllers[numberOfEvaluatedSkeletonAnimationControllers] = skeletonAnimationController;
+					++numberOfEvaluatedSkeletonAnimationControllers;
+				}
+				minimumDistanceToCamera = std::numeric_limits<float>::max();
+			}
+		}
+		mEvaluatedSkeletonAnimationControllers.resize(numberOfEvaluatedSkeletonAnimationControllers);
+
+		// Evaluate the skeleton animation controllers and pose their skeleton resources, each controller now has its own skeleton resource so this is done multi-threaded
+		::detail::parallelForEachSkeletonAnimationItem(renderer.getDefaultThreadPool(), mEvaluatedSkeletonAnimationControllers.data(), mEvaluatedSkeletonAnimationControllers.size(), [](SkeletonAnimationController* skeletonAnimationController)
+		{
+			skeletonAnimationController->evaluate();
+			skeletonAnimationController->applyPose().localToGlobalPose();
+		});
 	}
 
 
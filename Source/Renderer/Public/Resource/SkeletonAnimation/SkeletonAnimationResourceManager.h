@@ -74,15 +74,55 @@ namespace Renderer
 		friend class SkeletonAnimationController;	// Registers/unregisters itself inside the skeleton animation resource manager
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Skeleton animation level of detail (LOD) settings, applied to skeleton animation controllers with reported distances to the camera
+		*
+		*  @note
+		*    - Skeleton animations which weren't rendered since the last update are culled and not evaluated at all
+		*/
+		struct LodSettings final
+		{
+			float fullEvaluationRateDistance	= 15.0f;	///< Up to this distance to the camera the skeleton animation is evaluated each update
+			float minimumEvaluationRateDistance = 80.0f;	///< Distance to the camera at which the minimum evaluation rate is reached, the pose is interpolated between evaluations
+			float minimumEvaluationRate			= 5.0f;		///< Minimum number of skeleton animation evaluations per second, must be positive
+			float skipLeafBonesDistance			= 40.0f;	///< Beyond this distance to the camera bones without children (e.g. finger tips) aren't animated
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	public:
+		[[nodiscard]] inline const LodSettings& getLodSettings() const
+		{
+			return mLodSettings;
+		}
+
+		inline void setLodSettings(const LodSettings& lodSettings)
+		{
+			mLodSettings = lodSettings;
+		}
+
 		[[nodiscard]] RENDERER_API_EXPORT SkeletonAnimationResource* getSkeletonAnimationResourceByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
 		RENDERER_API_EXPORT void loadSkeletonAnimationResourceByAssetId(AssetId assetId, SkeletonAnimationResourceId& skeletonAnimationResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = getInvalid<ResourceLoaderTypeId>());	// Asynchronous
 		[[nodiscard]] RENDERER_API_EXPORT SkeletonAnimationResourceId createSkeletonAnimationResourceByAssetId(AssetId assetId);	// Skeleton animation resource is not allowed to exist, yet
 		RENDERER_API_EXPORT void setInvalidResourceId(SkeletonAnimationResourceId& skeletonAnimationResourceId, IResourceListener& resourceListener) const;
 
+		/**
+		*  @brief
+		*    Evaluate the skeleton animation controllers which were culled by the last update and reported a distance to the camera since then
+		*
+		*  @note
+		*    - Called by "Renderer::CompositorWorkspaceInstance" after gathering the visible scene items and before filling the command buffer, so unculled instances aren't rendered with a stale pose
+		*    - The skeleton animation controllers are evaluated multi-threaded, each of them controls a different skeleton resource
+		*/
+		RENDERER_API_EXPORT void evaluateUnculledSkeletonAnimationControllers();
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceManager methods     ]
@@ -124,7 +164,10 @@ namespace Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		SkeletonAnimationControllers mSkeletonAnimationControllers;	///< Don't destroy the instanced, they are not owned here
+		SkeletonAnimationControllers mSkeletonAnimationControllers;				///< Don't destroy the instanced, they are not owned here
+		SkeletonAnimationControllers mEvaluatedSkeletonAnimationControllers;	///< Skeleton animation controllers evaluated by the last update, only a member to avoid reallocations, don't destroy the instances, they are not owned here
+		SkeletonAnimationControllers mUnculledSkeletonAnimationControllers;		///< Skeleton animation controllers culled by the last update which reported a distance to the camera since then and still need to be evaluated, don't destroy the instances, they are not owned here
+		LodSettings					 mLodSettings;
 		ResourceManagerTemplate<SkeletonAnimationResource, SkeletonAnimationResourceLoader, SkeletonAnimationResourceId, 2048>* mInternalResourceManager;
 
 
@@ -125,7 +125,7 @@ namespace Renderer
 		return false;
 	}
 
-	void CrnArrayTextureResourceLoader::onProcessing()
+	bool CrnArrayTextureResourceLoader::onProcessing()
 	{
 		// TODO(co) Error handling
 
@@ -137,7 +137,7 @@ namespace Renderer
 		if (!crnd::crnd_get_texture_info(mFileData + masterSliceFileMetadata.offset, masterSliceFileMetadata.numberOfBytes, &masterCrnTextureInfo))
 		{
 			RHI_ASSERT(mRenderer.getContext(), false, "crnd_get_texture_info() failed")
-			return;
+			return false;
 		}
 		mWidth  = masterCrnTextureInfo.m_width;
 		mHeight = masterCrnTextureInfo.m_height;
@@ -187,7 +187,7 @@ namespace Renderer
 				// Error!
 				// TODO(co)
 				RHI_ASSERT(mRenderer.getContext(), false, "Invalid format")
-				return;
+				return false;
 		}
 
 		// Does the data contain mipmaps?
@@ -198,7 +198,7 @@ namespace Renderer
 		if (nullptr == crndUnpackContext)
 		{
 			RHI_ASSERT(mRenderer.getContext(), false, "crnd_unpack_begin() failed")
-			return;
+			return false;
 		}
 
 		// Handle optional top mipmap removal
@@ -265,7 +265,7 @@ namespace Renderer
 					if (!crnd::crnd_get_texture_info(mFileData + sliceFileMetadata.offset, sliceFileMetadata.numberOfBytes, &crnTextureInfo))
 					{
 						RHI_ASSERT(mRenderer.getContext(), false, "crnd_get_texture_info() failed")
-						return;
+						return false;
 					}
 					RHI_ASSERT(mRenderer.getContext(), memcmp(&masterCrnTextureInfo, &crnTextureInfo, sizeof(crnd::crn_texture_info)) == 0, "CRN texture information mismatch")
 				}
@@ -276,7 +276,7 @@ namespace Renderer
 				if (nullptr == crndUnpackContext)
 				{
 					RHI_ASSERT(mRenderer.getContext(), false, "crnd_unpack_begin() failed")
-					return;
+					return false;
 				}
 			}
 
@@ -306,7 +306,7 @@ namespace Renderer
 					// Free allocated memory
 					crnd::crnd_unpack_end(crndUnpackContext);
 					RHI_ASSERT(mRenderer.getContext(), false, "Failed transcoding texture")
-					return;
+					return false;
 				}
 			}
 
@@ -326,6 +326,9 @@ namespace Renderer
 		{
 			mTexture = createRhiTexture();
 		}
+
+		// Done
+		return true;
 	}
 
 
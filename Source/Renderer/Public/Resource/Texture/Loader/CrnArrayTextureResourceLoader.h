@@ -67,7 +67,7 @@ namespace Renderer
 		}
 
 		[[nodiscard]] virtual bool onDeserialization(IFile& file) override;
-		virtual void onProcessing() override;
+		[[nodiscard]] virtual bool onProcessing() override;
 
 
 	//[-------------------------------------------------------]
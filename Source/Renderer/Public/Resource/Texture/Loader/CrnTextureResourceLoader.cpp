@@ -117,7 +117,7 @@ namespace Renderer
 		return true;
 	}
 
-	void CrnTextureResourceLoader::onProcessing()
+	bool CrnTextureResourceLoader::onProcessing()
 	{
 		// TODO(co) Error handling
 
@@ -126,7 +126,7 @@ namespace Renderer
 		if (!crnd::crnd_get_texture_info(mFileData, mNumberOfUsedFileDataBytes, &crnTextureInfo))
 		{
 			RHI_ASSERT(mRenderer.getContext(), false, "crnd_get_texture_info() failed")
-			return;
+			return false;
 		}
 		mWidth  = crnTextureInfo.m_width;
 		mHeight = crnTextureInfo.m_height;
@@ -175,7 +175,7 @@ namespace Renderer
 				// Error!
 				// TODO(co)
 				RHI_ASSERT(mRenderer.getContext(), false, "Invalid format")
-				return;
+				return false;
 		}
 
 		// Does the data contain mipmaps?
@@ -185,7 +185,7 @@ namespace Renderer
 		if (nullptr == crndUnpackContext)
 		{
 			RHI_ASSERT(mRenderer.getContext(), false, "crnd_unpack_begin() failed")
-			return;
+			return false;
 		}
 
 		// Handle optional top mipmap removal
@@ -263,7 +263,7 @@ namespace Renderer
 					// Free allocated memory
 					crnd::crnd_unpack_end(crndUnpackContext);
 					RHI_ASSERT(mRenderer.getContext(), false, "Failed transcoding texture")
-					return;
+					return false;
 				}
 			}
 		}
@@ -283,6 +283,9 @@ namespace Renderer
 		{
 			mTexture = createRhiTexture();
 		}
+
+		// Done
+		return true;
 	}
 
 
@@ -68,9 +68,10 @@ namespace Renderer
 
 		[[nodiscard]] virtual bool onDeserialization(IFile& file) override;
 
-		inline virtual void onProcessing() override
+		[[nodiscard]] inline virtual bool onProcessing() override
 		{
 			// Nothing here
+			return true;
 		}
 
 
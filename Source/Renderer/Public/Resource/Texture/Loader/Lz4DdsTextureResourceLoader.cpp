@@ -126,7 +126,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceLoader methods      ]
 	//[-------------------------------------------------------]
-	void Lz4DdsTextureResourceLoader::onProcessing()
+	bool Lz4DdsTextureResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -291,7 +291,7 @@ namespace Renderer
 						default:
 							// Error!
 							RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-							return;
+							return false;
 					}
 				}
 				else
@@ -399,7 +399,7 @@ namespace Renderer
 									{
 										// Error
 										RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-										return;
+										return false;
 									}
 									break;
 
@@ -422,14 +422,14 @@ namespace Renderer
 									{
 										// Error
 										RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-										return;
+										return false;
 									}
 									break;
 
 								default:
 									// Error
 									RHI_ASSERT(mRenderer.getContext(), false, "Unsupported format")
-									return;
+									return false;
 							}
 					}
 				}
@@ -692,6 +692,9 @@ namespace Renderer
 		{
 			mTexture = createRhiTexture();
 		}
+
+		// Done
+		return true;
 	}
 
 
@@ -74,7 +74,7 @@ namespace Renderer
 			return mMemoryFile.loadLz4CompressedDataFromFile(FORMAT_TYPE, FORMAT_VERSION, file);
 		}
 
-		virtual void onProcessing() override;
+		[[nodiscard]] virtual bool onProcessing() override;
 
 
 	//[-------------------------------------------------------]
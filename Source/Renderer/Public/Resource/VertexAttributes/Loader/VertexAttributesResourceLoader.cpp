@@ -56,7 +56,7 @@ namespace Renderer
 		return mMemoryFile.loadLz4CompressedDataFromFile(v1VertexAttributes::FORMAT_TYPE, v1VertexAttributes::FORMAT_VERSION, file);
 	}
 
-	void VertexAttributesResourceLoader::onProcessing()
+	bool VertexAttributesResourceLoader::onProcessing()
 	{
 		// Decompress LZ4 compressed data
 		mMemoryFile.decompress();
@@ -243,6 +243,9 @@ namespace Renderer
 		{
 			RHI_ASSERT(mRenderer.getContext(), false, "Unknown vertex attributes asset")
 		}
+
+		// Done
+		return true;
 	}
 
 
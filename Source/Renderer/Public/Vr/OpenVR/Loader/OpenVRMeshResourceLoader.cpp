@@ -149,7 +149,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		static constexpr uint32_t NUMBER_OF_BYTES_PER_VERTEX = sizeof(float) * 3 + sizeof(float) * 2 + sizeof(short) * 4;
+		static constexpr uint32_t NUMBER_OF_BYTES_PER_VERTEX = sizeof(uint16_t) * 4 + sizeof(uint16_t) * 2 + sizeof(short) * 4;	///< Quantized position relative to the bounding box, half texture coordinate and QTangent, see "Renderer::MeshResource::VERTEX_ATTRIBUTES"
 
 
 		//[-------------------------------------------------------]
@@ -213,7 +213,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceLoader methods      ]
 	//[-------------------------------------------------------]
-	void OpenVRMeshResourceLoader::onProcessing()
+	bool OpenVRMeshResourceLoader::onProcessing()
 	{
 		// Load the render model
 		const std::string& renderModelName = getRenderModelName();
@@ -231,7 +231,7 @@ namespace Renderer
 		if (vr::VRRenderModelError_None != vrRenderModelError)
 		{
 			RHI_LOG(mRenderer.getContext(), CRITICAL, "The renderer was unable to load OpenVR render model \"%s\": %s", renderModelName.c_str(), vrRenderModels->GetRenderModelErrorNameFromEnum(vrRenderModelError))
-			return;
+			return false;
 		}
 
 		// Setup "MikkTSpace" by Morten S. Mikkelsen ( http://mmikkelsen3d.blogspot.com/ ) for semi-standard tangent space generation (see http://www.mikktspace.com/ for background information)
@@ -268,29 +268,28 @@ namespace Renderer
 					// TODO(co) Error handling
 					RHI_ASSERT(mRenderer.getContext(), false, "MikkTSpace for semi-standard tangent space generation failed")
 				}
+
+				// Update minimum and maximum bounding box position, needed up-front for the position quantization
+				for (uint32_t i = 0; i < numberOfVertices; ++i)
+				{
+					const float* vrRenderModelVertexPosition = currentVrRenderModelVertex[i].vPosition.v;
+					const glm::vec3 glmVertex(vrRenderModelVertexPosition[0], vrRenderModelVertexPosition[1], -vrRenderModelVertexPosition[2]);
+					mMinimumBoundingBoxPosition = glm::min(mMinimumBoundingBoxPosition, glmVertex);
+					mMaximumBoundingBoxPosition = glm::max(mMaximumBoundingBoxPosition, glmVertex);
+				}
+
 				for (uint32_t i = 0; i < numberOfVertices; ++i, ++currentVrRenderModelVertex)
 				{
 					const float* vrRenderModelVertexPosition = currentVrRenderModelVertex->vPosition.v;
 
-					{ // Update minimum and maximum bounding box position
-						const glm::vec3 glmVertex(vrRenderModelVertexPosition[0], vrRenderModelVertexPosition[1], -vrRenderModelVertexPosition[2]);
-						mMinimumBoundingBoxPosition = glm::min(mMinimumBoundingBoxPosition, glmVertex);
-						mMaximumBoundingBoxPosition = glm::max(mMaximumBoundingBoxPosition, glmVertex);
+					{ // 16 bit position relative to the bounding box
+						Math::quantizeVertexPosition(glm::vec3(vrRenderModelVertexPosition[0], vrRenderModelVertexPosition[1], -vrRenderModelVertexPosition[2]), mMinimumBoundingBoxPosition, mMaximumBoundingBoxPosition, reinterpret_cast<uint16_t*>(currentVertexBufferData));
+						currentVertexBufferData += sizeof(uint16_t) * 4;
 					}
 
-					{ // 32 bit position
-						float* position = reinterpret_cast<float*>(currentVertexBufferData);
-						position[0] = vrRenderModelVertexPosition[0];
-						position[1] = vrRenderModelVertexPosition[1];
-						position[2] = -vrRenderModelVertexPosition[2];
-						currentVertexBufferData += sizeof(float) * 3;
-					}
-
-					{ // 32 bit texture coordinate
-						float* textureCoordinate = reinterpret_cast<float*>(currentVertexBufferData);
-						textureCoordinate[0] = currentVrRenderModelVertex->rfTextureCoord[0];
-						textureCoordinate[1] = currentVrRenderModelVertex->rfTextureCoord[1];
-						currentVertexBufferData += sizeof(float) * 2;
+					{ // 16 bit texture coordinate
+						Math::quantizeTextureCoordinate(glm::vec2(currentVrRenderModelVertex->rfTextureCoord[0], currentVrRenderModelVertex->rfTextureCoord[1]), reinterpret_cast<uint16_t*>(currentVertexBufferData));
+						currentVertexBufferData += sizeof(uint16_t) * 2;
 					}
 
 					{ // 16 bit QTangent
@@ -339,6 +338,9 @@ namespace Renderer
 		{
 			mVertexArray = createVertexArray();
 		}
+
+		// Done
+		return true;
 	}
 
 	bool OpenVRMeshResourceLoader::onDispatch()
@@ -350,6 +352,7 @@ namespace Renderer
 
 		// Create vertex array object (VAO)
 		mMeshResource->setVertexArray(mRenderer.getRhi().getCapabilities().nativeMultithreading ? mVertexArray : createVertexArray());
+		mMeshResource->setQuantizedPositions(true);
 		mMeshResource->setNumberOfLods(1);
 
 		{ // Create sub-meshes
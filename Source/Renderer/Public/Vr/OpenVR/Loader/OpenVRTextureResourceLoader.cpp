@@ -46,7 +46,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceLoader methods      ]
 	//[-------------------------------------------------------]
-	void OpenVRTextureResourceLoader::onProcessing()
+	bool OpenVRTextureResourceLoader::onProcessing()
 	{
 		// Load the render model texture
 		vr::IVRRenderModels* vrRenderModels = vr::VRRenderModels();
@@ -64,7 +64,7 @@ namespace Renderer
 		if (vr::VRRenderModelError_None != vrRenderModelError)
 		{
 			RHI_LOG(mRenderer.getContext(), CRITICAL, "The renderer was unable to load OpenVR albedo texture %d: %s", albedoTextureId, vrRenderModels->GetRenderModelErrorNameFromEnum(vrRenderModelError))
-			return;
+			return false;
 		}
 
 		{ // The "_argb_nxa" texture channel packing stores the x channel of a normal map inside the alpha channel, set identity normal map x value
@@ -81,6 +81,9 @@ namespace Renderer
 		{
 			mTexture = createRhiTexture();
 		}
+
+		// Done
+		return true;
 	}
 
 
@@ -93,7 +93,7 @@ namespace Renderer
 			return true;
 		}
 
-		virtual void onProcessing() override;
+		[[nodiscard]] virtual bool onProcessing() override;
 
 
 	//[-------------------------------------------------------]
@@ -70,7 +70,11 @@
 #include "Public/Resource/CompositorNode/Pass/Copy/CompositorResourcePassCopy.cpp"
 #include "Public/Resource/CompositorNode/Pass/DebugGui/CompositorInstancePassDebugGui.cpp"
 #include "Public/Resource/CompositorNode/Pass/GenerateMipmaps/CompositorInstancePassGenerateMipmaps.cpp"
+#include "Public/Resource/CompositorNode/Pass/GpuCulling/CompositorInstancePassGpuCulling.cpp"
+#include "Public/Resource/CompositorNode/Pass/GpuCulling/CompositorResourcePassGpuCulling.cpp"
 #include "Public/Resource/CompositorNode/Pass/GenerateMipmaps/CompositorResourcePassGenerateMipmaps.cpp"
+#include "Public/Resource/CompositorNode/Pass/Particles/CompositorInstancePassParticles.cpp"
+#include "Public/Resource/CompositorNode/Pass/Particles/CompositorResourcePassParticles.cpp"
 #include "Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorInstancePassResolveMultisample.cpp"
 #include "Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorResourcePassResolveMultisample.cpp"
 #include "Public/Resource/CompositorNode/Pass/Scene/CompositorInstancePassScene.cpp"
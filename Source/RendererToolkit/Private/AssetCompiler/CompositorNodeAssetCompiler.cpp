@@ -39,6 +39,8 @@
 #include <Renderer/Public/Resource/CompositorNode/Pass/GenerateMipmaps/CompositorResourcePassGenerateMipmaps.h>
 #include <Renderer/Public/Resource/CompositorNode/Pass/Clear/CompositorResourcePassClear.h>
 #include <Renderer/Public/Resource/CompositorNode/Pass/DebugGui/CompositorResourcePassDebugGui.h>
+#include <Renderer/Public/Resource/CompositorNode/Pass/GpuCulling/CompositorResourcePassGpuCulling.h>
+#include <Renderer/Public/Resource/CompositorNode/Pass/Particles/CompositorResourcePassParticles.h>
 #include <Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorResourcePassShadowMap.h>
 #include <Renderer/Public/Resource/CompositorNode/Pass/VrHiddenAreaMesh/CompositorResourcePassVrHiddenAreaMesh.h>
 #include <Renderer/Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorResourcePassResolveMultisample.h>
@@ -344,6 +346,14 @@ namespace
 										fillSortedMaterialPropertyVector(input, renderTargetTextureAssetIds, rapidJsonMemberIteratorPasses->value, sortedMaterialPropertyVector);
 										numberOfBytes = static_cast<uint32_t>(sizeof(Renderer::v1CompositorNode::PassDebugGui) + sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size());
 										break;
+
+									case Renderer::CompositorResourcePassGpuCulling::TYPE_ID:
+										numberOfBytes = sizeof(Renderer::v1CompositorNode::PassGpuCulling);
+										break;
+
+									case Renderer::CompositorResourcePassParticles::TYPE_ID:
+										numberOfBytes = sizeof(Renderer::v1CompositorNode::PassParticles);
+										break;
 								}
 
 								{ // Write down the compositor resource node target pass header
@@ -525,6 +535,38 @@ namespace
 											}
 											break;
 										}
+
+										case Renderer::CompositorResourcePassGpuCulling::TYPE_ID:
+										{
+											// The material definition is not used by GPU culling, the fixed build in RHI configuration resources are used instead
+											Renderer::v1CompositorNode::PassGpuCulling passGpuCulling;
+											strcpy(passGpuCulling.name, "GPU culling compositor pass");
+											readPass(rapidJsonValuePass, passGpuCulling);
+											RendererToolkit::JsonHelper::optionalByteProperty(rapidJsonValuePass, "MinimumRenderQueueIndex", passGpuCulling.minimumRenderQueueIndex);
+											RendererToolkit::JsonHelper::optionalByteProperty(rapidJsonValuePass, "MaximumRenderQueueIndex", passGpuCulling.maximumRenderQueueIndex);
+											RendererToolkit::JsonHelper::mandatoryStringIdProperty(rapidJsonValuePass, "MaterialTechnique", passGpuCulling.sceneMaterialTechniqueId);
+											RendererToolkit::JsonHelper::optionalStringIdProperty(rapidJsonValuePass, "HierarchicalDepthTexture", passGpuCulling.hierarchicalDepthTextureAssetId);
+											if (passGpuCulling.maximumRenderQueueIndex < passGpuCulling.minimumRenderQueueIndex)
+											{
+												throw std::runtime_error("The maximum render queue index must be equal or greater as the minimum render queue index");
+											}
+											if (Renderer::isValid(passGpuCulling.hierarchicalDepthTextureAssetId) && renderTargetTextureAssetIds.find(passGpuCulling.hierarchicalDepthTextureAssetId) == renderTargetTextureAssetIds.end())
+											{
+												throw std::runtime_error(std::string("Hierarchical depth texture asset ID \"") + rapidJsonValuePass["HierarchicalDepthTexture"].GetString() + "\" is unknown");
+											}
+											file.write(&passGpuCulling, sizeof(Renderer::v1CompositorNode::PassGpuCulling));
+											break;
+										}
+
+										case Renderer::CompositorResourcePassParticles::TYPE_ID:
+										{
+											// The material definition is not used by the particles simulation, the fixed build in RHI configuration resources are used instead
+											Renderer::v1CompositorNode::PassParticles passParticles;
+											strcpy(passParticles.name, "Particles compositor pass");
+											readPass(rapidJsonValuePass, passParticles);
+											file.write(&passParticles, sizeof(Renderer::v1CompositorNode::PassParticles));
+											break;
+										}
 									}
 								}
 							}
@@ -249,6 +249,13 @@ namespace RendererToolkit
 		[[nodiscard]] virtual AssetCompilerClassId getAssetCompilerClassId() const = 0;
 		[[nodiscard]] virtual std::string_view getOptionalUniqueAssetFilenameExtension() const = 0;
 		[[nodiscard]] virtual std::string getVirtualOutputAssetFilename(const Input& input, const Configuration& configuration) const = 0;
+
+		// Virtual filenames of the source assets the asset depends on, used for the asset dependency graph so an asset is only compiled after the assets it depends on
+		inline virtual void getVirtualDependencyFilenames(const Input&, const Configuration&, std::vector<std::string>&) const
+		{
+			// Nothing here, by default an asset doesn't depend on other assets
+		}
+
 		[[nodiscard]] virtual bool checkIfChanged(const Input& input, const Configuration& configuration) const = 0;
 		virtual void compile(const Input& input, const Configuration& configuration) const = 0;
 
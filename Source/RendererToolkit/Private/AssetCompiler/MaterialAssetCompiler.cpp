@@ -65,6 +65,11 @@ namespace RendererToolkit
 		return (input.virtualAssetOutputDirectory + '/' + std_filesystem::path(input.virtualAssetFilename).stem().generic_string()).append(getOptionalUniqueAssetFilenameExtension());
 	}
 
+	void MaterialAssetCompiler::getVirtualDependencyFilenames(const Input& input, const Configuration& configuration, std::vector<std::string>& virtualDependencyFilenames) const
+	{
+		JsonMaterialHelper::getDependencyFiles(input, input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset), virtualDependencyFilenames);
+	}
+
 	bool MaterialAssetCompiler::checkIfChanged(const Input& input, const Configuration& configuration) const
 	{
 		std::vector<std::string> virtualDependencyFilenames;
@@ -87,7 +92,7 @@ namespace RendererToolkit
 		CacheManager::CacheEntries cacheEntries;
 		std::vector<std::string> virtualInputFilenames;
 		virtualInputFilenames.emplace_back(virtualInputFilename);
-		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilenames, virtualOutputAssetFilename, Renderer::v1Material::FORMAT_VERSION, cacheEntries) || input.cacheManager.dependencyFilesChanged(virtualDependencyFilenames))
+		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilenames, virtualOutputAssetFilename, Renderer::v1Material::FORMAT_VERSION, cacheEntries, virtualDependencyFilenames))
 		{
 			Renderer::MemoryFile memoryFile(0, 1024);
 
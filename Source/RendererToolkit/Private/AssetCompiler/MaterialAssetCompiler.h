@@ -81,6 +81,7 @@ namespace RendererToolkit
 		}
 
 		[[nodiscard]] virtual std::string getVirtualOutputAssetFilename(const Input& input, const Configuration& configuration) const override;
+		virtual void getVirtualDependencyFilenames(const Input& input, const Configuration& configuration, std::vector<std::string>& virtualDependencyFilenames) const override;
 		[[nodiscard]] virtual bool checkIfChanged(const Input& input, const Configuration& configuration) const override;
 		virtual void compile(const Input& input, const Configuration& configuration) const override;
 
@@ -153,6 +153,11 @@ namespace RendererToolkit
 		return (input.virtualAssetOutputDirectory + '/' + std_filesystem::path(input.virtualAssetFilename).stem().generic_string()).append(getOptionalUniqueAssetFilenameExtension());
 	}
 
+	void MaterialBlueprintAssetCompiler::getVirtualDependencyFilenames(const Input& input, const Configuration& configuration, std::vector<std::string>& virtualDependencyFilenames) const
+	{
+		JsonMaterialBlueprintHelper::getDependencyFiles(input, input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset), virtualDependencyFilenames);
+	}
+
 	bool MaterialBlueprintAssetCompiler::checkIfChanged(const Input& input, const Configuration& configuration) const
 	{
 		std::vector<std::string> virtualDependencyFilenames;
@@ -181,7 +186,7 @@ namespace RendererToolkit
 
 		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
 		CacheManager::CacheEntries cacheEntries;
-		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, Renderer::v1MaterialBlueprint::FORMAT_VERSION, cacheEntries) || input.cacheManager.dependencyFilesChanged(virtualDependencyFilenames))
+		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, Renderer::v1MaterialBlueprint::FORMAT_VERSION, cacheEntries, virtualDependencyFilenames))
 		{
 			Renderer::MemoryFile memoryFile(0, 4096);
 
@@ -25,6 +25,7 @@
 #include "RendererToolkit/Private/Helper/AssimpLogStream.h"
 #include "RendererToolkit/Private/Helper/AssimpIOSystem.h"
 #include "RendererToolkit/Private/Helper/AssimpHelper.h"
+#include "RendererToolkit/Private/Helper/ParallelHelper.h"
 #include "RendererToolkit/Private/Helper/CacheManager.h"
 #include "RendererToolkit/Private/Helper/StringHelper.h"
 #include "RendererToolkit/Private/Helper/JsonHelper.h"
@@ -36,6 +37,7 @@
 #include <Renderer/Public/Core/File/MemoryFile.h>
 #include <Renderer/Public/Core/File/IFileManager.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
 #include <Renderer/Public/Resource/Mesh/MeshResource.h>
 #include <Renderer/Public/Resource/Mesh/Loader/MeshFileFormat.h>
 
@@ -82,12 +84,6 @@ namespace
 	{
 
 
-		//[-------------------------------------------------------]
-		//[ Global variables                                      ]
-		//[-------------------------------------------------------]
-		SMikkTSpaceContext g_MikkTSpaceContext;
-
-
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -189,9 +185,20 @@ namespace
 		//[-------------------------------------------------------]
 		static constexpr uint8_t NUMBER_OF_BYTES_PER_VERTEX = 28;										///< Number of bytes per vertex (3 float position, 2 float texture coordinate, 4 short QTangent)
 		static constexpr uint8_t NUMBER_OF_BYTES_PER_SKINNED_VERTEX = NUMBER_OF_BYTES_PER_VERTEX + 8;	///< Number of bytes per skinned vertex (+4 byte bone indices, +4 byte bone weights)
+		static constexpr uint8_t NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX = 20;								///< Number of bytes per quantized vertex written into the mesh file (4 unsigned normalized short position relative to the bounding box, 2 half texture coordinate, 4 short QTangent), see "Renderer::MeshResource::VERTEX_ATTRIBUTES"
+		static constexpr uint8_t NUMBER_OF_BYTES_PER_QUANTIZED_SKINNED_VERTEX = 32;						///< Number of bytes per quantized skinned vertex written into the mesh file (3 float position since skinning is done in object space, 2 half texture coordinate, 4 short QTangent, 4 byte bone indices, 4 byte bone weights), see "Renderer::MeshResource::SKINNED_VERTEX_ATTRIBUTES"
 		typedef std::vector<Renderer::v1Mesh::SubMesh> SubMeshes;
 		typedef std::unordered_map<std::string, Renderer::AssetId> MaterialNameToAssetId;
 
+		struct MeshInstance final
+		{
+			aiMesh*		assimpMesh;		///< Assimp mesh, can be used by multiple mesh instances, always valid
+			aiMatrix4x4 transformation;	///< Absolute Assimp transformation matrix (local to global space)
+			uint32_t	startVertex;	///< Start vertex inside our vertex buffer
+			uint32_t	startIndex;		///< Start index inside our index buffer, identical to the start index location of the sub-mesh
+		};
+		typedef std::vector<MeshInstance> MeshInstances;	///< Mesh instances in depth-first Assimp node traversal order
+
 
 		//[-------------------------------------------------------]
 		//[ Classes                                               ]
@@ -441,37 +448,25 @@ namespace
 
 		/**
 		*  @brief
-		*    Fill the mesh data recursively
+		*    Gather the mesh instances recursively in depth-first traversal order, which is also the order of the sub-meshes
 		*
 		*  @param[in]  assimpScene
 		*    Assimp scene
 		*  @param[in]  assimpNode
 		*    Assimp node to gather the data from
-		*  @param[in]  skeleton
-		*    Skeleton instance
-		*  @param[in]  numberOfBytesPerVertex
-		*    Number of bytes per vertex
-		*  @param[in]  vertexBuffer
-		*    Vertex buffer to fill
-		*  @param[in]  indexBuffer
-		*    Index buffer to fill
 		*  @param[in]  assimpTransformation
 		*    Current absolute Assimp transformation matrix (local to global space)
-		*  @param[out] minimumBoundingBoxPosition
-		*    Receives the minimum bounding box position
-		*  @param[out] maximumBoundingBoxPosition
-		*    Receives the maximum bounding box position
+		*  @param[out] meshInstances
+		*    Receives the mesh instances
 		*  @param[out] numberOfVertices
-		*    Receives the number of processed vertices
+		*    Receives the number of gathered vertices
 		*  @param[out] numberOfIndices
-		*    Receives the number of processed indices
+		*    Receives the number of gathered indices
 		*/
-		void fillMeshRecursive(const aiScene& assimpScene, const aiNode& assimpNode, const Skeleton& skeleton, uint8_t numberOfBytesPerVertex, uint8_t* vertexBuffer, uint32_t* indexBuffer, const aiMatrix4x4& assimpTransformation,
-							   glm::vec3& minimumBoundingBoxPosition, glm::vec3& maximumBoundingBoxPosition, uint32_t& numberOfVertices, uint32_t& numberOfIndices)
+		void gatherMeshInstancesRecursive(const aiScene& assimpScene, const aiNode& assimpNode, const aiMatrix4x4& assimpTransformation, MeshInstances& meshInstances, uint32_t& numberOfVertices, uint32_t& numberOfIndices)
 		{
 			// Get the absolute transformation matrix of this Assimp node
 			const aiMatrix4x4 currentAssimpTransformation = assimpTransformation * assimpNode.mTransformation;
-			const aiMatrix3x3 currentAssimpNormalTransformation = aiMatrix3x3(currentAssimpTransformation);
 
 			// Loop through all meshes this node is using
 			for (uint32_t i = 0; i < assimpNode.mNumMeshes; ++i)
@@ -479,194 +474,241 @@ namespace
 				// Get the used mesh
 				aiMesh& assimpMesh = *assimpScene.mMeshes[assimpNode.mMeshes[i]];
 
-				// Use "MikkTSpace" by Morten S. Mikkelsen ( http://mmikkelsen3d.blogspot.com/ ) for semi-standard tangent space generation and overwrite what Assimp calculated (see http://www.mikktspace.com/ for background information)
-				if (0 != assimpMesh.mNumUVComponents[0] && nullptr != assimpMesh.mTangents && nullptr != assimpMesh.mBitangents)
+				// Add mesh instance
+				MeshInstance meshInstance;
+				meshInstance.assimpMesh		= &assimpMesh;
+				meshInstance.transformation = currentAssimpTransformation;
+				meshInstance.startVertex	= numberOfVertices;
+				meshInstance.startIndex		= numberOfIndices;
+				meshInstances.push_back(meshInstance);
+
+				// Update the number of gathered vertices and indices
+				numberOfVertices += assimpMesh.mNumVertices;
+				for (uint32_t j = 0; j < assimpMesh.mNumFaces; ++j)
 				{
-					MikkTSpace::g_MikkTSpaceContext.m_pUserData = reinterpret_cast<void*>(&assimpMesh);
-					if (genTangSpaceDefault(&MikkTSpace::g_MikkTSpaceContext) == 0)
-					{
-						throw std::runtime_error("MikkTSpace for semi-standard tangent space generation failed");
-					}
+					numberOfIndices += assimpMesh.mFaces[j].mNumIndices;
 				}
+			}
 
-				// Get the start vertex inside the our vertex buffer
-				const uint32_t starVertex = numberOfVertices;
+			// Loop through all child nodes recursively
+			for (uint32_t assimpChild = 0; assimpChild < assimpNode.mNumChildren; ++assimpChild)
+			{
+				gatherMeshInstancesRecursive(assimpScene, *assimpNode.mChildren[assimpChild], currentAssimpTransformation, meshInstances, numberOfVertices, numberOfIndices);
+			}
+		}
 
-				{ // Loop through the Assimp mesh vertices
-					uint8_t* RESTRICT currentVertexBuffer = vertexBuffer + numberOfVertices * numberOfBytesPerVertex;
-					for (uint32_t j = 0; j < assimpMesh.mNumVertices; ++j)
-					{
-						uint8_t* RESTRICT currentVertex = currentVertexBuffer + j * numberOfBytesPerVertex;
-
-						{ // 32 bit position
-							// Get the Assimp mesh vertex position
-							aiVector3D assimpVertex = assimpMesh.mVertices[j];
-
-							// Transform the Assimp mesh vertex position into global space
-							assimpVertex *= currentAssimpTransformation;
-
-							// Set our vertex buffer position
-							float* RESTRICT currentVertexBufferFloat = reinterpret_cast<float*>(currentVertex);
-							*currentVertexBufferFloat = assimpVertex.x;
-							++currentVertexBufferFloat;
-							*currentVertexBufferFloat = assimpVertex.y;
-							++currentVertexBufferFloat;
-							*currentVertexBufferFloat = assimpVertex.z;
-							currentVertex += sizeof(float) * 3;
-
-							{ // Update minimum and maximum bounding box position
-								const glm::vec3 glmVertex(assimpVertex.x, assimpVertex.y, assimpVertex.z);
-								minimumBoundingBoxPosition = glm::min(minimumBoundingBoxPosition, glmVertex);
-								maximumBoundingBoxPosition = glm::max(maximumBoundingBoxPosition, glmVertex);
-							}
-						}
+		/**
+		*  @brief
+		*    Generate the tangent space of a given Assimp mesh
+		*
+		*  @param[in] mikkTSpaceInterface
+		*    "MikkTSpace" interface to use
+		*  @param[in] assimpMesh
+		*    Assimp mesh to generate the tangent space for, the Assimp mesh tangents and bitangents are overwritten
+		*/
+		void generateTangentSpace(SMikkTSpaceInterface& mikkTSpaceInterface, aiMesh& assimpMesh)
+		{
+			// Use "MikkTSpace" by Morten S. Mikkelsen ( http://mmikkelsen3d.blogspot.com/ ) for semi-standard tangent space generation and overwrite what Assimp calculated (see http://www.mikktspace.com/ for background information)
+			if (0 != assimpMesh.mNumUVComponents[0] && nullptr != assimpMesh.mTangents && nullptr != assimpMesh.mBitangents)
+			{
+				SMikkTSpaceContext mikkTSpaceContext;
+				mikkTSpaceContext.m_pInterface = &mikkTSpaceInterface;
+				mikkTSpaceContext.m_pUserData  = reinterpret_cast<void*>(&assimpMesh);
+				if (genTangSpaceDefault(&mikkTSpaceContext) == 0)
+				{
+					throw std::runtime_error("MikkTSpace for semi-standard tangent space generation failed");
+				}
+			}
+		}
 
-						// 32 bit texture coordinate
-						if (0 != assimpMesh.mNumUVComponents[0])
-						{
-							// Get the Assimp mesh vertex texture coordinate
-							aiVector3D assimpTexCoord = assimpMesh.mTextureCoords[0][j];
-
-							// Set our vertex buffer 32 bit texture coordinate
-							float* RESTRICT currentVertexBufferFloat = reinterpret_cast<float*>(currentVertex);
-							*currentVertexBufferFloat = assimpTexCoord.x;
-							++currentVertexBufferFloat;
-							*currentVertexBufferFloat = assimpTexCoord.y;
-							currentVertex += sizeof(float) * 2;
-						}
-						else
-						{
-							// Set our vertex buffer 32 bit texture coordinate
-							float* RESTRICT currentVertexBufferFloat = reinterpret_cast<float*>(currentVertex);
-							*currentVertexBufferFloat = 0.0f;
-							++currentVertexBufferFloat;
-							*currentVertexBufferFloat = 0.0f;
-							currentVertex += sizeof(float) * 2;
+		/**
+		*  @brief
+		*    Fill the mesh data of a given mesh instance
+		*
+		*  @param[in]  meshInstance
+		*    Mesh instance to fill the data of, the tangent space of the Assimp mesh must already have been generated
+		*  @param[in]  skeleton
+		*    Skeleton instance
+		*  @param[in]  numberOfBytesPerVertex
+		*    Number of bytes per vertex
+		*  @param[in]  vertexBuffer
+		*    Vertex buffer to fill, only the vertex range of the mesh instance is written
+		*  @param[in]  indexBuffer
+		*    Index buffer to fill, only the index range of the mesh instance is written
+		*  @param[out] minimumBoundingBoxPosition
+		*    Receives the minimum bounding box position
+		*  @param[out] maximumBoundingBoxPosition
+		*    Receives the maximum bounding box position
+		*
+		*  @note
+		*    - Different mesh instances can be filled concurrently, the skeleton bone offset matrices aren't touched
+		*/
+		void fillMesh(const MeshInstance& meshInstance, const Skeleton& skeleton, uint8_t numberOfBytesPerVertex, uint8_t* vertexBuffer, uint32_t* indexBuffer, glm::vec3& minimumBoundingBoxPosition, glm::vec3& maximumBoundingBoxPosition)
+		{
+			const aiMesh& assimpMesh = *meshInstance.assimpMesh;
+			const aiMatrix3x3 assimpNormalTransformation = aiMatrix3x3(meshInstance.transformation);
+
+			{ // Loop through the Assimp mesh vertices
+				uint8_t* RESTRICT currentVertexBuffer = vertexBuffer + meshInstance.startVertex * numberOfBytesPerVertex;
+				for (uint32_t j = 0; j < assimpMesh.mNumVertices; ++j)
+				{
+					uint8_t* RESTRICT currentVertex = currentVertexBuffer + j * numberOfBytesPerVertex;
+
+					{ // 32 bit position
+						// Get the Assimp mesh vertex position
+						aiVector3D assimpVertex = assimpMesh.mVertices[j];
+
+						// Transform the Assimp mesh vertex position into global space
+						assimpVertex *= meshInstance.transformation;
+
+						// Set our vertex buffer position
+						float* RESTRICT currentVertexBufferFloat = reinterpret_cast<float*>(currentVertex);
+						*currentVertexBufferFloat = assimpVertex.x;
+						++currentVertexBufferFloat;
+						*currentVertexBufferFloat = assimpVertex.y;
+						++currentVertexBufferFloat;
+						*currentVertexBufferFloat = assimpVertex.z;
+						currentVertex += sizeof(float) * 3;
+
+						{ // Update minimum and maximum bounding box position
+							const glm::vec3 glmVertex(assimpVertex.x, assimpVertex.y, assimpVertex.z);
+							minimumBoundingBoxPosition = glm::min(minimumBoundingBoxPosition, glmVertex);
+							maximumBoundingBoxPosition = glm::max(maximumBoundingBoxPosition, glmVertex);
 						}
+					}
 
-						{ // 16 bit QTangent
-						  // - QTangent basing on http://dev.theomader.com/qtangents/ "QTangents" which is basing on
-						  //   http://www.crytek.com/cryengine/presentations/spherical-skinning-with-dual-quaternions-and-qtangents "Spherical Skinning with Dual-Quaternions and QTangents"
-							// Get the Assimp mesh vertex tangent, binormal and normal
-							aiVector3D tangent(1.0f, 0.0f, 0.0f);
-							aiVector3D binormal(0.0f, 1.0f, 0.0f);
-							aiVector3D normal = assimpMesh.mNormals[j];
-							if (0 != assimpMesh.mNumUVComponents[0] && nullptr != assimpMesh.mTangents && nullptr != assimpMesh.mBitangents)
-							{
-								tangent = assimpMesh.mTangents[j];
-								binormal = assimpMesh.mBitangents[j];
-							}
+					// 32 bit texture coordinate
+					if (0 != assimpMesh.mNumUVComponents[0])
+					{
+						// Get the Assimp mesh vertex texture coordinate
+						aiVector3D assimpTexCoord = assimpMesh.mTextureCoords[0][j];
+
+						// Set our vertex buffer 32 bit texture coordinate
+						float* RESTRICT currentVertexBufferFloat = reinterpret_cast<float*>(currentVertex);
+						*currentVertexBufferFloat = assimpTexCoord.x;
+						++currentVertexBufferFloat;
+						*currentVertexBufferFloat = assimpTexCoord.y;
+						currentVertex += sizeof(float) * 2;
+					}
+					else
+					{
+						// Set our vertex buffer 32 bit texture coordinate
+						float* RESTRICT currentVertexBufferFloat = reinterpret_cast<float*>(currentVertex);
+						*currentVertexBufferFloat = 0.0f;
+						++currentVertexBufferFloat;
+						*currentVertexBufferFloat = 0.0f;
+						currentVertex += sizeof(float) * 2;
+					}
 
-							// Transform the Assimp mesh vertex data into global space and re-normalize since the transform might contain scale
-							tangent *= currentAssimpNormalTransformation;
-							binormal *= currentAssimpNormalTransformation;
-							normal *= currentAssimpNormalTransformation;
-							tangent.Normalize();
-							binormal.Normalize();
-							normal.Normalize();
-
-							// Generate tangent frame rotation matrix
-							glm::mat3 tangentFrame(
-								tangent.x,  tangent.y,  tangent.z,
-								binormal.x, binormal.y, binormal.z,
-								normal.x,   normal.y,   normal.z
-							);
-
-							// Calculate tangent frame quaternion
-							const glm::quat tangentFrameQuaternion = Renderer::Math::calculateTangentFrameQuaternion(tangentFrame);
-
-							// Set our vertex buffer 16 bit QTangent
-							short* RESTRICT currentVertexBufferShort = reinterpret_cast<short*>(currentVertex);
-							*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.x * SHRT_MAX);
-							++currentVertexBufferShort;
-							*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.y * SHRT_MAX);
-							++currentVertexBufferShort;
-							*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.z * SHRT_MAX);
-							++currentVertexBufferShort;
-							*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.w * SHRT_MAX);
-							currentVertex += sizeof(short) * 4;
+					{ // 16 bit QTangent
+					  // - QTangent basing on http://dev.theomader.com/qtangents/ "QTangents" which is basing on
+					  //   http://www.crytek.com/cryengine/presentations/spherical-skinning-with-dual-quaternions-and-qtangents "Spherical Skinning with Dual-Quaternions and QTangents"
+						// Get the Assimp mesh vertex tangent, binormal and normal
+						aiVector3D tangent(1.0f, 0.0f, 0.0f);
+						aiVector3D binormal(0.0f, 1.0f, 0.0f);
+						aiVector3D normal = assimpMesh.mNormals[j];
+						if (0 != assimpMesh.mNumUVComponents[0] && nullptr != assimpMesh.mTangents && nullptr != assimpMesh.mBitangents)
+						{
+							tangent = assimpMesh.mTangents[j];
+							binormal = assimpMesh.mBitangents[j];
 						}
+
+						// Transform the Assimp mesh vertex data into global space and re-normalize since the transform might contain scale
+						tangent *= assimpNormalTransformation;
+						binormal *= assimpNormalTransformation;
+						normal *= assimpNormalTransformation;
+						tangent.Normalize();
+						binormal.Normalize();
+						normal.Normalize();
+
+						// Generate tangent frame rotation matrix
+						glm::mat3 tangentFrame(
+							tangent.x,  tangent.y,  tangent.z,
+							binormal.x, binormal.y, binormal.z,
+							normal.x,   normal.y,   normal.z
+						);
+
+						// Calculate tangent frame quaternion
+						const glm::quat tangentFrameQuaternion = Renderer::Math::calculateTangentFrameQuaternion(tangentFrame);
+
+						// Set our vertex buffer 16 bit QTangent
+						short* RESTRICT currentVertexBufferShort = reinterpret_cast<short*>(currentVertex);
+						*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.x * SHRT_MAX);
+						++currentVertexBufferShort;
+						*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.y * SHRT_MAX);
+						++currentVertexBufferShort;
+						*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.z * SHRT_MAX);
+						++currentVertexBufferShort;
+						*currentVertexBufferShort = static_cast<short>(tangentFrameQuaternion.w * SHRT_MAX);
+						currentVertex += sizeof(short) * 4;
 					}
 				}
+			}
+
+			// Process the Assimp bones, if there are any to start with
+			if (assimpMesh.mNumBones > 0 && skeleton.numberOfBones > 0)
+			{
+				std::vector<uint8_t> numberOfWeightsPerVertex;
+				numberOfWeightsPerVertex.resize(assimpMesh.mNumVertices);
+				memset(numberOfWeightsPerVertex.data(), 0, sizeof(uint8_t) * assimpMesh.mNumVertices);
 
-				// Process the Assimp bones, if there are any to start with
-				if (assimpMesh.mNumBones > 0 && skeleton.numberOfBones > 0)
+				// Loop through the Assimp bones
+				uint8_t* RESTRICT currentVertexBuffer = vertexBuffer + meshInstance.startVertex * numberOfBytesPerVertex;
+				for (unsigned int bone = 0; bone < assimpMesh.mNumBones; ++bone)
 				{
-					std::vector<uint8_t> numberOfWeightsPerVertex;
-					numberOfWeightsPerVertex.resize(assimpMesh.mNumVertices);
-					memset(numberOfWeightsPerVertex.data(), 0, sizeof(uint8_t) * assimpMesh.mNumVertices);
+					const aiBone* assimpBone = assimpMesh.mBones[bone];
+					const uint32_t boneIndex = skeleton.getBoneIndexByBoneId(Renderer::StringId::calculateFNV(assimpBone->mName.C_Str()));
+					if (Renderer::isInvalid(boneIndex))
+					{
+						throw std::runtime_error(std::string("Invalid Assimp bone name \"") + assimpBone->mName.C_Str() + '\"');
+					}
 
-					// Loop through the Assimp bones
-					uint8_t* RESTRICT currentVertexBuffer = vertexBuffer + numberOfVertices * numberOfBytesPerVertex;
-					for (unsigned int bone = 0; bone < assimpMesh.mNumBones; ++bone)
+					// Loop through the Assimp bone weights
+					for (unsigned int weight = 0; weight < assimpBone->mNumWeights; ++weight)
 					{
-						const aiBone* assimpBone = assimpMesh.mBones[bone];
-						const uint32_t boneIndex = skeleton.getBoneIndexByBoneId(Renderer::StringId::calculateFNV(assimpBone->mName.C_Str()));
-						if (Renderer::isInvalid(boneIndex))
-						{
-							throw std::runtime_error(std::string("Invalid Assimp bone name \"") + assimpBone->mName.C_Str() + '\"');
-						}
-						skeleton.boneOffsetMatrices[boneIndex] = assimpBone->mOffsetMatrix;
+						const aiVertexWeight& assimpVertexWeight = assimpBone->mWeights[weight];
 
-						// Loop through the Assimp bone weights
-						for (unsigned int weight = 0; weight < assimpBone->mNumWeights; ++weight)
+						// Does this vertex still have a free weight slot?
+						const uint8_t numberOfVertexWeights = numberOfWeightsPerVertex[assimpVertexWeight.mVertexId];
+						if (numberOfVertexWeights < 4)
 						{
-							const aiVertexWeight& assimpVertexWeight = assimpBone->mWeights[weight];
-
-							// Does this vertex still have a free weight slot?
-							const uint8_t numberOfVertexWeights = numberOfWeightsPerVertex[assimpVertexWeight.mVertexId];
-							if (numberOfVertexWeights < 4)
-							{
-								uint8_t* RESTRICT currentVertex = currentVertexBuffer + assimpVertexWeight.mVertexId * numberOfBytesPerVertex;
+							uint8_t* RESTRICT currentVertex = currentVertexBuffer + assimpVertexWeight.mVertexId * numberOfBytesPerVertex;
 
-								// Skip 32 bit position, 32 bit texture coordinate and 16 bit QTangent
-								currentVertex += sizeof(float) * 3 + sizeof(float) * 2 + sizeof(short) * 4;
+							// Skip 32 bit position, 32 bit texture coordinate and 16 bit QTangent
+							currentVertex += sizeof(float) * 3 + sizeof(float) * 2 + sizeof(short) * 4;
 
-								{ // 8 bit bone indices
-									uint8_t* boneIndices = currentVertex;
-									boneIndices[numberOfVertexWeights] = static_cast<uint8_t>(boneIndex);
-									currentVertex += sizeof(uint8_t) * 4;
-								}
-
-								{ // 8 bit bone weights
-									uint8_t* boneWeights = reinterpret_cast<uint8_t*>(currentVertex);
-									boneWeights[numberOfVertexWeights] = static_cast<uint8_t>(assimpVertexWeight.mWeight * 255);
-								}
+							{ // 8 bit bone indices
+								uint8_t* boneIndices = currentVertex;
+								boneIndices[numberOfVertexWeights] = static_cast<uint8_t>(boneIndex);
+								currentVertex += sizeof(uint8_t) * 4;
+							}
 
-								// Update the number of vertex weights
-								++numberOfWeightsPerVertex[assimpVertexWeight.mVertexId];
+							{ // 8 bit bone weights
+								uint8_t* boneWeights = reinterpret_cast<uint8_t*>(currentVertex);
+								boneWeights[numberOfVertexWeights] = static_cast<uint8_t>(assimpVertexWeight.mWeight * 255);
 							}
+
+							// Update the number of vertex weights
+							++numberOfWeightsPerVertex[assimpVertexWeight.mVertexId];
 						}
 					}
 				}
+			}
 
-				// Update the number of processed vertices
-				numberOfVertices += assimpMesh.mNumVertices;
+			// Loop through all Assimp mesh faces
+			uint32_t* currentIndexBuffer = indexBuffer + meshInstance.startIndex;
+			for (uint32_t j = 0; j < assimpMesh.mNumFaces; ++j)
+			{
+				// Get the Assimp face
+				const aiFace& assimpFace = assimpMesh.mFaces[j];
 
-				// Loop through all Assimp mesh faces
-				uint32_t* currentIndexBuffer = indexBuffer + numberOfIndices;
-				for (uint32_t j = 0; j < assimpMesh.mNumFaces; ++j)
+				// Loop through all indices of the Assimp face and set our indices
+				for (uint32_t assimpIndex = 0; assimpIndex < assimpFace.mNumIndices; ++assimpIndex, ++currentIndexBuffer)
 				{
-					// Get the Assimp face
-					const aiFace& assimpFace = assimpMesh.mFaces[j];
-
-					// Loop through all indices of the Assimp face and set our indices
-					for (uint32_t assimpIndex = 0; assimpIndex < assimpFace.mNumIndices; ++assimpIndex, ++currentIndexBuffer)
-					{
-						//					  Assimp mesh vertex index			 Where the Assimp mesh starts within the our vertex buffer
-						*currentIndexBuffer = assimpFace.mIndices[assimpIndex] + starVertex;
-					}
-
-					// Update the number if processed indices
-					numberOfIndices += assimpFace.mNumIndices;
+					//					  Assimp mesh vertex index			 Where the Assimp mesh starts within the our vertex buffer
+					*currentIndexBuffer = assimpFace.mIndices[assimpIndex] + meshInstance.startVertex;
 				}
 			}
-
-			// Loop through all child nodes recursively
-			for (uint32_t assimpChild = 0; assimpChild < assimpNode.mNumChildren; ++assimpChild)
-			{
-				fillMeshRecursive(assimpScene, *assimpNode.mChildren[assimpChild], skeleton, numberOfBytesPerVertex, vertexBuffer, indexBuffer, currentAssimpTransformation, minimumBoundingBoxPosition, maximumBoundingBoxPosition, numberOfVertices, numberOfIndices);
-			}
 		}
 
 		/**
@@ -703,6 +745,94 @@ namespace
 			}
 		}
 
+		/**
+		*  @brief
+		*    Encode index buffer data using the "meshoptimizer" index buffer codec
+		*
+		*  @param[in] indexBufferData
+		*    Triangle list index buffer data to encode, should be vertex cache optimized for best results
+		*  @param[in] numberOfVertices
+		*    Number of vertices referenced by the index buffer data
+		*  @param[out] encodedIndexBufferData
+		*    Receives the encoded index buffer data, can be decoded into 16-bit or 32-bit indices
+		*/
+		void encodeIndexBufferData(const std::vector<uint32_t>& indexBufferData, uint32_t numberOfVertices, std::vector<uint8_t>& encodedIndexBufferData)
+		{
+			encodedIndexBufferData.resize(meshopt_encodeIndexBufferBound(indexBufferData.size(), numberOfVertices));
+			encodedIndexBufferData.resize(meshopt_encodeIndexBuffer(encodedIndexBufferData.data(), encodedIndexBufferData.size(), indexBufferData.data(), indexBufferData.size()));
+			if (encodedIndexBufferData.empty())
+			{
+				throw std::runtime_error("Failed to encode the index buffer using meshoptimizer");
+			}
+		}
+
+		/**
+		*  @brief
+		*    Quantize vertex buffer data for writing it into a mesh file
+		*
+		*  @param[in] skinned
+		*    "true" if the vertex buffer data is using the skinned vertex layout, else "false"
+		*  @param[in] vertexBufferData
+		*    Vertex buffer data using "NUMBER_OF_BYTES_PER_VERTEX" or "NUMBER_OF_BYTES_PER_SKINNED_VERTEX" bytes per vertex
+		*  @param[in] numberOfVertices
+		*    Number of vertices
+		*  @param[in] minimumBoundingBoxPosition
+		*    Minimum bounding box position, used for the position quantization
+		*  @param[in] maximumBoundingBoxPosition
+		*    Maximum bounding box position, used for the position quantization
+		*  @param[out] quantizedVertexBufferData
+		*    Receives the quantized vertex buffer data using "NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX" or "NUMBER_OF_BYTES_PER_QUANTIZED_SKINNED_VERTEX" bytes per vertex
+		*  @param[out] maximumPositionQuantizationError
+		*    Receives the maximum absolute position quantization error, zero for skinned vertices since their positions aren't quantized
+		*  @param[out] maximumTextureCoordinateQuantizationError
+		*    Receives the maximum absolute texture coordinate quantization error
+		*
+		*  @note
+		*    - The QTangent is already 16 bit and the bone indices and bone weights are already 8 bit, those are just copied over
+		*/
+		void quantizeVertexBufferData(bool skinned, const uint8_t* vertexBufferData, uint32_t numberOfVertices, const glm::vec3& minimumBoundingBoxPosition, const glm::vec3& maximumBoundingBoxPosition, std::vector<uint8_t>& quantizedVertexBufferData, float& maximumPositionQuantizationError, float& maximumTextureCoordinateQuantizationError)
+		{
+			const uint8_t numberOfBytesPerVertex = skinned ? NUMBER_OF_BYTES_PER_SKINNED_VERTEX : NUMBER_OF_BYTES_PER_VERTEX;
+			const uint8_t numberOfBytesPerQuantizedVertex = skinned ? NUMBER_OF_BYTES_PER_QUANTIZED_SKINNED_VERTEX : NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX;
+			quantizedVertexBufferData.resize(static_cast<size_t>(numberOfBytesPerQuantizedVertex) * numberOfVertices);
+			maximumPositionQuantizationError = 0.0f;
+			maximumTextureCoordinateQuantizationError = 0.0f;
+			const uint8_t* RESTRICT currentVertex = vertexBufferData;
+			uint8_t* RESTRICT currentQuantizedVertex = quantizedVertexBufferData.data();
+			for (uint32_t vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex)
+			{
+				const float* currentVertexFloat = reinterpret_cast<const float*>(currentVertex);
+
+				// Position
+				if (skinned)
+				{
+					// 32 bit position, skinning is done in object space so there's no bounding box which stays valid during animation
+					memcpy(currentQuantizedVertex, currentVertexFloat, sizeof(float) * 3);
+					currentQuantizedVertex += sizeof(float) * 3;
+				}
+				else
+				{
+					// 16 bit position relative to the bounding box
+					uint16_t* quantizedPosition = reinterpret_cast<uint16_t*>(currentQuantizedVertex);
+					maximumPositionQuantizationError = std::max(maximumPositionQuantizationError, Renderer::Math::quantizeVertexPosition(glm::vec3(currentVertexFloat[0], currentVertexFloat[1], currentVertexFloat[2]), minimumBoundingBoxPosition, maximumBoundingBoxPosition, quantizedPosition));
+					currentQuantizedVertex += sizeof(uint16_t) * 4;
+				}
+
+				// 16 bit texture coordinate
+				uint16_t* quantizedTextureCoordinate = reinterpret_cast<uint16_t*>(currentQuantizedVertex);
+				maximumTextureCoordinateQuantizationError = std::max(maximumTextureCoordinateQuantizationError, Renderer::Math::quantizeTextureCoordinate(glm::vec2(currentVertexFloat[3], currentVertexFloat[4]), quantizedTextureCoordinate));
+				currentQuantizedVertex += sizeof(uint16_t) * 2;
+
+				// 16 bit QTangent and optional 8 bit bone indices and bone weights
+				const uint8_t numberOfRemainingBytes = static_cast<uint8_t>(numberOfBytesPerVertex - sizeof(float) * 5);
+				memcpy(currentQuantizedVertex, currentVertex + sizeof(float) * 5, numberOfRemainingBytes);
+				currentQuantizedVertex += numberOfRemainingBytes;
+
+				// Next vertex, please
+				currentVertex += numberOfBytesPerVertex;
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -745,6 +875,16 @@ namespace RendererToolkit
 		{
 			Renderer::MemoryFile memoryFile(0, 42 * 1024);
 
+			// Per-stage timings for the compilation report, large meshes like photogrammetry ones can take quite some time
+			Renderer::Stopwatch totalStopwatch(true);
+			Renderer::Stopwatch stageStopwatch(true);
+			float importMilliseconds = 0.0f;
+			float fillMilliseconds = 0.0f;
+			float lodMilliseconds = 0.0f;
+			float meshletMilliseconds = 0.0f;
+			float vertexFetchMilliseconds = 0.0f;
+			float encodeMilliseconds = 0.0f;
+
 			// Setup "MikkTSpace" by Morten S. Mikkelsen ( http://mmikkelsen3d.blogspot.com/ ) for semi-standard tangent space generation (see http://www.mikktspace.com/ for background information)
 			SMikkTSpaceInterface mikkTSpaceInterface;
 			mikkTSpaceInterface.m_getNumFaces		   = MikkTSpace::getNumFaces;
@@ -754,8 +894,6 @@ namespace RendererToolkit
 			mikkTSpaceInterface.m_getTexCoord		   = MikkTSpace::getTexCoord;
 			mikkTSpaceInterface.m_setTSpaceBasic	   = nullptr;
 			mikkTSpaceInterface.m_setTSpace			   = MikkTSpace::setTSpace;
-			MikkTSpace::g_MikkTSpaceContext.m_pInterface = &mikkTSpaceInterface;
-			MikkTSpace::g_MikkTSpaceContext.m_pUserData  = nullptr;
 
 			// Create an instance of the Assimp importer class
 			AssimpLogStream assimpLogStream;
@@ -768,6 +906,7 @@ namespace RendererToolkit
 			// -> "aiProcess_CalcTangentSpace" from Assimp is still used to allocate internal memory and enable Assimp to perform work regarding e.g. shared vertices
 			assimpImporter.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_LINE | aiPrimitiveType_POINT);	// Tell ASSIMP that we don't support lines nor points
 			const aiScene* assimpScene = assimpImporter.ReadFile(virtualInputFilename.c_str(), AssimpHelper::getAssimpFlagsByRapidJsonValue(rapidJsonValueMeshAssetCompiler, "ImportFlags"));
+			importMilliseconds = stageStopwatch.getMilliseconds();
 			if (nullptr != assimpScene && nullptr != assimpScene->mRootNode)
 			{
 				// Get the optional material name to asset ID mapping information
@@ -831,17 +970,72 @@ namespace RendererToolkit
 				std::vector<uint32_t> indexBufferData(numberOfIndices);
 				std::vector<uint16_t> temporaryShortIndexBufferData;	// Defined here to be able to reuse allocated memory
 
-				// Fill the mesh data recursively
+				// Fill the mesh data
 				glm::vec3 minimumBoundingBoxPosition(std::numeric_limits<float>::max());
 				glm::vec3 maximumBoundingBoxPosition(std::numeric_limits<float>::lowest());
 				{
-					uint32_t numberOfFilledVertices = 0;
-					uint32_t numberOfFilledIndices  = 0;
-					::detail::fillMeshRecursive(*assimpScene, *assimpScene->mRootNode, skeleton, numberOfBytesPerVertex, vertexBufferData, &indexBufferData[0], aiMatrix4x4(), minimumBoundingBoxPosition, maximumBoundingBoxPosition, numberOfFilledVertices, numberOfFilledIndices);
-					if (numberOfVertices != numberOfFilledVertices || numberOfIndices != numberOfFilledIndices)
+					stageStopwatch.start();
+
+					// Gather the mesh instances, their order is the sub-mesh order
+					::detail::MeshInstances meshInstances;
+					{
+						uint32_t numberOfFilledVertices = 0;
+						uint32_t numberOfFilledIndices  = 0;
+						::detail::gatherMeshInstancesRecursive(*assimpScene, *assimpScene->mRootNode, aiMatrix4x4(), meshInstances, numberOfFilledVertices, numberOfFilledIndices);
+						if (numberOfVertices != numberOfFilledVertices || numberOfIndices != numberOfFilledIndices || meshInstances.size() != subMeshes.size())
+						{
+							throw std::runtime_error("Error while recursively filling the mesh data");
+						}
+					}
+
+					// Generate the tangent space of each Assimp mesh in parallel, an Assimp mesh can be used by multiple nodes but must be processed only once
+					{
+						std::vector<aiMesh*> assimpMeshes;
+						assimpMeshes.reserve(assimpScene->mNumMeshes);
+						for (const ::detail::MeshInstance& meshInstance : meshInstances)
+						{
+							if (std::find(assimpMeshes.cbegin(), assimpMeshes.cend(), meshInstance.assimpMesh) == assimpMeshes.cend())
+							{
+								assimpMeshes.push_back(meshInstance.assimpMesh);
+							}
+						}
+						ParallelHelper::forEachInParallel(static_cast<uint32_t>(assimpMeshes.size()), [&mikkTSpaceInterface, &assimpMeshes](uint32_t assimpMeshIndex)
+						{
+							::detail::generateTangentSpace(mikkTSpaceInterface, *assimpMeshes[assimpMeshIndex]);
+						});
+					}
+
+					// Fill the mesh instances in parallel, each one writes only into its own vertex and index range
+					// -> The bounding box is gathered per mesh instance and merged afterwards
+					const uint32_t numberOfMeshInstances = static_cast<uint32_t>(meshInstances.size());
+					std::vector<glm::vec3> minimumBoundingBoxPositions(numberOfMeshInstances, minimumBoundingBoxPosition);
+					std::vector<glm::vec3> maximumBoundingBoxPositions(numberOfMeshInstances, maximumBoundingBoxPosition);
+					ParallelHelper::forEachInParallel(numberOfMeshInstances, [&](uint32_t meshInstanceIndex)
+					{
+						::detail::fillMesh(meshInstances[meshInstanceIndex], skeleton, numberOfBytesPerVertex, vertexBufferData, indexBufferData.data(), minimumBoundingBoxPositions[meshInstanceIndex], maximumBoundingBoxPositions[meshInstanceIndex]);
+					});
+					for (uint32_t meshInstanceIndex = 0; meshInstanceIndex < numberOfMeshInstances; ++meshInstanceIndex)
+					{
+						minimumBoundingBoxPosition = glm::min(minimumBoundingBoxPosition, minimumBoundingBoxPositions[meshInstanceIndex]);
+						maximumBoundingBoxPosition = glm::max(maximumBoundingBoxPosition, maximumBoundingBoxPositions[meshInstanceIndex]);
+					}
+
+					// Set the skeleton bone offset matrices in mesh instance order, bones used by multiple meshes get the offset matrix of the last one
+					if (skeleton.numberOfBones > 0)
 					{
-						throw std::runtime_error("Error while recursively filling the mesh data");
+						for (const ::detail::MeshInstance& meshInstance : meshInstances)
+						{
+							const aiMesh& assimpMesh = *meshInstance.assimpMesh;
+							for (unsigned int bone = 0; bone < assimpMesh.mNumBones; ++bone)
+							{
+								// The bone index was already validated while filling the mesh instance
+								const aiBone* assimpBone = assimpMesh.mBones[bone];
+								skeleton.boneOffsetMatrices[skeleton.getBoneIndexByBoneId(Renderer::StringId::calculateFNV(assimpBone->mName.C_Str()))] = assimpBone->mOffsetMatrix;
+							}
+						}
 					}
+
+					fillMilliseconds = stageStopwatch.getMilliseconds();
 				}
 
 				// Paranoid sub-mesh and number of indices sanity check
@@ -861,6 +1055,7 @@ namespace RendererToolkit
 
 				// "meshoptimizer", in-place is supported internally so we don't need to create own vertex and index buffer copies
 				std::vector<uint32_t> positionOnlyIndexBufferData;
+				std::vector<Renderer::v1Mesh::Meshlet> meshlets;
 				uint32_t numberOfLods = 5;	// There's always at least one LOD, namely the original none reduced version
 				{
 					// "meshoptimizer" configuration
@@ -896,7 +1091,10 @@ namespace RendererToolkit
 					}
 
 					// Step one: Create the LOD indices
-					for (uint32_t subMeshIndex = 0; subMeshIndex < numberOfSubMeshes; ++subMeshIndex)
+					// -> The sub-meshes are independent of each other and processed in parallel, each one only writes into its own LOD index lists or its own index buffer range
+					// -> Each LOD of a sub-mesh is simplified from the previous LOD so the LOD chain itself is sequential, but optimizing the LODs for vertex cache and overdraw is done in parallel again
+					stageStopwatch.start();
+					ParallelHelper::forEachInParallel(numberOfSubMeshes, [&](uint32_t subMeshIndex)
 					{
 						const Renderer::v1Mesh::SubMesh& subMesh = subMeshes[subMeshIndex];
 						uint32_t* subMeshIndexBufferData = &indexBufferData[subMesh.startIndexLocation];
@@ -925,18 +1123,10 @@ namespace RendererToolkit
 								currentLodIndices.resize(source.size());
 								currentLodIndices.resize(meshopt_simplify(currentLodIndices.data(), source.data(), source.size(), reinterpret_cast<const float*>(vertexBufferData), numberOfVertices, numberOfBytesPerVertex, targetNumberOfIndices, TARGET_ERROR));
 							}
-
-							// Optimize each individual LOD for vertex cache & overdraw
-							for (size_t lodIndex = 0; lodIndex < numberOfLods; ++lodIndex)
-							{
-								std::vector<unsigned int>& currentLodIndices = lodIndices[lodIndex][subMeshIndex];
-								meshopt_optimizeVertexCache(currentLodIndices.data(), currentLodIndices.data(), currentLodIndices.size(), numberOfVertices);
-								meshopt_optimizeOverdraw(currentLodIndices.data(), currentLodIndices.data(), currentLodIndices.size(), reinterpret_cast<const float*>(vertexBufferData), numberOfVertices, numberOfBytesPerVertex, OVERDRAW_THRESHOLD);
-							}
 						}
 						else
 						{
-							lodIndexOffsets[0][subMeshIndex] = 0;
+							lodIndexOffsets[0][subMeshIndex] = subMesh.startIndexLocation;
 							lodNumberOfIndices[0][subMeshIndex] = subMeshNumberOfIndices;
 
 							// Vertex cache optimization should go first as it provides starting order for overdraw
@@ -945,7 +1135,18 @@ namespace RendererToolkit
 							// Reorder indices for overdraw, balancing overdraw and vertex cache efficiency
 							meshopt_optimizeOverdraw(subMeshIndexBufferData, subMeshIndexBufferData, subMeshNumberOfIndices, reinterpret_cast<const float*>(vertexBufferData), numberOfVertices, numberOfBytesPerVertex, OVERDRAW_THRESHOLD);
 						}
+					});
+					if (numberOfLods > 1)
+					{
+						// Optimize each individual LOD of each sub-mesh for vertex cache & overdraw
+						ParallelHelper::forEachInParallel(numberOfSubMeshes * numberOfLods, [&](uint32_t item)
+						{
+							std::vector<unsigned int>& currentLodIndices = lodIndices[item % numberOfLods][item / numberOfLods];
+							meshopt_optimizeVertexCache(currentLodIndices.data(), currentLodIndices.data(), currentLodIndices.size(), numberOfVertices);
+							meshopt_optimizeOverdraw(currentLodIndices.data(), currentLodIndices.data(), currentLodIndices.size(), reinterpret_cast<const float*>(vertexBufferData), numberOfVertices, numberOfBytesPerVertex, OVERDRAW_THRESHOLD);
+						});
 					}
+					lodMilliseconds = stageStopwatch.getMilliseconds();
 
 					// Step two: Concatenate all LODs into one index buffer
 					if (numberOfLods > 1)
@@ -1004,10 +1205,100 @@ namespace RendererToolkit
 						}
 					}
 
-					// Step four: Vertex fetch optimization should go last as it depends on the final index order, note that the order of LODs above affects vertex fetch results
+					// Step four: Optional meshlets (aka clusters) for fine-grained culling like frustum, occlusion and backface culling at cluster granularity
+					// -> The triangles of each sub-mesh of each LOD are reordered so that each meshlet is a continuous index range, the sub-mesh can still be rendered as a whole
+					// -> The meshlet bounds are invariant to the vertex remapping done by the following vertex fetch optimization, so they can be computed right now
+					stageStopwatch.start();
+					{
+						bool buildMeshlets = false;
+						JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "BuildMeshlets", buildMeshlets);
+						if (buildMeshlets && numberOfIndices > 0)
+						{
+							// "meshoptimizer" meshlet configuration, by default use the limits recommended for NVIDIA mesh shaders
+							uint32_t maximumNumberOfMeshletVertices = 64;
+							uint32_t maximumNumberOfMeshletTriangles = 124;
+							float meshletConeWeight = 0.25f;	// Trade off between spatial locality and normal cone tightness, the later is important for backface culling
+							JsonHelper::optionalIntegerProperty(rapidJsonValueMeshAssetCompiler, "MaximumNumberOfMeshletVertices", maximumNumberOfMeshletVertices);
+							JsonHelper::optionalIntegerProperty(rapidJsonValueMeshAssetCompiler, "MaximumNumberOfMeshletTriangles", maximumNumberOfMeshletTriangles);
+							JsonHelper::optionalFloatProperty(rapidJsonValueMeshAssetCompiler, "MeshletConeWeight", meshletConeWeight);
+							if (maximumNumberOfMeshletVertices < 3 || maximumNumberOfMeshletVertices > 255)
+							{
+								throw std::runtime_error("The maximum number of meshlet vertices must be inside the interval [3, 255]");
+							}
+							if (maximumNumberOfMeshletTriangles < 4 || maximumNumberOfMeshletTriangles > 512 || (maximumNumberOfMeshletTriangles % 4) != 0)
+							{
+								throw std::runtime_error("The maximum number of meshlet triangles must be inside the interval [4, 512] and divisible by four");
+							}
+
+							// Build the meshlets of each sub-mesh of each LOD in parallel, each sub-mesh only writes into its own index buffer range and its own meshlet list
+							// -> The meshlet lists are concatenated in sub-mesh order afterwards, so the result doesn't depend on the number of threads
+							const uint32_t numberOfSubMeshesAndLods = static_cast<uint32_t>(subMeshes.size());
+							std::vector<std::vector<Renderer::v1Mesh::Meshlet>> subMeshMeshlets(numberOfSubMeshesAndLods);
+							ParallelHelper::forEachInParallel(numberOfSubMeshesAndLods, [&](uint32_t subMeshIndex)
+							{
+								// Build the meshlets
+								const Renderer::v1Mesh::SubMesh& subMesh = subMeshes[subMeshIndex];
+								std::vector<Renderer::v1Mesh::Meshlet>& currentMeshlets = subMeshMeshlets[subMeshIndex];
+								uint32_t* subMeshIndexBufferData = &indexBufferData[subMesh.startIndexLocation];
+								const size_t maximumNumberOfMeshlets = meshopt_buildMeshletsBound(subMesh.numberOfIndices, maximumNumberOfMeshletVertices, maximumNumberOfMeshletTriangles);
+								std::vector<meshopt_Meshlet> meshoptMeshlets(maximumNumberOfMeshlets);
+								std::vector<unsigned int> meshletVertices(maximumNumberOfMeshlets * maximumNumberOfMeshletVertices);
+								std::vector<unsigned char> meshletTriangles(maximumNumberOfMeshlets * maximumNumberOfMeshletTriangles * 3);
+								const size_t numberOfMeshlets = meshopt_buildMeshlets(meshoptMeshlets.data(), meshletVertices.data(), meshletTriangles.data(), subMeshIndexBufferData, subMesh.numberOfIndices, reinterpret_cast<const float*>(vertexBufferData), numberOfVertices, numberOfBytesPerVertex, maximumNumberOfMeshletVertices, maximumNumberOfMeshletTriangles, meshletConeWeight);
+								currentMeshlets.reserve(numberOfMeshlets);
+
+								// Write the meshlet triangles back into the sub-mesh index range, since the meshlets contain exactly the same triangles in-place is fine
+								uint32_t currentIndexLocation = subMesh.startIndexLocation;
+								for (size_t meshletIndex = 0; meshletIndex < numberOfMeshlets; ++meshletIndex)
+								{
+									const meshopt_Meshlet& meshoptMeshlet = meshoptMeshlets[meshletIndex];
+									const unsigned int* currentMeshletVertices = &meshletVertices[meshoptMeshlet.vertex_offset];
+									const unsigned char* currentMeshletTriangles = &meshletTriangles[meshoptMeshlet.triangle_offset];
+									const meshopt_Bounds meshoptBounds = meshopt_computeMeshletBounds(currentMeshletVertices, currentMeshletTriangles, meshoptMeshlet.triangle_count, reinterpret_cast<const float*>(vertexBufferData), numberOfVertices, numberOfBytesPerVertex);
+
+									// Add meshlet
+									Renderer::v1Mesh::Meshlet meshlet;
+									meshlet.startIndexLocation	   = currentIndexLocation;
+									meshlet.numberOfIndices		   = meshoptMeshlet.triangle_count * 3;
+									meshlet.boundingSpherePosition = glm::vec3(meshoptBounds.center[0], meshoptBounds.center[1], meshoptBounds.center[2]);
+									meshlet.boundingSphereRadius   = meshoptBounds.radius;
+									meshlet.coneApex			   = glm::vec3(meshoptBounds.cone_apex[0], meshoptBounds.cone_apex[1], meshoptBounds.cone_apex[2]);
+									meshlet.coneAxis			   = glm::vec3(meshoptBounds.cone_axis[0], meshoptBounds.cone_axis[1], meshoptBounds.cone_axis[2]);
+									meshlet.coneCutoff			   = meshoptBounds.cone_cutoff;
+									currentMeshlets.push_back(meshlet);
+
+									// Write down the meshlet triangles and optimize them for vertex cache, this doesn't leave the meshlet index range
+									for (uint32_t i = 0; i < meshlet.numberOfIndices; ++i)
+									{
+										indexBufferData[currentIndexLocation + i] = currentMeshletVertices[currentMeshletTriangles[i]];
+									}
+									meshopt_optimizeVertexCache(&indexBufferData[currentIndexLocation], &indexBufferData[currentIndexLocation], meshlet.numberOfIndices, numberOfVertices);
+									currentIndexLocation += meshlet.numberOfIndices;
+								}
+								if (currentIndexLocation != subMesh.startIndexLocation + subMesh.numberOfIndices)
+								{
+									throw std::runtime_error("Meshlet and sub-mesh number of indices mismatch");
+								}
+							});
+
+							// Concatenate the meshlets of all sub-meshes
+							for (uint32_t subMeshIndex = 0; subMeshIndex < numberOfSubMeshesAndLods; ++subMeshIndex)
+							{
+								Renderer::v1Mesh::SubMesh& subMesh = subMeshes[subMeshIndex];
+								const std::vector<Renderer::v1Mesh::Meshlet>& currentMeshlets = subMeshMeshlets[subMeshIndex];
+								subMesh.startMeshletIndex = static_cast<uint32_t>(meshlets.size());
+								subMesh.numberOfMeshlets  = static_cast<uint32_t>(currentMeshlets.size());
+								meshlets.insert(meshlets.end(), currentMeshlets.cbegin(), currentMeshlets.cend());
+							}
+						}
+					}
+					meshletMilliseconds = stageStopwatch.getMilliseconds();
+
+					// Step five: Vertex fetch optimization should go last as it depends on the final index order, note that the order of LODs above affects vertex fetch results
+					stageStopwatch.start();
 					meshopt_optimizeVertexFetch(vertexBufferData, indexBufferData.data(), numberOfIndices, vertexBufferData, numberOfVertices, numberOfBytesPerVertex);
 
-					// Step five: Optional position-only index buffer (can reduce the number of processed vertices up to half)
+					// Step six: Optional position-only index buffer (can reduce the number of processed vertices up to half)
 					// -> This index buffer can be used for position-only rendering (e.g. shadow map rendering) using the same vertex data that the original index buffer uses
 					// -> In case a mesh is only used together with materials using an alpha map for semi-transparent rendering, one can disable the optional position-only index buffer to save some memory (automatic detection not possible since the material might be changed during runtime)
 					{
@@ -1016,6 +1307,10 @@ namespace RendererToolkit
 						if (hasPositionOnlyIndexBuffer)
 						{
 							positionOnlyIndexBufferData.resize(numberOfIndices);
+							const uint8_t* positionVertexBufferData = vertexBufferData;
+							size_t numberOfBytesPerPositionVertex = 12;	// Number of bytes per position-only vertex (3 float position) = 12 bytes
+							size_t positionVertexStride = numberOfBytesPerVertex;
+							uint8_t* temporaryVertexBufferData = nullptr;
 							if (numberOfBones > 0)
 							{
 								// For "meshopt_generateShadowIndexBuffer()" to work correctly, we also need to take the bone indices and bone weights into account. Those attributes don't directly
@@ -1024,7 +1319,7 @@ namespace RendererToolkit
 
 								// Number of bytes per position-only skinned vertex (3 float position, 4 byte bone indices, 4 byte bone weights) = 20 bytes
 								static const uint32_t NUMBER_OF_BYTES_PER_VERTEX = 20;
-								uint8_t* temporaryVertexBufferData = new uint8_t[NUMBER_OF_BYTES_PER_VERTEX * numberOfVertices];
+								temporaryVertexBufferData = new uint8_t[NUMBER_OF_BYTES_PER_VERTEX * numberOfVertices];
 								{
 									uint8_t* RESTRICT currentTemporaryVertexBufferData = temporaryVertexBufferData;
 									const uint8_t* RESTRICT currentVertexBufferData = vertexBufferData;
@@ -1051,38 +1346,21 @@ namespace RendererToolkit
 										currentVertexBufferData += sizeof(uint8_t) * 8;
 									}
 								}
-								for (uint32_t subMeshIndex = 0; subMeshIndex < numberOfSubMeshes; ++subMeshIndex)
-								{
-									for (uint32_t lodIndex = 0; lodIndex < numberOfLods; ++lodIndex)
-									{
-										const uint32_t lodIndexOffset = lodIndexOffsets[lodIndex][subMeshIndex];
-										meshopt_generateShadowIndexBuffer(&positionOnlyIndexBufferData[lodIndexOffset], &indexBufferData[lodIndexOffset], lodNumberOfIndices[lodIndex][subMeshIndex], temporaryVertexBufferData, numberOfVertices, NUMBER_OF_BYTES_PER_VERTEX, NUMBER_OF_BYTES_PER_VERTEX);
-									}
-								}
-								delete [] temporaryVertexBufferData;
-							}
-							else
-							{
-								// Number of bytes per position-only vertex (3 float position) = 12 bytes
-								for (uint32_t subMeshIndex = 0; subMeshIndex < numberOfSubMeshes; ++subMeshIndex)
-								{
-									for (uint32_t lodIndex = 0; lodIndex < numberOfLods; ++lodIndex)
-									{
-										const uint32_t lodIndexOffset = lodIndexOffsets[lodIndex][subMeshIndex];
-										meshopt_generateShadowIndexBuffer(&positionOnlyIndexBufferData[lodIndexOffset], &indexBufferData[lodIndexOffset], lodNumberOfIndices[lodIndex][subMeshIndex], vertexBufferData, numberOfVertices, 12, numberOfBytesPerVertex);
-									}
-								}
+								positionVertexBufferData = temporaryVertexBufferData;
+								numberOfBytesPerPositionVertex = positionVertexStride = NUMBER_OF_BYTES_PER_VERTEX;
 							}
 
-							// While you can't optimize the vertex data after shadow index buffer was constructed, you can and should optimize the shadow index buffer for vertex cache this is valuable even if the original indices array was optimized for vertex cache
-							for (uint32_t subMeshIndex = 0; subMeshIndex < numberOfSubMeshes; ++subMeshIndex)
+							// Generate the position-only index buffer ranges of all sub-meshes and all LODs in parallel, the ranges don't overlap
+							// -> While you can't optimize the vertex data after shadow index buffer was constructed, you can and should optimize the shadow index buffer for vertex cache this is valuable even if the original indices array was optimized for vertex cache
+							ParallelHelper::forEachInParallel(numberOfSubMeshes * numberOfLods, [&](uint32_t item)
 							{
-								for (uint32_t lodIndex = 0; lodIndex < numberOfLods; ++lodIndex)
-								{
-									const uint32_t lodIndexOffset = lodIndexOffsets[lodIndex][subMeshIndex];
-									meshopt_optimizeVertexCache(&positionOnlyIndexBufferData[lodIndexOffset], &positionOnlyIndexBufferData[lodIndexOffset], lodNumberOfIndices[lodIndex][subMeshIndex], numberOfVertices);
-								}
-							}
+								const uint32_t lodIndex = item % numberOfLods;
+								const uint32_t subMeshIndex = item / numberOfLods;
+								const uint32_t lodIndexOffset = lodIndexOffsets[lodIndex][subMeshIndex];
+								meshopt_generateShadowIndexBuffer(&positionOnlyIndexBufferData[lodIndexOffset], &indexBufferData[lodIndexOffset], lodNumberOfIndices[lodIndex][subMeshIndex], positionVertexBufferData, numberOfVertices, numberOfBytesPerPositionVertex, positionVertexStride);
+								meshopt_optimizeVertexCache(&positionOnlyIndexBufferData[lodIndexOffset], &positionOnlyIndexBufferData[lodIndexOffset], lodNumberOfIndices[lodIndex][subMeshIndex], numberOfVertices);
+							});
+							delete [] temporaryVertexBufferData;
 						}
 
 						/*
@@ -1103,10 +1381,62 @@ namespace RendererToolkit
 						}
 						*/
 					}
+					vertexFetchMilliseconds = stageStopwatch.getMilliseconds();
+				}
 
-					// "meshoptimizer" vertex/index buffer compression isn't used by intent. As of 22 December 2019 there's no 16-bit index support when using index compression and
-					// a quick'n'dirty test showed that when using vertex compression the resulting file got actually bigger instead of smaller (we're using LZ4 compressed files).
+				// Quantize the vertex data, "meshoptimizer" is working with 32 bit positions so this has to be done after all index buffer related steps
+				// -> The QTangent is already 16 bit and the bone indices and bone weights are already 8 bit
+				// -> Per-asset maximum quantization errors can be set, by default any quantization error is accepted
+				stageStopwatch.start();
+				std::vector<uint8_t> quantizedVertexBufferData;
+				{
+					float maximumPositionQuantizationError = std::numeric_limits<float>::max();
+					float maximumTextureCoordinateQuantizationError = std::numeric_limits<float>::max();
+					JsonHelper::optionalFloatProperty(rapidJsonValueMeshAssetCompiler, "MaximumPositionQuantizationError", maximumPositionQuantizationError);
+					JsonHelper::optionalFloatProperty(rapidJsonValueMeshAssetCompiler, "MaximumTextureCoordinateQuantizationError", maximumTextureCoordinateQuantizationError);
+					float positionQuantizationError = 0.0f;
+					float textureCoordinateQuantizationError = 0.0f;
+					::detail::quantizeVertexBufferData(numberOfBones > 0, vertexBufferData, numberOfVertices, minimumBoundingBoxPosition, maximumBoundingBoxPosition, quantizedVertexBufferData, positionQuantizationError, textureCoordinateQuantizationError);
+					if (positionQuantizationError > maximumPositionQuantizationError)
+					{
+						throw std::runtime_error("The position quantization error of " + std::to_string(positionQuantizationError) + " exceeds the maximum position quantization error of " + std::to_string(maximumPositionQuantizationError));
+					}
+					if (textureCoordinateQuantizationError > maximumTextureCoordinateQuantizationError)
+					{
+						throw std::runtime_error("The texture coordinate quantization error of " + std::to_string(textureCoordinateQuantizationError) + " exceeds the maximum texture coordinate quantization error of " + std::to_string(maximumTextureCoordinateQuantizationError));
+					}
+				}
+				const uint8_t numberOfBytesPerQuantizedVertex = (numberOfBones > 0) ? ::detail::NUMBER_OF_BYTES_PER_QUANTIZED_SKINNED_VERTEX : ::detail::NUMBER_OF_BYTES_PER_QUANTIZED_VERTEX;
+
+				// Encode the vertex and index buffers using the "meshoptimizer" vertex and index buffer codecs, decoded by the mesh resource loader on a worker thread
+				// -> Enabled by default, can be disabled per asset via "EncodeVertexAndIndexBuffers"
+				// -> The encoded indices can be decoded into 16-bit or 32-bit indices, so the index buffer format doesn't matter
+				// -> The codecs exploit the vertex cache and vertex fetch optimized order established above, so this must happen after all index and vertex buffer related steps
+				std::vector<uint8_t> encodedVertexBufferData;
+				std::vector<uint8_t> encodedIndexBufferData;
+				std::vector<uint8_t> encodedPositionOnlyIndexBufferData;
+				{
+					bool encodeVertexAndIndexBuffers = true;
+					JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "EncodeVertexAndIndexBuffers", encodeVertexAndIndexBuffers);
+					if (encodeVertexAndIndexBuffers)
+					{
+						// Vertex buffer
+						encodedVertexBufferData.resize(meshopt_encodeVertexBufferBound(numberOfVertices, numberOfBytesPerQuantizedVertex));
+						encodedVertexBufferData.resize(meshopt_encodeVertexBuffer(encodedVertexBufferData.data(), encodedVertexBufferData.size(), quantizedVertexBufferData.data(), numberOfVertices, numberOfBytesPerQuantizedVertex));
+
+						// Index buffer and optional position-only index buffer, index codec version 1 offers better compression and is supported by every decoder version
+						meshopt_encodeIndexVersion(1);
+						if (numberOfIndices > 0)
+						{
+							::detail::encodeIndexBufferData(indexBufferData, numberOfVertices, encodedIndexBufferData);
+						}
+						if (!positionOnlyIndexBufferData.empty())
+						{
+							::detail::encodeIndexBufferData(positionOnlyIndexBufferData, numberOfVertices, encodedPositionOnlyIndexBufferData);
+						}
+					}
 				}
+				encodeMilliseconds = stageStopwatch.getMilliseconds();
 
 				{ // Write down the mesh header
 					Renderer::v1Mesh::MeshHeader meshHeader;
@@ -1119,17 +1449,24 @@ namespace RendererToolkit
 					meshHeader.boundingSphereRadius		  = Renderer::Math::calculateInnerBoundingSphereRadius(minimumBoundingBoxPosition, maximumBoundingBoxPosition);
 
 					// Vertex and index data
-					meshHeader.numberOfBytesPerVertex	= numberOfBytesPerVertex;
-					meshHeader.numberOfVertices			= numberOfVertices;
-					meshHeader.indexBufferFormat		= static_cast<uint8_t>(indexBufferFormat);
-					meshHeader.numberOfIndices			= numberOfIndices;
-					meshHeader.numberOfVertexAttributes = static_cast<uint8_t>(vertexAttributes.numberOfAttributes);
-					meshHeader.hasPositionOnlyIndices	= !positionOnlyIndexBufferData.empty();
+					meshHeader.numberOfBytesPerVertex						= numberOfBytesPerQuantizedVertex;
+					meshHeader.numberOfVertices								= numberOfVertices;
+					meshHeader.indexBufferFormat							= static_cast<uint8_t>(indexBufferFormat);
+					meshHeader.numberOfIndices								= numberOfIndices;
+					meshHeader.numberOfVertexAttributes						= static_cast<uint8_t>(vertexAttributes.numberOfAttributes);
+					meshHeader.hasPositionOnlyIndices						= !positionOnlyIndexBufferData.empty();
+					meshHeader.hasQuantizedPositions						= (0 == numberOfBones);
+					meshHeader.numberOfEncodedVertexBufferBytes				= static_cast<uint32_t>(encodedVertexBufferData.size());
+					meshHeader.numberOfEncodedIndexBufferBytes				= static_cast<uint32_t>(encodedIndexBufferData.size());
+					meshHeader.numberOfEncodedPositionOnlyIndexBufferBytes	= static_cast<uint32_t>(encodedPositionOnlyIndexBufferData.size());
 
 					// Sub-meshes and LODs
 					meshHeader.numberOfSubMeshes = static_cast<uint16_t>(subMeshes.size());
 					meshHeader.numberOfLods = static_cast<uint8_t>(numberOfLods);
 
+					// Optional meshlets
+					meshHeader.numberOfMeshlets = static_cast<uint32_t>(meshlets.size());
+
 					// Optional skeleton
 					meshHeader.numberOfBones = skeleton.numberOfBones;
 
@@ -1138,21 +1475,36 @@ namespace RendererToolkit
 				}
 
 				// Write down the vertex and index buffer (directly containing also the index data of all LODs)
-				// -> Not using "meshopt_encodeVertexBuffer()" from "meshoptimizer" since tests on 2 August 2021 showed that with the additional LZ4 compression the compression rate got worse instead of better
-				memoryFile.write(vertexBufferData, numberOfBytesPerVertex * numberOfVertices);
-				if (numberOfIndices > 0)
+				if (encodedVertexBufferData.empty())
+				{
+					memoryFile.write(quantizedVertexBufferData.data(), quantizedVertexBufferData.size());
+				}
+				else
+				{
+					memoryFile.write(encodedVertexBufferData.data(), encodedVertexBufferData.size());
+				}
+				if (!encodedIndexBufferData.empty())
+				{
+					memoryFile.write(encodedIndexBufferData.data(), encodedIndexBufferData.size());
+				}
+				else if (numberOfIndices > 0)
 				{
 					::detail::writeIndexBufferData(indexBufferFormat, indexBufferData, temporaryShortIndexBufferData, memoryFile);
 				}
 
 				// Write down the optional position-only index buffer (directly containing also the index data of all LODs)
-				if (!positionOnlyIndexBufferData.empty())
+				if (!encodedPositionOnlyIndexBufferData.empty())
+				{
+					memoryFile.write(encodedPositionOnlyIndexBufferData.data(), encodedPositionOnlyIndexBufferData.size());
+				}
+				else if (!positionOnlyIndexBufferData.empty())
 				{
 					::detail::writeIndexBufferData(indexBufferFormat, positionOnlyIndexBufferData, temporaryShortIndexBufferData, memoryFile);
 				}
 
 				// Destroy local vertex and input buffer data
 				delete [] vertexBufferData;
+				quantizedVertexBufferData.clear();
 				indexBufferData.clear();
 
 				// Write down the vertex array attributes
@@ -1161,6 +1513,12 @@ namespace RendererToolkit
 				// Write down the sub-meshes
 				memoryFile.write(subMeshes.data(), sizeof(Renderer::v1Mesh::SubMesh) * subMeshes.size());
 
+				// Write down the optional meshlets
+				if (!meshlets.empty())
+				{
+					memoryFile.write(meshlets.data(), sizeof(Renderer::v1Mesh::Meshlet) * meshlets.size());
+				}
+
 				// Write down the optional skeleton
 				if (skeleton.numberOfBones > 0)
 				{
@@ -1182,12 +1540,21 @@ namespace RendererToolkit
 				throw std::runtime_error("Assimp failed to load in the given mesh \"" + virtualInputFilename + "\": " + assimpLogStream.getLastErrorMessage());
 			}
 
-			// Write LZ4 compressed output
-			if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::v1Mesh::FORMAT_TYPE, Renderer::v1Mesh::FORMAT_VERSION, input.context.getFileManager(), virtualOutputAssetFilename.c_str()))
+			// Write optionally LZ4 compressed output
+			// -> LZ4 compression is applied on top of the "meshoptimizer" codecs, the encoded data is byte oriented so it usually still compresses well
+			// -> Can be disabled per asset via "Lz4Compression", in case LZ4 doesn't make the data smaller the data is stored uncompressed anyway
+			stageStopwatch.start();
+			bool lz4Compression = true;
+			JsonHelper::optionalBooleanProperty(rapidJsonValueMeshAssetCompiler, "Lz4Compression", lz4Compression);
+			if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::v1Mesh::FORMAT_TYPE, Renderer::v1Mesh::FORMAT_VERSION, input.context.getFileManager(), virtualOutputAssetFilename.c_str(), lz4Compression))
 			{
 				throw std::runtime_error("Failed to write LZ4 compressed output file \"" + virtualOutputAssetFilename + '\"');
 			}
 
+			// Report the per-stage timings
+			RHI_LOG(input.context, INFORMATION, "Compiled mesh \"%s\" in %.1f ms (import %.1f ms, tangent space and vertex data %.1f ms, LODs %.1f ms, meshlets %.1f ms, vertex fetch and position-only indices %.1f ms, quantization and encoding %.1f ms, writing %.1f ms)",
+				virtualInputFilename.c_str(), totalStopwatch.getMilliseconds(), importMilliseconds, fillMilliseconds, lodMilliseconds, meshletMilliseconds, vertexFetchMilliseconds, encodeMilliseconds, stageStopwatch.getMilliseconds())
+
 			// Store new cache entries or update existing ones
 			input.cacheManager.storeOrUpdateCacheEntries(cacheEntries);
 		}
@@ -32,6 +32,7 @@
 #include <Renderer/Public/Asset/AssetPackage.h>
 #include <Renderer/Public/Core/Math/Math.h>
 #include <Renderer/Public/Core/File/MemoryFile.h>
+#include <Renderer/Public/Core/File/IFileManager.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
 #include <Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h>
 #include <Renderer/Public/Resource/Scene/Item/Debug/DebugDrawSceneItem.h>
@@ -60,6 +61,16 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5054)	// warning C5054: operator '|': deprecated between enumerations of different types
 	#include <rapidjson/document.h>
+	#include <cmath>
+PRAGMA_WARNING_POP
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)						// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4505)						// warning C4505: 'stbi__err': unreferenced local function has been removed
+	PRAGMA_WARNING_DISABLE_CLANG("-Wunused-function")		// warning: unused function 'stbi__err' [-Wunused-function]
+	PRAGMA_WARNING_DISABLE_GCC("-Wunused-function")			// warning: 'int stbi__err(const char*)' defined but not used [-Wunused-function]
+	#include <../src/crn_stb_image.cpp>	// Only the declarations, the implementation is part of "crunchUnityBuild2.cpp"
 PRAGMA_WARNING_POP
 
 
@@ -192,6 +203,78 @@ namespace
 			}
 		}
 
+		template <typename TYPE>
+		void loadGrassMap(const RendererToolkit::IAssetCompiler::Input& input, const std::string& virtualInputFilename, uint32_t& width, uint32_t& height, std::vector<TYPE>& map)
+		{
+			// Load file content into memory
+			std::vector<uint8_t> fileBuffer;
+			{
+				Renderer::IFileManager& fileManager = input.context.getFileManager();
+				Renderer::IFile* file = fileManager.openFile(Renderer::IFileManager::FileMode::READ, virtualInputFilename.c_str());
+				if (nullptr == file)
+				{
+					throw std::runtime_error("Failed to open grass map \"" + virtualInputFilename + '\"');
+				}
+				const std::size_t numberOfFileBytes = file->getNumberOfBytes();
+				fileBuffer.resize(numberOfFileBytes);
+				file->read(fileBuffer.data(), numberOfFileBytes);
+				fileManager.closeFile(*file);
+			}
+
+			// Decode the single channel image, same orientation as the terrain height map
+			// -> Don't use "stbi_set_flip_vertically_on_load()", it's global state shared with other threads, the rows are flipped vertically while copying them instead
+			int x = 0, y = 0, n = 0;
+			void* data = nullptr;
+			if constexpr (sizeof(TYPE) == sizeof(stbi_us))
+			{
+				data = stbi_load_16_from_memory(fileBuffer.data(), static_cast<int>(fileBuffer.size()), &x, &y, &n, 1);
+			}
+			else
+			{
+				data = stbi_load_from_memory(fileBuffer.data(), static_cast<int>(fileBuffer.size()), &x, &y, &n, 1);
+			}
+			if (nullptr == data)
+			{
+				throw std::runtime_error("Failed to load grass map \"" + virtualInputFilename + '\"');
+			}
+			width = static_cast<uint32_t>(x);
+			height = static_cast<uint32_t>(y);
+			map.resize(static_cast<size_t>(width) * height);
+			for (uint32_t row = 0; row < height; ++row)
+			{
+				const TYPE* sourceRow = static_cast<const TYPE*>(data) + static_cast<size_t>(height - 1 - row) * width;
+				std::copy(sourceRow, sourceRow + width, map.data() + static_cast<size_t>(row) * width);
+			}
+			stbi_image_free(data);
+		}
+
+		void getGrassMapVirtualInputFilenames(const RendererToolkit::IAssetCompiler::Input& input, const rapidjson::Value& rapidJsonValueNodes, std::vector<std::string>& virtualInputFilenames)
+		{
+			// The grass density and height maps are baked into the scene, so they're scene input files as well
+			for (rapidjson::SizeType nodeIndex = 0; nodeIndex < rapidJsonValueNodes.Size(); ++nodeIndex)
+			{
+				const rapidjson::Value& rapidJsonValueNode = rapidJsonValueNodes[nodeIndex];
+				if (rapidJsonValueNode.HasMember("Items"))
+				{
+					const rapidjson::Value& rapidJsonValueItems = rapidJsonValueNode["Items"];
+					for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIteratorItems = rapidJsonValueItems.MemberBegin(); rapidJsonMemberIteratorItems != rapidJsonValueItems.MemberEnd(); ++rapidJsonMemberIteratorItems)
+					{
+						if (Renderer::GrassSceneItem::TYPE_ID == Renderer::StringId(rapidJsonMemberIteratorItems->name.GetString()))
+						{
+							const rapidjson::Value& rapidJsonValueItem = rapidJsonMemberIteratorItems->value;
+							for (const char* propertyName : { "DensityMap", "HeightMap" })
+							{
+								if (rapidJsonValueItem.HasMember(propertyName))
+								{
+									virtualInputFilenames.emplace_back(input.virtualAssetInputDirectory + '/' + rapidJsonValueItem[propertyName].GetString());
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -218,7 +301,14 @@ namespace RendererToolkit
 	bool SceneAssetCompiler::checkIfChanged(const Input& input, const Configuration& configuration) const
 	{
 		const std::string virtualInputFilename = input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset);
-		return input.cacheManager.checkIfFileIsModified(configuration.rhiTarget, input.virtualAssetFilename, {virtualInputFilename}, getVirtualOutputAssetFilename(input, configuration), Renderer::v1Scene::FORMAT_VERSION);
+		std::vector<std::string> virtualInputFilenames;
+		virtualInputFilenames.emplace_back(virtualInputFilename);
+		{ // Baked grass maps
+			rapidjson::Document rapidJsonDocument;
+			JsonHelper::loadDocumentByFilename(input.context.getFileManager(), virtualInputFilename, "SceneAsset", "1", rapidJsonDocument);
+			::detail::getGrassMapVirtualInputFilenames(input, rapidJsonDocument["SceneAsset"]["Nodes"], virtualInputFilenames);
+		}
+		return input.cacheManager.checkIfFileIsModified(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilenames, getVirtualOutputAssetFilename(input, configuration), Renderer::v1Scene::FORMAT_VERSION);
 	}
 
 	void SceneAssetCompiler::compile(const Input& input, const Configuration& configuration) const
@@ -227,17 +317,20 @@ namespace RendererToolkit
 		const std::string virtualInputFilename = input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset);
 		const std::string virtualOutputAssetFilename = getVirtualOutputAssetFilename(input, configuration);
 
+		// Parse JSON
+		rapidjson::Document rapidJsonDocument;
+		JsonHelper::loadDocumentByFilename(input.context.getFileManager(), virtualInputFilename, "SceneAsset", "1", rapidJsonDocument);
+
 		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
 		CacheManager::CacheEntries cacheEntries;
-		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilename, virtualOutputAssetFilename, Renderer::v1Scene::FORMAT_VERSION, cacheEntries))
+		std::vector<std::string> virtualInputFilenames;
+		virtualInputFilenames.emplace_back(virtualInputFilename);
+		::detail::getGrassMapVirtualInputFilenames(input, rapidJsonDocument["SceneAsset"]["Nodes"], virtualInputFilenames);
+		if (input.cacheManager.needsToBeCompiled(configuration.rhiTarget, input.virtualAssetFilename, virtualInputFilenames, virtualOutputAssetFilename, Renderer::v1Scene::FORMAT_VERSION, cacheEntries))
 		{
 			Renderer::MemoryFile memoryFile(0, 4096);
 
 			{ // Scene
-				// Parse JSON
-				rapidjson::Document rapidJsonDocument;
-				JsonHelper::loadDocumentByFilename(input.context.getFileManager(), virtualInputFilename, "SceneAsset", "1", rapidJsonDocument);
-
 				{ // Write down the scene resource header
 					Renderer::v1Scene::SceneHeader sceneHeader;
 					sceneHeader.unused = 42;	// TODO(co) Currently the scene header is unused
@@ -471,9 +564,7 @@ namespace RendererToolkit
 
 									case Renderer::SkySceneItem::TYPE_ID:
 									case Renderer::VolumeSceneItem::TYPE_ID:
-									case Renderer::GrassSceneItem::TYPE_ID:
 									case Renderer::TerrainSceneItem::TYPE_ID:
-									case Renderer::ParticlesSceneItem::TYPE_ID:
 									{
 										// Get material properties
 										Renderer::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
@@ -487,6 +578,157 @@ namespace RendererToolkit
 										break;
 									}
 
+									case Renderer::GrassSceneItem::TYPE_ID:
+									{
+										// Get material properties
+										Renderer::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+										::detail::fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
+
+										// Read properties
+										Renderer::v1Scene::GrassItem grassItem;
+										float size[2] = { grassItem.minimumSize, grassItem.maximumSize };
+										JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "Extents", grassItem.extents, 2);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "ChunkSize", grassItem.chunkSize);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "Density", grassItem.density);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "Size", size, 2);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "Color", grassItem.color, 3);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "ColorVariation", grassItem.colorVariation);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "LodDistance", grassItem.lodDistance);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "MaximumDistance", grassItem.maximumDistance);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "MinimumDensityFactor", grassItem.minimumDensityFactor);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "FadeDistance", grassItem.fadeDistance);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "SingleQuadDistance", grassItem.singleQuadDistance);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "HeightRange", grassItem.heightRange, 2);
+										JsonHelper::optionalIntegerProperty(rapidJsonValueItem, "RandomSeed", grassItem.randomSeed);
+										grassItem.minimumSize = size[0];
+										grassItem.maximumSize = size[1];
+
+										// Sanity checks
+										if (grassItem.extents[0] <= 0.0f || grassItem.extents[1] <= 0.0f)
+										{
+											throw std::runtime_error("The grass extents must be greater as zero");
+										}
+										if (grassItem.chunkSize <= 0.0f)
+										{
+											throw std::runtime_error("The grass chunk size must be greater as zero");
+										}
+										if (std::ceil(grassItem.extents[0] * 2.0f / grassItem.chunkSize) * std::ceil(grassItem.extents[1] * 2.0f / grassItem.chunkSize) > 65536.0f)
+										{
+											// Each grass chunk is a renderable
+											throw std::runtime_error("There are more than 65536 grass chunks, increase the grass chunk size");
+										}
+										if (grassItem.density < 0.0f)
+										{
+											throw std::runtime_error("The grass density must be >= 0");
+										}
+										if (grassItem.minimumSize <= 0.0f || grassItem.minimumSize > grassItem.maximumSize)
+										{
+											throw std::runtime_error("The minimum grass size must be greater as zero and not greater as the maximum grass size");
+										}
+										if (grassItem.colorVariation < 0.0f || grassItem.colorVariation > 1.0f)
+										{
+											throw std::runtime_error("The grass color variation must be within [0, 1]");
+										}
+										if (grassItem.lodDistance < 0.0f || grassItem.lodDistance > grassItem.maximumDistance)
+										{
+											throw std::runtime_error("The grass LOD distance must be >= 0 and not greater as the maximum grass distance");
+										}
+										if (grassItem.minimumDensityFactor < 0.0f || grassItem.minimumDensityFactor > 1.0f)
+										{
+											throw std::runtime_error("The minimum grass density factor must be within [0, 1]");
+										}
+										if (grassItem.fadeDistance < 0.0f)
+										{
+											throw std::runtime_error("The grass fade distance must be >= 0");
+										}
+
+										// Bake the optional density and height map into the scene, the grass is generated during runtime
+										std::vector<uint8_t> densityMap;
+										std::vector<uint16_t> heightMap;
+										if (rapidJsonValueItem.HasMember("DensityMap"))
+										{
+											::detail::loadGrassMap(input, input.virtualAssetInputDirectory + '/' + rapidJsonValueItem["DensityMap"].GetString(), grassItem.densityMapWidth, grassItem.densityMapHeight, densityMap);
+										}
+										if (rapidJsonValueItem.HasMember("HeightMap"))
+										{
+											::detail::loadGrassMap(input, input.virtualAssetInputDirectory + '/' + rapidJsonValueItem["HeightMap"].GetString(), grassItem.heightMapWidth, grassItem.heightMapHeight, heightMap);
+										}
+
+										// Write down the scene item header
+										::detail::writeItemHeader(memoryFile, typeId, static_cast<uint32_t>(sizeof(Renderer::v1Scene::GrassItem) + densityMap.size() + sizeof(uint16_t) * heightMap.size() + sizeof(Renderer::v1Scene::MaterialData) + sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size()));
+
+										// Write down
+										memoryFile.write(&grassItem, sizeof(Renderer::v1Scene::GrassItem));
+										if (!densityMap.empty())
+										{
+											memoryFile.write(densityMap.data(), densityMap.size());
+										}
+										if (!heightMap.empty())
+										{
+											memoryFile.write(heightMap.data(), sizeof(uint16_t) * heightMap.size());
+										}
+										detail::writeMaterialData(memoryFile, input, rapidJsonValueItem, sortedMaterialPropertyVector);
+										break;
+									}
+
+									case Renderer::ParticlesSceneItem::TYPE_ID:
+									{
+										// Get material properties
+										Renderer::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+										::detail::fillSortedMaterialPropertyVector(input, rapidJsonValueItem, sortedMaterialPropertyVector);
+
+										// Write down the scene item header
+										::detail::writeItemHeader(memoryFile, typeId, static_cast<uint32_t>(sizeof(Renderer::v1Scene::ParticlesItem) + sizeof(Renderer::v1Scene::MaterialData) + sizeof(Renderer::MaterialProperty) * sortedMaterialPropertyVector.size()));
+
+										// Read properties
+										Renderer::v1Scene::ParticlesItem particlesItem;
+										float lifetime[2] = { particlesItem.minimumLifetime, particlesItem.maximumLifetime };
+										float size[2] = { particlesItem.startSize, particlesItem.endSize };
+										JsonHelper::optionalIntegerProperty(rapidJsonValueItem, "MaximumNumberOfParticles", particlesItem.maximumNumberOfParticles);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "EmissionRate", particlesItem.emissionRate);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "Lifetime", lifetime, 2);
+										JsonHelper::optionalUnitNProperty(rapidJsonValueItem, "EmitterExtents", particlesItem.emitterExtents, 3);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "MinimumVelocity", particlesItem.minimumVelocity, 3);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "MaximumVelocity", particlesItem.maximumVelocity, 3);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "Gravity", particlesItem.gravity, 3);
+										JsonHelper::optionalFloatProperty(rapidJsonValueItem, "Drag", particlesItem.drag);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "Size", size, 2);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "StartColor", particlesItem.startColor, 4);
+										JsonHelper::optionalFloatNProperty(rapidJsonValueItem, "EndColor", particlesItem.endColor, 4);
+										JsonHelper::optionalBooleanProperty(rapidJsonValueItem, "SortParticles", particlesItem.sortParticles);
+										particlesItem.minimumLifetime = lifetime[0];
+										particlesItem.maximumLifetime = lifetime[1];
+										particlesItem.startSize = size[0];
+										particlesItem.endSize = size[1];
+
+										// Sanity checks
+										if (0 == particlesItem.maximumNumberOfParticles || particlesItem.maximumNumberOfParticles > Renderer::ParticlesSceneItem::MAXIMUM_NUMBER_OF_PARTICLES)
+										{
+											throw std::runtime_error("The maximum number of particles must be within [1, " + std::to_string(Renderer::ParticlesSceneItem::MAXIMUM_NUMBER_OF_PARTICLES) + ']');
+										}
+										if (particlesItem.emissionRate < 0.0f)
+										{
+											throw std::runtime_error("The particles emission rate must be >= 0");
+										}
+										if (particlesItem.minimumLifetime <= 0.0f || particlesItem.minimumLifetime > particlesItem.maximumLifetime)
+										{
+											throw std::runtime_error("The minimum particle lifetime must be greater as zero and not greater as the maximum particle lifetime");
+										}
+										if (particlesItem.drag < 0.0f)
+										{
+											throw std::runtime_error("The particles drag must be >= 0");
+										}
+										if (particlesItem.startSize < 0.0f || particlesItem.endSize < 0.0f)
+										{
+											throw std::runtime_error("The particle sizes must be >= 0");
+										}
+
+										// Write down
+										memoryFile.write(&particlesItem, sizeof(Renderer::v1Scene::ParticlesItem));
+										detail::writeMaterialData(memoryFile, input, rapidJsonValueItem, sortedMaterialPropertyVector);
+										break;
+									}
+
 									default:
 									{
 										// Error!
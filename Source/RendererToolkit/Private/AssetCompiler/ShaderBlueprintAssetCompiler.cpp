@@ -150,6 +150,27 @@ namespace RendererToolkit
 		return (input.virtualAssetOutputDirectory + '/' + std_filesystem::path(input.virtualAssetFilename).stem().generic_string()).append(getOptionalUniqueAssetFilenameExtension());
 	}
 
+	void ShaderBlueprintAssetCompiler::getVirtualDependencyFilenames(const Input& input, const Configuration& configuration, std::vector<std::string>& virtualDependencyFilenames) const
+	{
+		// Gather the "@includepiece(<asset ID>)" shader pieces
+		std::string sourceCode;
+		StringHelper::readStringWithStrippedCommentsByFilename(input.context.getFileManager(), input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset), sourceCode);
+		size_t includePiecePosition = sourceCode.find("@includepiece");
+		while (std::string::npos != includePiecePosition)
+		{
+			// ( asset ID )
+			const size_t openingPosition = sourceCode.find("(", includePiecePosition);
+			const size_t closingPosition = sourceCode.find(")", openingPosition);
+			if (std::string::npos == openingPosition || std::string::npos == closingPosition)
+			{
+				throw std::runtime_error("Malformed \"@includepiece\" instruction inside shader blueprint");
+			}
+			const std::string assetIdAsString = sourceCode.substr(openingPosition + 1, closingPosition - openingPosition - 1);
+			virtualDependencyFilenames.emplace_back(input.sourceAssetIdToVirtualAssetFilename(StringHelper::getSourceAssetIdByString(assetIdAsString.c_str(), input)));
+			includePiecePosition = sourceCode.find("@includepiece", closingPosition);
+		}
+	}
+
 	bool ShaderBlueprintAssetCompiler::checkIfChanged(const Input& input, const Configuration& configuration) const
 	{
 		const std::string virtualInputFilename = input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset);
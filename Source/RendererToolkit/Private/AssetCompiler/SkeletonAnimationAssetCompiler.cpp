@@ -73,6 +73,8 @@ PRAGMA_WARNING_PUSH
 	#include <rapidjson/document.h>
 PRAGMA_WARNING_POP
 
+#include <unordered_map>
+
 
 //[-------------------------------------------------------]
 //[ Macros                                                ]
@@ -141,6 +143,51 @@ namespace
 	};
 
 
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] bool hasDefaultScale(const aiNodeAnim& assimpNodeAnim)
+		{
+			static const aiVector3D ONE_VECTOR(1.0f, 1.0f, 1.0f);
+			for (unsigned int i = 0; i < assimpNodeAnim.mNumScalingKeys; ++i)
+			{
+				if (!assimpNodeAnim.mScalingKeys[i].mValue.Equal(ONE_VECTOR, 1e-5f))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		void getParentBoneIndices(const aiScene& assimpScene, const aiAnimation& assimpAnimation, std::vector<uint32_t>& parentBoneIndices)
+		{
+			// The parent bone of a bone is the nearest ancestor node which is animated as well
+			const uint32_t numberOfBones = assimpAnimation.mNumChannels;
+			std::unordered_map<std::string, uint32_t> boneIndexByName;
+			for (uint32_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
+			{
+				boneIndexByName.emplace(assimpAnimation.mChannels[boneIndex]->mNodeName.C_Str(), boneIndex);
+			}
+			parentBoneIndices.resize(numberOfBones, acl::k_invalid_track_index);
+			for (uint32_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
+			{
+				const aiNode* assimpNode = assimpScene.mRootNode->FindNode(assimpAnimation.mChannels[boneIndex]->mNodeName);
+				if (nullptr != assimpNode)
+				{
+					for (const aiNode* assimpParentNode = assimpNode->mParent; nullptr != assimpParentNode; assimpParentNode = assimpParentNode->mParent)
+					{
+						std::unordered_map<std::string, uint32_t>::const_iterator iterator = boneIndexByName.find(assimpParentNode->mName.C_Str());
+						if (boneIndexByName.cend() != iterator)
+						{
+							parentBoneIndices[boneIndex] = iterator->second;
+							break;
+						}
+					}
+				}
+			}
+		}
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -196,6 +243,28 @@ namespace RendererToolkit
 				bool ignoreBoneScale = false;
 				JsonHelper::optionalBooleanProperty(rapidJsonValueSkeletonAnimationAssetCompiler, "IgnoreBoneScale", ignoreBoneScale);
 
+				// Read ACL compression configuration, distances are in centimeter
+				// -> "Precision": Precision ACL tries to attain on the shell around every bone
+				// -> "ShellDistance": Distance of the rigidly deformed shell around every bone the error is measured on
+				// -> "BonePrecision": Optional object with precision overrides by bone name, e.g. a tighter precision for hand and face bones
+				float precision = 0.01f;
+				float shellDistance = 3.0f;
+				JsonHelper::optionalFloatProperty(rapidJsonValueSkeletonAnimationAssetCompiler, "Precision", precision);
+				JsonHelper::optionalFloatProperty(rapidJsonValueSkeletonAnimationAssetCompiler, "ShellDistance", shellDistance);
+				if (precision <= 0.0f)
+				{
+					throw std::runtime_error("The skeleton animation asset compiler \"Precision\" must be a positive number in centimeter");
+				}
+				if (shellDistance <= 0.0f)
+				{
+					throw std::runtime_error("The skeleton animation asset compiler \"ShellDistance\" must be a positive number in centimeter");
+				}
+				const rapidjson::Value* rapidJsonValueBonePrecision = rapidJsonValueSkeletonAnimationAssetCompiler.HasMember("BonePrecision") ? &rapidJsonValueSkeletonAnimationAssetCompiler["BonePrecision"] : nullptr;
+				if (nullptr != rapidJsonValueBonePrecision && !rapidJsonValueBonePrecision->IsObject())
+				{
+					throw std::runtime_error("The skeleton animation asset compiler \"BonePrecision\" must be an object with precision overrides by bone name");
+				}
+
 				// Get the Assimp animation instance to import
 				// -> In case there are multiple animations stored inside the imported skeleton animation we must
 				//    insist that the skeleton animation compiler gets supplied with the animation index to use
@@ -222,28 +291,6 @@ namespace RendererToolkit
 					throw std::runtime_error("The animation at index " + std::to_string(animationIndex) + " of input file \"" + virtualInputFilename + "\" has no channels");
 				}
 
-				// Determine whether or not bone scale is used, in case it's not ignored in general to start with
-				if (!ignoreBoneScale)
-				{
-					// Let's be ignorant until someone proofs us wrong
-					ignoreBoneScale = true;
-
-					// Try to proof that the guy above is wrong and bone scale is used
-					static const aiVector3D ONE_VECTOR(1.0f, 1.0f, 1.0f);
-					for (unsigned int channel = 0; channel < assimpAnimation->mNumChannels && ignoreBoneScale; ++channel)
-					{
-						const aiNodeAnim* assimpNodeAnim = assimpAnimation->mChannels[channel];
-						for (unsigned int i = 0; i < assimpNodeAnim->mNumScalingKeys; ++i)
-						{
-							if (!assimpNodeAnim->mScalingKeys[i].mValue.Equal(ONE_VECTOR, 1e-5f))
-							{
-								ignoreBoneScale = false;
-								break;
-							}
-						}
-					}
-				}
-
 				{ // Use ACL ( https://github.com/nfrechette/acl ) to compress the skeleton animation tracks
 					::detail::AclAllocator aclAllocator(context.getAllocator());
 					const uint32_t numberOfSamples = static_cast<uint32_t>(assimpAnimation->mDuration) + 1;
@@ -256,10 +303,14 @@ namespace RendererToolkit
 							const aiNodeAnim* assimpNodeAnim = assimpAnimation->mChannels[boneIndex];
 							RHI_ASSERT(context, 1 == assimpNodeAnim->mNumRotationKeys || numberOfSamples == assimpNodeAnim->mNumRotationKeys, "Number of animation rotation keys mismatch")
 							RHI_ASSERT(context, 1 == assimpNodeAnim->mNumPositionKeys || numberOfSamples == assimpNodeAnim->mNumPositionKeys, "Number of animation position keys mismatch")
-							RHI_ASSERT(context, ignoreBoneScale || 1 == assimpNodeAnim->mNumScalingKeys || numberOfSamples == assimpNodeAnim->mNumScalingKeys, "Number of animation scaling keys mismatch")
+							RHI_ASSERT(context, ignoreBoneScale || ::detail::hasDefaultScale(*assimpNodeAnim) || 1 == assimpNodeAnim->mNumScalingKeys || numberOfSamples == assimpNodeAnim->mNumScalingKeys, "Number of animation scaling keys mismatch")
 						}
 					#endif
 
+					// Gather the bone hierarchy, this way ACL measures the error in object space instead of having to be conservative for every bone
+					std::vector<uint32_t> parentBoneIndices;
+					::detail::getParentBoneIndices(*assimpScene, *assimpAnimation, parentBoneIndices);
+
 					// Create ACL raw animation tracks
 					// -> See ACL documentation https://github.com/nfrechette/acl/blob/develop/docs/creating_a_raw_track_list.md
 					std::vector<uint32_t> boneIds(numberOfBones);
@@ -278,14 +329,24 @@ namespace RendererToolkit
 						// Fill ACL raw animation tracks
 						for (uint16_t boneIndex = 0; boneIndex < numberOfBones; ++boneIndex)
 						{
+							const aiNodeAnim* assimpNodeAnim = assimpAnimation->mChannels[boneIndex];
+							float bonePrecision = precision;
+							if (nullptr != rapidJsonValueBonePrecision && rapidJsonValueBonePrecision->HasMember(assimpNodeAnim->mNodeName.C_Str()))
+							{
+								const rapidjson::Value& rapidJsonValueBone = (*rapidJsonValueBonePrecision)[assimpNodeAnim->mNodeName.C_Str()];
+								if (!rapidJsonValueBone.IsNumber() || rapidJsonValueBone.GetFloat() <= 0.0f)
+								{
+									throw std::runtime_error(std::string("The skeleton animation asset compiler \"BonePrecision\" of bone \"") + assimpNodeAnim->mNodeName.C_Str() + "\" must be a positive number in centimeter");
+								}
+								bonePrecision = rapidJsonValueBone.GetFloat();
+							}
 							acl::track_desc_transformf aclTrackDesc;
 							aclTrackDesc.output_index					= boneIndex;
-							// aclTrackDesc.parent_index				=	// TODO(co) Fill bone hierarchy
-							aclTrackDesc.precision						= CENTIMETER_TO_METER(0.01f);	// We're using one unit = one meter (not centimeter)
-							aclTrackDesc.shell_distance					= CENTIMETER_TO_METER(3.0f);	// We're using one unit = one meter (not centimeter)
-							aclTrackDesc.constant_translation_threshold = CENTIMETER_TO_METER(0.001f);	// We're using one unit = one meter (not centimeter)
+							aclTrackDesc.parent_index					= parentBoneIndices[boneIndex];
+							aclTrackDesc.precision						= CENTIMETER_TO_METER(bonePrecision);	// We're using one unit = one meter (not centimeter)
+							aclTrackDesc.shell_distance					= CENTIMETER_TO_METER(shellDistance);	// We're using one unit = one meter (not centimeter)
+							aclTrackDesc.constant_translation_threshold = CENTIMETER_TO_METER(0.001f);			// We're using one unit = one meter (not centimeter)
 							acl::track_qvvf aclTrackQvvf = acl::track_qvvf::make_reserve(aclTrackDesc, aclAllocator, numberOfSamples, static_cast<float>(assimpAnimation->mTicksPerSecond));
-							const aiNodeAnim* assimpNodeAnim = assimpAnimation->mChannels[boneIndex];
 							boneIds[boneIndex] = Renderer::StringId::calculateFNV(assimpNodeAnim->mNodeName.C_Str());
 
 							// Rotation
@@ -340,9 +401,9 @@ namespace RendererToolkit
 							}
 
 							// Scale
-							if (ignoreBoneScale)
+							if (ignoreBoneScale || ::detail::hasDefaultScale(*assimpNodeAnim))
 							{
-								// TODO(co) Is it possible to tell ACL to ignore the scale?
+								// Exact default scale: ACL strips default scale tracks and doesn't store scale at all if no bone uses it
 								const rtm::vector4f rtmVector4f = rtm::vector_set(1.0f);
 								for (uint32_t sampleIndex = 0; sampleIndex < numberOfSamples; ++sampleIndex)
 								{
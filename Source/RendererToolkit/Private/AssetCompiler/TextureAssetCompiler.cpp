@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RendererToolkit/Private/AssetCompiler/TextureAssetCompiler.h"
+#include "RendererToolkit/Private/Helper/ParallelHelper.h"
 #include "RendererToolkit/Private/Helper/StringHelper.h"
 #include "RendererToolkit/Private/Helper/CacheManager.h"
 #include "RendererToolkit/Private/Helper/JsonHelper.h"
@@ -138,27 +139,82 @@ namespace
 			return exp(-glm::dot(offset, offset) / v) / (glm::pi<float>() * v);
 		}
 
-		[[nodiscard]] glm::vec4 fetch(crnlib::image_u8& normalMapCrunchImage, const glm::vec2& position, const glm::vec2& offset)
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Normalized normal map normals, unpacked once per texel instead of once per 3x3 filter tap
+		*/
+		class NormalMap final
 		{
-			const crnlib::color_quad_u8& crunchColor = normalMapCrunchImage.get_clamped(static_cast<int>(position.x + offset.x), static_cast<int>(position.y + offset.y));
-			const glm::vec3 n((static_cast<float>(crunchColor.r) / 255.0f) * 2.0f - 1.0f, (static_cast<float>(crunchColor.g) / 255.0f) * 2.0f - 1.0f, (static_cast<float>(crunchColor.b) / 255.0f) * 2.0f - 1.0f);
-			return glm::vec4(glm::normalize(n), 1.0f) * gaussianWeight(offset);
-		}
 
-		[[nodiscard]] float calculateToksvig(crnlib::image_u8& normalMapCrunchImage, const glm::vec2& position, float power)
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			explicit NormalMap(const crnlib::image_u8& normalMapCrunchImage) :
+				mWidth(static_cast<int>(normalMapCrunchImage.get_width())),
+				mHeight(static_cast<int>(normalMapCrunchImage.get_height())),
+				mNormals(static_cast<size_t>(mWidth) * static_cast<size_t>(mHeight))
+			{
+				RendererToolkit::ParallelHelper::forEachInParallel(normalMapCrunchImage.get_height(), [this, &normalMapCrunchImage](crnlib::uint y)
+				{
+					glm::vec3* normals = &mNormals[static_cast<size_t>(y) * static_cast<size_t>(mWidth)];
+					for (int x = 0; x < mWidth; ++x)
+					{
+						const crnlib::color_quad_u8& crunchColor = normalMapCrunchImage(static_cast<crnlib::uint>(x), y);
+						const glm::vec3 n((static_cast<float>(crunchColor.r) / 255.0f) * 2.0f - 1.0f, (static_cast<float>(crunchColor.g) / 255.0f) * 2.0f - 1.0f, (static_cast<float>(crunchColor.b) / 255.0f) * 2.0f - 1.0f);
+						normals[x] = glm::normalize(n);
+					}
+				});
+			}
+
+			[[nodiscard]] inline const glm::vec3& getClamped(int x, int y) const	// Same addressing as "crnlib::image_u8::get_clamped()"
+			{
+				return mNormals[static_cast<size_t>(glm::clamp(y, 0, mHeight - 1)) * static_cast<size_t>(mWidth) + static_cast<size_t>(glm::clamp(x, 0, mWidth - 1))];
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			int					   mWidth;
+			int					   mHeight;
+			std::vector<glm::vec3> mNormals;
+
+
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] float calculateToksvig(const NormalMap& normalMap, int x, int y, float power)
 		{
+			// The Gaussian weights of the 3x3 filter taps are constant
+			static const float GAUSSIAN_WEIGHTS[9] =
+			{
+				gaussianWeight(glm::vec2(-1.0f, -1.0f)), gaussianWeight(glm::vec2(0.0f, -1.0f)), gaussianWeight(glm::vec2(1.0f, -1.0f)),
+				gaussianWeight(glm::vec2(-1.0f,  0.0f)), gaussianWeight(glm::vec2(0.0f,  0.0f)), gaussianWeight(glm::vec2(1.0f,  0.0f)),
+				gaussianWeight(glm::vec2(-1.0f,  1.0f)), gaussianWeight(glm::vec2(0.0f,  1.0f)), gaussianWeight(glm::vec2(1.0f,  1.0f))
+			};
+
 			// 3x3 filter
-			glm::vec4 n = fetch(normalMapCrunchImage, position, glm::vec2(-1.0f, -1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 0.0f, -1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 1.0f, -1.0f));
+			glm::vec4 n = glm::vec4(normalMap.getClamped(x - 1, y - 1), 1.0f) * GAUSSIAN_WEIGHTS[0];
+			n += glm::vec4(normalMap.getClamped(x,	   y - 1), 1.0f) * GAUSSIAN_WEIGHTS[1];
+			n += glm::vec4(normalMap.getClamped(x + 1, y - 1), 1.0f) * GAUSSIAN_WEIGHTS[2];
 
-			n += fetch(normalMapCrunchImage, position, glm::vec2(-1.0f,  0.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 0.0f,  0.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 1.0f,  0.0f));
+			n += glm::vec4(normalMap.getClamped(x - 1, y), 1.0f) * GAUSSIAN_WEIGHTS[3];
+			n += glm::vec4(normalMap.getClamped(x,	   y), 1.0f) * GAUSSIAN_WEIGHTS[4];
+			n += glm::vec4(normalMap.getClamped(x + 1, y), 1.0f) * GAUSSIAN_WEIGHTS[5];
 
-			n += fetch(normalMapCrunchImage, position, glm::vec2(-1.0f,  1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 0.0f,  1.0f));
-			n += fetch(normalMapCrunchImage, position, glm::vec2( 1.0f,  1.0f));
+			n += glm::vec4(normalMap.getClamped(x - 1, y + 1), 1.0f) * GAUSSIAN_WEIGHTS[6];
+			n += glm::vec4(normalMap.getClamped(x,	   y + 1), 1.0f) * GAUSSIAN_WEIGHTS[7];
+			n += glm::vec4(normalMap.getClamped(x + 1, y + 1), 1.0f) * GAUSSIAN_WEIGHTS[8];
 
 			// Divide by weight sum
 			n.x /= n.w;
@@ -174,40 +230,40 @@ namespace
 		{
 			const crnlib::uint width = normalMapCrunchMipLevel.get_width();
 			const crnlib::uint height = normalMapCrunchMipLevel.get_height();
-			crnlib::image_u8* normalMapCrunchImage = normalMapCrunchMipLevel.get_image();
+			const NormalMap normalMap(*normalMapCrunchMipLevel.get_image());
 			crnlib::image_u8* crunchImage = toksvigCrunchMipLevel.get_image();
-			for (crnlib::uint y = 0; y < height; ++y)
+			RendererToolkit::ParallelHelper::forEachInParallel(height, [width, &normalMap, crunchImage](crnlib::uint y)
 			{
 				for (crnlib::uint x = 0; x < width; ++x)
 				{
 					// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
-					const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
+					const float toksvig = glm::clamp(calculateToksvig(normalMap, static_cast<int>(x), static_cast<int>(y), POWER), 0.0f, 1.0f);
 
 					// Roughness = 1 - glossiness
 					(*crunchImage)(x, y) = static_cast<crnlib::uint8>((1.0f - toksvig) * 255.0f);
 				}
-			}
+			});
 		}
 
 		void compositeToksvigRoughnessMap(const crnlib::mip_level& roughnessMapCrunchMipLevel, const crnlib::mip_level& normalMapCrunchMipLevel, crnlib::mip_level& crunchMipLevel)
 		{
 			const crnlib::uint width = normalMapCrunchMipLevel.get_width();
 			const crnlib::uint height = normalMapCrunchMipLevel.get_height();
-			crnlib::image_u8* roughnessMapCrunchImage = roughnessMapCrunchMipLevel.get_image();
-			crnlib::image_u8* normalMapCrunchImage = normalMapCrunchMipLevel.get_image();
+			const crnlib::image_u8* roughnessMapCrunchImage = roughnessMapCrunchMipLevel.get_image();
+			const NormalMap normalMap(*normalMapCrunchMipLevel.get_image());
 			crnlib::image_u8* crunchImage = crunchMipLevel.get_image();
-			for (crnlib::uint y = 0; y < height; ++y)
+			RendererToolkit::ParallelHelper::forEachInParallel(height, [width, roughnessMapCrunchImage, &normalMap, crunchImage](crnlib::uint y)
 			{
 				for (crnlib::uint x = 0; x < width; ++x)
 				{
 					// Toksvig: Areas in the original normal map that were flat are white (glossy), whereas noisy, bumpy sections are darker
-					const float toksvig = glm::clamp(calculateToksvig(*normalMapCrunchImage, glm::vec2(x, y), POWER), 0.0f, 1.0f);
+					const float toksvig = glm::clamp(calculateToksvig(normalMap, static_cast<int>(x), static_cast<int>(y), POWER), 0.0f, 1.0f);
 
 					// Roughness = 1 - glossiness
 					const float originalGlossiness = 1.0f - (static_cast<float>((*roughnessMapCrunchImage)(x, y).r) / 255.0f);
 					(*crunchImage)(x, y).r = 255u - static_cast<crnlib::uint8>(originalGlossiness * toksvig * 255.0f);
 				}
-			}
+			});
 		}
 
 
@@ -264,7 +320,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global variables                                      ]
 		//[-------------------------------------------------------]
-		static std::atomic<bool> g_CrunchInitialized = false;
+		static std::atomic<uint32_t> g_CrunchReferenceCounter = 0;		///< There's one texture asset compiler instance per asset compiler worker thread, but Crunch must only be initialized once
 
 
 		//[-------------------------------------------------------]
@@ -1208,24 +1264,22 @@ namespace
 
 		void initializeCrunch(const RendererToolkit::Context& context)
 		{
-			if (!g_CrunchInitialized)
+			if (0 == g_CrunchReferenceCounter++)
 			{
 				// The Crunch console is using "printf()" by default if no console output function handles Crunch console output
 				// -> Redirect the Crunch console output into our log so we have an uniform handling of such information
 				crn_set_memory_callbacks(::detail::crunchRealloc, ::detail::crunchMsize, &context.getAllocator());
 				crnlib::console::add_console_output_func(crunchConsoleOutput, &const_cast<RendererToolkit::Context&>(context));
-				g_CrunchInitialized = true;
 			}
 		}
 
 		void deinitializeCrunch()
 		{
-			if (g_CrunchInitialized)
+			if (1 == g_CrunchReferenceCounter--)
 			{
 				crnlib::console::remove_console_output_func(crunchConsoleOutput);
 				crnlib::console::deinit();
 				crn_set_memory_callbacks(nullptr, nullptr, nullptr);
-				g_CrunchInitialized = false;
 			}
 		}
 
@@ -1521,7 +1575,8 @@ namespace
 			crunchConvertParams.m_y_flip = true;
 			crunchConvertParams.m_no_stats = true;
 			crunchConvertParams.m_dst_format = crnlib::PIXEL_FMT_INVALID;
-			crunchConvertParams.m_comp_params.m_num_helper_threads = crnlib::g_number_of_processors - 1;
+			const RendererToolkit::ParallelHelper::ReservedThreads crunchHelperThreads(static_cast<uint32_t>(std::max(0, static_cast<int>(crnlib::g_number_of_processors) - 1)));
+			crunchConvertParams.m_comp_params.m_num_helper_threads = crunchHelperThreads.getNumberOfThreads();	// Crunch helper threads taken from the shared processor budget, the calling thread is always used as well
 
 			// The 4x4 block size based DXT compression format has no support for 1D textures
 			bool compression = true;
@@ -1810,14 +1865,11 @@ namespace
 			crnlib::uint8_vec buf;
 			if (fileDataStreamSerializer.read_entire_file(buf))
 			{
+				// -> Don't use "stbi_set_flip_vertically_on_load()", it's global state shared with other threads, the height map is flipped vertically while writing it down instead
 				int x = 0, y = 0, n = 0;
-				stbi_set_flip_vertically_on_load(true);
 				stbi_us* pData = stbi_load_16_from_memory(buf.get_ptr(), static_cast<int>(buf.size_in_bytes()), &x, &y, &n, 1);
-				stbi_set_flip_vertically_on_load(false);
 				if (nullptr != pData)
 				{
-					const uint32_t numberOfTexelsPerLayer = static_cast<uint32_t>(x * y);
-
 					// TODO(co) Check n?
 
 					// Fill dds header for 16-bit height map "DXGI_FORMAT_R16_UNORM" ("A single-component, 16-bit unsigned-normalized-integer format that supports 16 bits for the red channel.") used during runtime.
@@ -1843,7 +1895,10 @@ namespace
 						Renderer::MemoryFile memoryFile(0, 4096);
 						memoryFile.write("DDS ", sizeof(uint32_t));
 						memoryFile.write(reinterpret_cast<const char*>(&ddsSurfaceDesc2), sizeof(crnlib::DDSURFACEDESC2));
-						memoryFile.write(pData, sizeof(stbi_us) * numberOfTexelsPerLayer);
+						for (int row = y - 1; row >= 0; --row)
+						{
+							memoryFile.write(pData + static_cast<size_t>(row) * static_cast<size_t>(x), sizeof(stbi_us) * static_cast<size_t>(x));
+						}
 						if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::Lz4DdsTextureResourceLoader::FORMAT_TYPE, Renderer::Lz4DdsTextureResourceLoader::FORMAT_VERSION, fileManager, virtualOutputAssetFilename))
 						{
 							stbi_image_free(pData);
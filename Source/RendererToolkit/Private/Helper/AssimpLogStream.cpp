@@ -24,6 +24,98 @@
 #include "RendererToolkit/Private/Helper/AssimpLogStream.h"
 
 #include <stdexcept>
+#include <mutex>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		static std::mutex g_AssimpDefaultLoggerMutex;										///< Protects the Assimp default logger setup
+		static uint32_t g_NumberOfAssimpLogStreams = 0;										///< Number of Assimp log stream instances, protected by "g_AssimpDefaultLoggerMutex"
+		thread_local RendererToolkit::AssimpLogStream* g_CurrentAssimpLogStream = nullptr;	///< Assimp log stream of the current thread, can be a null pointer
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Assimp logger forwarding errors to the Assimp log stream of the calling thread
+		*
+		*  @note
+		*    - Stateless, unlike the Assimp default logger which e.g. remembers the last message to suppress repetitions, so it can be used by multiple threads at one and the same time
+		*/
+		class ThreadDispatchingAssimpLogger final : public Assimp::Logger
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual Assimp::Logger methods                 ]
+		//[-------------------------------------------------------]
+		public:
+			virtual bool attachStream(Assimp::LogStream*, unsigned int) override
+			{
+				// Assimp log streams register themselves for their thread
+				return false;
+			}
+
+			virtual bool detachStream(Assimp::LogStream*, unsigned int) override
+			{
+				// Assimp log streams register themselves for their thread
+				return false;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Protected virtual Assimp::Logger methods              ]
+		//[-------------------------------------------------------]
+		protected:
+			virtual void OnDebug(const char*) override
+			{
+				// Nothing here
+			}
+
+			virtual void OnVerboseDebug(const char*) override
+			{
+				// Nothing here
+			}
+
+			virtual void OnInfo(const char*) override
+			{
+				// Nothing here
+			}
+
+			virtual void OnWarn(const char*) override
+			{
+				// Nothing here
+			}
+
+			virtual void OnError(const char* message) override
+			{
+				if (nullptr != g_CurrentAssimpLogStream)
+				{
+					g_CurrentAssimpLogStream->write(message);
+				}
+			}
+
+
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -38,14 +130,37 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	AssimpLogStream::AssimpLogStream()
 	{
-		Assimp::DefaultLogger::create("", Assimp::Logger::NORMAL, aiDefaultLogStream_DEBUGGER);
-		Assimp::DefaultLogger::get()->attachStream(this, Assimp::DefaultLogger::Err);
+		// Register for the current thread
+		if (nullptr != ::detail::g_CurrentAssimpLogStream)
+		{
+			throw std::runtime_error("There can be only one Assimp log stream instance per thread");
+		}
+		::detail::g_CurrentAssimpLogStream = this;
+
+		{ // The first Assimp log stream instance sets up the Assimp default logger
+			const std::lock_guard<std::mutex> mutexLock(::detail::g_AssimpDefaultLoggerMutex);
+			if (0 == ::detail::g_NumberOfAssimpLogStreams)
+			{
+				// The Assimp default logger takes over the ownership
+				Assimp::DefaultLogger::set(new ::detail::ThreadDispatchingAssimpLogger());
+			}
+			++::detail::g_NumberOfAssimpLogStreams;
+		}
 	}
 
 	AssimpLogStream::~AssimpLogStream()
 	{
-		Assimp::DefaultLogger::get()->detachStream(this, Assimp::DefaultLogger::Err);
-		Assimp::DefaultLogger::kill();
+		// Unregister for the current thread
+		::detail::g_CurrentAssimpLogStream = nullptr;
+
+		{ // The last Assimp log stream instance destroys the Assimp default logger
+			const std::lock_guard<std::mutex> mutexLock(::detail::g_AssimpDefaultLoggerMutex);
+			--::detail::g_NumberOfAssimpLogStreams;
+			if (0 == ::detail::g_NumberOfAssimpLogStreams)
+			{
+				Assimp::DefaultLogger::kill();
+			}
+		}
 	}
 
 
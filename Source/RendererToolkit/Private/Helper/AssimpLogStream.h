@@ -57,6 +57,14 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Assimp log stream turning Assimp errors into exceptions
+	*
+	*  @note
+	*    - The Assimp default logger is a global singleton, so a thread dispatching Assimp logger is shared by all Assimp log stream instances and forwards the errors to the Assimp log stream of the calling thread
+	*    - Asset compiler worker threads can use Assimp concurrently, but there can be only one Assimp log stream instance per thread at one and the same time
+	*/
 	class AssimpLogStream final : public Assimp::LogStream
 	{
 
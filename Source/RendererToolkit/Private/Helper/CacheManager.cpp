@@ -31,6 +31,21 @@
 #include <Renderer/Public/Core/File/IFileManager.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <random>
+	#include <fstream>
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -50,6 +65,27 @@ namespace
 			static constexpr uint32_t FORMAT_VERSION = 1;
 		}
 
+		// Shared cache entry file content:
+		// - Header
+		// - Compiled asset data
+		namespace RendererToolkitSharedCache
+		{
+			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("RendererToolkitSharedCache");
+			static constexpr uint32_t FORMAT_VERSION = 1;
+
+			#pragma pack(push)
+			#pragma pack(1)
+				struct Header final
+				{
+					uint32_t formatType;
+					uint32_t formatVersion;
+					uint64_t key;			///< Content-addressed shared cache key, guards against misplaced files
+					uint64_t numberOfBytes;	///< Number of bytes of the compiled asset data
+					uint64_t dataHash;		///< 64-bit FNV-1a hash of the compiled asset data, guards against truncated or otherwise corrupt files
+				};
+			#pragma pack(pop)
+		}
+
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
@@ -91,6 +127,60 @@ namespace
 			}
 		}
 
+		template <typename T>
+		[[nodiscard]] uint64_t hashValue(uint64_t hash, const T& value)
+		{
+			return Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&value), sizeof(T), hash);
+		}
+
+		[[nodiscard]] uint64_t hashString(uint64_t hash, const std::string& value)
+		{
+			// Include the terminating zero so concatenated strings can't collide
+			return Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(value.c_str()), static_cast<uint32_t>(value.length() + 1), hash);
+		}
+
+		[[nodiscard]] uint64_t hashData(const std::vector<uint8_t>& data)
+		{
+			// "Renderer::Math::calculateFNV1a64()" is limited to 32-bit sizes, so hash in chunks
+			static constexpr size_t CHUNK_SIZE = 64 * 1024 * 1024;
+			uint64_t hash = Renderer::Math::FNV1a_INITIAL_HASH_64;
+			for (size_t offset = 0; offset < data.size(); offset += CHUNK_SIZE)
+			{
+				hash = Renderer::Math::calculateFNV1a64(data.data() + offset, static_cast<uint32_t>(std::min(CHUNK_SIZE, data.size() - offset)), hash);
+			}
+			return hash;
+		}
+
+		[[nodiscard]] bool readVirtualFile(const Renderer::IFileManager& fileManager, const std::string& virtualFilename, std::vector<uint8_t>& data)
+		{
+			Renderer::IFile* file = fileManager.openFile(Renderer::IFileManager::FileMode::READ, virtualFilename.c_str());
+			if (nullptr == file)
+			{
+				return false;
+			}
+			data.resize(file->getNumberOfBytes());
+			file->read(data.data(), data.size());
+			fileManager.closeFile(*file);
+			return true;
+		}
+
+		[[nodiscard]] bool writeVirtualFile(const Renderer::IFileManager& fileManager, const std::string& virtualFilename, const std::vector<uint8_t>& data)
+		{
+			const size_t lastSlash = virtualFilename.find_last_of('/');
+			if (std::string::npos != lastSlash && !fileManager.createDirectories(virtualFilename.substr(0, lastSlash).c_str()))
+			{
+				return false;
+			}
+			Renderer::IFile* file = fileManager.openFile(Renderer::IFileManager::FileMode::WRITE, virtualFilename.c_str());
+			if (nullptr == file)
+			{
+				return false;
+			}
+			file->write(data.data(), data.size());
+			fileManager.closeFile(*file);
+			return true;
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -109,10 +199,12 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	CacheManager::CacheManager(const Context& context, const std::string& projectName) :
+	CacheManager::CacheManager(const Context& context, const std::string& projectName, uint64_t compilerOptionsHash) :
 		mContext(context),
 		mProjectName(projectName),
-		mDiskCacheDirty(false)
+		mCompilerOptionsHash(compilerOptionsHash),
+		mDiskCacheDirty(false),
+		mSharedCacheMaximumSize(0)
 	{
 		loadCache();
 	}
@@ -122,14 +214,14 @@ namespace RendererToolkit
 		saveCache();
 	}
 
-	bool CacheManager::needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::string& virtualSourceFilename, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries)
+	bool CacheManager::needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::string& virtualSourceFilename, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries, const std::vector<std::string>& virtualDependencyFilenames)
 	{
 		std::vector<std::string> virtualSourceFilenames;
 		virtualSourceFilenames.push_back(virtualSourceFilename);
-		return needsToBeCompiled(rhiTarget, virtualAssetFilename, virtualSourceFilenames, virtualDestinationFilename, compilerVersion, cacheEntries);
+		return needsToBeCompiled(rhiTarget, virtualAssetFilename, virtualSourceFilenames, virtualDestinationFilename, compilerVersion, cacheEntries, virtualDependencyFilenames);
 	}
 
-	bool CacheManager::needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries)
+	bool CacheManager::needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries, const std::vector<std::string>& virtualDependencyFilenames)
 	{
 		if (virtualSourceFilenames.empty())
 		{
@@ -167,6 +259,9 @@ namespace RendererToolkit
 		// Check if also the asset file (*.asset) has changed, e.g. compile options has changed
 		// -> ".asset"-check for automatically in-memory generated ".asset"-file support
 		const bool assetFileChanged = (virtualAssetFilename.find(".asset") != std::string::npos && checkIfFileChanged(rhiTarget, virtualAssetFilename.c_str(), IAssetCompiler::ASSET_FORMAT_VERSION, cacheEntries.assetCacheEntry));
+
+		// The file checks above lock on their own, the following cache data accesses need the lock
+		std::unique_lock<std::mutex> mutexLock(mMutex);
 		if (!assetFileChanged && (sourceFilesChanged || !destinationExists))
 		{
 			// Mark the asset file as changed when asset needs to be compiled and asset file itself didn't changed
@@ -174,12 +269,69 @@ namespace RendererToolkit
 			mCheckedFilesStatus[Renderer::StringId::calculateFNV(virtualAssetFilename.c_str())].changed = true;
 		}
 
-		// File needs to be compiled either destination doesn't exists, the source data has changed or the asset file has changed
-		return (sourceFilesChanged || assetFileChanged || !destinationExists);
+		// Check whether or not one of the assets the asset depends on has changed
+		bool dependencyFilesChanged = false;
+		for (const std::string& virtualDependencyFilename : virtualDependencyFilenames)
+		{
+			CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(Renderer::StringId::calculateFNV(virtualDependencyFilename.c_str()));
+			if (mCheckedFilesStatus.end() != iterator && iterator->second.changed)
+			{
+				dependencyFilesChanged = true;
+				break;
+			}
+		}
+
+		// File needs to be compiled either destination doesn't exists, the source data has changed, the asset file has changed or a dependency has changed
+		if (!sourceFilesChanged && !assetFileChanged && !dependencyFilesChanged && destinationExists)
+		{
+			return false;
+		}
+		if (mSharedCacheDirectory.empty() || !virtualDependencyFilenames.empty())
+		{
+			// The compiled data of assets with dependencies depends on the compiled state of other assets, which isn't part of the content-addressed key
+			return true;
+		}
+
+		// Calculate the content-addressed shared cache key: Hash everything the compiled asset depends on
+		uint64_t sharedCacheKey = ::detail::hashValue(Renderer::Math::FNV1a_INITIAL_HASH_64, ::detail::RendererToolkitSharedCache::FORMAT_VERSION);
+		sharedCacheKey = ::detail::hashValue(sharedCacheKey, compilerVersion);
+		sharedCacheKey = ::detail::hashValue(sharedCacheKey, mCompilerOptionsHash);
+		sharedCacheKey = ::detail::hashString(sharedCacheKey, rhiTarget);
+		sharedCacheKey = ::detail::hashString(sharedCacheKey, virtualAssetFilename);
+		sharedCacheKey = ::detail::hashString(sharedCacheKey, virtualDestinationFilename);
+		sharedCacheKey = ::detail::hashValue(sharedCacheKey, cacheEntries.assetCacheEntry.fileHash);
+		for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
+		{
+			sharedCacheKey = ::detail::hashValue(sharedCacheKey, sourceCacheEntry.fileHash);
+		}
+
+		// The shared cache is accessed without holding the lock
+		mutexLock.unlock();
+		if (fetchFromSharedCache(sharedCacheKey, virtualDestinationFilename))
+		{
+			// Shared cache hit, the fetched compiled asset is up-to-date
+			mutexLock.lock();
+			for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
+			{
+				storeOrUpdateCacheEntry(sourceCacheEntry);
+			}
+			storeOrUpdateCacheEntry(cacheEntries.assetCacheEntry);
+			return false;
+		}
+
+		// Shared cache miss, store the compiled asset inside the shared cache as soon as it has been compiled
+		cacheEntries.sharedCacheKey = sharedCacheKey;
+		cacheEntries.virtualDestinationFilename = virtualDestinationFilename;
+		return true;
 	}
 
 	void CacheManager::storeOrUpdateCacheEntries(const CacheEntries& cacheEntries)
 	{
+		if (Renderer::isValid(cacheEntries.sharedCacheKey))
+		{
+			storeInSharedCache(cacheEntries.sharedCacheKey, cacheEntries.virtualDestinationFilename);
+		}
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		for (const CacheEntry& sourceCacheEntry : cacheEntries.sourceCacheEntries)
 		{
 			storeOrUpdateCacheEntry(sourceCacheEntry);
@@ -219,6 +371,7 @@ namespace RendererToolkit
 				{
 					// Asset file itself has not changed but the source file so mark the asset file as changed too
 					// Dependencies are defined via the asset file and with this change the asset which depends on this asset knows if the referenced asset has changed
+					std::lock_guard<std::mutex> mutexLock(mMutex);
 					mCheckedFilesStatus[Renderer::StringId::calculateFNV(virtualAssetFilename.c_str())].changed = true;
 				}
 			}
@@ -234,6 +387,7 @@ namespace RendererToolkit
 
 	bool CacheManager::dependencyFilesChanged(const std::vector<std::string>& virtualDependencyFilenames)
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		for (const std::string& virtualDependencyFilename : virtualDependencyFilenames)
 		{
 			CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(Renderer::StringId::calculateFNV(virtualDependencyFilename.c_str()));
@@ -248,14 +402,94 @@ namespace RendererToolkit
 		return false;
 	}
 
+	void CacheManager::setSharedCache(const std::string& absoluteDirectoryName, uint64_t maximumSizeInBytes)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		mSharedCacheDirectory = absoluteDirectoryName;
+		mSharedCacheMaximumSize = maximumSizeInBytes;
+		if (!mSharedCacheDirectory.empty())
+		{
+			std::error_code errorCode;
+			std_filesystem::create_directories(std_filesystem::u8path(mSharedCacheDirectory), errorCode);
+			if (errorCode)
+			{
+				RHI_LOG(mContext, WARNING, "The renderer toolkit failed to create the shared cache directory \"%s\", the shared cache isn't used", mSharedCacheDirectory.c_str())
+				mSharedCacheDirectory.clear();
+			}
+		}
+	}
+
+	void CacheManager::evictSharedCache()
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		if (mSharedCacheDirectory.empty() || 0 == mSharedCacheMaximumSize)
+		{
+			// Nothing to do in here
+			return;
+		}
+
+		// Gather the shared cache entries, the last write time is updated on each shared cache hit so it's our least recently used criterion
+		struct SharedCacheFile final
+		{
+			std_filesystem::path			path;
+			std_filesystem::file_time_type	lastWriteTime;
+			uint64_t						numberOfBytes;
+		};
+		std::vector<SharedCacheFile> sharedCacheFiles;
+		uint64_t totalNumberOfBytes = 0;
+		try
+		{
+			for (const std_filesystem::directory_entry& directoryEntry : std_filesystem::recursive_directory_iterator(std_filesystem::u8path(mSharedCacheDirectory)))
+			{
+				if (std_filesystem::is_regular_file(directoryEntry.path()))
+				{
+					const SharedCacheFile& sharedCacheFile = sharedCacheFiles.emplace_back(SharedCacheFile{directoryEntry.path(), std_filesystem::last_write_time(directoryEntry.path()), static_cast<uint64_t>(std_filesystem::file_size(directoryEntry.path()))});
+					totalNumberOfBytes += sharedCacheFile.numberOfBytes;
+				}
+			}
+		}
+		catch (const std::exception& e)
+		{
+			// Other processes might modify the shared cache concurrently, just try again next time
+			RHI_LOG(mContext, WARNING, "The renderer toolkit failed to enumerate the shared cache \"%s\": %s", mSharedCacheDirectory.c_str(), e.what())
+			return;
+		}
+		if (totalNumberOfBytes <= mSharedCacheMaximumSize)
+		{
+			// Nothing to do in here
+			return;
+		}
+
+		// Remove the least recently used shared cache entries until the shared cache size limit is respected
+		std::sort(sharedCacheFiles.begin(), sharedCacheFiles.end(), [](const SharedCacheFile& left, const SharedCacheFile& right) { return (left.lastWriteTime < right.lastWriteTime); });
+		const uint64_t previousTotalNumberOfBytes = totalNumberOfBytes;
+		uint32_t numberOfRemovedFiles = 0;
+		for (const SharedCacheFile& sharedCacheFile : sharedCacheFiles)
+		{
+			if (totalNumberOfBytes <= mSharedCacheMaximumSize)
+			{
+				break;
+			}
+			std::error_code errorCode;
+			if (std_filesystem::remove(sharedCacheFile.path, errorCode))
+			{
+				totalNumberOfBytes -= sharedCacheFile.numberOfBytes;
+				++numberOfRemovedFiles;
+			}
+		}
+		RHI_LOG(mContext, INFORMATION, "Evicted %u files from the shared cache \"%s\", the shared cache size was reduced from %llu to %llu bytes", numberOfRemovedFiles, mSharedCacheDirectory.c_str(), static_cast<unsigned long long>(previousTotalNumberOfBytes), static_cast<unsigned long long>(totalNumberOfBytes))
+	}
+
 	void CacheManager::clearInternalCache()
 	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		mCheckedFilesStatus.clear();
 	}
 
 	void CacheManager::saveCache()
 	{
 		// Do only save the renderer toolkit cache if writing local data is allowed
+		std::lock_guard<std::mutex> mutexLock(mMutex);
 		if (mDiskCacheDirty && nullptr != mContext.getFileManager().getLocalDataMountPoint())
 		{
 			const uint32_t numberOfStoredCacheEntries = static_cast<uint32_t>(mStoredCacheEntries.size());
@@ -330,47 +564,29 @@ namespace RendererToolkit
 
 		// Get cache entry data if an entry exists
 		Renderer::StringId fileId(virtualFilename);
-		const bool hasFileEntry = fillEntryForFile(rhiTarget, fileId, cacheEntry);
-		if (hasFileEntry)
+		bool hasFileEntry = false;
 		{
-			// A file might be referenced by different assets so first check if the file was already checked by a previous call to this method
-			// If so return the result (the file shouldn't change between two checks while a compilation is running)
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			hasFileEntry = fillEntryForFile(rhiTarget, fileId, cacheEntry);
+			if (hasFileEntry)
 			{
-				CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
-				if (mCheckedFilesStatus.end() != iterator)
+				// A file might be referenced by different assets so first check if the file was already checked by a previous call to this method
+				// If so return the result (the file shouldn't change between two checks while a compilation is running)
 				{
-					// Copy cache entry data from stored one
-					cacheEntry = iterator->second.cacheEntry;
-
-					// The file was already checked before simply return the result
-					return iterator->second.changed;
+					CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
+					if (mCheckedFilesStatus.end() != iterator)
+					{
+						// Copy cache entry data from stored one
+						cacheEntry = iterator->second.cacheEntry;
+
+						// The file was already checked before simply return the result
+						return iterator->second.changed;
+					}
 				}
-			}
-
-			// First and faster step: Check file size and file time as well as the compiler version (needed so that we also detect compiler version changes here too)
-			if (cacheEntry.fileSize == fileSize && cacheEntry.fileTime == fileTime && cacheEntry.compilerVersion == compilerVersion)
-			{
-				// The file has not changed -> store the result
-				CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-				checkedFile.changed = false;
-				checkedFile.cacheEntry = cacheEntry;
 
-				// Source file didn't changed
-				return false;
-			}
-			else
-			{
-				// Current file differs in file size and/or file time do the second step:
-				// Check the compiler version and the 64-bit FNV-1a hash
-				const uint64_t fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
-				if (cacheEntry.fileHash == fileHash && cacheEntry.compilerVersion == compilerVersion)
+				// First and faster step: Check file size and file time as well as the compiler version (needed so that we also detect compiler version changes here too)
+				if (cacheEntry.fileSize == fileSize && cacheEntry.fileTime == fileTime && cacheEntry.compilerVersion == compilerVersion)
 				{
-					// Hash of the file and compiler version didn't changed but store the changed file size/time
-					cacheEntry.fileSize		   = fileSize;
-					cacheEntry.fileTime		   = fileTime;
-					cacheEntry.compilerVersion = compilerVersion;
-					storeOrUpdateCacheEntry(cacheEntry);
-
 					// The file has not changed -> store the result
 					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
 					checkedFile.changed = false;
@@ -379,37 +595,55 @@ namespace RendererToolkit
 					// Source file didn't changed
 					return false;
 				}
-				else
-				{
-					cacheEntry.fileSize		   = fileSize;
-					cacheEntry.fileTime		   = fileTime;
-					cacheEntry.fileHash		   = fileHash;
-					cacheEntry.compilerVersion = compilerVersion;
-					storeOrUpdateCacheEntry(cacheEntry);
+			}
+		}
 
-					// The file has changed -> store the result
-					CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-					checkedFile.changed = true;
-					checkedFile.cacheEntry = cacheEntry;
-				}
+		// Either there's no cache entry yet or the current file differs in file size and/or file time, do the second step:
+		// Check the compiler version and the 64-bit FNV-1a hash, the hashing is done without holding the lock
+		const uint64_t fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		{
+			// Another thread might have checked the file in the meantime
+			CheckedFilesStatus::const_iterator iterator = mCheckedFilesStatus.find(fileId);
+			if (mCheckedFilesStatus.end() != iterator)
+			{
+				cacheEntry = iterator->second.cacheEntry;
+				return iterator->second.changed;
 			}
 		}
-		else
+		if (hasFileEntry && cacheEntry.fileHash == fileHash && cacheEntry.compilerVersion == compilerVersion)
 		{
-			// No cache entry exists yet: Store the data
-			cacheEntry.rhiTargetId		= Renderer::StringId::calculateFNV(rhiTarget.c_str());
-			cacheEntry.fileId			= fileId;
-			cacheEntry.fileSize			= fileSize;
-			cacheEntry.fileTime			= fileTime;
-			cacheEntry.fileHash			= Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualFilename);
-			cacheEntry.compilerVersion	= compilerVersion;
+			// Hash of the file and compiler version didn't changed but store the changed file size/time
+			cacheEntry.fileSize		   = fileSize;
+			cacheEntry.fileTime		   = fileTime;
+			cacheEntry.compilerVersion = compilerVersion;
 			storeOrUpdateCacheEntry(cacheEntry);
 
-			// The file had no cache entry yet -> store it as "has changed"
+			// The file has not changed -> store the result
 			CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
-			checkedFile.changed = true;
+			checkedFile.changed = false;
 			checkedFile.cacheEntry = cacheEntry;
+
+			// Source file didn't changed
+			return false;
+		}
+
+		// The file has changed or had no cache entry yet: Store the data
+		if (!hasFileEntry)
+		{
+			cacheEntry.rhiTargetId = Renderer::StringId::calculateFNV(rhiTarget.c_str());
+			cacheEntry.fileId	   = fileId;
 		}
+		cacheEntry.fileSize		   = fileSize;
+		cacheEntry.fileTime		   = fileTime;
+		cacheEntry.fileHash		   = fileHash;
+		cacheEntry.compilerVersion = compilerVersion;
+		storeOrUpdateCacheEntry(cacheEntry);
+
+		// The file has changed -> store the result
+		CheckedFile& checkedFile = mCheckedFilesStatus[fileId];
+		checkedFile.changed = true;
+		checkedFile.cacheEntry = cacheEntry;
 
 		// Default file has changed to do not break compilation, if cache doesn't work
 		return true;
@@ -432,6 +666,102 @@ namespace RendererToolkit
 		mDiskCacheDirty = true;
 	}
 
+	std::string CacheManager::getSharedCacheFilename(uint64_t sharedCacheKey) const
+	{
+		char filename[32];
+		snprintf(filename, sizeof(filename), "%02x/%016llx", static_cast<uint32_t>(sharedCacheKey >> 56), static_cast<unsigned long long>(sharedCacheKey));
+		return mSharedCacheDirectory + '/' + filename;
+	}
+
+	bool CacheManager::fetchFromSharedCache(uint64_t sharedCacheKey, const std::string& virtualDestinationFilename) const
+	{
+		// Read the shared cache entry, if there's one
+		const std::string absoluteFilename = getSharedCacheFilename(sharedCacheKey);
+		const std_filesystem::path path = std_filesystem::u8path(absoluteFilename);
+		std::vector<uint8_t> data;
+		{
+			std::ifstream inputFileStream(path, std::ios::binary);
+			if (!inputFileStream)
+			{
+				// Shared cache miss
+				return false;
+			}
+			::detail::RendererToolkitSharedCache::Header header = {};
+			inputFileStream.read(reinterpret_cast<char*>(&header), sizeof(::detail::RendererToolkitSharedCache::Header));
+			bool valid = (inputFileStream && header.formatType == ::detail::RendererToolkitSharedCache::FORMAT_TYPE && header.formatVersion == ::detail::RendererToolkitSharedCache::FORMAT_VERSION && header.key == sharedCacheKey);
+			if (valid)
+			{
+				data.resize(static_cast<size_t>(header.numberOfBytes));
+				inputFileStream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+				valid = (inputFileStream && ::detail::hashData(data) == header.dataHash);
+			}
+			if (!valid)
+			{
+				// Corrupt shared cache entry, remove it so it gets replaced by the next one compiling the asset
+				inputFileStream.close();
+				RHI_LOG(mContext, WARNING, "The renderer toolkit removed the corrupt shared cache entry \"%s\"", absoluteFilename.c_str())
+				std::error_code errorCode;
+				std_filesystem::remove(path, errorCode);
+				return false;
+			}
+		}
+
+		// Write the compiled asset
+		if (!::detail::writeVirtualFile(mContext.getFileManager(), virtualDestinationFilename, data))
+		{
+			RHI_LOG(mContext, WARNING, "The renderer toolkit failed to write \"%s\" fetched from the shared cache", virtualDestinationFilename.c_str())
+			return false;
+		}
+
+		// Update the last write time, used as least recently used eviction criterion
+		std::error_code errorCode;
+		std_filesystem::last_write_time(path, std_filesystem::file_time_type::clock::now(), errorCode);
+
+		// Shared cache hit
+		return true;
+	}
+
+	void CacheManager::storeInSharedCache(uint64_t sharedCacheKey, const std::string& virtualDestinationFilename) const
+	{
+		const std_filesystem::path path = std_filesystem::u8path(getSharedCacheFilename(sharedCacheKey));
+		std::error_code errorCode;
+		if (std_filesystem::exists(path, errorCode))
+		{
+			// Someone else was faster
+			return;
+		}
+
+		// Read the compiled asset
+		std::vector<uint8_t> data;
+		if (!::detail::readVirtualFile(mContext.getFileManager(), virtualDestinationFilename, data))
+		{
+			return;
+		}
+
+		// Write into a temporary file first and then rename it so other processes never see partially written shared cache entries
+		std_filesystem::create_directories(path.parent_path(), errorCode);
+		std_filesystem::path temporaryPath = path;
+		temporaryPath += '.' + std::to_string(std::random_device()()) + ".tmp";
+		{
+			const ::detail::RendererToolkitSharedCache::Header header = { ::detail::RendererToolkitSharedCache::FORMAT_TYPE, ::detail::RendererToolkitSharedCache::FORMAT_VERSION, sharedCacheKey, data.size(), ::detail::hashData(data) };
+			std::ofstream outputFileStream(temporaryPath, std::ios::binary);
+			outputFileStream.write(reinterpret_cast<const char*>(&header), sizeof(::detail::RendererToolkitSharedCache::Header));
+			outputFileStream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+			if (!outputFileStream)
+			{
+				outputFileStream.close();
+				RHI_LOG(mContext, WARNING, "The renderer toolkit failed to write the shared cache entry \"%s\"", temporaryPath.generic_string().c_str())
+				std_filesystem::remove(temporaryPath, errorCode);
+				return;
+			}
+		}
+		std_filesystem::rename(temporaryPath, path, errorCode);
+		if (errorCode)
+		{
+			std_filesystem::remove(temporaryPath, errorCode);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
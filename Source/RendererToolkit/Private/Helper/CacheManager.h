@@ -40,6 +40,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <mutex>
 	#include <string>
 	#include <vector>
 	#include <unordered_map>
@@ -75,6 +76,9 @@ namespace RendererToolkit
 	*
 	*  @note
 	*    - This manager caches the content hash of source assets to speed up project compilation when the source doesn't changes
+	*    - The public methods are thread safe since asset compilers are running concurrently on multiple worker threads
+	*    - Optionally, compiled assets are exchanged via a content-addressed shared cache directory (e.g. on a network share) so an asset
+	*      compiled once by anyone doesn't need to be compiled again, the key is the hash of all compiler inputs, the compiler version and options
 	*/
 	class CacheManager final
 	{
@@ -109,6 +113,8 @@ namespace RendererToolkit
 		{
 			std::vector<CacheEntry>	sourceCacheEntries;
 			CacheEntry				assetCacheEntry;
+			uint64_t				sharedCacheKey = Renderer::getInvalid<uint64_t>();	///< Content-addressed shared cache key of the compiled asset, invalid if the shared cache isn't used
+			std::string				virtualDestinationFilename;							///< Virtual UTF-8 filename of the compiled asset, only set if the shared cache is used
 		};
 
 
@@ -124,8 +130,10 @@ namespace RendererToolkit
 		*    The renderer toolkit context to use, the renderer toolkit context instance must stay valid as long as the cache manager instance exists
 		*  @param[in] projectName
 		*    UTF-8 name of the project this cache is for
+		*  @param[in] compilerOptionsHash
+		*    64-bit FNV-1a hash of the project wide compiler options (e.g. targets and quality strategy), part of the shared cache key
 		*/
-		CacheManager(const Context& context, const std::string& projectName);
+		CacheManager(const Context& context, const std::string& projectName, uint64_t compilerOptionsHash);
 
 		/**
 		*  @brief
@@ -149,11 +157,17 @@ namespace RendererToolkit
 		*    Compiler version so we can detect compiler version changes and enforce compiling even if the source data has not been changed
 		*  @param[out] cacheEntries
 		*    Receives information about the cache entries; to be passed into "RendererToolkit::CacheManager::storeOrUpdateCacheEntries()"
+		*  @param[in] virtualDependencyFilenames
+		*    Virtual UTF-8 filenames of other asset files the compiled asset depends on, the asset needs to be compiled if one of them has changed
 		*
 		*  @return
 		*    "true" if the file needs to be compiled (aka source changed, destination doesn't exists or is yet unknown file) otherwise "false"
+		*
+		*  @note
+		*    - If the shared cache is used and has the compiled asset, the compiled asset is fetched from the shared cache and "false" is returned
+		*    - Assets with dependencies don't use the shared cache since their compiled data depends on the compiled state of other assets
 		*/
-		[[nodiscard]] bool needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::string& virtualSourceFilename, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries);
+		[[nodiscard]] bool needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::string& virtualSourceFilename, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries, const std::vector<std::string>& virtualDependencyFilenames = {});
 
 		/**
 		*  @brief
@@ -171,11 +185,17 @@ namespace RendererToolkit
 		*    Compiler version so we can detect compiler version changes and enforce compiling even if the source data has not been changed
 		*  @param[out] cacheEntries
 		*    Receives information about the cache entries; to be passed into "RendererToolkit::CacheManager::storeOrUpdateCacheEntries()"
+		*  @param[in] virtualDependencyFilenames
+		*    Virtual UTF-8 filenames of other asset files the compiled asset depends on, the asset needs to be compiled if one of them has changed
 		*
 		*  @return
 		*    "true" if the file needs to be compiled (aka source changed, destination doesn't exists or is yet unknown file) otherwise "false"
+		*
+		*  @note
+		*    - If the shared cache is used and has the compiled asset, the compiled asset is fetched from the shared cache and "false" is returned
+		*    - Assets with dependencies don't use the shared cache since their compiled data depends on the compiled state of other assets
 		*/
-		[[nodiscard]] bool needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries);
+		[[nodiscard]] bool needsToBeCompiled(const std::string& rhiTarget, const std::string& virtualAssetFilename, const std::vector<std::string>& virtualSourceFilenames, const std::string& virtualDestinationFilename, uint32_t compilerVersion, CacheEntries& cacheEntries, const std::vector<std::string>& virtualDependencyFilenames = {});
 
 		/**
 		*  @brief
@@ -183,6 +203,9 @@ namespace RendererToolkit
 		*
 		*  @param[in] cacheEntries
 		*    The cache entries data to store / update
+		*
+		*  @note
+		*    - If the shared cache is used, the compiled asset is stored inside the shared cache
 		*/
 		void storeOrUpdateCacheEntries(const CacheEntries& cacheEntries);
 
@@ -221,6 +244,23 @@ namespace RendererToolkit
 		*/
 		[[nodiscard]] bool dependencyFilesChanged(const std::vector<std::string>& virtualDependencyFilenames);
 
+		/**
+		*  @brief
+		*    Set the content-addressed shared cache
+		*
+		*  @param[in] absoluteDirectoryName
+		*    Absolute UTF-8 name of the shared cache directory, can be shared by multiple machines, empty string to not use a shared cache
+		*  @param[in] maximumSizeInBytes
+		*    Maximum size of the shared cache in bytes, "0" for no limit
+		*/
+		void setSharedCache(const std::string& absoluteDirectoryName, uint64_t maximumSizeInBytes);
+
+		/**
+		*  @brief
+		*    Evict the least recently used compiled assets from the shared cache until the shared cache size limit is respected
+		*/
+		void evictSharedCache();
+
 		/**
 		*  @brief
 		*    Clear the internal cache for file changes
@@ -278,6 +318,7 @@ namespace RendererToolkit
 		*
 		*  @note
 		*    - When a change was detected the an cache entry is stored/updated
+		*    - The caller must not hold the lock, it's only locked for the cache data lookup and update so the file hashing of multiple assets can run in parallel
 		*/
 		[[nodiscard]] bool checkIfFileChanged(const std::string& rhiTarget, Renderer::VirtualFilename virtualFilename, uint32_t compilerVersion, CacheEntry& cacheEntry);
 
@@ -290,6 +331,49 @@ namespace RendererToolkit
 		*/
 		void storeOrUpdateCacheEntry(const CacheEntry& cacheEntry);
 
+		/**
+		*  @brief
+		*    Return the absolute UTF-8 filename of a compiled asset inside the shared cache
+		*
+		*  @param[in] sharedCacheKey
+		*    Content-addressed shared cache key of the compiled asset
+		*
+		*  @return
+		*    The absolute UTF-8 filename, the subdirectory is named after the first key byte to keep directories small
+		*/
+		[[nodiscard]] std::string getSharedCacheFilename(uint64_t sharedCacheKey) const;
+
+		/**
+		*  @brief
+		*    Fetch a compiled asset from the shared cache
+		*
+		*  @param[in] sharedCacheKey
+		*    Content-addressed shared cache key of the compiled asset
+		*  @param[in] virtualDestinationFilename
+		*    The virtual UTF-8 filename to write the compiled asset to
+		*
+		*  @return
+		*    "true" if the compiled asset was fetched, else "false" (not in the shared cache or the shared cache entry is corrupt)
+		*
+		*  @note
+		*    - Doesn't require the caller to hold the lock
+		*/
+		[[nodiscard]] bool fetchFromSharedCache(uint64_t sharedCacheKey, const std::string& virtualDestinationFilename) const;
+
+		/**
+		*  @brief
+		*    Store a compiled asset inside the shared cache
+		*
+		*  @param[in] sharedCacheKey
+		*    Content-addressed shared cache key of the compiled asset
+		*  @param[in] virtualDestinationFilename
+		*    The virtual UTF-8 filename of the compiled asset
+		*
+		*  @note
+		*    - Doesn't require the caller to hold the lock
+		*/
+		void storeInSharedCache(uint64_t sharedCacheKey, const std::string& virtualDestinationFilename) const;
+
 		CacheManager(const CacheManager&) = delete;
 		CacheManager& operator=(const CacheManager&) = delete;
 
@@ -313,9 +397,13 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	private:
 		const Context&	   mContext;
-		const std::string  mProjectName;	///< UTF-8 name of the project this cache is for
+		const std::string  mProjectName;				///< UTF-8 name of the project this cache is for
+		const uint64_t	   mCompilerOptionsHash;		///< 64-bit FNV-1a hash of the project wide compiler options, part of the shared cache key
+		std::mutex		   mMutex;						///< Guards the cache manager data, private methods expect the caller to hold the lock unless stated otherwise
 		StoredCacheEntries mStoredCacheEntries;
 		bool			   mDiskCacheDirty;
+		std::string		   mSharedCacheDirectory;		///< Absolute UTF-8 name of the shared cache directory, empty if no shared cache is used, only changed while no compilation is running
+		uint64_t		   mSharedCacheMaximumSize;		///< Maximum size of the shared cache in bytes, "0" for no limit
 
 		// We use here "uint32_t" instead of "Renderer::StringId" because we don't define a "std::hash"-method for "Renderer::StringId", which internal stores an "uint32_t"
 		CheckedFilesStatus mCheckedFilesStatus;	///< Holds the status of each file checked via "RendererToolkit::CacheManager::checkIfFileChanged()"
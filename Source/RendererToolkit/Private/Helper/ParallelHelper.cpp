@@ -0,0 +1,288 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RendererToolkit/Private/Helper/ParallelHelper.h"
+
+#include <Renderer/Public/Core/Platform/PlatformManager.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::atomic_flag': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::atomic_flag': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::atomic_flag': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+	#include <deque>
+	#include <atomic>
+	#include <thread>
+	#include <vector>
+	#include <algorithm>
+	#include <exception>
+	#include <condition_variable>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct Job final
+		{
+			const std::function<void(uint32_t)>* function;
+			uint32_t							 numberOfItems;
+			std::atomic<uint32_t>				 nextItem;
+			std::mutex							 mutex;						///< Guards the number of running helpers and the exception
+			std::condition_variable				 helpersDoneCondition;
+			uint32_t							 numberOfRunningHelpers;
+			std::exception_ptr					 exception;					///< First exception thrown by a work item
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		static std::mutex				g_Mutex;						///< Guards the helper threads and the pending jobs
+		static std::condition_variable	g_PendingJobCondition;
+		static std::deque<Job*>			g_PendingJobs;					///< One entry per requested helper thread, the jobs don't own the memory
+		static std::vector<std::thread>	g_HelperThreads;
+		static uint32_t					g_ReferenceCounter = 0;
+		static bool						g_ShutdownHelperThreads = false;
+		static std::atomic<uint32_t>	g_NumberOfBusyThreads = 0;		///< Number of busy asset compiler worker threads and helper threads, the processor budget
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] uint32_t getNumberOfProcessors()
+		{
+			// "std::thread::hardware_concurrency()" might return zero if the value is not computable
+			return std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		[[nodiscard]] uint32_t acquireThreads(uint32_t numberOfRequestedThreads)
+		{
+			const uint32_t numberOfProcessors = getNumberOfProcessors();
+			uint32_t numberOfBusyThreads = g_NumberOfBusyThreads.load();
+			for (;;)
+			{
+				const uint32_t numberOfIdleProcessors = (numberOfProcessors > numberOfBusyThreads) ? (numberOfProcessors - numberOfBusyThreads) : 0;
+				const uint32_t numberOfThreads = std::min(numberOfRequestedThreads, numberOfIdleProcessors);
+				if (0 == numberOfThreads || g_NumberOfBusyThreads.compare_exchange_weak(numberOfBusyThreads, numberOfBusyThreads + numberOfThreads))
+				{
+					return numberOfThreads;
+				}
+			}
+		}
+
+		void processItems(Job& job)
+		{
+			for (uint32_t item = job.nextItem++; item < job.numberOfItems; item = job.nextItem++)
+			{
+				try
+				{
+					(*job.function)(item);
+				}
+				catch (...)
+				{
+					const std::lock_guard<std::mutex> mutexLock(job.mutex);
+					if (nullptr == job.exception)
+					{
+						job.exception = std::current_exception();
+					}
+				}
+			}
+		}
+
+		void helperThread()
+		{
+			Renderer::PlatformManager::setCurrentThreadName("Asset compiler helper", "Renderer toolkit: Asset compiler helper");
+			for (;;)
+			{
+				// Wait for a pending job
+				Job* job = nullptr;
+				{
+					std::unique_lock<std::mutex> mutexLock(g_Mutex);
+					g_PendingJobCondition.wait(mutexLock, []() { return (g_ShutdownHelperThreads || !g_PendingJobs.empty()); });
+					if (g_PendingJobs.empty())
+					{
+						break;
+					}
+					job = g_PendingJobs.front();
+					g_PendingJobs.pop_front();
+				}
+
+				// Help processing the work items
+				processItems(*job);
+				--g_NumberOfBusyThreads;
+
+				// Notify while holding the lock, the job is owned by the waiting thread and destroyed as soon as it wakes up
+				const std::lock_guard<std::mutex> mutexLock(job->mutex);
+				--job->numberOfRunningHelpers;
+				job->helpersDoneCondition.notify_one();
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public RendererToolkit::ParallelHelper::BusyThread methods ]
+	//[-------------------------------------------------------]
+	ParallelHelper::BusyThread::BusyThread()
+	{
+		++::detail::g_NumberOfBusyThreads;
+	}
+
+	ParallelHelper::BusyThread::~BusyThread()
+	{
+		--::detail::g_NumberOfBusyThreads;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public RendererToolkit::ParallelHelper::ReservedThreads methods ]
+	//[-------------------------------------------------------]
+	ParallelHelper::ReservedThreads::ReservedThreads(uint32_t numberOfRequestedThreads) :
+		mNumberOfThreads(::detail::acquireThreads(numberOfRequestedThreads))
+	{
+		// Nothing here
+	}
+
+	ParallelHelper::ReservedThreads::~ReservedThreads()
+	{
+		::detail::g_NumberOfBusyThreads -= mNumberOfThreads;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void ParallelHelper::startup()
+	{
+		const std::lock_guard<std::mutex> mutexLock(::detail::g_Mutex);
+		if (0 == ::detail::g_ReferenceCounter++)
+		{
+			// The calling thread always takes part, so one helper thread less than there are processors is sufficient
+			::detail::g_ShutdownHelperThreads = false;
+			const uint32_t numberOfHelperThreads = ::detail::getNumberOfProcessors() - 1;
+			::detail::g_HelperThreads.reserve(numberOfHelperThreads);
+			for (uint32_t i = 0; i < numberOfHelperThreads; ++i)
+			{
+				::detail::g_HelperThreads.emplace_back(&::detail::helperThread);
+			}
+		}
+	}
+
+	void ParallelHelper::shutdown()
+	{
+		std::vector<std::thread> helperThreads;
+		{
+			const std::lock_guard<std::mutex> mutexLock(::detail::g_Mutex);
+			if (0 != --::detail::g_ReferenceCounter)
+			{
+				return;
+			}
+			::detail::g_ShutdownHelperThreads = true;
+			helperThreads.swap(::detail::g_HelperThreads);
+		}
+		::detail::g_PendingJobCondition.notify_all();
+		for (std::thread& thread : helperThreads)
+		{
+			thread.join();
+		}
+	}
+
+	uint32_t ParallelHelper::forEachInParallel(uint32_t numberOfItems, const std::function<void(uint32_t)>& function)
+	{
+		::detail::Job job;
+		job.function			   = &function;
+		job.numberOfItems		   = numberOfItems;
+		job.nextItem			   = 0;
+		job.numberOfRunningHelpers = 0;
+
+		// Request helper threads for the work items the calling thread can't process at the same time, limited by the idle processors
+		// -> The number of running helpers is only accessed under the job lock as soon as the job is pending
+		uint32_t numberOfHelpers = 0;
+		if (numberOfItems > 1)
+		{
+			const std::lock_guard<std::mutex> mutexLock(::detail::g_Mutex);
+			if (!::detail::g_HelperThreads.empty())
+			{
+				numberOfHelpers = ::detail::acquireThreads(std::min(numberOfItems - 1, static_cast<uint32_t>(::detail::g_HelperThreads.size())));
+				job.numberOfRunningHelpers = numberOfHelpers;
+				for (uint32_t i = 0; i < numberOfHelpers; ++i)
+				{
+					::detail::g_PendingJobs.push_back(&job);
+				}
+			}
+		}
+		if (numberOfHelpers > 0)
+		{
+			::detail::g_PendingJobCondition.notify_all();
+		}
+
+		// The calling thread processes work items as well, then waits for the helper threads
+		::detail::processItems(job);
+		{
+			std::unique_lock<std::mutex> mutexLock(job.mutex);
+			job.helpersDoneCondition.wait(mutexLock, [&job]() { return (0 == job.numberOfRunningHelpers); });
+		}
+		if (nullptr != job.exception)
+		{
+			std::rethrow_exception(job.exception);
+		}
+
+		// Done
+		return numberOfHelpers + 1;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
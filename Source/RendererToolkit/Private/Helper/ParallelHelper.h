@@ -0,0 +1,159 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/Public/Core/Platform/PlatformTypes.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Func_base<_Ret>': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Func_base<_Ret>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Func_base<_Ret>': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Func_base<_Ret>': move assignment operator was implicitly defined as deleted
+	#include <functional>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RendererToolkit
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Data parallel processing inside asset compilers
+	*
+	*  @remarks
+	*    The asset compiler worker threads already keep the processors busy when many assets are compiled. In order to not oversubscribe
+	*    the processors, all asset compilers share one set of persistent helper threads and one processor budget, which also counts the
+	*    busy asset compiler worker threads. As a result, a huge mesh or texture compiled at the end of a compilation run gets all idle
+	*    processors while asset compilations running concurrently use only their calling thread.
+	*
+	*  @note
+	*    - "Renderer::DefaultThreadPool" isn't used since it launches a new thread per task and isn't meant to be used by multiple threads at once
+	*/
+	class ParallelHelper final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Registers the calling thread as busy for the lifetime of the instance, used by the asset compiler worker threads while compiling an asset
+		*/
+		class BusyThread final
+		{
+		public:
+			BusyThread();
+			~BusyThread();
+			BusyThread(const BusyThread&) = delete;
+			BusyThread& operator=(const BusyThread&) = delete;
+		};
+
+		/**
+		*  @brief
+		*    Reserves idle processors of the processor budget for the lifetime of the instance, used for threads not owned by the parallel helper like the Crunch helper threads
+		*/
+		class ReservedThreads final
+		{
+		public:
+			explicit ReservedThreads(uint32_t numberOfRequestedThreads);
+			~ReservedThreads();
+			[[nodiscard]] inline uint32_t getNumberOfThreads() const
+			{
+				return mNumberOfThreads;
+			}
+			ReservedThreads(const ReservedThreads&) = delete;
+			ReservedThreads& operator=(const ReservedThreads&) = delete;
+		private:
+			uint32_t mNumberOfThreads;	///< Number of reserved threads, can be less than the number of requested threads
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Start the helper threads, reference counted
+		*/
+		static void startup();
+
+		/**
+		*  @brief
+		*    Stop the helper threads, reference counted
+		*/
+		static void shutdown();
+
+		/**
+		*  @brief
+		*    Process independent work items in parallel, the calling thread is always used as well
+		*
+		*  @param[in] numberOfItems
+		*    Number of work items
+		*  @param[in] function
+		*    Function to call for each work item index
+		*
+		*  @return
+		*    Number of used threads including the calling thread
+		*
+		*  @note
+		*    - Work items are fetched one after another as soon as a thread is done, so work items can have very different costs
+		*    - Each work item must only write its own data, so the result doesn't depend on the number of threads or on the processing order
+		*    - The first exception thrown by a work item is rethrown after all threads have finished
+		*    - Without started helper threads or without idle processors all work items are processed by the calling thread
+		*/
+		static uint32_t forEachInParallel(uint32_t numberOfItems, const std::function<void(uint32_t)>& function);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		ParallelHelper(const ParallelHelper&) = delete;
+		ParallelHelper& operator=(const ParallelHelper&) = delete;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RendererToolkit
@@ -107,6 +107,8 @@ namespace RendererToolkit
 	public:
 		virtual void load(Renderer::AbsoluteDirectoryName absoluteDirectoryName) = 0;
 		virtual void importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName, const std::string& targetDirectoryName = "Imported") = 0;
+		virtual void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads) = 0;	// "0" means one asset compiler worker thread per hardware thread
+		virtual void setSharedCacheDirectory(const std::string& absoluteDirectoryName, uint64_t maximumSizeInBytes = 0) = 0;	// Content-addressed compiled asset cache directory which can be shared by multiple machines, empty string means no shared cache, "0" means no size limit
 		virtual void compileAllAssets(const char* rhiTarget) = 0;
 		virtual void startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget) = 0;
 		virtual void shutdownAssetMonitor() = 0;
@@ -27,6 +27,7 @@
 #include "RendererToolkit/Private/Context.h"
 
 #include <Renderer/Public/IRenderer.h>
+#include <Renderer/Public/Core/File/FileSystemHelper.h>
 #include <Renderer/Public/Core/Platform/PlatformManager.h>
 
 #include <SimpleFileWatcher/FileWatcher.h>
@@ -68,52 +69,27 @@ namespace RendererToolkit
 			{
 				if (!mFileActions.empty())
 				{
-					// TODO(co) The current simple solution is not sufficient for large scale projects having ten thousands of assets: Add more efficient asset search which can handle asset dependencies as well
-					/*
-					const size_t numberOfFileActions = mFileActions.size();
-					for (size_t fileActionIndex = 0; fileActionIndex < numberOfFileActions; ++fileActionIndex)
-					{
-						const FileAction& fileAction = mFileActions[fileActionIndex];
-						*/
+					// Gather the absolute filenames of the modified files
+					IProject::AbsoluteFilenames absoluteFilenames;
+					absoluteFilenames.reserve(mFileActions.size());
+					for (const FileAction& fileAction : mFileActions)
 					{
-						// Get the corresponding asset
-						const Renderer::AssetPackage::SortedAssetVector& sortedAssetVector = mProjectAssetMonitor.mProjectImpl.getAssetPackage().getSortedAssetVector();
-						const size_t numberOfAssets = sortedAssetVector.size();
-						for (size_t i = 0; i < numberOfAssets; ++i)
-						{
-							const Renderer::Asset& asset = sortedAssetVector[i];
-							try
-							{
-								if (mProjectAssetMonitor.mProjectImpl.checkAssetIsChanged(asset, mProjectAssetMonitor.mRhiTarget.c_str()))
-								{
-									// TODO(co) Performance: Add asset compiler queue so we can compile more then one asset at a time in background
-									// TODO(co) At the moment, we only support modifying already existing asset data, we should add support for changes inside the asset package as well
-									Renderer::AssetPackage outputAssetPackage;
-									mProjectAssetMonitor.mProjectImpl.compileAssetIncludingDependencies(asset, mProjectAssetMonitor.mRhiTarget.c_str(), outputAssetPackage);
-
-									// Inform the asset manager about the modified assets (just pass them individually, there's no real benefit in trying to apply "were's one, there are many" in this situation)
-									const Renderer::AssetPackage::SortedAssetVector& sortedOutputAssetVector = outputAssetPackage.getSortedAssetVector();
-									const size_t numberOfOutputAssets = sortedOutputAssetVector.size();
-									for (size_t outputAssetIndex = 0; outputAssetIndex < numberOfOutputAssets; ++outputAssetIndex)
-									{
-										mProjectAssetMonitor.mRenderer.reloadResourceByAssetId(sortedOutputAssetVector[outputAssetIndex].assetId);
-									}
-
-									// A compilation run has been finished do cleanup
-									mProjectAssetMonitor.mProjectImpl.onCompilationRunFinished();
-									break;
-								}
-							}
-							catch (const std::exception& e)
-							{
-								RHI_LOG(mProjectAssetMonitor.mProjectImpl.getContext(), CRITICAL, e.what())
-							}
-
-							// A compilation run has been finished do cleanup
-							mProjectAssetMonitor.mProjectImpl.onCompilationRunFinished();
-						}
+						absoluteFilenames.push_back(fileAction.absoluteFilename);
 					}
 					mFileActions.clear();
+
+					// Compile exactly the assets affected by the modified files, resources are reloaded as soon as the corresponding asset has been compiled
+					try
+					{
+						mProjectAssetMonitor.mProjectImpl.compileAssetsBySourceFiles(absoluteFilenames, mProjectAssetMonitor.mRhiTarget.c_str());
+					}
+					catch (const std::exception& e)
+					{
+						RHI_LOG(mProjectAssetMonitor.mProjectImpl.getContext(), CRITICAL, e.what())
+					}
+
+					// A compilation run has been finished do cleanup
+					mProjectAssetMonitor.mProjectImpl.onCompilationRunFinished();
 				}
 			}
 
@@ -122,22 +98,24 @@ namespace RendererToolkit
 		//[ Public virtual FW::FileWatchListener methods          ]
 		//[-------------------------------------------------------]
 		public:
-			void handleFileAction(FW::WatchID, const FW::String&, const FW::String& filename, FW::Action action) override
+			void handleFileAction(FW::WatchID, const FW::String& directory, const FW::String& filename, FW::Action action) override
 			{
 				if (FW::Action::Modified == action)
 				{
+					const std::string absoluteFilename = (std_filesystem::path(directory) / filename).generic_string();
+
 					// Sadly, we can and will get multiple modified events for one and the same modification, so we need to handle it in here
 					const size_t numberOfFileActions = mFileActions.size();
 					for (size_t fileActionIndex = 0; fileActionIndex < numberOfFileActions; ++fileActionIndex)
 					{
 						const FileAction& fileAction = mFileActions[fileActionIndex];
-						if (fileAction.action == action && fileAction.filename == filename)
+						if (fileAction.action == action && fileAction.absoluteFilename == absoluteFilename)
 						{
 							// No duplicates, please
 							return;
 						}
 					}
-					mFileActions.push_back(FileAction(filename, action));
+					mFileActions.push_back(FileAction(absoluteFilename, action));
 				}
 			}
 
@@ -148,10 +126,10 @@ namespace RendererToolkit
 		private:
 			struct FileAction final
 			{
-				FW::String filename;
-				FW::Action action;
-				FileAction(const FW::String& _filename, FW::Action _action) :
-					filename(_filename),
+				std::string absoluteFilename;	///< UTF-8 absolute filename
+				FW::Action  action;
+				FileAction(const std::string& _absoluteFilename, FW::Action _action) :
+					absoluteFilename(_absoluteFilename),
 					action(_action)
 				{
 					// Nothing here
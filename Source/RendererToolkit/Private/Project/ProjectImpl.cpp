@@ -26,6 +26,7 @@
 #include "RendererToolkit/Private/Helper/JsonHelper.h"
 #include "RendererToolkit/Private/Helper/StringHelper.h"
 #include "RendererToolkit/Private/Helper/CacheManager.h"
+#include "RendererToolkit/Private/Helper/ParallelHelper.h"
 #include "RendererToolkit/Private/AssetImporter/SketchfabAssetImporter.h"
 #include "RendererToolkit/Private/AssetCompiler/MeshAssetCompiler.h"
 #include "RendererToolkit/Private/AssetCompiler/SceneAssetCompiler.h"
@@ -115,7 +116,81 @@ namespace
 			}
 		}
 
-		void outputAsset(const Renderer::IFileManager& fileManager, const std::string& assetIdAsString, const std::string& virtualOutputAssetFilename, Renderer::AssetPackage& outputAssetPackage)
+		void gatherVirtualInputFilenames(const rapidjson::Value& rapidJsonValue, const std::string& virtualAssetInputDirectory, std::vector<std::string>& virtualFilenames)
+		{
+			// Input files are relative to the asset and start with "./", see "RendererToolkit::JsonHelper::getAssetFile()"
+			if (rapidJsonValue.IsString())
+			{
+				const std::string_view valueAsString(rapidJsonValue.GetString(), rapidJsonValue.GetStringLength());
+				if (valueAsString.length() > 2 && valueAsString.substr(0, 2) == "./")
+				{
+					virtualFilenames.push_back(Renderer::FileSystemHelper::lexicallyNormal(virtualAssetInputDirectory + '/' + std::string(valueAsString.substr(2))).generic_string());
+				}
+			}
+			else if (rapidJsonValue.IsObject())
+			{
+				for (rapidjson::Value::ConstMemberIterator rapidJsonMemberIterator = rapidJsonValue.MemberBegin(); rapidJsonMemberIterator != rapidJsonValue.MemberEnd(); ++rapidJsonMemberIterator)
+				{
+					gatherVirtualInputFilenames(rapidJsonMemberIterator->value, virtualAssetInputDirectory, virtualFilenames);
+				}
+			}
+			else if (rapidJsonValue.IsArray())
+			{
+				for (rapidjson::SizeType i = 0; i < rapidJsonValue.Size(); ++i)
+				{
+					gatherVirtualInputFilenames(rapidJsonValue[i], virtualAssetInputDirectory, virtualFilenames);
+				}
+			}
+		}
+
+		void createAssetCompilers(const RendererToolkit::Context& context, std::unordered_map<uint32_t, RendererToolkit::IAssetCompiler*>& assetCompilerByClassId)
+		{
+			// TODO(co) Currently this is fixed build in, later on me might want to have this dynamic so we can plugin additional asset compilers
+			assetCompilerByClassId.emplace(RendererToolkit::TextureAssetCompiler::CLASS_ID, new RendererToolkit::TextureAssetCompiler(context));
+			assetCompilerByClassId.emplace(RendererToolkit::ShaderPieceAssetCompiler::CLASS_ID, new RendererToolkit::ShaderPieceAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::ShaderBlueprintAssetCompiler::CLASS_ID, new RendererToolkit::ShaderBlueprintAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::MaterialBlueprintAssetCompiler::CLASS_ID, new RendererToolkit::MaterialBlueprintAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::MaterialAssetCompiler::CLASS_ID, new RendererToolkit::MaterialAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::SkeletonAssetCompiler::CLASS_ID, new RendererToolkit::SkeletonAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::SkeletonAnimationAssetCompiler::CLASS_ID, new RendererToolkit::SkeletonAnimationAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::MeshAssetCompiler::CLASS_ID, new RendererToolkit::MeshAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::SceneAssetCompiler::CLASS_ID, new RendererToolkit::SceneAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::CompositorNodeAssetCompiler::CLASS_ID, new RendererToolkit::CompositorNodeAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::CompositorWorkspaceAssetCompiler::CLASS_ID, new RendererToolkit::CompositorWorkspaceAssetCompiler());
+			assetCompilerByClassId.emplace(RendererToolkit::VertexAttributesAssetCompiler::CLASS_ID, new RendererToolkit::VertexAttributesAssetCompiler());
+		}
+
+		void destroyAssetCompilers(std::unordered_map<uint32_t, RendererToolkit::IAssetCompiler*>& assetCompilerByClassId)
+		{
+			for (const auto& pair : assetCompilerByClassId)
+			{
+				delete pair.second;
+			}
+			assetCompilerByClassId.clear();
+		}
+
+		void loadCompiledAssetPackage(const Renderer::IFileManager& fileManager, const std::string& virtualAssetPackageFilename, Renderer::AssetPackage::SortedAssetVector& sortedAssetVector)
+		{
+			// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
+			Renderer::MemoryFile memoryFile;
+			if (fileManager.doesFileExist(virtualAssetPackageFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(Renderer::v1AssetPackage::FORMAT_TYPE, Renderer::v1AssetPackage::FORMAT_VERSION, fileManager, virtualAssetPackageFilename.c_str()))
+			{
+				memoryFile.decompress();
+
+				// Read in the asset package header
+				Renderer::v1AssetPackage::AssetPackageHeader assetPackageHeader;
+				memoryFile.read(&assetPackageHeader, sizeof(Renderer::v1AssetPackage::AssetPackageHeader));
+
+				// Sanity check
+				ASSERT(assetPackageHeader.numberOfAssets > 0, "Invalid empty asset package detected")
+
+				// Read in the asset package content in one single burst
+				sortedAssetVector.resize(assetPackageHeader.numberOfAssets);
+				memoryFile.read(sortedAssetVector.data(), sizeof(Renderer::Asset) * assetPackageHeader.numberOfAssets);
+			}
+		}
+
+		void outputAsset(const std::string& assetIdAsString, const std::string& virtualOutputAssetFilename, uint64_t fileHash, Renderer::AssetPackage& outputAssetPackage)
 		{
 			// Sanity check
 			const std::string virtualFilename = assetIdAsString + std_filesystem::path(virtualOutputAssetFilename).extension().generic_string();
@@ -127,7 +202,7 @@ namespace
 			// Append or update asset
 			Renderer::Asset outputAsset;
 			outputAsset.assetId = Renderer::AssetId(assetIdAsString.c_str());
-			outputAsset.fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualOutputAssetFilename.c_str());
+			outputAsset.fileHash = fileHash;
 			Renderer::Asset* asset = outputAssetPackage.tryGetWritableAssetByAssetId(outputAsset.assetId);
 			if (nullptr != asset)
 			{
@@ -158,6 +233,32 @@ namespace RendererToolkit
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	struct ProjectImpl::CompilerJob final
+	{
+		// Prepared by the thread dispatching the compiler jobs
+		const Renderer::Asset*	  asset						  = nullptr;
+		const char*				  rhiTarget					  = nullptr;
+		rapidjson::Document		  rapidJsonDocument{rapidjson::kObjectType};
+		const rapidjson::Value*	  rapidJsonValueTargets		  = nullptr;
+		AssetCompilerClassId	  assetCompilerClassId;
+		std::string				  virtualAssetPackageInputDirectory;	///< Without "/" at the end
+		std::string				  virtualAssetInputDirectory;	///< Without "/" at the end
+		std::string				  virtualAssetOutputDirectory;	///< Without "/" at the end
+		std::string				  assetIdAsString;
+		std::vector<std::string>  virtualDependencyFilenames;
+		std::vector<CompilerJob*> dependentCompilerJobs;		///< Compiler jobs which must wait until this compiler job has been finished
+		uint32_t				  numberOfPendingDependencies = 0;	///< Number of not yet finished compiler jobs this compiler job depends on
+		// Filled by the asset compiler worker thread
+		bool					  succeeded					  = false;
+		std::string				  virtualOutputAssetFilename;
+		uint64_t				  fileHash					  = 0;	///< 64-bit FNV-1a hash of the compiled asset file
+		std::string				  errorMessage;
+	};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -167,30 +268,32 @@ namespace RendererToolkit
 		mQualityStrategy(QualityStrategy::PRODUCTION),
 		mRapidJsonDocument(nullptr),
 		mProjectAssetMonitor(nullptr),
-		mShutdownThread(false),
-		mCacheManager(nullptr)
+		mCacheManager(nullptr),
+		mSharedCacheMaximumSize(0),
+		mNumberOfCompilerThreads(0),
+		mShutdownCompilerWorkerThreads(false)
 	{
-		// Nothing here
+		// Start the helper threads used for data parallel processing inside asset compilers
+		ParallelHelper::startup();
 	}
 
 	ProjectImpl::~ProjectImpl()
 	{
 		if (isInitialized())
 		{
-			// Shutdown worker thread
-			mShutdownThread = true;
-			mThread.join();
+			// Shutdown asset compiler worker threads
+			shutdownCompilerWorkerThreads();
 
 			// Clear
 			clear();
-			for (const auto& pair : mAssetCompilerByClassId)
-			{
-				delete pair.second;
-			}
+			::detail::destroyAssetCompilers(mAssetCompilerByClassId);
 
 			// Destroy the cache manager
 			delete mCacheManager;
 		}
+
+		// Stop the helper threads used for data parallel processing inside asset compilers
+		ParallelHelper::shutdown();
 	}
 
 	Renderer::VirtualFilename ProjectImpl::tryGetVirtualFilenameByAssetId(Renderer::AssetId assetId) const
@@ -211,15 +314,13 @@ namespace RendererToolkit
 			rapidjson::Document rapidJsonDocument(rapidjson::kObjectType);
 			const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(virtualAssetFilename, rapidJsonDocument);
 
-			// Dispatch asset compiler
-			// TODO(co) Add multithreading support: Add compiler queue which is processed in the background, ensure compiler instances are reused
-
 			// Get the asset input directory and asset output directory
-			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + mAssetPackageDirectoryName;
+			const std::string& assetPackageDirectoryName = mAssetPackageDirectoryNames[getAssetPackageIndexBySourceAssetId(asset.assetId)];
+			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + assetPackageDirectoryName;
 			const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
 			const std::string assetDirectory = virtualAssetInputDirectory.substr(virtualAssetInputDirectory.find('/') + 1);
 			const std::string renderTargetDataRootDirectory = getRenderTargetDataRootDirectory(rhiTarget);
-			const std::string virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + assetDirectory;
+			const std::string virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + assetPackageDirectoryName + '/' + assetDirectory;
 
 			// Do we need to mount a directory now? (e.g. "DataPc", "DataMobile" etc.)
 			Renderer::IFileManager& fileManager = mContext.getFileManager();
@@ -260,15 +361,13 @@ namespace RendererToolkit
 			rapidjson::Document rapidJsonDocument(rapidjson::kObjectType);
 			const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(virtualAssetFilename, rapidJsonDocument);
 
-			// Dispatch asset compiler
-			// TODO(co) Add multithreading support: Add compiler queue which is processed in the background, ensure compiler instances are reused
-
 			// Get the asset input directory and asset output directory
-			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + mAssetPackageDirectoryName;
+			const std::string& assetPackageDirectoryName = mAssetPackageDirectoryNames[getAssetPackageIndexBySourceAssetId(asset.assetId)];
+			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + assetPackageDirectoryName;
 			const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
 			const std::string assetDirectory = virtualAssetInputDirectory.substr(virtualAssetInputDirectory.find('/') + 1);
 			const std::string renderTargetDataRootDirectory = getRenderTargetDataRootDirectory(rhiTarget);
-			const std::string virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + assetDirectory;
+			const std::string virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + assetPackageDirectoryName + '/' + assetDirectory;
 
 			// Ensure that the asset output directory exists, else creating output file streams will fail
 			Renderer::IFileManager& fileManager = mContext.getFileManager();
@@ -294,7 +393,8 @@ namespace RendererToolkit
 			{ // Update the output asset package
 				const std::string assetName = std_filesystem::path(input.virtualAssetFilename).stem().generic_string();
 				const std::string assetIdAsString = input.projectName + '/' + assetDirectory + '/' + assetName;
-				::detail::outputAsset(input.context.getFileManager(), assetIdAsString, assetCompiler->getVirtualOutputAssetFilename(input, configuration), outputAssetPackage);
+				const std::string virtualOutputAssetFilename = assetCompiler->getVirtualOutputAssetFilename(input, configuration);
+				::detail::outputAsset(assetIdAsString, virtualOutputAssetFilename, Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, virtualOutputAssetFilename.c_str()), outputAssetPackage);
 			}
 		}
 		catch (const std::exception& e)
@@ -306,22 +406,76 @@ namespace RendererToolkit
 		mCacheManager->saveCache();
 	}
 
-	void ProjectImpl::compileAssetIncludingDependencies(const Renderer::Asset& asset, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage) noexcept
+	void ProjectImpl::compileAssetsBySourceFiles(const AbsoluteFilenames& absoluteFilenames, const char* rhiTarget)
 	{
-		// Compile the given asset
-		compileAsset(asset, rhiTarget, outputAssetPackage);
+		// Build the reverse source file index, if necessary
+		if (mSourceAssetIdToSourceFileIds.empty())
+		{
+			buildSourceFileIndex(rhiTarget);
+		}
 
-		// Compile other assets depending on the given asset, if necessary
-		const Renderer::AssetPackage::SortedAssetVector& sortedAssetVector = mAssetPackage.getSortedAssetVector();
-		const size_t numberOfAssets = sortedAssetVector.size();
-		for (size_t i = 0; i < numberOfAssets; ++i)
+		// Absolute filenames to source file IDs, the project directory is mounted using the project name
+		std::vector<uint32_t> sourceFileIds;
+		const std::string absoluteProjectDirectory = Renderer::FileSystemHelper::lexicallyNormal(mAbsoluteProjectDirectory).generic_string() + '/';
+		for (const std::string& absoluteFilename : absoluteFilenames)
 		{
-			const Renderer::Asset& dependedAsset = sortedAssetVector[i];
-			if (checkAssetIsChanged(dependedAsset, rhiTarget) && &dependedAsset != &asset)
+			const std::string normalizedAbsoluteFilename = Renderer::FileSystemHelper::lexicallyNormal(absoluteFilename).generic_string();
+			if (normalizedAbsoluteFilename.compare(0, absoluteProjectDirectory.length(), absoluteProjectDirectory) == 0)
 			{
-				compileAsset(dependedAsset, rhiTarget, outputAssetPackage);
+				sourceFileIds.push_back(Renderer::StringId::calculateFNV((mProjectName + '/' + normalizedAbsoluteFilename.substr(absoluteProjectDirectory.length())).c_str()));
 			}
 		}
+
+		// Gather the affected source assets: Assets using one of the source files as well as, transitively, all assets depending on an affected asset
+		std::unordered_set<uint32_t> affectedAssetIds;
+		while (!sourceFileIds.empty())
+		{
+			const uint32_t sourceFileId = sourceFileIds.back();
+			sourceFileIds.pop_back();
+			SourceFileIdToSourceAssetIds::const_iterator iterator = mSourceFileIdToSourceAssetIds.find(sourceFileId);
+			if (mSourceFileIdToSourceAssetIds.cend() != iterator)
+			{
+				for (const uint32_t sourceAssetId : iterator->second)
+				{
+					if (affectedAssetIds.insert(sourceAssetId).second)
+					{
+						const Renderer::Asset* asset = mAssetPackage.tryGetAssetByAssetId(sourceAssetId);
+						if (nullptr != asset)
+						{
+							sourceFileIds.push_back(Renderer::StringId::calculateFNV(asset->virtualFilename));
+						}
+					}
+				}
+			}
+		}
+		if (affectedAssetIds.empty())
+		{
+			// Nothing to do
+			return;
+		}
+
+		// Collect the affected assets in asset package order, the asset compilers are still skipping assets which are up-to-date
+		std::vector<const Renderer::Asset*> assets;
+		std::vector<Renderer::AssetId> changedAssetIds;
+		for (const Renderer::Asset& asset : mAssetPackage.getSortedAssetVector())
+		{
+			if (affectedAssetIds.find(asset.assetId) != affectedAssetIds.cend())
+			{
+				assets.push_back(&asset);
+				changedAssetIds.push_back(asset.assetId);
+
+				// The modified source files might have changed the source files used by the asset (e.g. a new shader piece include)
+				updateSourceFileIndex(asset, rhiTarget);
+			}
+		}
+		RHI_LOG(mContext, INFORMATION, "Found %u assets affected by %u modified files", assets.size(), absoluteFilenames.size())
+
+		// Compile the affected assets and update the already compiled asset packages containing them
+		// TODO(co) At the moment, we only support modifying already existing asset data, we should add support for adding and removing assets as well
+		Renderer::AssetPackage outputAssetPackage;
+		compileAssetsParallel(assets, changedAssetIds, rhiTarget, outputAssetPackage);
+		std::vector<Renderer::AssetPackage::SortedAssetVector> compiledAssetPackages(mAssetPackageDirectoryNames.size());
+		writeCompiledAssetPackages(rhiTarget, outputAssetPackage, compiledAssetPackages, false);
 	}
 
 	void ProjectImpl::onCompilationRunFinished()
@@ -372,15 +526,13 @@ namespace RendererToolkit
 		{ // Read project data
 			RHI_LOG(mContext, INFORMATION, "Gather asset from %s...", mAbsoluteProjectDirectory.c_str())
 			{ // Asset packages
+				// -> Large projects can be split into multiple asset packages (e.g. per level or downloadable content), each asset package gets its own compiled asset package
 				const rapidjson::Value& rapidJsonValueAssetPackages = rapidJsonValueProject["AssetPackages"];
-				if (rapidJsonValueAssetPackages.Size() > 1)
-				{
-					throw std::runtime_error("TODO(co) Support for multiple asset packages isn't implemented, yet");
-				}
 				for (rapidjson::SizeType i = 0; i < rapidJsonValueAssetPackages.Size(); ++i)
 				{
 					readAssetPackageByDirectory(std::string(rapidJsonValueAssetPackages[i].GetString()));
 				}
+				buildSourceAssetIdToCompiledAssetId();
 			}
 			readTargetsByFilename(rapidJsonValueProject["TargetsFilename"].GetString());
 			::detail::optionalQualityStrategy(rapidJsonValueProject, "QualityStrategy", mQualityStrategy);
@@ -388,7 +540,11 @@ namespace RendererToolkit
 		}
 
 		// Setup project folder for cache manager, it will store there its data
-		mCacheManager = new CacheManager(mContext, mProjectName);
+		// -> The project wide compiler options are part of the content-addressed shared cache key
+		uint64_t compilerOptionsHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(fileManager, (mProjectName + '/' + rapidJsonValueProject["TargetsFilename"].GetString()).c_str());
+		compilerOptionsHash = Renderer::Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&mQualityStrategy), sizeof(QualityStrategy), compilerOptionsHash);
+		mCacheManager = new CacheManager(mContext, mProjectName, compilerOptionsHash);
+		mCacheManager->setSharedCache(mSharedCacheDirectory, mSharedCacheMaximumSize);
 
 		// The renderer toolkit is now considered to be idle
 		mRendererToolkitImpl.setState(IRendererToolkit::State::IDLE);
@@ -397,10 +553,11 @@ namespace RendererToolkit
 	void ProjectImpl::importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName, const std::string& targetDirectoryName)
 	{
 		// Sanity check
-		// TODO(co) Add support for multiple asset packages
-		if (mAssetPackageDirectoryName != targetAssetPackageName)
+		// -> All asset packages share the project mount point, new files are written into the last mounted asset package
+		// TODO(co) Add support for importing into any asset package
+		if (mAssetPackageDirectoryNames.empty() || mAssetPackageDirectoryNames.back() != targetAssetPackageName)
 		{
-			throw std::runtime_error("The asset import target asset package name must be \"" + mAssetPackageDirectoryName + '\"');
+			throw std::runtime_error("The asset import target asset package name must be \"" + (mAssetPackageDirectoryNames.empty() ? std::string() : mAssetPackageDirectoryNames.back()) + '\"');
 		}
 
 		// Import all assets
@@ -420,6 +577,26 @@ namespace RendererToolkit
 		RHI_LOG(mContext, INFORMATION, "Finished import of %u assets", numberOfSourceAssets)
 	}
 
+	void ProjectImpl::setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads)
+	{
+		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
+		{
+			// The asset compiler worker threads are started on demand with the new number of threads during the next compilation run
+			mNumberOfCompilerThreads = numberOfCompilerThreads;
+			shutdownCompilerWorkerThreads();
+		}
+	}
+
+	void ProjectImpl::setSharedCacheDirectory(const std::string& absoluteDirectoryName, uint64_t maximumSizeInBytes)
+	{
+		mSharedCacheDirectory = absoluteDirectoryName;
+		mSharedCacheMaximumSize = maximumSizeInBytes;
+		if (nullptr != mCacheManager)
+		{
+			mCacheManager->setSharedCache(mSharedCacheDirectory, mSharedCacheMaximumSize);
+		}
+	}
+
 	void ProjectImpl::compileAllAssets(const char* rhiTarget)
 	{
 		const Renderer::AssetPackage::SortedAssetVector& sortedAssetVector = mAssetPackage.getSortedAssetVector();
@@ -440,7 +617,6 @@ namespace RendererToolkit
 		RHI_LOG(mContext, INFORMATION, "Found %u changed assets", changedAssetIds.size())
 
 		// Do we need to mount a directory now? (e.g. "DataPc", "DataMobile" etc.)
-		const std::string virtualAssetPackageFilename = getRenderTargetDataRootDirectory(rhiTarget) + '/' + mProjectName + '/' + mAssetPackageDirectoryName + '/' + mAssetPackageDirectoryName + ".assets";
 		Renderer::IFileManager& fileManager = mContext.getFileManager();
 		{
 			const std::string renderTargetDataRootDirectory = getRenderTargetDataRootDirectory(rhiTarget);
@@ -450,149 +626,39 @@ namespace RendererToolkit
 			}
 		}
 
-		// Compile all changed assets, do also take the case into account that the output asset package file is missing
-		if (!changedAssetIds.empty() || !fileManager.doesFileExist(virtualAssetPackageFilename.c_str()))
+		// Try to load the already compiled asset packages to speed up the asset compilation
+		const uint32_t numberOfAssetPackages = static_cast<uint32_t>(mAssetPackageDirectoryNames.size());
+		std::vector<Renderer::AssetPackage::SortedAssetVector> compiledAssetPackages(numberOfAssetPackages);
+		for (uint32_t assetPackageIndex = 0; assetPackageIndex < numberOfAssetPackages; ++assetPackageIndex)
 		{
-			// Try to load an already compiled asset package to speed up the asset compilation
-			Renderer::AssetPackage outputAssetPackage;
-			{
-				// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
-				Renderer::MemoryFile memoryFile;
-				if (memoryFile.loadLz4CompressedDataByVirtualFilename(Renderer::v1AssetPackage::FORMAT_TYPE, Renderer::v1AssetPackage::FORMAT_VERSION, fileManager, virtualAssetPackageFilename.c_str()))
-				{
-					memoryFile.decompress();
-
-					// Read in the asset package header
-					Renderer::v1AssetPackage::AssetPackageHeader assetPackageHeader;
-					memoryFile.read(&assetPackageHeader, sizeof(Renderer::v1AssetPackage::AssetPackageHeader));
-
-					// Sanity check
-					ASSERT(assetPackageHeader.numberOfAssets > 0, "Invalid empty asset package detected")
-
-					// Read in the asset package content in one single burst
-					Renderer::AssetPackage::SortedAssetVector& sortedOutputAssetVector = outputAssetPackage.getWritableSortedAssetVector();
-					sortedOutputAssetVector.resize(assetPackageHeader.numberOfAssets);
-					memoryFile.read(sortedOutputAssetVector.data(), sizeof(Renderer::Asset) * assetPackageHeader.numberOfAssets);
-				}
-			}
-
-			// Compile all changed assets
-			if (outputAssetPackage.getSortedAssetVector().empty())
-			{
-				// Slow path: Failed to load an already existing compiled asset package, we need to build a complete one
-				outputAssetPackage.getWritableSortedAssetVector().reserve(numberOfAssets);
-				for (size_t i = 0; i < numberOfAssets; ++i)
-				{
-					// Reminder: Assets might not be fully compiled but just collect needed information
-					RHI_LOG(mContext, INFORMATION, "Compiling asset %u of %u", i + 1, numberOfAssets)
-					const Renderer::Asset& asset = sortedAssetVector[i];
-					compileAsset(asset, rhiTarget, outputAssetPackage);
-					if (nullptr != mProjectAssetMonitor)
-					{
-						// In case a shutdown was requested while we're compiling the changed assets, shutdown immediately
-						if (mProjectAssetMonitor->mShutdownThread)
-						{
-							break;
-						}
+			::detail::loadCompiledAssetPackage(fileManager, getVirtualAssetPackageFilename(rhiTarget, assetPackageIndex), compiledAssetPackages[assetPackageIndex]);
+		}
 
-						// Call "Renderer::IRenderer::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
-						const Renderer::AssetId sourceAssetId = asset.assetId;
-						if (std::find(changedAssetIds.cbegin(), changedAssetIds.cend(), sourceAssetId) != changedAssetIds.cend())
-						{
-							SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
-							if (iterator == mSourceAssetIdToCompiledAssetId.cend())
-							{
-								throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
-							}
-							mProjectAssetMonitor->mRenderer.reloadResourceByAssetId(iterator->second);
-						}
-					}
-				}
-			}
-			else
+		// Gather the assets to compile: Changed assets as well as all assets of asset packages without a previously compiled asset package
+		// -> Reminder: Assets might not be fully compiled but just collect needed information
+		std::vector<const Renderer::Asset*> assets;
+		assets.reserve(changedAssetIds.size());
+		for (size_t i = 0; i < numberOfAssets; ++i)
+		{
+			const Renderer::Asset& asset = sortedAssetVector[i];
+			// -> The changed asset IDs were gathered in asset order, so they're sorted
+			if (compiledAssetPackages[getAssetPackageIndexBySourceAssetId(asset.assetId)].empty() || std::binary_search(changedAssetIds.cbegin(), changedAssetIds.cend(), asset.assetId))
 			{
-				// Fast path: We were able to load a previously compiled asset package and now only have to care about the changed assets
-				const size_t numberOfChangedAssets = changedAssetIds.size();
-				for (size_t i = 0; i < numberOfChangedAssets; ++i)
-				{
-					const Renderer::AssetId sourceAssetId = changedAssetIds[i];
-					const Renderer::Asset* asset = mAssetPackage.tryGetAssetByAssetId(sourceAssetId);
-					if (nullptr == asset)
-					{
-						throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
-					}
-					RHI_LOG(mContext, INFORMATION, "Compiling asset %u of %u", i + 1, numberOfChangedAssets)
-					compileAsset(*asset, rhiTarget, outputAssetPackage);
-					if (nullptr != mProjectAssetMonitor)
-					{
-						// In case a shutdown was requested while we're compiling the changed assets, shutdown immediately
-						if (mProjectAssetMonitor->mShutdownThread)
-						{
-							break;
-						}
-
-						// Call "Renderer::IRenderer::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
-						SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
-						if (iterator == mSourceAssetIdToCompiledAssetId.cend())
-						{
-							throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
-						}
-						mProjectAssetMonitor->mRenderer.reloadResourceByAssetId(iterator->second);
-					}
-				}
+				assets.push_back(&asset);
 			}
+		}
 
-			{ // Write asset package
-				Renderer::AssetPackage::SortedAssetVector& sortedOutputAssetVector = outputAssetPackage.getWritableSortedAssetVector();
-				if (sortedOutputAssetVector.empty())
-				{
-					throw std::runtime_error("The asset package is empty");
-				}
-				Renderer::MemoryFile memoryFile(0, 4096);
-
-				// Ensure the asset package is sorted
-				std::sort(sortedOutputAssetVector.begin(), sortedOutputAssetVector.end(), ::detail::orderByAssetId);
-
-				// Sanity check: The output asset package must contain all of our source assets
-				std::vector<Renderer::AssetId> missingSourceAssetIds;
-				for (const auto& pair : mSourceAssetIdToCompiledAssetId)
-				{
-					if (nullptr == outputAssetPackage.tryGetAssetByAssetId(pair.second))	// Second = compiled asset ID
-					{
-						missingSourceAssetIds.push_back(pair.first);	// First = source asset ID
-					}
-				}
-				if (!missingSourceAssetIds.empty())
-				{
-					std::string assetString;
-					for (const Renderer::AssetId assetId : missingSourceAssetIds)
-					{
-						SourceAssetIdToVirtualFilename::const_iterator iterator = mSourceAssetIdToVirtualFilename.find(assetId);
-						if (mSourceAssetIdToVirtualFilename.cend() != iterator)
-						{
-							assetString += iterator->second + '\n';
-						}
-					}
-					throw std::runtime_error("The output asset package is missing assets: " + assetString);
-				}
-
-				{ // Write down the asset package header
-					Renderer::v1AssetPackage::AssetPackageHeader assetPackageHeader;
-					assetPackageHeader.numberOfAssets = static_cast<uint32_t>(sortedOutputAssetVector.size());
-					memoryFile.write(&assetPackageHeader, sizeof(Renderer::v1AssetPackage::AssetPackageHeader));
-				}
-
-				// Write down the asset package content in one single burst
-				memoryFile.write(sortedOutputAssetVector.data(), sizeof(Renderer::Asset) * sortedOutputAssetVector.size());
-
-				// Write LZ4 compressed output
-				if (!memoryFile.writeLz4CompressedDataByVirtualFilename(STRING_ID("AssetPackage"), Renderer::v1AssetPackage::FORMAT_VERSION, fileManager, virtualAssetPackageFilename.c_str()))
-				{
-					throw std::runtime_error("Failed to write LZ4 compressed output file \"" + virtualAssetPackageFilename + '\"');
-				}
-			}
+		// Compile the assets and write the asset packages containing changes
+		if (!assets.empty())
+		{
+			Renderer::AssetPackage outputAssetPackage;
+			compileAssetsParallel(assets, changedAssetIds, rhiTarget, outputAssetPackage);
+			writeCompiledAssetPackages(rhiTarget, outputAssetPackage, compiledAssetPackages, true);
 		}
 
+		// Keep the shared cache size within its limit, done once per full compilation run since enumerating a shared directory can be slow
+		mCacheManager->evictSharedCache();
+
 		// Compilation run finished clear internal caches/states
 		onCompilationRunFinished();
 	}
@@ -629,22 +695,9 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	void ProjectImpl::initialize()
 	{
-		mThread = std::thread(&ProjectImpl::threadWorker, this);
-
 		// Setup asset compilers map
-		// TODO(co) Currently this is fixed build in, later on me might want to have this dynamic so we can plugin additional asset compilers
-		mAssetCompilerByClassId.emplace(TextureAssetCompiler::CLASS_ID, new TextureAssetCompiler(mContext));
-		mAssetCompilerByClassId.emplace(ShaderPieceAssetCompiler::CLASS_ID, new ShaderPieceAssetCompiler());
-		mAssetCompilerByClassId.emplace(ShaderBlueprintAssetCompiler::CLASS_ID, new ShaderBlueprintAssetCompiler());
-		mAssetCompilerByClassId.emplace(MaterialBlueprintAssetCompiler::CLASS_ID, new MaterialBlueprintAssetCompiler());
-		mAssetCompilerByClassId.emplace(MaterialAssetCompiler::CLASS_ID, new MaterialAssetCompiler());
-		mAssetCompilerByClassId.emplace(SkeletonAssetCompiler::CLASS_ID, new SkeletonAssetCompiler());
-		mAssetCompilerByClassId.emplace(SkeletonAnimationAssetCompiler::CLASS_ID, new SkeletonAnimationAssetCompiler());
-		mAssetCompilerByClassId.emplace(MeshAssetCompiler::CLASS_ID, new MeshAssetCompiler());
-		mAssetCompilerByClassId.emplace(SceneAssetCompiler::CLASS_ID, new SceneAssetCompiler());
-		mAssetCompilerByClassId.emplace(CompositorNodeAssetCompiler::CLASS_ID, new CompositorNodeAssetCompiler());
-		mAssetCompilerByClassId.emplace(CompositorWorkspaceAssetCompiler::CLASS_ID, new CompositorWorkspaceAssetCompiler());
-		mAssetCompilerByClassId.emplace(VertexAttributesAssetCompiler::CLASS_ID, new VertexAttributesAssetCompiler());
+		// -> Used for change checks and single asset compilation, the asset compiler worker threads have their own asset compiler instances
+		::detail::createAssetCompilers(mContext, mAssetCompilerByClassId);
 		for (const auto& element : mAssetCompilerByClassId)
 		{
 			const std::string_view& filenameExtension = element.second->getOptionalUniqueAssetFilenameExtension();
@@ -673,10 +726,13 @@ namespace RendererToolkit
 		mQualityStrategy = QualityStrategy::PRODUCTION;
 		mAbsoluteProjectDirectory.clear();
 		mAssetPackage.clear();
-		mAssetPackageDirectoryName.clear();
+		mAssetPackageDirectoryNames.clear();
+		mSourceAssetIdToAssetPackageIndex.clear();
 		mSourceAssetIdToCompiledAssetId.clear();
 		mCompiledAssetIdToSourceAssetId.clear();
 		mSourceAssetIdToVirtualFilename.clear();
+		mSourceFileIdToSourceAssetIds.clear();
+		mSourceAssetIdToSourceFileIds.clear();
 		if (nullptr != mRapidJsonDocument)
 		{
 			delete mRapidJsonDocument;
@@ -687,16 +743,22 @@ namespace RendererToolkit
 	void ProjectImpl::readAssetPackageByDirectory(const std::string& directoryName)
 	{
 		// Get the asset package name
-		mAssetPackageDirectoryName = directoryName;
+		if (std::find(mAssetPackageDirectoryNames.cbegin(), mAssetPackageDirectoryNames.cend(), directoryName) != mAssetPackageDirectoryNames.cend())
+		{
+			throw std::runtime_error("The asset package \"" + directoryName + "\" is listed multiple times");
+		}
+		const uint32_t assetPackageIndex = static_cast<uint32_t>(mAssetPackageDirectoryNames.size());
+		mAssetPackageDirectoryNames.push_back(directoryName);
 
 		// Mount project read-only data source file system directory
 		Renderer::IFileManager& fileManager = mContext.getFileManager();
-		fileManager.mountDirectory((mAbsoluteProjectDirectory + '/' + mAssetPackageDirectoryName).c_str(), mProjectName.c_str());
+		fileManager.mountDirectory((mAbsoluteProjectDirectory + '/' + directoryName).c_str(), mProjectName.c_str());
 
 		// Discover assets, first pass: Look for explicit ".asset"-files
+		// -> All asset packages share the same asset ID namespace, so a source asset must not be part of multiple asset packages
 		Renderer::AssetPackage::SortedAssetVector& sortedAssetVector = mAssetPackage.getWritableSortedAssetVector();
 		std::vector<std::string> virtualFilenames;
-		fileManager.enumerateFiles((mProjectName + '/' + mAssetPackageDirectoryName).c_str(), Renderer::IFileManager::EnumerationMode::FILES, virtualFilenames);
+		fileManager.enumerateFiles((mProjectName + '/' + directoryName).c_str(), Renderer::IFileManager::EnumerationMode::FILES, virtualFilenames);
 		for (const std::string& virtualFilename : virtualFilenames)
 		{
 			if (StringHelper::isSourceAssetIdAsString(virtualFilename))
@@ -713,6 +775,10 @@ namespace RendererToolkit
 				asset.assetId = Renderer::StringId(virtualFilename.c_str());
 				Renderer::setInvalid(asset.fileHash);
 				strcpy(asset.virtualFilename, virtualFilename.c_str());
+				if (!mSourceAssetIdToAssetPackageIndex.emplace(asset.assetId, assetPackageIndex).second)
+				{
+					throw std::runtime_error("Asset \"" + virtualFilename + "\" is part of multiple asset packages");
+				}
 				sortedAssetVector.push_back(asset);
 			}
 		}
@@ -736,7 +802,12 @@ namespace RendererToolkit
 
 				// Does the source asset has an explicit ".asset"-file?
 				const Renderer::AssetId assetId = Renderer::StringId(virtualAssetFilename.c_str());
-				if (mAssetPackage.tryGetAssetByAssetId(assetId) == nullptr)
+				const SourceAssetIdToAssetPackageIndex::const_iterator assetPackageIndexIterator = mSourceAssetIdToAssetPackageIndex.find(assetId);
+				if (mSourceAssetIdToAssetPackageIndex.cend() != assetPackageIndexIterator && assetPackageIndexIterator->second != assetPackageIndex)
+				{
+					throw std::runtime_error("Asset \"" + virtualAssetFilename + "\" is part of multiple asset packages");
+				}
+				if (mSourceAssetIdToAssetPackageIndex.cend() == assetPackageIndexIterator)
 				{
 					// Automatically in-memory generated ".asset"-file
 
@@ -752,6 +823,7 @@ namespace RendererToolkit
 					asset.assetId = Renderer::StringId(virtualAssetFilename.c_str());	// Asset ID using the ".asset"-filename
 					Renderer::setInvalid(asset.fileHash);
 					strcpy(asset.virtualFilename, virtualFilename.c_str());						// Filename of source asset (e.g. "<name>.material_blueprint") and not the ".asset"-file
+					mSourceAssetIdToAssetPackageIndex.emplace(asset.assetId, assetPackageIndex);
 					sortedAssetVector.push_back(asset);
 				}
 			}
@@ -760,9 +832,6 @@ namespace RendererToolkit
 		{
 			std::sort(sortedAssetVector.begin(), sortedAssetVector.end(), ::detail::orderByAssetId);
 		}
-
-		// Build the source asset ID to compiled asset ID map
-		buildSourceAssetIdToCompiledAssetId();
 	}
 
 	void ProjectImpl::readTargetsByFilename(const std::string& relativeFilename)
@@ -811,6 +880,160 @@ namespace RendererToolkit
 		}
 	}
 
+	uint32_t ProjectImpl::getAssetPackageIndexBySourceAssetId(Renderer::AssetId sourceAssetId) const
+	{
+		const SourceAssetIdToAssetPackageIndex::const_iterator iterator = mSourceAssetIdToAssetPackageIndex.find(sourceAssetId);
+		if (mSourceAssetIdToAssetPackageIndex.cend() == iterator)
+		{
+			throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
+		}
+		return iterator->second;
+	}
+
+	std::string ProjectImpl::getVirtualAssetPackageFilename(const char* rhiTarget, uint32_t assetPackageIndex) const
+	{
+		const std::string& assetPackageDirectoryName = mAssetPackageDirectoryNames[assetPackageIndex];
+		return getRenderTargetDataRootDirectory(rhiTarget) + '/' + mProjectName + '/' + assetPackageDirectoryName + '/' + assetPackageDirectoryName + ".assets";
+	}
+
+	void ProjectImpl::writeCompiledAssetPackages(const char* rhiTarget, const Renderer::AssetPackage& outputAssetPackage, std::vector<Renderer::AssetPackage::SortedAssetVector>& compiledAssetPackages, bool completeAssetPackages)
+	{
+		// Sort the compiled assets into the asset packages of their source assets
+		const uint32_t numberOfAssetPackages = static_cast<uint32_t>(mAssetPackageDirectoryNames.size());
+		std::vector<std::vector<const Renderer::Asset*>> outputAssetsByAssetPackage(numberOfAssetPackages);
+		for (const Renderer::Asset& outputAsset : outputAssetPackage.getSortedAssetVector())
+		{
+			CompiledAssetIdToSourceAssetId::const_iterator iterator = mCompiledAssetIdToSourceAssetId.find(outputAsset.assetId);
+			if (mCompiledAssetIdToSourceAssetId.cend() == iterator)
+			{
+				throw std::runtime_error("The compiled asset \"" + std::string(outputAsset.virtualFilename) + "\" has no source asset");
+			}
+			outputAssetsByAssetPackage[getAssetPackageIndexBySourceAssetId(iterator->second)].push_back(&outputAsset);
+		}
+
+		// Update the compiled asset packages
+		Renderer::IFileManager& fileManager = mContext.getFileManager();
+		for (uint32_t assetPackageIndex = 0; assetPackageIndex < numberOfAssetPackages; ++assetPackageIndex)
+		{
+			// When compiling all assets, every asset package with a compiled asset package index has to be visited even if it received no compiled assets, else compiled assets whose source asset got deleted or moved into another asset package would never be pruned
+			const std::vector<const Renderer::Asset*>& outputAssets = outputAssetsByAssetPackage[assetPackageIndex];
+			if (outputAssets.empty() && !completeAssetPackages)
+			{
+				// Nothing to do in here, don't even touch the compiled asset package
+				continue;
+			}
+			const std::string virtualAssetPackageFilename = getVirtualAssetPackageFilename(rhiTarget, assetPackageIndex);
+			Renderer::AssetPackage::SortedAssetVector& sortedAssetVector = compiledAssetPackages[assetPackageIndex];
+			if (sortedAssetVector.empty())
+			{
+				::detail::loadCompiledAssetPackage(fileManager, virtualAssetPackageFilename, sortedAssetVector);
+				if (sortedAssetVector.empty())
+				{
+					if (outputAssets.empty())
+					{
+						// There's neither a compiled asset package index nor a compiled asset, nothing to update or prune
+						continue;
+					}
+					if (!completeAssetPackages)
+					{
+						// Don't write an incomplete compiled asset package, the next full compilation run will create it
+						RHI_LOG(mContext, WARNING, "The compiled asset package \"%s\" doesn't exist, skipping update", virtualAssetPackageFilename.c_str())
+						continue;
+					}
+				}
+			}
+
+			// Merge the compiled assets into the compiled asset package, only changed entries mark the compiled asset package as dirty
+			bool dirty = false;
+			const size_t previousNumberOfAssets = sortedAssetVector.size();
+			for (const Renderer::Asset* outputAsset : outputAssets)
+			{
+				Renderer::AssetPackage::SortedAssetVector::iterator iterator = std::lower_bound(sortedAssetVector.begin(), sortedAssetVector.begin() + static_cast<std::ptrdiff_t>(previousNumberOfAssets), *outputAsset, ::detail::orderByAssetId);
+				if (iterator != sortedAssetVector.begin() + static_cast<std::ptrdiff_t>(previousNumberOfAssets) && iterator->assetId == outputAsset->assetId)
+				{
+					if (iterator->fileHash != outputAsset->fileHash || strcmp(iterator->virtualFilename, outputAsset->virtualFilename) != 0)
+					{
+						*iterator = *outputAsset;
+						dirty = true;
+					}
+				}
+				else
+				{
+					sortedAssetVector.push_back(*outputAsset);
+					dirty = true;
+				}
+			}
+			if (completeAssetPackages)
+			{
+				// Remove compiled assets whose source asset no longer exists or moved into another asset package
+				const size_t numberOfAssets = sortedAssetVector.size();
+				sortedAssetVector.erase(std::remove_if(sortedAssetVector.begin(), sortedAssetVector.end(), [this, assetPackageIndex](const Renderer::Asset& asset)
+					{
+						CompiledAssetIdToSourceAssetId::const_iterator iterator = mCompiledAssetIdToSourceAssetId.find(asset.assetId);
+						return (mCompiledAssetIdToSourceAssetId.cend() == iterator || mSourceAssetIdToAssetPackageIndex.find(iterator->second)->second != assetPackageIndex);
+					}), sortedAssetVector.end());
+				dirty |= (sortedAssetVector.size() != numberOfAssets);
+			}
+			if (!dirty)
+			{
+				// The compiled assets are identical to the previously compiled ones, no need to write the compiled asset package
+				continue;
+			}
+			std::sort(sortedAssetVector.begin(), sortedAssetVector.end(), ::detail::orderByAssetId);
+
+			// Sanity check: The compiled asset package must contain all source assets of the asset package
+			if (completeAssetPackages)
+			{
+				std::string assetString;
+				for (const auto& pair : mSourceAssetIdToCompiledAssetId)
+				{
+					Renderer::Asset compiledAsset;
+					compiledAsset.assetId = pair.second;	// Second = compiled asset ID
+					if (mSourceAssetIdToAssetPackageIndex.find(pair.first)->second == assetPackageIndex && !std::binary_search(sortedAssetVector.cbegin(), sortedAssetVector.cend(), compiledAsset, ::detail::orderByAssetId))	// First = source asset ID
+					{
+						SourceAssetIdToVirtualFilename::const_iterator iterator = mSourceAssetIdToVirtualFilename.find(pair.first);
+						if (mSourceAssetIdToVirtualFilename.cend() != iterator)
+						{
+							assetString += iterator->second + '\n';
+						}
+					}
+				}
+				if (!assetString.empty())
+				{
+					throw std::runtime_error("The output asset package \"" + virtualAssetPackageFilename + "\" is missing assets: " + assetString);
+				}
+			}
+			if (sortedAssetVector.empty())
+			{
+				// All compiled assets have been pruned, empty asset packages are invalid so remove the compiled asset package
+				std::error_code errorCode;
+				std_filesystem::remove(fileManager.mapVirtualToAbsoluteFilename(Renderer::IFileManager::FileMode::WRITE, virtualAssetPackageFilename.c_str()), errorCode);
+				RHI_LOG(mContext, INFORMATION, "Removed the compiled asset package \"%s\" since it has no assets left", virtualAssetPackageFilename.c_str())
+				continue;
+			}
+
+			{ // Write asset package
+				Renderer::MemoryFile memoryFile(0, sizeof(Renderer::v1AssetPackage::AssetPackageHeader) + sizeof(Renderer::Asset) * sortedAssetVector.size());
+
+				{ // Write down the asset package header
+					Renderer::v1AssetPackage::AssetPackageHeader assetPackageHeader;
+					assetPackageHeader.numberOfAssets = static_cast<uint32_t>(sortedAssetVector.size());
+					memoryFile.write(&assetPackageHeader, sizeof(Renderer::v1AssetPackage::AssetPackageHeader));
+				}
+
+				// Write down the asset package content in one single burst
+				memoryFile.write(sortedAssetVector.data(), sizeof(Renderer::Asset) * sortedAssetVector.size());
+
+				// Write LZ4 compressed output
+				if (!memoryFile.writeLz4CompressedDataByVirtualFilename(Renderer::v1AssetPackage::FORMAT_TYPE, Renderer::v1AssetPackage::FORMAT_VERSION, fileManager, virtualAssetPackageFilename.c_str()))
+				{
+					throw std::runtime_error("Failed to write LZ4 compressed output file \"" + virtualAssetPackageFilename + '\"');
+				}
+			}
+			RHI_LOG(mContext, INFORMATION, "Wrote compiled asset package \"%s\" with %u assets", virtualAssetPackageFilename.c_str(), sortedAssetVector.size())
+		}
+	}
+
 	const IAssetCompiler* ProjectImpl::getSourceAssetCompilerAndRapidJsonDocument(const std::string& virtualAssetFilename, rapidjson::Document& rapidJsonDocument) const
 	{
 		const IAssetCompiler* assetCompiler = nullptr;
@@ -891,13 +1114,368 @@ namespace RendererToolkit
 		return assetCompiler;
 	}
 
-	void ProjectImpl::threadWorker()
+	void ProjectImpl::buildSourceFileIndex(const char* rhiTarget)
+	{
+		mSourceFileIdToSourceAssetIds.clear();
+		mSourceAssetIdToSourceFileIds.clear();
+		for (const Renderer::Asset& asset : mAssetPackage.getSortedAssetVector())
+		{
+			updateSourceFileIndex(asset, rhiTarget);
+		}
+	}
+
+	void ProjectImpl::updateSourceFileIndex(const Renderer::Asset& asset, const char* rhiTarget)
+	{
+		// Forget the previously gathered source files of the asset
+		std::vector<uint32_t>& sourceFileIds = mSourceAssetIdToSourceFileIds[asset.assetId];
+		for (const uint32_t sourceFileId : sourceFileIds)
+		{
+			SourceFileIdToSourceAssetIds::iterator iterator = mSourceFileIdToSourceAssetIds.find(sourceFileId);
+			if (mSourceFileIdToSourceAssetIds.end() != iterator)
+			{
+				iterator->second.erase(asset.assetId);
+			}
+		}
+		sourceFileIds.clear();
+
+		// Gather the virtual filenames of the source files used by the asset: The asset itself, the input files referenced by the asset compiler configuration and the source assets the asset depends on
+		// -> The asset itself is always known, even if the asset is currently broken
+		const std::string virtualAssetFilename = asset.virtualFilename;
+		std::vector<std::string> virtualFilenames;
+		virtualFilenames.push_back(virtualAssetFilename);
+		try
+		{
+			rapidjson::Document rapidJsonDocument(rapidjson::kObjectType);
+			const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(virtualAssetFilename, rapidJsonDocument);
+			RHI_ASSERT(getContext(), nullptr != assetCompiler, "Invalid asset compiler")
+			RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
+			const std::string& assetPackageDirectoryName = mAssetPackageDirectoryNames[getAssetPackageIndexBySourceAssetId(asset.assetId)];
+			const std::string virtualAssetPackageInputDirectory = mProjectName + '/' + assetPackageDirectoryName;
+			const std::string virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
+			const std::string assetDirectory = virtualAssetInputDirectory.substr(virtualAssetInputDirectory.find('/') + 1);
+			const std::string virtualAssetOutputDirectory = getRenderTargetDataRootDirectory(rhiTarget) + '/' + mProjectName + '/' + assetPackageDirectoryName + '/' + assetDirectory;
+			::detail::gatherVirtualInputFilenames(rapidJsonDocument["Asset"]["Compiler"], virtualAssetInputDirectory, virtualFilenames);
+			const IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+			const IAssetCompiler::Configuration configuration(rapidJsonDocument, (*mRapidJsonDocument)["Targets"], rhiTarget, mQualityStrategy);
+			assetCompiler->getVirtualDependencyFilenames(input, configuration, virtualFilenames);
+		}
+		catch (const std::exception& e)
+		{
+			RHI_LOG(mContext, WARNING, "Failed to gather the source files of asset with filename \"%s\": \"%s\". Only changes to the asset itself will trigger its compilation.", asset.virtualFilename, e.what())
+		}
+
+		// Register the source files
+		for (const std::string& virtualFilename : virtualFilenames)
+		{
+			const uint32_t sourceFileId = Renderer::StringId::calculateFNV(virtualFilename.c_str());
+			if (std::find(sourceFileIds.cbegin(), sourceFileIds.cend(), sourceFileId) == sourceFileIds.cend())
+			{
+				sourceFileIds.push_back(sourceFileId);
+				mSourceFileIdToSourceAssetIds[sourceFileId].insert(asset.assetId);
+			}
+		}
+	}
+
+	void ProjectImpl::compileAssetsParallel(const std::vector<const Renderer::Asset*>& assets, const std::vector<Renderer::AssetId>& changedAssetIds, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage)
+	{
+		// The renderer toolkit is now considered to be busy
+		mRendererToolkitImpl.setState(IRendererToolkit::State::BUSY);
+
+		// Startup the asset compiler worker threads, if necessary
+		if (mCompilerWorkerThreads.empty())
+		{
+			startupCompilerWorkerThreads();
+		}
+
+		// Prepare the compiler jobs
+		// -> Done by this thread since it's cheap compared to the asset compilation itself and output directories can be created without racing
+		const size_t numberOfAssets = assets.size();
+		std::vector<CompilerJob> compilerJobs(numberOfAssets);
+		{
+			RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
+			const rapidjson::Value& rapidJsonValueTargets = (*mRapidJsonDocument)["Targets"];
+			const std::string renderTargetDataRootDirectory = getRenderTargetDataRootDirectory(rhiTarget);
+			Renderer::IFileManager& fileManager = mContext.getFileManager();
+			std::unordered_map<std::string_view, CompilerJob*> compilerJobByVirtualAssetFilename;
+			compilerJobByVirtualAssetFilename.reserve(numberOfAssets);
+			for (size_t i = 0; i < numberOfAssets; ++i)
+			{
+				const Renderer::Asset& asset = *assets[i];
+				CompilerJob& compilerJob = compilerJobs[i];
+				compilerJob.asset = &asset;
+				compilerJob.rhiTarget = rhiTarget;
+				compilerJob.rapidJsonValueTargets = &rapidJsonValueTargets;
+				compilerJobByVirtualAssetFilename.emplace(asset.virtualFilename, &compilerJob);
+				try
+				{
+					// Get asset compiler class instance
+					const std::string virtualAssetFilename = asset.virtualFilename;
+					const IAssetCompiler* assetCompiler = getSourceAssetCompilerAndRapidJsonDocument(virtualAssetFilename, compilerJob.rapidJsonDocument);
+					RHI_ASSERT(getContext(), nullptr != assetCompiler, "Invalid asset compiler")
+					compilerJob.assetCompilerClassId = assetCompiler->getAssetCompilerClassId();
+
+					// Get the asset input directory and asset output directory
+					const std::string& assetPackageDirectoryName = mAssetPackageDirectoryNames[getAssetPackageIndexBySourceAssetId(asset.assetId)];
+					compilerJob.virtualAssetPackageInputDirectory = mProjectName + '/' + assetPackageDirectoryName;
+					compilerJob.virtualAssetInputDirectory = std_filesystem::path(virtualAssetFilename).parent_path().generic_string();
+					const std::string assetDirectory = compilerJob.virtualAssetInputDirectory.substr(compilerJob.virtualAssetInputDirectory.find('/') + 1);
+					compilerJob.virtualAssetOutputDirectory = renderTargetDataRootDirectory + '/' + mProjectName + '/' + assetPackageDirectoryName + '/' + assetDirectory;
+					compilerJob.assetIdAsString = mProjectName + '/' + assetDirectory + '/' + std_filesystem::path(virtualAssetFilename).stem().generic_string();
+
+					// Ensure that the asset output directory exists, else creating output file streams will fail
+					fileManager.createDirectories(compilerJob.virtualAssetOutputDirectory.c_str());
+
+					// Gather the source assets this asset depends on
+					const IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, compilerJob.virtualAssetPackageInputDirectory, virtualAssetFilename, compilerJob.virtualAssetInputDirectory, compilerJob.virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+					const IAssetCompiler::Configuration configuration(compilerJob.rapidJsonDocument, rapidJsonValueTargets, rhiTarget, mQualityStrategy);
+					assetCompiler->getVirtualDependencyFilenames(input, configuration, compilerJob.virtualDependencyFilenames);
+				}
+				catch (const std::exception& e)
+				{
+					throw std::runtime_error("Failed to compile asset with filename \"" + std::string(asset.virtualFilename) + "\": " + std::string(e.what()));
+				}
+			}
+
+			// Build the asset dependency graph, dependencies to assets which aren't compiled during this run are already satisfied
+			for (CompilerJob& compilerJob : compilerJobs)
+			{
+				for (const std::string& virtualDependencyFilename : compilerJob.virtualDependencyFilenames)
+				{
+					std::unordered_map<std::string_view, CompilerJob*>::const_iterator iterator = compilerJobByVirtualAssetFilename.find(virtualDependencyFilename);
+					if (compilerJobByVirtualAssetFilename.cend() != iterator && iterator->second != &compilerJob)
+					{
+						std::vector<CompilerJob*>& dependentCompilerJobs = iterator->second->dependentCompilerJobs;
+						if (std::find(dependentCompilerJobs.cbegin(), dependentCompilerJobs.cend(), &compilerJob) == dependentCompilerJobs.cend())
+						{
+							dependentCompilerJobs.push_back(&compilerJob);
+							++compilerJob.numberOfPendingDependencies;
+						}
+					}
+				}
+			}
+		}
+
+		// Dispatch the compiler jobs as soon as all compiler jobs they depend on have been finished
+		// -> Ready compiler jobs are always dispatched in asset order and only this thread updates the output asset package, so the output doesn't depend on the number of asset compiler worker threads
+		std::vector<CompilerJob*> readyCompilerJobs;
+		for (CompilerJob& compilerJob : compilerJobs)
+		{
+			if (0 == compilerJob.numberOfPendingDependencies)
+			{
+				readyCompilerJobs.push_back(&compilerJob);
+			}
+		}
+		std::vector<CompilerJob*> finishedCompilerJobs;
+		size_t numberOfRunningCompilerJobs = 0;
+		size_t numberOfFinishedCompilerJobs = 0;
+		bool cancelled = false;
+		std::string errorMessage;
+		for (;;)
+		{
+			// Dispatch ready compiler jobs, unless the compilation run has been failed or cancelled
+			if (!readyCompilerJobs.empty() && errorMessage.empty() && !cancelled)
+			{
+				{
+					std::lock_guard<std::mutex> mutexLock(mCompilerJobMutex);
+					mPendingCompilerJobs.insert(mPendingCompilerJobs.end(), readyCompilerJobs.cbegin(), readyCompilerJobs.cend());
+				}
+				numberOfRunningCompilerJobs += readyCompilerJobs.size();
+				readyCompilerJobs.clear();
+				mPendingCompilerJobCondition.notify_all();
+			}
+			if (0 == numberOfRunningCompilerJobs)
+			{
+				// Done or there are no compiler jobs left which can be dispatched
+				break;
+			}
+
+			// Wait for finished compiler jobs
+			{
+				std::unique_lock<std::mutex> mutexLock(mCompilerJobMutex);
+				mFinishedCompilerJobCondition.wait(mutexLock, [this]() { return !mFinishedCompilerJobs.empty(); });
+				finishedCompilerJobs.swap(mFinishedCompilerJobs);
+			}
+
+			// Process finished compiler jobs
+			// -> Exceptions must not leave this method as long as compiler jobs are running
+			for (CompilerJob* compilerJob : finishedCompilerJobs)
+			{
+				--numberOfRunningCompilerJobs;
+				++numberOfFinishedCompilerJobs;
+				try
+				{
+					if (!compilerJob->succeeded)
+					{
+						throw std::runtime_error(compilerJob->errorMessage);
+					}
+					RHI_LOG(mContext, INFORMATION, "Compiled asset %u of %u", numberOfFinishedCompilerJobs, numberOfAssets)
+
+					// Update the output asset package and save renderer toolkit cache
+					::detail::outputAsset(compilerJob->assetIdAsString, compilerJob->virtualOutputAssetFilename, compilerJob->fileHash, outputAssetPackage);
+					mCacheManager->saveCache();
+
+					// Compiler jobs depending on this compiler job might be ready now
+					for (CompilerJob* dependentCompilerJob : compilerJob->dependentCompilerJobs)
+					{
+						if (0 == --dependentCompilerJob->numberOfPendingDependencies)
+						{
+							readyCompilerJobs.push_back(dependentCompilerJob);
+						}
+					}
+
+					if (nullptr != mProjectAssetMonitor)
+					{
+						// In case a shutdown was requested while we're compiling the changed assets, shutdown as soon as the running compiler jobs have been finished
+						if (mProjectAssetMonitor->mShutdownThread)
+						{
+							cancelled = true;
+						}
+						else
+						{
+							// Call "Renderer::IRenderer::reloadResourceByAssetId()" directly after an asset has been compiled to see changes as early as possible
+							const Renderer::AssetId sourceAssetId = compilerJob->asset->assetId;
+							if (std::find(changedAssetIds.cbegin(), changedAssetIds.cend(), sourceAssetId) != changedAssetIds.cend())
+							{
+								SourceAssetIdToCompiledAssetId::const_iterator iterator = mSourceAssetIdToCompiledAssetId.find(sourceAssetId);
+								if (iterator == mSourceAssetIdToCompiledAssetId.cend())
+								{
+									throw std::runtime_error(std::string("Source asset ID ") + std::to_string(sourceAssetId) + " is unknown");
+								}
+								mProjectAssetMonitor->mRenderer.reloadResourceByAssetId(iterator->second);
+							}
+						}
+					}
+				}
+				catch (const std::exception& e)
+				{
+					if (errorMessage.empty())
+					{
+						errorMessage = "Failed to compile asset with filename \"" + std::string(compilerJob->asset->virtualFilename) + "\": " + std::string(e.what());
+					}
+				}
+			}
+			finishedCompilerJobs.clear();
+
+			// The compiler jobs are stored in asset order, keep the dispatch order independent of the asset compiler worker thread timing
+			std::sort(readyCompilerJobs.begin(), readyCompilerJobs.end());
+		}
+		if (!errorMessage.empty())
+		{
+			throw std::runtime_error(errorMessage);
+		}
+
+		// Sanity check: Compiler jobs which couldn't be dispatched are part of a cyclic asset dependency
+		if (!cancelled && numberOfFinishedCompilerJobs != numberOfAssets)
+		{
+			std::string assetString;
+			for (const CompilerJob& compilerJob : compilerJobs)
+			{
+				if (compilerJob.numberOfPendingDependencies > 0)
+				{
+					assetString += std::string(compilerJob.asset->virtualFilename) + '\n';
+				}
+			}
+			throw std::runtime_error("Cyclic asset dependency detected, the following assets can't be compiled: " + assetString);
+		}
+	}
+
+	void ProjectImpl::startupCompilerWorkerThreads()
 	{
-		Renderer::PlatformManager::setCurrentThreadName("Project worker", "Renderer toolkit: Project worker");
+		RHI_ASSERT(getContext(), mCompilerWorkerThreads.empty(), "The asset compiler worker threads are already running")
+
+		// Get the number of asset compiler worker threads, "std::thread::hardware_concurrency()" might return zero if the value is not computable
+		uint32_t numberOfCompilerThreads = (0 != mNumberOfCompilerThreads) ? mNumberOfCompilerThreads : std::thread::hardware_concurrency();
+		if (0 == numberOfCompilerThreads)
+		{
+			numberOfCompilerThreads = 1;
+		}
+		RHI_LOG(mContext, INFORMATION, "Starting %u asset compiler worker threads", numberOfCompilerThreads)
+
+		// Each asset compiler worker thread gets its own asset compiler instances, created by this thread since e.g. the texture asset compiler initializes Crunch
+		mShutdownCompilerWorkerThreads = false;
+		mCompilerWorkerAssetCompilers.resize(numberOfCompilerThreads);
+		for (AssetCompilerByClassId& assetCompilerByClassId : mCompilerWorkerAssetCompilers)
+		{
+			::detail::createAssetCompilers(mContext, assetCompilerByClassId);
+		}
+		mCompilerWorkerThreads.reserve(numberOfCompilerThreads);
+		for (uint32_t i = 0; i < numberOfCompilerThreads; ++i)
+		{
+			mCompilerWorkerThreads.emplace_back(&ProjectImpl::compilerWorkerThread, this, i);
+		}
+	}
 
-		while (!mShutdownThread)
+	void ProjectImpl::shutdownCompilerWorkerThreads()
+	{
+		if (!mCompilerWorkerThreads.empty())
 		{
-			// TODO(co) Implement me
+			// Wake up and join the asset compiler worker threads
+			{
+				std::lock_guard<std::mutex> mutexLock(mCompilerJobMutex);
+				mShutdownCompilerWorkerThreads = true;
+			}
+			mPendingCompilerJobCondition.notify_all();
+			for (std::thread& thread : mCompilerWorkerThreads)
+			{
+				thread.join();
+			}
+			mCompilerWorkerThreads.clear();
+
+			// Destroy the asset compiler instances of the asset compiler worker threads
+			for (AssetCompilerByClassId& assetCompilerByClassId : mCompilerWorkerAssetCompilers)
+			{
+				::detail::destroyAssetCompilers(assetCompilerByClassId);
+			}
+			mCompilerWorkerAssetCompilers.clear();
+		}
+	}
+
+	void ProjectImpl::compilerWorkerThread(uint32_t compilerWorkerThreadIndex)
+	{
+		Renderer::PlatformManager::setCurrentThreadName("Asset compiler worker", "Renderer toolkit: Asset compiler worker");
+		const AssetCompilerByClassId& assetCompilerByClassId = mCompilerWorkerAssetCompilers[compilerWorkerThreadIndex];
+
+		for (;;)
+		{
+			// Wait for a pending compiler job
+			CompilerJob* compilerJob = nullptr;
+			{
+				std::unique_lock<std::mutex> mutexLock(mCompilerJobMutex);
+				mPendingCompilerJobCondition.wait(mutexLock, [this]() { return (mShutdownCompilerWorkerThreads || !mPendingCompilerJobs.empty()); });
+				if (mShutdownCompilerWorkerThreads)
+				{
+					break;
+				}
+				compilerJob = mPendingCompilerJobs.front();
+				mPendingCompilerJobs.pop_front();
+			}
+
+			// Compile the asset by using the asset compiler instance owned by this asset compiler worker thread
+			// -> The busy asset compiler worker thread is taken into account by the processor budget of data parallel processing inside asset compilers
+			try
+			{
+				const ParallelHelper::BusyThread busyThread;
+				AssetCompilerByClassId::const_iterator iterator = assetCompilerByClassId.find(compilerJob->assetCompilerClassId);
+				RHI_ASSERT(getContext(), assetCompilerByClassId.cend() != iterator, "Invalid asset compiler")
+				const IAssetCompiler* assetCompiler = iterator->second;
+				const IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, compilerJob->virtualAssetPackageInputDirectory, compilerJob->asset->virtualFilename, compilerJob->virtualAssetInputDirectory, compilerJob->virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+				const IAssetCompiler::Configuration configuration(compilerJob->rapidJsonDocument, *compilerJob->rapidJsonValueTargets, compilerJob->rhiTarget, mQualityStrategy);
+				assetCompiler->compile(input, configuration);
+				compilerJob->virtualOutputAssetFilename = assetCompiler->getVirtualOutputAssetFilename(input, configuration);
+				compilerJob->fileHash = Renderer::Math::calculateFileFNV1a64ByVirtualFilename(mContext.getFileManager(), compilerJob->virtualOutputAssetFilename.c_str());
+				compilerJob->succeeded = true;
+			}
+			catch (const std::exception& e)
+			{
+				compilerJob->errorMessage = e.what();
+			}
+
+			// Hand the finished compiler job back to the dispatching thread
+			{
+				std::lock_guard<std::mutex> mutexLock(mCompilerJobMutex);
+				mFinishedCompilerJobs.push_back(compilerJob);
+			}
+			mFinishedCompilerJobCondition.notify_one();
 		}
 	}
 
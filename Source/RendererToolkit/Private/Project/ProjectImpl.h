@@ -42,10 +42,12 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::atomic_flag': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <deque>
+	#include <mutex>
 	#include <thread>
-	#include <atomic>	// For "std::atomic<>"
 	#include <string_view>
 	#include <unordered_set>
+	#include <condition_variable>
 PRAGMA_WARNING_POP
 
 
@@ -80,6 +82,9 @@ namespace RendererToolkit
 	typedef std::unordered_map<uint32_t, uint32_t>	  CompiledAssetIdToSourceAssetId;	///< Key = compiled asset ID, value = source asset ID ("AssetId"-type not used directly or we would need to define a hash-function for it)
 	typedef std::unordered_map<uint32_t, std::string> SourceAssetIdToVirtualFilename;	///< Key = source asset ID, virtual asset filename
 	typedef std::unordered_set<uint32_t>			  DefaultTextureAssetIds;			///< "Renderer::AssetId"-type for compiled asset IDs
+	typedef std::unordered_map<uint32_t, std::unordered_set<uint32_t>> SourceFileIdToSourceAssetIds;	///< Key = source file ID (string ID of the virtual filename), value = source asset IDs using the source file directly or as asset dependency
+	typedef std::unordered_map<uint32_t, std::vector<uint32_t>>		   SourceAssetIdToSourceFileIds;	///< Key = source asset ID, value = source file IDs (string ID of the virtual filename) used by the source asset
+	typedef std::unordered_map<uint32_t, uint32_t>	  SourceAssetIdToAssetPackageIndex;	///< Key = source asset ID, value = index of the asset package containing the source asset
 
 
 	//[-------------------------------------------------------]
@@ -140,7 +145,21 @@ namespace RendererToolkit
 		[[nodiscard]] Renderer::VirtualFilename tryGetVirtualFilenameByAssetId(Renderer::AssetId assetId) const;
 		[[nodiscard]] bool checkAssetIsChanged(const Renderer::Asset& asset, const char* rhiTarget);
 		void compileAsset(const Renderer::Asset& asset, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage);
-		void compileAssetIncludingDependencies(const Renderer::Asset& asset, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage) noexcept;
+
+		/**
+		*  @brief
+		*    Compile the assets affected by the given modified source files
+		*
+		*  @param[in] absoluteFilenames
+		*    UTF-8 absolute filenames of the modified source files, files outside of the project directory are ignored
+		*  @param[in] rhiTarget
+		*    The UTF-8 RHI target name for which the assets should be compiled
+		*
+		*  @note
+		*    - Only the assets using one of the source files, directly or as asset dependency, are compiled
+		*    - Resources of the compiled assets are reloaded if the project asset monitor is running
+		*/
+		void compileAssetsBySourceFiles(const AbsoluteFilenames& absoluteFilenames, const char* rhiTarget);
 
 		/**
 		*  @brief
@@ -157,6 +176,8 @@ namespace RendererToolkit
 	//[-------------------------------------------------------]
 	public:
 		virtual void load(Renderer::AbsoluteDirectoryName absoluteProjectDirectoryName) override;
+		virtual void setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads) override;
+		virtual void setSharedCacheDirectory(const std::string& absoluteDirectoryName, uint64_t maximumSizeInBytes = 0) override;
 		virtual void compileAllAssets(const char* rhiTarget) override;
 		virtual void importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName, const std::string& targetDirectoryName = "Imported") override;
 		virtual void startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget) override;
@@ -187,9 +208,49 @@ namespace RendererToolkit
 		void readAssetPackageByDirectory(const std::string& directoryName);	// Directory name has no "/" at the end
 		void readTargetsByFilename(const std::string& relativeFilename);
 		[[nodiscard]] std::string getRenderTargetDataRootDirectory(const char* rhiTarget) const;	// Directory name has no "/" at the end
+		[[nodiscard]] uint32_t getAssetPackageIndexBySourceAssetId(Renderer::AssetId sourceAssetId) const;
+		[[nodiscard]] std::string getVirtualAssetPackageFilename(const char* rhiTarget, uint32_t assetPackageIndex) const;
+
+		/**
+		*  @brief
+		*    Write the compiled asset packages containing the given compiled assets
+		*
+		*  @param[in] rhiTarget
+		*    The UTF-8 RHI target name for which the assets were compiled
+		*  @param[in] outputAssetPackage
+		*    Compiled assets of the compilation run
+		*  @param[in, out] compiledAssetPackages
+		*    Previously compiled content per asset package, empty entries are loaded on demand
+		*  @param[in] completeAssetPackages
+		*    "true" if the compiled asset packages must contain all source assets of the asset package (the compilation run compiled the assets missing in the previously compiled asset package),
+		*    "false" to only update compiled asset packages which already exist
+		*
+		*  @note
+		*    - Only asset packages containing new or modified compiled assets are written, the other asset packages are left untouched
+		*/
+		void writeCompiledAssetPackages(const char* rhiTarget, const Renderer::AssetPackage& outputAssetPackage, std::vector<Renderer::AssetPackage::SortedAssetVector>& compiledAssetPackages, bool completeAssetPackages);
+
 		void buildSourceAssetIdToCompiledAssetId();
 		const IAssetCompiler* getSourceAssetCompilerAndRapidJsonDocument(const std::string& virtualAssetFilename, rapidjson::Document& rapidJsonDocument) const;
-		void threadWorker();
+		void buildSourceFileIndex(const char* rhiTarget);
+		void updateSourceFileIndex(const Renderer::Asset& asset, const char* rhiTarget);
+		/**
+		*  @brief
+		*    Compile the given assets using the asset compiler worker threads
+		*
+		*  @param[in] assets
+		*    Assets to compile, assets are only compiled after the assets they depend on
+		*  @param[in] changedAssetIds
+		*    Changed source asset IDs, resources of changed assets are reloaded after the asset has been compiled if the project asset monitor is running
+		*  @param[in] rhiTarget
+		*    The UTF-8 RHI target name for which the assets should be compiled
+		*  @param[out] outputAssetPackage
+		*    Output asset package receiving the compiled assets, only updated by the calling thread in order to keep the output deterministic
+		*/
+		void compileAssetsParallel(const std::vector<const Renderer::Asset*>& assets, const std::vector<Renderer::AssetId>& changedAssetIds, const char* rhiTarget, Renderer::AssetPackage& outputAssetPackage);
+		void startupCompilerWorkerThreads();
+		void shutdownCompilerWorkerThreads();
+		void compilerWorkerThread(uint32_t compilerWorkerThreadIndex);
 
 
 	//[-------------------------------------------------------]
@@ -198,6 +259,7 @@ namespace RendererToolkit
 	private:
 		typedef std::unordered_map<uint32_t, IAssetCompiler*> AssetCompilerByClassId;
 		typedef std::unordered_map<std::string_view, IAssetCompiler*> AssetCompilerByFilenameExtension;
+		struct CompilerJob;
 
 
 	//[-------------------------------------------------------]
@@ -210,18 +272,31 @@ namespace RendererToolkit
 		std::string							mAbsoluteProjectDirectory;			///< UTF-8 project directory, Has no "/" at the end
 		QualityStrategy						mQualityStrategy;
 		Renderer::AssetPackage				mAssetPackage;
-		std::string							mAssetPackageDirectoryName;			///< UTF-8 asset package name, has no "/" at the end
+		std::vector<std::string>			mAssetPackageDirectoryNames;		///< UTF-8 asset package names, have no "/" at the end
+		SourceAssetIdToAssetPackageIndex	mSourceAssetIdToAssetPackageIndex;
 		SourceAssetIdToCompiledAssetId		mSourceAssetIdToCompiledAssetId;
 		CompiledAssetIdToSourceAssetId		mCompiledAssetIdToSourceAssetId;
 		SourceAssetIdToVirtualFilename		mSourceAssetIdToVirtualFilename;
 		DefaultTextureAssetIds				mDefaultTextureAssetIds;
+		SourceFileIdToSourceAssetIds		mSourceFileIdToSourceAssetIds;		///< Reverse source file index used for incremental asset compilation, built on demand
+		SourceAssetIdToSourceFileIds		mSourceAssetIdToSourceFileIds;		///< Source files of the source assets, used to update the reverse source file index
 		rapidjson::Document*				mRapidJsonDocument;					///< There's no real benefit in trying to store the targets data in custom data structures, so we just stick to the read in JSON object
 		ProjectAssetMonitor*				mProjectAssetMonitor;
-		std::atomic<bool>					mShutdownThread;
-		std::thread							mThread;
 		CacheManager*						mCacheManager;						///< Cache manager, can be a null pointer, destroy the instance if no longer needed
+		std::string							mSharedCacheDirectory;				///< UTF-8 absolute shared cache directory, empty if no shared cache is used, survives project reloads
+		uint64_t							mSharedCacheMaximumSize;			///< Maximum size of the shared cache in bytes, "0" means no limit
 		AssetCompilerByClassId				mAssetCompilerByClassId;			///< List of asset compilers by key "RendererToolkit::AssetCompilerClassId" (type not used directly or we would need to define a hash-function for it)
 		AssetCompilerByFilenameExtension	mAssetCompilerByFilenameExtension;	///< List of asset compilers by key "unique asset filename extension"
+		// Asset compiler worker threads
+		uint32_t							mNumberOfCompilerThreads;			///< Number of asset compiler worker threads, "0" means one worker thread per hardware thread
+		std::vector<std::thread>			mCompilerWorkerThreads;
+		std::vector<AssetCompilerByClassId>	mCompilerWorkerAssetCompilers;		///< Asset compiler instances per asset compiler worker thread, reused across assets and compilation runs
+		std::mutex							mCompilerJobMutex;					///< Guards the compiler job queues and the shutdown flag
+		std::condition_variable				mPendingCompilerJobCondition;		///< Wakes up the asset compiler worker threads
+		std::condition_variable				mFinishedCompilerJobCondition;		///< Wakes up the thread dispatching the compiler jobs
+		std::deque<CompilerJob*>			mPendingCompilerJobs;
+		std::vector<CompilerJob*>			mFinishedCompilerJobs;
+		bool								mShutdownCompilerWorkerThreads;
 
 
 	};
@@ -3837,7 +3837,9 @@ namespace Direct3D11Rhi
 				DXGI_FORMAT_R8G8B8A8_UINT,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				DXGI_FORMAT_R16G16_SINT,		// Rhi::VertexAttributeFormat::SHORT_2
 				DXGI_FORMAT_R16G16B16A16_SINT,	// Rhi::VertexAttributeFormat::SHORT_4
-				DXGI_FORMAT_R32_UINT			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R32_UINT,			// Rhi::VertexAttributeFormat::UINT_1
+				DXGI_FORMAT_R16G16B16A16_UNORM,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				DXGI_FORMAT_R16G16_FLOAT		// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -2762,7 +2762,9 @@ namespace Direct3D9Rhi
 				D3DDECLTYPE_UBYTE4,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				D3DDECLTYPE_SHORT2,		// Rhi::VertexAttributeFormat::SHORT_2
 				D3DDECLTYPE_SHORT4,		// Rhi::VertexAttributeFormat::SHORT_4
-				D3DDECLTYPE_UNUSED		// Rhi::VertexAttributeFormat::UINT_1 - not supported by DirectX 9
+				D3DDECLTYPE_UNUSED,		// Rhi::VertexAttributeFormat::UINT_1 - not supported by DirectX 9
+				D3DDECLTYPE_USHORT4N,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				D3DDECLTYPE_FLOAT16_2	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3324,7 +3324,9 @@ namespace OpenGLES3Rhi
 				4,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				2,	// Rhi::VertexAttributeFormat::SHORT_2
 				4,	// Rhi::VertexAttributeFormat::SHORT_4
-				1	// Rhi::VertexAttributeFormat::UINT_1
+				1,	// Rhi::VertexAttributeFormat::UINT_1
+				4,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				2	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3351,7 +3353,9 @@ namespace OpenGLES3Rhi
 				GL_UNSIGNED_BYTE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_2
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_4
-				GL_UNSIGNED_INT		// Rhi::VertexAttributeFormat::UINT_1
+				GL_UNSIGNED_INT,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_UNSIGNED_SHORT,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				GL_HALF_FLOAT		// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3378,7 +3382,9 @@ namespace OpenGLES3Rhi
 				GL_FALSE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_FALSE	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_TRUE,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				GL_FALSE	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -3405,7 +3411,9 @@ namespace OpenGLES3Rhi
 				GL_TRUE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_TRUE		// Rhi::VertexAttributeFormat::UINT_1
+				GL_TRUE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				GL_FALSE	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
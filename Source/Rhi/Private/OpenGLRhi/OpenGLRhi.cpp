@@ -525,6 +525,7 @@ namespace OpenGLRhi
 	class RootSignature;
 	class IOpenGLContext;
 	class OpenGLRuntimeLinking;
+	class ProgramBinaryCache;
 	class ComputePipelineState;
 	class GraphicsPipelineState;
 }
@@ -904,6 +905,8 @@ FNDEF_EX(glActiveShaderProgram,			PFNGLACTIVESHADERPROGRAMPROC);
 
 // GL_ARB_get_program_binary
 FNDEF_EX(glProgramParameteri,	PFNGLPROGRAMPARAMETERIPROC);
+FNDEF_EX(glGetProgramBinary,	PFNGLGETPROGRAMBINARYPROC);
+FNDEF_EX(glProgramBinary,		PFNGLPROGRAMBINARYPROC);
 
 // GL_ARB_uniform_buffer_object
 FNDEF_EX(glGetUniformBlockIndex,	PFNGLGETUNIFORMBLOCKINDEXPROC);
@@ -921,6 +924,9 @@ FNDEF_EX(glDrawElementsIndirect,	PFNGLDRAWELEMENTSINDIRECTPROC);
 FNDEF_EX(glMultiDrawArraysIndirect,		PFNGLMULTIDRAWARRAYSINDIRECTPROC);
 FNDEF_EX(glMultiDrawElementsIndirect,	PFNGLMULTIDRAWELEMENTSINDIRECTPROC);
 
+// GL_ARB_indirect_parameters
+FNDEF_EX(glMultiDrawElementsIndirectCountARB,	PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC);
+
 // GL_ARB_vertex_shader
 FNDEF_EX(glBindAttribLocation,	PFNGLBINDATTRIBLOCATIONPROC);	// glBindAttribLocationARB
 
@@ -971,6 +977,8 @@ FNDEF_EX(glCreateVertexArrays,				PFNGLCREATEVERTEXARRAYSPROC);
 FNDEF_EX(glNamedBufferData,					PFNGLNAMEDBUFFERDATAPROC);
 FNDEF_EX(glNamedBufferSubData,				PFNGLNAMEDBUFFERSUBDATAPROC);
 FNDEF_EX(glMapNamedBuffer,					PFNGLMAPNAMEDBUFFERPROC);
+FNDEF_EX(glMapNamedBufferRange,				PFNGLMAPNAMEDBUFFERRANGEPROC);
+FNDEF_EX(glNamedBufferStorage,				PFNGLNAMEDBUFFERSTORAGEPROC);
 FNDEF_EX(glUnmapNamedBuffer,				PFNGLUNMAPNAMEDBUFFERPROC);
 FNDEF_EX(glProgramUniform1i,				PFNGLPROGRAMUNIFORM1IPROC);
 FNDEF_EX(glProgramUniform1ui,				PFNGLPROGRAMUNIFORM1UIPROC);
@@ -1026,7 +1034,27 @@ FNDEF_EX(glEndQueryARB,				PFNGLENDQUERYARBPROC);
 FNDEF_EX(glGetQueryObjectuivARB,	PFNGLGETQUERYOBJECTUIVARBPROC);
 
 // GL_ARB_timer_query
-FNDEF_EX(glQueryCounter,	PFNGLQUERYCOUNTERPROC);
+FNDEF_EX(glQueryCounter,		PFNGLQUERYCOUNTERPROC);
+FNDEF_EX(glGetQueryObjectui64v,	PFNGLGETQUERYOBJECTUI64VPROC);
+
+// GL_ARB_buffer_storage
+FNDEF_EX(glBufferStorage,	PFNGLBUFFERSTORAGEPROC);
+
+// GL_ARB_sync
+FNDEF_EX(glFenceSync,		PFNGLFENCESYNCPROC);
+FNDEF_EX(glClientWaitSync,	PFNGLCLIENTWAITSYNCPROC);
+FNDEF_EX(glDeleteSync,		PFNGLDELETESYNCPROC);
+
+// GL_ARB_multi_bind
+FNDEF_EX(glBindBuffersBase,	PFNGLBINDBUFFERSBASEPROC);
+FNDEF_EX(glBindTextures,	PFNGLBINDTEXTURESPROC);
+FNDEF_EX(glBindSamplers,	PFNGLBINDSAMPLERSPROC);
+
+// GL_ARB_bindless_texture
+FNDEF_EX(glGetTextureHandleARB,				PFNGLGETTEXTUREHANDLEARBPROC);
+FNDEF_EX(glGetTextureSamplerHandleARB,		PFNGLGETTEXTURESAMPLERHANDLEARBPROC);
+FNDEF_EX(glMakeTextureHandleResidentARB,	PFNGLMAKETEXTUREHANDLERESIDENTARBPROC);
+FNDEF_EX(glIsTextureHandleResidentARB,		PFNGLISTEXTUREHANDLERESIDENTARBPROC);
 
 
 //[-------------------------------------------------------]
@@ -1389,29 +1417,57 @@ namespace
 		*/
 		[[nodiscard]] GLuint loadShaderProgramFromSourceCode(const Rhi::Context& context, GLenum shaderType, const GLchar* sourceCode)
 		{
-			// Create the shader program
-			const GLuint openGLProgram = glCreateShaderProgramv(shaderType, 1, &sourceCode);
+			// Create, load and compile the shader object
+			// -> Same as "glCreateShaderProgramv()", but we need to set program parameters before the program gets linked
+			const GLuint openGLShader = glCreateShader(shaderType);
+			glShaderSource(openGLShader, 1, &sourceCode, nullptr);
+			glCompileShader(openGLShader);
 
-			// Check the link status
-			GLint linked = GL_FALSE;
-			glGetProgramiv(openGLProgram, GL_LINK_STATUS, &linked);
-			if (GL_TRUE == linked)
+			// Check the compile status
+			GLint compiled = GL_FALSE;
+			glGetShaderiv(openGLShader, GL_OBJECT_COMPILE_STATUS_ARB, &compiled);
+			if (GL_TRUE == compiled)
 			{
-				// All went fine, return the program
-				return openGLProgram;
+				// Create the program
+				const GLuint openGLProgram = glCreateProgram();
+				glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+
+				// Tell the driver that we're going to ask for the program binary, see "OpenGLRhi::ProgramBinaryCache"
+				glProgramParameteri(openGLProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+				// Link the program
+				glAttachShader(openGLProgram, openGLShader);
+				glLinkProgram(openGLProgram);
+				glDetachShader(openGLProgram, openGLShader);
+				glDeleteShader(openGLShader);
+
+				// Check the link status
+				GLint linked = GL_FALSE;
+				glGetProgramiv(openGLProgram, GL_LINK_STATUS, &linked);
+				if (GL_TRUE == linked)
+				{
+					// All went fine, return the program
+					return openGLProgram;
+				}
+
+				// Error, program link failed!
+				printOpenGLProgramInformationIntoLog(context, openGLProgram, sourceCode);
+
+				// Destroy the program
+				glDeleteProgram(openGLProgram);
 			}
 			else
 			{
 				// Error, failed to compile the shader!
-				printOpenGLProgramInformationIntoLog(context, openGLProgram, sourceCode);
+				printOpenGLShaderInformationIntoLog(context, openGLShader, sourceCode);
 
-				// Destroy the program
+				// Destroy the OpenGL shader
 				// -> A value of 0 for shader will be silently ignored
-				glDeleteProgram(openGLProgram);
-
-				// Error!
-				return 0u;
+				glDeleteShader(openGLShader);
 			}
+
+			// Error!
+			return 0u;
 		}
 
 		// Basing on the implementation from https://www.opengl.org/registry/specs/ARB/separate_shader_objects.txt
@@ -1425,6 +1481,9 @@ namespace
 				{
 					glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
 
+					// Tell the driver that we're going to ask for the program binary, see "OpenGLRhi::ProgramBinaryCache"
+					glProgramParameteri(openGLProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 					// Attach the shader to the program
 					glAttachShader(openGLProgram, openGLShader);
 
@@ -1853,6 +1912,22 @@ namespace OpenGLRhi
 			return *mExtensions;
 		}
 
+		/**
+		*  @brief
+		*    Create a separate shader program from source code, uses the program binary cache if possible
+		*
+		*  @param[in] shaderType
+		*    Shader type (for example "GL_VERTEX_SHADER_ARB")
+		*  @param[in] sourceCode
+		*    Shader ASCII source code, must be a valid pointer
+		*  @param[in] vertexAttributes
+		*    Vertex attributes to bind, only used by vertex shader programs, null pointer for none
+		*
+		*  @return
+		*    The OpenGL shader program, 0 on error, destroy the resource if you no longer need it
+		*/
+		[[nodiscard]] GLuint loadShaderProgramFromSourceCode(GLenum shaderType, const char* sourceCode, const Rhi::VertexAttributes* vertexAttributes = nullptr);
+
 		void dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer);
 
 		//[-------------------------------------------------------]
@@ -1870,6 +1945,7 @@ namespace OpenGLRhi
 		void drawGraphicsEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexedGraphics(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexedGraphicsEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
+		void drawIndexedGraphicsCount(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t maximumNumberOfDraws, const Rhi::IIndirectBuffer& countBuffer, uint32_t countBufferOffset);
 		void drawMeshTasks(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawMeshTasksEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		//[-------------------------------------------------------]
@@ -1938,6 +2014,15 @@ namespace OpenGLRhi
 		//[ Operation                                             ]
 		//[-------------------------------------------------------]
 		virtual void dispatchCommandBuffer(const Rhi::CommandBuffer& commandBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] virtual uint32_t getPipelineCacheData(uint32_t numberOfDataBytes, uint8_t* data) override;
+		virtual bool setPipelineCacheData(uint32_t numberOfDataBytes, const uint8_t* data) override;
+		//[-------------------------------------------------------]
+		//[ Bindless texture                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] virtual uint64_t getBindlessTextureHandle(Rhi::ITexture& texture, Rhi::ISamplerState* samplerState) override;
 
 
 	//[-------------------------------------------------------]
@@ -1976,6 +2061,65 @@ namespace OpenGLRhi
 		static void CALLBACK debugMessageCallback(uint32_t source, uint32_t type, uint32_t id, uint32_t severity, int length, const char* message, const void* userParam);
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr GLuint UNKNOWN_OPENGL_BINDING = ~0u;	///< Resource binding state cache value for a binding point whose OpenGL binding is unknown
+		/**
+		*  @brief
+		*    Range of binding points whose OpenGL binding calls are deferred and issued as "GL_ARB_multi_bind" calls
+		*/
+		struct BatchedBindings final
+		{
+			uint32_t first;
+			uint32_t last;
+
+			inline BatchedBindings() :
+				first(~0u),
+				last(0)
+			{}
+
+			inline void add(uint32_t index)
+			{
+				if (first > index)
+				{
+					first = index;
+				}
+				if (last < index)
+				{
+					last = index;
+				}
+			}
+
+			[[nodiscard]] inline bool getNextRun(const GLuint* openGLBindings, GLuint& runFirst, GLsizei& runCount)
+			{
+				// Skip binding points whose OpenGL binding is unknown, they mustn't be touched
+				while (first <= last && UNKNOWN_OPENGL_BINDING == openGLBindings[first])
+				{
+					++first;
+				}
+				if (first > last)
+				{
+					// Done
+					return false;
+				}
+
+				// Gather the run of consecutive binding points with known OpenGL bindings
+				// -> Binding points inside the run which weren't changed are just rebound to the resource they already reference
+				runFirst = first;
+				while (first <= last && UNKNOWN_OPENGL_BINDING != openGLBindings[first])
+				{
+					++first;
+				}
+				runCount = static_cast<GLsizei>(first - runFirst);
+
+				// Done
+				return true;
+			}
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -2008,6 +2152,65 @@ namespace OpenGLRhi
 		*/
 		void setResourceGroup(const RootSignature& rootSignature, uint32_t rootParameterIndex, Rhi::IResourceGroup* resourceGroup);
 
+		/**
+		*  @brief
+		*    Initialize the resource binding state cache
+		*/
+		void initializeBindingStateCache();
+
+		/**
+		*  @brief
+		*    Invalidate the resource binding state cache
+		*
+		*  @note
+		*    - OpenGL might reuse the names of destroyed resources and resource creation might change bindings, so the cache content is only trusted during a single command buffer dispatch
+		*/
+		void invalidateBindingStateCache();
+
+		/**
+		*  @brief
+		*    Update a resource binding state cache entry
+		*
+		*  @param[in] openGLBindings
+		*    Cached OpenGL bindings to update, can be a null pointer
+		*  @param[in] numberOfBindings
+		*    Number of cached OpenGL bindings
+		*  @param[in] index
+		*    Binding index
+		*  @param[in] openGLName
+		*    OpenGL name of the resource to bind
+		*
+		*  @return
+		*    "true" if the OpenGL binding call is required, "false" if the resource is already bound and the call can be skipped
+		*/
+		[[nodiscard]] bool updateBindingStateCache(GLuint* openGLBindings, uint32_t numberOfBindings, uint32_t index, GLuint openGLName);
+
+		/**
+		*  @brief
+		*    Bind an OpenGL buffer to an indexed uniform buffer or shader storage buffer binding point, if required
+		*
+		*  @param[in] openGLTarget
+		*    OpenGL buffer target, "GL_UNIFORM_BUFFER" or "GL_SHADER_STORAGE_BUFFER"
+		*  @param[in] index
+		*    Binding point index
+		*  @param[in] openGLBuffer
+		*    OpenGL buffer to bind
+		*  @param[in] batchedBindings
+		*    Receives the binding point in case the binding is deferred to a "GL_ARB_multi_bind" call
+		*/
+		void bindOpenGLBufferBase(GLenum openGLTarget, GLuint index, GLuint openGLBuffer, BatchedBindings& batchedBindings);
+
+		/**
+		*  @brief
+		*    Count a redundant state change which was filtered out instead of being passed to OpenGL
+		*/
+		inline void countSkippedStateChange()
+		{
+			#ifdef RHI_STATISTICS
+				++getStatistics().numberOfSkippedStateChanges;
+			#endif
+		}
+
 		/**
 		*  @brief
 		*    Set OpenGL graphics program
@@ -2043,6 +2246,7 @@ namespace OpenGLRhi
 		OpenGLRuntimeLinking* mOpenGLRuntimeLinking;			///< OpenGL runtime linking instance, always valid
 		IOpenGLContext*		  mOpenGLContext;					///< OpenGL context instance, always valid
 		Extensions*			  mExtensions;						///< Extensions instance, always valid
+		ProgramBinaryCache*	  mProgramBinaryCache;				///< Program binary cache instance, can be a null pointer
 		Rhi::IShaderLanguage* mShaderLanguage;					///< Shader language instance (we keep a reference to it), can be a null pointer
 		RootSignature*		  mGraphicsRootSignature;			///< Currently set graphics root signature (we keep a reference to it), can be a null pointer
 		RootSignature*		  mComputeRootSignature;			///< Currently set compute root signature (we keep a reference to it), can be a null pointer
@@ -2063,6 +2267,14 @@ namespace OpenGLRhi
 		GLuint mOpenGLProgramPipeline;		///< Currently set OpenGL program pipeline, can be zero if no resource is set
 		GLuint mOpenGLProgram;				///< Currently set OpenGL program, can be zero if no resource is set
 		GLuint mOpenGLIndirectBuffer;		///< Currently set OpenGL indirect buffer, can be zero if no resource is set
+		// Resource binding state cache to avoid making redundant OpenGL calls, only trusted during a command buffer dispatch
+		GLuint*	 mOpenGLTextureUnits;							///< OpenGL texture bound per texture unit, "UNKNOWN_OPENGL_BINDING" if unknown, can be a null pointer, memory block also holding the other cached bindings
+		GLuint*	 mOpenGLSamplerUnits;							///< OpenGL sampler bound per texture unit, "UNKNOWN_OPENGL_BINDING" if unknown, can be a null pointer
+		GLuint*	 mOpenGLUniformBufferBindings;					///< OpenGL buffer bound per uniform buffer binding point, "UNKNOWN_OPENGL_BINDING" if unknown, can be a null pointer
+		GLuint*	 mOpenGLShaderStorageBufferBindings;			///< OpenGL buffer bound per shader storage buffer binding point, "UNKNOWN_OPENGL_BINDING" if unknown, can be a null pointer
+		uint32_t mNumberOfOpenGLTextureUnits;					///< Number of elements in "mOpenGLTextureUnits" and "mOpenGLSamplerUnits"
+		uint32_t mNumberOfOpenGLUniformBufferBindings;			///< Number of elements in "mOpenGLUniformBufferBindings"
+		uint32_t mNumberOfOpenGLShaderStorageBufferBindings;	///< Number of elements in "mOpenGLShaderStorageBufferBindings"
 		// Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		GLuint	 mOpenGLVertexProgram;			///< Currently set OpenGL vertex program, can be zero if no resource is set
 		GLint	 mDrawIdUniformLocation;		///< Draw ID uniform location
@@ -2507,6 +2719,11 @@ namespace OpenGLRhi
 			return mGL_ARB_multi_draw_indirect;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_indirect_parameters() const
+		{
+			return mGL_ARB_indirect_parameters;
+		}
+
 		[[nodiscard]] inline bool isGL_ARB_vertex_shader() const
 		{
 			return mGL_ARB_vertex_shader;
@@ -2622,6 +2839,26 @@ namespace OpenGLRhi
 			return mGL_ARB_timer_query;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_buffer_storage() const
+		{
+			return mGL_ARB_buffer_storage;
+		}
+
+		[[nodiscard]] inline bool isGL_ARB_sync() const
+		{
+			return mGL_ARB_sync;
+		}
+
+		[[nodiscard]] inline bool isGL_ARB_multi_bind() const
+		{
+			return mGL_ARB_multi_bind;
+		}
+
+		[[nodiscard]] inline bool isGL_ARB_bindless_texture() const
+		{
+			return mGL_ARB_bindless_texture;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -2812,6 +3049,7 @@ namespace OpenGLRhi
 			mGL_ARB_texture_buffer_object		 = false;
 			mGL_ARB_draw_indirect				 = false;
 			mGL_ARB_multi_draw_indirect			 = false;
+			mGL_ARB_indirect_parameters			 = false;
 			mGL_ARB_vertex_shader				 = false;
 			mGL_ARB_vertex_program				 = false;
 			mGL_ARB_tessellation_shader			 = false;
@@ -2835,6 +3073,10 @@ namespace OpenGLRhi
 			mGL_ARB_occlusion_query				 = false;
 			mGL_ARB_pipeline_statistics_query	 = false;
 			mGL_ARB_timer_query					 = false;
+			mGL_ARB_buffer_storage				 = false;
+			mGL_ARB_sync						 = false;
+			mGL_ARB_multi_bind					 = false;
+			mGL_ARB_bindless_texture			 = false;
 		}
 
 		/**
@@ -3243,6 +3485,8 @@ namespace OpenGLRhi
 				// Load the entry points
 				bool result = true;	// Success by default
 				IMPORT_FUNC(glProgramParameteri)
+				IMPORT_FUNC(glGetProgramBinary)
+				IMPORT_FUNC(glProgramBinary)
 				mGL_ARB_get_program_binary = result;
 			}
 
@@ -3290,6 +3534,16 @@ namespace OpenGLRhi
 				mGL_ARB_multi_draw_indirect = result;
 			}
 
+			// GL_ARB_indirect_parameters - Is core since OpenGL 4.6
+			mGL_ARB_indirect_parameters = isSupported("GL_ARB_indirect_parameters");
+			if (mGL_ARB_indirect_parameters)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glMultiDrawElementsIndirectCountARB)
+				mGL_ARB_indirect_parameters = result;
+			}
+
 			// GL_ARB_vertex_shader - Is core since OpenGL 2.0
 			mGL_ARB_vertex_shader = isCoreProfile ? true : isSupported("GL_ARB_vertex_shader");
 			if (mGL_ARB_vertex_shader)
@@ -3439,6 +3693,8 @@ namespace OpenGLRhi
 				IMPORT_FUNC(glNamedBufferData)
 				IMPORT_FUNC(glNamedBufferSubData)
 				IMPORT_FUNC(glMapNamedBuffer)
+				IMPORT_FUNC(glMapNamedBufferRange)
+				IMPORT_FUNC(glNamedBufferStorage)
 				IMPORT_FUNC(glUnmapNamedBuffer)
 				IMPORT_FUNC(glProgramUniform1i)
 				IMPORT_FUNC(glProgramUniform1ui)
@@ -3546,9 +3802,57 @@ namespace OpenGLRhi
 				// Load the entry points
 				bool result = true;	// Success by default
 				IMPORT_FUNC(glQueryCounter)
+				IMPORT_FUNC(glGetQueryObjectui64v)
 				mGL_ARB_timer_query = result;
 			}
 
+			// GL_ARB_buffer_storage - Is core since OpenGL 4.4
+			mGL_ARB_buffer_storage = isSupported("GL_ARB_buffer_storage");
+			if (mGL_ARB_buffer_storage)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glBufferStorage)
+				mGL_ARB_buffer_storage = result;
+			}
+
+			// GL_ARB_sync - Is core since OpenGL 3.2
+			mGL_ARB_sync = isCoreProfile ? true : isSupported("GL_ARB_sync");
+			if (mGL_ARB_sync)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glFenceSync)
+				IMPORT_FUNC(glClientWaitSync)
+				IMPORT_FUNC(glDeleteSync)
+				mGL_ARB_sync = result;
+			}
+
+			// GL_ARB_multi_bind - Is core since OpenGL 4.4
+			mGL_ARB_multi_bind = isSupported("GL_ARB_multi_bind");
+			if (mGL_ARB_multi_bind)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glBindBuffersBase)
+				IMPORT_FUNC(glBindTextures)
+				IMPORT_FUNC(glBindSamplers)
+				mGL_ARB_multi_bind = result;
+			}
+
+			// GL_ARB_bindless_texture - Not core, software rasterizers usually don't expose it
+			mGL_ARB_bindless_texture = isSupported("GL_ARB_bindless_texture");
+			if (mGL_ARB_bindless_texture)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glGetTextureHandleARB)
+				IMPORT_FUNC(glGetTextureSamplerHandleARB)
+				IMPORT_FUNC(glMakeTextureHandleResidentARB)
+				IMPORT_FUNC(glIsTextureHandleResidentARB)
+				mGL_ARB_bindless_texture = result;
+			}
+
 
 			//[-------------------------------------------------------]
 			//[ Core (OpenGL version dependent)                       ]
@@ -3605,6 +3909,7 @@ namespace OpenGLRhi
 		bool mGL_ARB_texture_buffer_object;
 		bool mGL_ARB_draw_indirect;
 		bool mGL_ARB_multi_draw_indirect;
+		bool mGL_ARB_indirect_parameters;
 		bool mGL_ARB_vertex_shader;
 		bool mGL_ARB_vertex_program;
 		bool mGL_ARB_tessellation_shader;
@@ -3628,6 +3933,10 @@ namespace OpenGLRhi
 		bool mGL_ARB_occlusion_query;
 		bool mGL_ARB_pipeline_statistics_query;
 		bool mGL_ARB_timer_query;
+		bool mGL_ARB_buffer_storage;
+		bool mGL_ARB_sync;
+		bool mGL_ARB_multi_bind;
+		bool mGL_ARB_bindless_texture;
 
 
 	};
@@ -4795,7 +5104,9 @@ namespace OpenGLRhi
 				4,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				2,	// Rhi::VertexAttributeFormat::SHORT_2
 				4,	// Rhi::VertexAttributeFormat::SHORT_4
-				1	// Rhi::VertexAttributeFormat::UINT_1
+				1,	// Rhi::VertexAttributeFormat::UINT_1
+				4,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				2	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4822,7 +5133,9 @@ namespace OpenGLRhi
 				GL_UNSIGNED_BYTE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_2
 				GL_SHORT,			// Rhi::VertexAttributeFormat::SHORT_4
-				GL_UNSIGNED_INT		// Rhi::VertexAttributeFormat::UINT_1
+				GL_UNSIGNED_INT,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_UNSIGNED_SHORT,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				GL_HALF_FLOAT_ARB	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4849,7 +5162,9 @@ namespace OpenGLRhi
 				GL_FALSE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_FALSE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_FALSE	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_TRUE,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				GL_FALSE	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4876,7 +5191,9 @@ namespace OpenGLRhi
 				GL_TRUE,	// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_2
 				GL_TRUE,	// Rhi::VertexAttributeFormat::SHORT_4
-				GL_TRUE		// Rhi::VertexAttributeFormat::UINT_1
+				GL_TRUE,	// Rhi::VertexAttributeFormat::UINT_1
+				GL_FALSE,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				GL_FALSE	// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -5503,84 +5820,356 @@ namespace OpenGLRhi
 
 
 	//[-------------------------------------------------------]
-	//[ OpenGLRhi/Buffer/VertexBuffer.h                       ]
+	//[ OpenGLRhi/Buffer/StreamingBuffer.h                    ]
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Abstract OpenGL vertex buffer object (VBO, "array buffer" in OpenGL terminology) interface
+	*    OpenGL streaming buffer, a fixed number of persistently mapped buffer copies which are cycled through on "Rhi::MapType::WRITE_DISCARD"
+	*
+	*  @remarks
+	*    Instead of letting the driver orphan and remap the buffer data store on each update, the buffer copies are created once via
+	*    "glNamedBufferStorage()" using "GL_MAP_PERSISTENT_BIT" and stay mapped during their whole lifetime. Before the CPU writes into
+	*    a copy again, the fence which was inserted when leaving this copy is waited for so the GPU never reads memory the CPU is writing to.
+	*
+	*  @note
+	*    - Not a resource on its own, owned by the buffer resource using it
+	*    - Requires "GL_ARB_buffer_storage", "GL_ARB_sync" and "GL_ARB_direct_state_access", see "OpenGLRhi::StreamingBuffer::isSupported()"
+	*    - Vertex and index buffers are captured by vertex array objects and hence not streamed
 	*/
-	class VertexBuffer : public Rhi::IVertexBuffer
+	class StreamingBuffer final
 	{
 
 
 	//[-------------------------------------------------------]
-	//[ Public methods                                        ]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_COPIES = 3;	///< Triple buffering: One copy written by the CPU while up to two copies might still be in flight on the GPU
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
 	public:
 		/**
 		*  @brief
-		*    Destructor
+		*    Return whether or not a buffer with the given properties should be streamed
+		*
+		*  @param[in] extensions
+		*    OpenGL extensions
+		*  @param[in] bufferUsage
+		*    Indication of the buffer usage
+		*  @param[in] unorderedAccess
+		*    Is the buffer used for unordered access? If so, the GPU writes into it and it can't be streamed.
+		*
+		*  @return
+		*    "true" if the buffer should be streamed, else "false"
 		*/
-		inline virtual ~VertexBuffer() override
+		[[nodiscard]] static inline bool isSupported(const Extensions& extensions, Rhi::BufferUsage bufferUsage, bool unorderedAccess)
 		{
-			// Destroy the OpenGL array buffer
-			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
-			glDeleteBuffersARB(1, &mOpenGLArrayBuffer);
+			// Only dynamic buffers are worth the additional memory, static buffers are uploaded once and are never touched again
+			return (!unorderedAccess && (Rhi::BufferUsage::STREAM_DRAW == bufferUsage || Rhi::BufferUsage::DYNAMIC_DRAW == bufferUsage) &&
+					extensions.isGL_ARB_buffer_storage() && extensions.isGL_ARB_sync() && extensions.isGL_ARB_direct_state_access());
 		}
 
 		/**
 		*  @brief
-		*    Return the OpenGL array buffer
+		*    Return whether or not a streaming buffer can be mapped using the given map type
+		*
+		*  @param[in] mapType
+		*    Map type
 		*
 		*  @return
-		*    The OpenGL array buffer, can be zero if no resource is allocated, do not destroy the returned resource
+		*    "true" if the map type is supported, else "false" (the buffer copies are mapped write-only)
 		*/
-		[[nodiscard]] inline GLuint getOpenGLArrayBuffer() const
+		[[nodiscard]] static inline bool isMapTypeSupported(Rhi::MapType mapType)
 		{
-			return mOpenGLArrayBuffer;
+			return (Rhi::MapType::READ != mapType && Rhi::MapType::READ_WRITE != mapType);
 		}
 
 
 	//[-------------------------------------------------------]
-	//[ Protected virtual Rhi::RefCount methods               ]
+	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	protected:
-		inline virtual void selfDestruct() override
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		inline StreamingBuffer() :
+			mCurrentCopyIndex(0),
+			mOpenGLBuffers{},
+			mMappedData{},
+			mOpenGLSyncs{}
+		{}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~StreamingBuffer()
 		{
-			RHI_DELETE(getRhi().getContext(), VertexBuffer, this);
+			destroy();
 		}
 
-
-	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
-	//[-------------------------------------------------------]
-	protected:
 		/**
 		*  @brief
-		*    Constructor
+		*    Create the persistently mapped buffer copies
 		*
-		*  @param[in] openGLRhi
-		*    Owner OpenGL RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within each buffer copy, must be valid
+		*  @param[in] data
+		*    Buffer data, can be a null pointer (empty buffer), the data is internally copied and you have to free your memory if you no longer need it
+		*  @param[out] openGLBuffer
+		*    Receives the OpenGL buffer of the current copy on success
+		*
+		*  @return
+		*    "true" if all went fine, else "false" in which case the caller has to fall back to a traditional buffer
 		*/
-		inline explicit VertexBuffer(OpenGLRhi& openGLRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			IVertexBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLArrayBuffer(0)
-		{}
+		[[nodiscard]] bool create(uint32_t numberOfBytes, const void* data, GLuint& openGLBuffer)
+		{
+			// "GL_MAP_COHERENT_BIT" spares us explicit flushes, CPU writes become visible to GPU commands issued afterwards
+			// -> Write-only, the CPU never reads back what it streams to the GPU, see "OpenGLRhi::StreamingBuffer::isMapTypeSupported()"
+			static constexpr GLbitfield FLAGS = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
 
+			// Create and persistently map the OpenGL buffer copies
+			// -> Each copy starts with the initial data so all copies are consistent no matter which copy is current
+			glCreateBuffers(static_cast<GLsizei>(NUMBER_OF_COPIES), mOpenGLBuffers);
+			for (uint32_t i = 0; i < NUMBER_OF_COPIES; ++i)
+			{
+				glNamedBufferStorage(mOpenGLBuffers[i], static_cast<GLsizeiptr>(numberOfBytes), data, FLAGS);
+				mMappedData[i] = static_cast<uint8_t*>(glMapNamedBufferRange(mOpenGLBuffers[i], 0, static_cast<GLsizeiptr>(numberOfBytes), FLAGS));
+				if (nullptr == mMappedData[i])
+				{
+					// Error!
+					destroy();
+					return false;
+				}
+			}
 
-	//[-------------------------------------------------------]
-	//[ Protected data                                        ]
-	//[-------------------------------------------------------]
-	protected:
-		GLuint mOpenGLArrayBuffer;	///< OpenGL array buffer, can be zero if no resource is allocated
+			// Done
+			openGLBuffer = mOpenGLBuffers[mCurrentCopyIndex];
+			return true;
+		}
 
+		/**
+		*  @brief
+		*    Return whether or not the streaming buffer has been created successfully
+		*
+		*  @return
+		*    "true" if the streaming buffer is in use, else "false"
+		*/
+		[[nodiscard]] inline bool isStreaming() const
+		{
+			return (nullptr != mMappedData[0]);
+		}
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	private:
-		explicit VertexBuffer(const VertexBuffer& source) = delete;
-		VertexBuffer& operator =(const VertexBuffer& source) = delete;
+		/**
+		*  @brief
+		*    Map the streaming buffer
+		*
+		*  @param[in] mapType
+		*    Map type, must be supported, see "OpenGLRhi::StreamingBuffer::isMapTypeSupported()", "Rhi::MapType::WRITE_DISCARD" switches to the next buffer copy, "Rhi::MapType::WRITE_NO_OVERWRITE" never waits
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*
+		*  @return
+		*    The OpenGL buffer of the current copy, from now on to be used for binding, do not destroy the returned resource
+		*
+		*  @note
+		*    - Unmapping isn't required, the buffer copies stay mapped
+		*/
+		[[nodiscard]] GLuint map(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			if (Rhi::MapType::WRITE_DISCARD == mapType)
+			{
+				// Fence the GPU commands issued so far which might still read from the copy we're leaving, then move on to the next copy
+				insertFence(mCurrentCopyIndex);
+				mCurrentCopyIndex = (mCurrentCopyIndex + 1) % NUMBER_OF_COPIES;
+				waitForFence(mCurrentCopyIndex);
+			}
+			else if (Rhi::MapType::WRITE_NO_OVERWRITE != mapType)
+			{
+				// Partially writing the current copy requires the GPU to be done with it
+				insertFence(mCurrentCopyIndex);
+				waitForFence(mCurrentCopyIndex);
+			}
+
+			// Done
+			mappedSubresource.data		 = mMappedData[mCurrentCopyIndex];
+			mappedSubresource.rowPitch   = 0;
+			mappedSubresource.depthPitch = 0;
+			return mOpenGLBuffers[mCurrentCopyIndex];
+		}
+
+		#ifdef RHI_DEBUG
+			/**
+			*  @brief
+			*    Assign the given debug name to all buffer copies
+			*
+			*  @param[in] debugName
+			*    ASCII debug name, must be valid
+			*/
+			void setDebugName(const char* debugName) const
+			{
+				for (uint32_t i = 0; i < NUMBER_OF_COPIES; ++i)
+				{
+					glObjectLabel(GL_BUFFER, mOpenGLBuffers[i], -1, debugName);
+				}
+			}
+		#endif
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit StreamingBuffer(const StreamingBuffer& source) = delete;
+		StreamingBuffer& operator =(const StreamingBuffer& source) = delete;
+
+		void destroy()
+		{
+			// Destroy the OpenGL fences
+			// -> Silently ignores 0's
+			for (uint32_t i = 0; i < NUMBER_OF_COPIES; ++i)
+			{
+				glDeleteSync(mOpenGLSyncs[i]);
+				mOpenGLSyncs[i] = nullptr;
+				mMappedData[i] = nullptr;
+			}
+
+			// Destroy the OpenGL buffer copies, this implicitly unmaps them
+			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
+			glDeleteBuffersARB(static_cast<GLsizei>(NUMBER_OF_COPIES), mOpenGLBuffers);
+			for (uint32_t i = 0; i < NUMBER_OF_COPIES; ++i)
+			{
+				mOpenGLBuffers[i] = 0;
+			}
+		}
+
+		void insertFence(uint32_t copyIndex)
+		{
+			// A new fence supersedes an older one of the same copy
+			GLsync& openGLSync = mOpenGLSyncs[copyIndex];
+			if (nullptr != openGLSync)
+			{
+				glDeleteSync(openGLSync);
+			}
+			openGLSync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+
+		void waitForFence(uint32_t copyIndex)
+		{
+			GLsync& openGLSync = mOpenGLSyncs[copyIndex];
+			if (nullptr != openGLSync)
+			{
+				// Flush on the first wait, else we might wait forever on commands which never reach the GPU
+				static constexpr GLuint64 TIMEOUT_IN_NANOSECONDS = 1000000000;
+				GLenum result = glClientWaitSync(openGLSync, GL_SYNC_FLUSH_COMMANDS_BIT, TIMEOUT_IN_NANOSECONDS);
+				while (GL_TIMEOUT_EXPIRED == result)
+				{
+					result = glClientWaitSync(openGLSync, 0, TIMEOUT_IN_NANOSECONDS);
+				}
+				glDeleteSync(openGLSync);
+				openGLSync = nullptr;
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mCurrentCopyIndex;					///< Index of the buffer copy currently used for writing and binding
+		GLuint	 mOpenGLBuffers[NUMBER_OF_COPIES];	///< OpenGL buffer copies, can be zero if no resource is allocated
+		uint8_t* mMappedData[NUMBER_OF_COPIES];		///< Persistently mapped data of the OpenGL buffer copies, null pointer if the streaming buffer isn't in use
+		GLsync	 mOpenGLSyncs[NUMBER_OF_COPIES];	///< OpenGL fences guarding the buffer copies, null pointer if there's nothing to wait for
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ OpenGLRhi/Buffer/VertexBuffer.h                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Abstract OpenGL vertex buffer object (VBO, "array buffer" in OpenGL terminology) interface
+	*/
+	class VertexBuffer : public Rhi::IVertexBuffer
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline virtual ~VertexBuffer() override
+		{
+			// Destroy the OpenGL array buffer
+			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
+			glDeleteBuffersARB(1, &mOpenGLArrayBuffer);
+		}
+
+		/**
+		*  @brief
+		*    Return the OpenGL array buffer
+		*
+		*  @return
+		*    The OpenGL array buffer, can be zero if no resource is allocated, do not destroy the returned resource
+		*/
+		[[nodiscard]] inline GLuint getOpenGLArrayBuffer() const
+		{
+			return mOpenGLArrayBuffer;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual Rhi::RefCount methods               ]
+	//[-------------------------------------------------------]
+	protected:
+		inline virtual void selfDestruct() override
+		{
+			RHI_DELETE(getRhi().getContext(), VertexBuffer, this);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*/
+		inline explicit VertexBuffer(OpenGLRhi& openGLRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			IVertexBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mOpenGLArrayBuffer(0)
+		{}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected data                                        ]
+	//[-------------------------------------------------------]
+	protected:
+		GLuint mOpenGLArrayBuffer;	///< OpenGL array buffer, can be zero if no resource is allocated
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit VertexBuffer(const VertexBuffer& source) = delete;
+		VertexBuffer& operator =(const VertexBuffer& source) = delete;
 
 
 	};
@@ -6863,7 +7452,11 @@ namespace OpenGLRhi
 
 			// Destroy the OpenGL texture buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
-			glDeleteBuffersARB(1, &mOpenGLTextureBuffer);
+			// -> Streamed buffer copies are owned by the streaming buffer
+			if (!mStreamingBuffer.isStreaming())
+			{
+				glDeleteBuffersARB(1, &mOpenGLTextureBuffer);
+			}
 		}
 
 		/**
@@ -6902,6 +7495,38 @@ namespace OpenGLRhi
 			return mOpenGLInternalFormat;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the texture buffer is streamed through persistently mapped buffer copies
+		*
+		*  @return
+		*    "true" if the texture buffer is streamed, else "false"
+		*/
+		[[nodiscard]] inline bool isStreaming() const
+		{
+			return mStreamingBuffer.isStreaming();
+		}
+
+		/**
+		*  @brief
+		*    Map the streamed texture buffer, only valid if "OpenGLRhi::TextureBuffer::isStreaming()" returns "true"
+		*
+		*  @param[in] mapType
+		*    Map type
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*/
+		void mapStreamingBuffer(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			const GLuint openGLTextureBuffer = mStreamingBuffer.map(mapType, mappedSubresource);
+			if (mOpenGLTextureBuffer != openGLTextureBuffer)
+			{
+				// Attach the storage of the current buffer copy to the buffer texture
+				mOpenGLTextureBuffer = openGLTextureBuffer;
+				glTextureBuffer(mOpenGLTexture, mOpenGLInternalFormat, mOpenGLTextureBuffer);
+			}
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -6938,9 +7563,10 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLTextureBuffer;	///< OpenGL texture buffer, can be zero if no resource is allocated
-		GLuint mOpenGLTexture;			///< OpenGL texture, can be zero if no resource is allocated
-		GLuint mOpenGLInternalFormat;	///< OpenGL internal format
+		GLuint			mOpenGLTextureBuffer;	///< OpenGL texture buffer, can be zero if no resource is allocated, current buffer copy if streamed
+		GLuint			mOpenGLTexture;			///< OpenGL texture, can be zero if no resource is allocated
+		GLuint			mOpenGLInternalFormat;	///< OpenGL internal format
+		StreamingBuffer mStreamingBuffer;		///< Streaming buffer, only used for dynamic texture buffers if supported
 
 
 	//[-------------------------------------------------------]
@@ -7089,17 +7715,21 @@ namespace OpenGLRhi
 		*    Number of bytes within the texture buffer, must be valid
 		*  @param[in] data
 		*    Texture buffer data, can be a null pointer (empty buffer)
+		*  @param[in] bufferFlags
+		*    Buffer flags, see "Rhi::BufferFlag"
 		*  @param[in] bufferUsage
 		*    Indication of the buffer usage
 		*  @param[in] textureFormat
 		*    Texture buffer data format
 		*/
-		TextureBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		TextureBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, uint32_t bufferFlags, Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			TextureBuffer(openGLRhi, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
-				{ // Buffer part
+				// Buffer part: Dynamic texture buffers are streamed through persistently mapped buffer copies if possible
+				if (!StreamingBuffer::isSupported(openGLRhi.getExtensions(), bufferUsage, (bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0) || !mStreamingBuffer.create(numberOfBytes, data, mOpenGLTextureBuffer))
+				{
 					// Create the OpenGL texture buffer
 					glCreateBuffers(1, &mOpenGLTextureBuffer);
 
@@ -7156,7 +7786,14 @@ namespace OpenGLRhi
 				{
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "TBO", 6)	// 6 = "TBO: " including terminating zero
 					glObjectLabel(GL_TEXTURE, mOpenGLTexture, -1, detailedDebugName);
-					glObjectLabel(GL_BUFFER, mOpenGLTextureBuffer, -1, detailedDebugName);
+					if (mStreamingBuffer.isStreaming())
+					{
+						mStreamingBuffer.setDebugName(detailedDebugName);
+					}
+					else
+					{
+						glObjectLabel(GL_BUFFER, mOpenGLTextureBuffer, -1, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -7454,7 +8091,11 @@ namespace OpenGLRhi
 		{
 			// Destroy the OpenGL indirect buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
-			glDeleteBuffersARB(1, &mOpenGLIndirectBuffer);
+			// -> Streamed buffer copies are owned by the streaming buffer
+			if (!mStreamingBuffer.isStreaming())
+			{
+				glDeleteBuffersARB(1, &mOpenGLIndirectBuffer);
+			}
 		}
 
 		/**
@@ -7469,6 +8110,32 @@ namespace OpenGLRhi
 			return mOpenGLIndirectBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the indirect buffer is streamed through persistently mapped buffer copies
+		*
+		*  @return
+		*    "true" if the indirect buffer is streamed, else "false"
+		*/
+		[[nodiscard]] inline bool isStreaming() const
+		{
+			return mStreamingBuffer.isStreaming();
+		}
+
+		/**
+		*  @brief
+		*    Map the streamed indirect buffer, only valid if "OpenGLRhi::IndirectBuffer::isStreaming()" returns "true"
+		*
+		*  @param[in] mapType
+		*    Map type
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*/
+		inline void mapStreamingBuffer(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			mOpenGLIndirectBuffer = mStreamingBuffer.map(mapType, mappedSubresource);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Rhi::IIndirectBuffer methods           ]
@@ -7511,7 +8178,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated
+		GLuint			mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated, current buffer copy if streamed
+		StreamingBuffer mStreamingBuffer;		///< Streaming buffer, only used for dynamic indirect buffers if supported
 
 
 	//[-------------------------------------------------------]
@@ -7633,20 +8301,26 @@ namespace OpenGLRhi
 		*    Number of bytes within the indirect buffer, must be valid
 		*  @param[in] data
 		*    Indirect buffer data, can be a null pointer (empty buffer), the data is internally copied and you have to free your memory if you no longer need it
+		*  @param[in] indirectBufferFlags
+		*    Indirect buffer flags, see "Rhi::IndirectBufferFlag"
 		*  @param[in] bufferUsage
 		*    Indication of the buffer usage
 		*/
-		IndirectBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		IndirectBufferDsa(OpenGLRhi& openGLRhi, uint32_t numberOfBytes, const void* data, uint32_t indirectBufferFlags, Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IndirectBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
 		{
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
-				// Create the OpenGL indirect buffer
-				glCreateBuffers(1, &mOpenGLIndirectBuffer);
+				// Dynamic indirect buffers are streamed through persistently mapped buffer copies if possible
+				if (!StreamingBuffer::isSupported(openGLRhi.getExtensions(), bufferUsage, (indirectBufferFlags & Rhi::IndirectBufferFlag::UNORDERED_ACCESS) != 0) || !mStreamingBuffer.create(numberOfBytes, data, mOpenGLIndirectBuffer))
+				{
+					// Create the OpenGL indirect buffer
+					glCreateBuffers(1, &mOpenGLIndirectBuffer);
 
-				// Upload the data
-				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+					// Upload the data
+					// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
+					glNamedBufferData(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				}
 			}
 			else
 			{
@@ -7663,7 +8337,14 @@ namespace OpenGLRhi
 				if (openGLRhi.getExtensions().isGL_KHR_debug())
 				{
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IndirectBufferObject", 23)	// 23 = "IndirectBufferObject: " including terminating zero
-					glObjectLabel(GL_BUFFER, mOpenGLIndirectBuffer, -1, detailedDebugName);
+					if (mStreamingBuffer.isStreaming())
+					{
+						mStreamingBuffer.setDebugName(detailedDebugName);
+					}
+					else
+					{
+						glObjectLabel(GL_BUFFER, mOpenGLIndirectBuffer, -1, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -7712,7 +8393,11 @@ namespace OpenGLRhi
 		{
 			// Destroy the OpenGL uniform buffer
 			// -> Silently ignores 0's and names that do not correspond to existing buffer objects
-			glDeleteBuffersARB(1, &mOpenGLUniformBuffer);
+			// -> Streamed buffer copies are owned by the streaming buffer
+			if (!mStreamingBuffer.isStreaming())
+			{
+				glDeleteBuffersARB(1, &mOpenGLUniformBuffer);
+			}
 		}
 
 		/**
@@ -7727,6 +8412,32 @@ namespace OpenGLRhi
 			return mOpenGLUniformBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the uniform buffer is streamed through persistently mapped buffer copies
+		*
+		*  @return
+		*    "true" if the uniform buffer is streamed, else "false"
+		*/
+		[[nodiscard]] inline bool isStreaming() const
+		{
+			return mStreamingBuffer.isStreaming();
+		}
+
+		/**
+		*  @brief
+		*    Map the streamed uniform buffer, only valid if "OpenGLRhi::UniformBuffer::isStreaming()" returns "true"
+		*
+		*  @param[in] mapType
+		*    Map type
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*/
+		inline void mapStreamingBuffer(Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		{
+			mOpenGLUniformBuffer = mStreamingBuffer.map(mapType, mappedSubresource);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -7759,7 +8470,8 @@ namespace OpenGLRhi
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		GLuint mOpenGLUniformBuffer;	///< OpenGL uniform buffer, can be zero if no resource is allocated
+		GLuint			mOpenGLUniformBuffer;	///< OpenGL uniform buffer, can be zero if no resource is allocated, current buffer copy if streamed
+		StreamingBuffer mStreamingBuffer;		///< Streaming buffer, only used for dynamic uniform buffers if supported
 
 
 	//[-------------------------------------------------------]
@@ -7893,12 +8605,16 @@ namespace OpenGLRhi
 
 			if (openGLRhi.getExtensions().isGL_ARB_direct_state_access())
 			{
-				// Create the OpenGL uniform buffer
-				glCreateBuffers(1, &mOpenGLUniformBuffer);
+				// Dynamic uniform buffers are streamed through persistently mapped buffer copies if possible
+				if (!StreamingBuffer::isSupported(openGLRhi.getExtensions(), bufferUsage, false) || !mStreamingBuffer.create(numberOfBytes, data, mOpenGLUniformBuffer))
+				{
+					// Create the OpenGL uniform buffer
+					glCreateBuffers(1, &mOpenGLUniformBuffer);
 
-				// Upload the data
-				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLUniformBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+					// Upload the data
+					// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
+					glNamedBufferData(mOpenGLUniformBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				}
 			}
 			else
 			{
@@ -7915,7 +8631,14 @@ namespace OpenGLRhi
 				if (openGLRhi.getExtensions().isGL_KHR_debug())
 				{
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "UBO", 6)	// 6 = "UBO: " including terminating zero
-					glObjectLabel(GL_BUFFER, mOpenGLUniformBuffer, -1, detailedDebugName);
+					if (mStreamingBuffer.isStreaming())
+					{
+						mStreamingBuffer.setDebugName(detailedDebugName);
+					}
+					else
+					{
+						glObjectLabel(GL_BUFFER, mOpenGLUniformBuffer, -1, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -8089,7 +8812,7 @@ namespace OpenGLRhi
 			return nullptr;
 		}
 
-		[[nodiscard]] virtual Rhi::ITextureBuffer* createTextureBuffer(uint32_t numberOfBytes, const void* data = nullptr, uint32_t = Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::ITextureBuffer* createTextureBuffer(uint32_t numberOfBytes, const void* data = nullptr, uint32_t bufferFlags = Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			OpenGLRhi& openGLRhi = static_cast<OpenGLRhi&>(getRhi());
 
@@ -8103,7 +8826,7 @@ namespace OpenGLRhi
 				if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
 				{
 					// Effective direct state access (DSA)
-					return RHI_NEW(openGLRhi.getContext(), TextureBufferDsa)(openGLRhi, numberOfBytes, data, bufferUsage, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+					return RHI_NEW(openGLRhi.getContext(), TextureBufferDsa)(openGLRhi, numberOfBytes, data, bufferFlags, bufferUsage, textureFormat RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 				}
 				else
 				{
@@ -8148,7 +8871,7 @@ namespace OpenGLRhi
 			}
 		}
 
-		[[nodiscard]] virtual Rhi::IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, [[maybe_unused]] uint32_t indirectBufferFlags = 0, Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] virtual Rhi::IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, const void* data = nullptr, uint32_t indirectBufferFlags = 0, Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			OpenGLRhi& openGLRhi = static_cast<OpenGLRhi&>(getRhi());
 
@@ -8165,7 +8888,7 @@ namespace OpenGLRhi
 				if (mExtensions->isGL_EXT_direct_state_access() || mExtensions->isGL_ARB_direct_state_access())
 				{
 					// Effective direct state access (DSA)
-					return RHI_NEW(openGLRhi.getContext(), IndirectBufferDsa)(openGLRhi, numberOfBytes, data, bufferUsage RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+					return RHI_NEW(openGLRhi.getContext(), IndirectBufferDsa)(openGLRhi, numberOfBytes, data, indirectBufferFlags, bufferUsage RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 				}
 				else
 				{
@@ -16150,31 +16873,411 @@ namespace OpenGLRhi
 
 
 	//[-------------------------------------------------------]
-	//[ OpenGLRhi/Shader/Separate/VertexShaderSeparate.h      ]
+	//[ OpenGLRhi/Shader/Separate/ProgramBinaryCache.h        ]
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Separate vertex shader class
+	*    OpenGL program binary cache ("GL_ARB_get_program_binary"), avoids compiling and linking separate shader programs from source code
+	*
+	*  @remarks
+	*    Linked program binaries are collected while shader programs are created from source code and serialized via "Rhi::IRhi::getPipelineCacheData()".
+	*    When fed back via "Rhi::IRhi::setPipelineCacheData()" during the next run, shader programs are created by "glProgramBinary()" instead.
+	*    Program binaries are only valid for the driver which produced them, so the serialized data is tagged with a hash of the OpenGL vendor,
+	*    renderer and version strings. If a driver rejects a program binary nevertheless, the shader program is compiled from source code as usual.
 	*/
-	class VertexShaderSeparate final : public Rhi::IVertexShader
+	class ProgramBinaryCache final
 	{
 
 
 	//[-------------------------------------------------------]
-	//[ Public methods                                        ]
+	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
 	public:
 		/**
 		*  @brief
-		*    Constructor for creating a vertex shader from shader bytecode
+		*    Calculate the program binary key of a separate shader program
 		*
-		*  @param[in] openGLRhi
-		*    Owner OpenGL RHI instance
+		*  @param[in] shaderType
+		*    Shader type (for example "GL_VERTEX_SHADER_ARB")
+		*  @param[in] sourceCode
+		*    Shader ASCII source code, must be a valid pointer
 		*  @param[in] vertexAttributes
-		*    Vertex attributes ("vertex declaration" in Direct3D 9 terminology, "input layout" in Direct3D 10 & 11 terminology)
-		*  @param[in] shaderBytecode
-		*    Shader bytecode
-		*/
+		*    Vertex attributes bound to the vertex shader program, null pointer for none
+		*
+		*  @return
+		*    The program binary key covering everything which influences the linked program
+		*/
+		[[nodiscard]] static uint64_t calculateKey(GLenum shaderType, const char* sourceCode, const Rhi::VertexAttributes* vertexAttributes)
+		{
+			uint64_t key = hash(FNV1A_OFFSET_BASIS, &shaderType, sizeof(GLenum));
+			key = hash(key, sourceCode, strlen(sourceCode));
+			if (nullptr != vertexAttributes)
+			{
+				for (uint32_t i = 0; i < vertexAttributes->numberOfAttributes; ++i)
+				{
+					const char* name = vertexAttributes->attributes[i].name;
+					key = hash(key, name, strlen(name) + 1);
+				}
+			}
+			return key;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] context
+		*    RHI context to use
+		*
+		*  @note
+		*    - The OpenGL context must be current
+		*/
+		explicit ProgramBinaryCache(const Rhi::Context& context) :
+			mContext(context),
+			mDriverHash(FNV1A_OFFSET_BASIS),
+			mNumberOfEntries(0),
+			mMaximumNumberOfEntries(0),
+			mEntries(nullptr)
+		{
+			// Program binaries are only valid for the exact driver which produced them
+			const GLenum names[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+			for (GLenum name : names)
+			{
+				const char* string = reinterpret_cast<const char*>(glGetString(name));
+				if (nullptr != string)
+				{
+					mDriverHash = hash(mDriverHash, string, strlen(string) + 1);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~ProgramBinaryCache()
+		{
+			for (uint32_t i = 0; i < mNumberOfEntries; ++i)
+			{
+				RHI_FREE(mContext, mEntries[i].data);
+			}
+			RHI_FREE(mContext, mEntries);
+		}
+
+		/**
+		*  @brief
+		*    Create a separate shader program from a cached program binary
+		*
+		*  @param[in] key
+		*    Program binary key, see "OpenGLRhi::ProgramBinaryCache::calculateKey()"
+		*
+		*  @return
+		*    The OpenGL shader program, 0 if there's no program binary or if it has been rejected by the driver, destroy the resource if you no longer need it
+		*/
+		[[nodiscard]] GLuint loadProgram(uint64_t key)
+		{
+			const uint32_t index = findEntryIndex(key);
+			if (index < mNumberOfEntries && mEntries[index].key == key)
+			{
+				const Entry& entry = mEntries[index];
+				const GLuint openGLProgram = glCreateProgram();
+				glProgramParameteri(openGLProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+				glProgramBinary(openGLProgram, entry.openGLBinaryFormat, entry.data, static_cast<GLsizei>(entry.numberOfBytes));
+
+				// Check the link status, drivers are allowed to reject program binaries at any time (e.g. after a driver update without a version string change)
+				GLint linked = GL_FALSE;
+				glGetProgramiv(openGLProgram, GL_LINK_STATUS, &linked);
+				if (GL_TRUE == linked)
+				{
+					// Done
+					return openGLProgram;
+				}
+
+				// Destroy the program and forget about the rejected program binary, the caller falls back to source code and stores a new one
+				glDeleteProgram(openGLProgram);
+				removeEntry(index);
+			}
+
+			// Error!
+			return 0;
+		}
+
+		/**
+		*  @brief
+		*    Store the program binary of a successfully linked separate shader program
+		*
+		*  @param[in] key
+		*    Program binary key, see "OpenGLRhi::ProgramBinaryCache::calculateKey()"
+		*  @param[in] openGLProgram
+		*    Successfully linked OpenGL shader program
+		*/
+		void storeProgram(uint64_t key, GLuint openGLProgram)
+		{
+			// Drivers are allowed to return no program binary at all
+			GLint numberOfBytes = 0;
+			glGetProgramiv(openGLProgram, GL_PROGRAM_BINARY_LENGTH, &numberOfBytes);
+			if (numberOfBytes > 0)
+			{
+				uint8_t* data = RHI_MALLOC_TYPED(mContext, uint8_t, numberOfBytes);
+				GLenum openGLBinaryFormat = GL_NONE;
+				glGetProgramBinary(openGLProgram, numberOfBytes, &numberOfBytes, &openGLBinaryFormat, data);
+				if (numberOfBytes > 0)
+				{
+					insertEntry(key, openGLBinaryFormat, static_cast<uint32_t>(numberOfBytes), data);
+				}
+				else
+				{
+					RHI_FREE(mContext, data);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Serialize the program binary cache, see "Rhi::IRhi::getPipelineCacheData()"
+		*/
+		[[nodiscard]] uint32_t getData(uint32_t numberOfDataBytes, uint8_t* data) const
+		{
+			// Calculate the number of required bytes
+			uint32_t numberOfRequiredBytes = sizeof(Header);
+			for (uint32_t i = 0; i < mNumberOfEntries; ++i)
+			{
+				numberOfRequiredBytes += sizeof(EntryHeader) + mEntries[i].numberOfBytes;
+			}
+			if (nullptr == data)
+			{
+				return (mNumberOfEntries > 0) ? numberOfRequiredBytes : 0;
+			}
+			if (numberOfDataBytes < numberOfRequiredBytes)
+			{
+				// Error!
+				return 0;
+			}
+
+			// Write the header followed by the entries
+			const Header header = { FORMAT_VERSION, mNumberOfEntries, mDriverHash };
+			memcpy(data, &header, sizeof(Header));
+			data += sizeof(Header);
+			for (uint32_t i = 0; i < mNumberOfEntries; ++i)
+			{
+				const Entry& entry = mEntries[i];
+				const EntryHeader entryHeader = { entry.key, entry.openGLBinaryFormat, entry.numberOfBytes };
+				memcpy(data, &entryHeader, sizeof(EntryHeader));
+				data += sizeof(EntryHeader);
+				memcpy(data, entry.data, entry.numberOfBytes);
+				data += entry.numberOfBytes;
+			}
+
+			// Done
+			return numberOfRequiredBytes;
+		}
+
+		/**
+		*  @brief
+		*    Deserialize program binaries previously received via "OpenGLRhi::ProgramBinaryCache::getData()", see "Rhi::IRhi::setPipelineCacheData()"
+		*/
+		[[nodiscard]] bool setData(uint32_t numberOfDataBytes, const uint8_t* data)
+		{
+			// Validate the header against the used driver
+			if (numberOfDataBytes < sizeof(Header))
+			{
+				return false;
+			}
+			Header header;
+			memcpy(&header, data, sizeof(Header));
+			if (FORMAT_VERSION != header.formatVersion || mDriverHash != header.driverHash)
+			{
+				// Not an error, the data was just written by another driver
+				RHI_LOG(mContext, INFORMATION, "Ignoring OpenGL program binaries which were created by another driver")
+				return false;
+			}
+
+			// Read the entries
+			const uint8_t* dataEnd = data + numberOfDataBytes;
+			data += sizeof(Header);
+			for (uint32_t i = 0; i < header.numberOfEntries; ++i)
+			{
+				EntryHeader entryHeader;
+				if (static_cast<size_t>(dataEnd - data) < sizeof(EntryHeader))
+				{
+					return false;
+				}
+				memcpy(&entryHeader, data, sizeof(EntryHeader));
+				data += sizeof(EntryHeader);
+				if (static_cast<size_t>(dataEnd - data) < entryHeader.numberOfBytes)
+				{
+					return false;
+				}
+				uint8_t* entryData = RHI_MALLOC_TYPED(mContext, uint8_t, entryHeader.numberOfBytes);
+				memcpy(entryData, data, entryHeader.numberOfBytes);
+				data += entryHeader.numberOfBytes;
+				insertEntry(entryHeader.key, entryHeader.openGLBinaryFormat, entryHeader.numberOfBytes, entryData);
+			}
+
+			// Done
+			return true;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint64_t FNV1A_OFFSET_BASIS = 0xcbf29ce484222325;
+		static constexpr uint64_t FNV1A_PRIME		 = 0x100000001b3;
+		static constexpr uint32_t FORMAT_VERSION	 = 1;
+		struct Header final
+		{
+			uint32_t formatVersion;
+			uint32_t numberOfEntries;
+			uint64_t driverHash;
+		};
+		struct EntryHeader final
+		{
+			uint64_t key;
+			GLenum	 openGLBinaryFormat;
+			uint32_t numberOfBytes;
+		};
+		struct Entry final
+		{
+			uint64_t key;
+			GLenum	 openGLBinaryFormat;
+			uint32_t numberOfBytes;
+			uint8_t* data;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] static uint64_t hash(uint64_t hash, const void* data, size_t numberOfBytes)
+		{
+			// FNV-1a
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < numberOfBytes; ++i)
+			{
+				hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+			}
+			return hash;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit ProgramBinaryCache(const ProgramBinaryCache& source) = delete;
+		ProgramBinaryCache& operator =(const ProgramBinaryCache& source) = delete;
+
+		[[nodiscard]] uint32_t findEntryIndex(uint64_t key) const
+		{
+			// Binary search, the entries are sorted by key
+			uint32_t first = 0;
+			uint32_t last = mNumberOfEntries;
+			while (first < last)
+			{
+				const uint32_t middle = first + (last - first) / 2;
+				if (mEntries[middle].key < key)
+				{
+					first = middle + 1;
+				}
+				else
+				{
+					last = middle;
+				}
+			}
+			return first;
+		}
+
+		void insertEntry(uint64_t key, GLenum openGLBinaryFormat, uint32_t numberOfBytes, uint8_t* data)
+		{
+			const uint32_t index = findEntryIndex(key);
+			if (index < mNumberOfEntries && mEntries[index].key == key)
+			{
+				// Replace the existing program binary
+				Entry& entry = mEntries[index];
+				RHI_FREE(mContext, entry.data);
+				entry.openGLBinaryFormat = openGLBinaryFormat;
+				entry.numberOfBytes = numberOfBytes;
+				entry.data = data;
+				return;
+			}
+
+			// Grow the entries, if necessary
+			if (mNumberOfEntries == mMaximumNumberOfEntries)
+			{
+				mMaximumNumberOfEntries = (0 == mMaximumNumberOfEntries) ? 64 : mMaximumNumberOfEntries * 2;
+				Entry* entries = RHI_MALLOC_TYPED(mContext, Entry, mMaximumNumberOfEntries);
+				if (nullptr != mEntries)
+				{
+					memcpy(entries, mEntries, sizeof(Entry) * mNumberOfEntries);
+					RHI_FREE(mContext, mEntries);
+				}
+				mEntries = entries;
+			}
+
+			// Insert the entry while keeping the sort order
+			memmove(&mEntries[index + 1], &mEntries[index], sizeof(Entry) * (mNumberOfEntries - index));
+			mEntries[index] = { key, openGLBinaryFormat, numberOfBytes, data };
+			++mNumberOfEntries;
+		}
+
+		void removeEntry(uint32_t index)
+		{
+			RHI_FREE(mContext, mEntries[index].data);
+			--mNumberOfEntries;
+			memmove(&mEntries[index], &mEntries[index + 1], sizeof(Entry) * (mNumberOfEntries - index));
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		const Rhi::Context& mContext;					///< RHI context
+		uint64_t			mDriverHash;				///< FNV-1a hash of the OpenGL vendor, renderer and version strings
+		uint32_t			mNumberOfEntries;			///< Number of program binary entries
+		uint32_t			mMaximumNumberOfEntries;	///< Number of program binary entries "mEntries" can hold
+		Entry*				mEntries;					///< Program binary entries sorted by key, can be a null pointer
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ OpenGLRhi/Shader/Separate/VertexShaderSeparate.h      ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Separate vertex shader class
+	*/
+	class VertexShaderSeparate final : public Rhi::IVertexShader
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor for creating a vertex shader from shader bytecode
+		*
+		*  @param[in] openGLRhi
+		*    Owner OpenGL RHI instance
+		*  @param[in] vertexAttributes
+		*    Vertex attributes ("vertex declaration" in Direct3D 9 terminology, "input layout" in Direct3D 10 & 11 terminology)
+		*  @param[in] shaderBytecode
+		*    Shader bytecode
+		*/
 		inline VertexShaderSeparate(OpenGLRhi& openGLRhi, const Rhi::VertexAttributes& vertexAttributes, const Rhi::ShaderBytecode& shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IVertexShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLShaderProgram(::detail::loadShaderProgramFromBytecode(openGLRhi.getContext(), vertexAttributes, GL_VERTEX_SHADER_ARB, shaderBytecode)),
@@ -16203,7 +17306,7 @@ namespace OpenGLRhi
 		*/
 		inline VertexShaderSeparate(OpenGLRhi& openGLRhi, const Rhi::VertexAttributes& vertexAttributes, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IVertexShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourcecode(openGLRhi.getContext(), vertexAttributes, GL_VERTEX_SHADER_ARB, sourceCode)),
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_VERTEX_SHADER_ARB, sourceCode, &vertexAttributes)),
 			mDrawIdUniformLocation(openGLRhi.getExtensions().isGL_ARB_base_instance() ? -1 : glGetUniformLocation(mOpenGLShaderProgram, "drawIdUniform"))
 		{
 			// Return shader bytecode, if requested do to so
@@ -16348,7 +17451,7 @@ namespace OpenGLRhi
 		*/
 		inline TessellationControlShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITessellationControlShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_TESS_CONTROL_SHADER, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_TESS_CONTROL_SHADER, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -16479,7 +17582,7 @@ namespace OpenGLRhi
 		*/
 		inline TessellationEvaluationShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITessellationEvaluationShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_TESS_EVALUATION_SHADER, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_TESS_EVALUATION_SHADER, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -16610,7 +17713,7 @@ namespace OpenGLRhi
 		*/
 		inline GeometryShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IGeometryShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_GEOMETRY_SHADER_ARB, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_GEOMETRY_SHADER_ARB, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -16741,7 +17844,7 @@ namespace OpenGLRhi
 		*/
 		inline FragmentShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IFragmentShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_FRAGMENT_SHADER_ARB, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_FRAGMENT_SHADER_ARB, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -16872,7 +17975,7 @@ namespace OpenGLRhi
 		*/
 		inline TaskShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITaskShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_TASK_SHADER_NV, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_TASK_SHADER_NV, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -17003,7 +18106,7 @@ namespace OpenGLRhi
 		*/
 		inline MeshShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IMeshShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_MESH_SHADER_NV, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_MESH_SHADER_NV, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -17134,7 +18237,7 @@ namespace OpenGLRhi
 		*/
 		inline ComputeShaderSeparate(OpenGLRhi& openGLRhi, const char* sourceCode, Rhi::ShaderBytecode* shaderBytecode RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IComputeShader(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLShaderProgram(::detail::loadShaderProgramFromSourceCode(openGLRhi.getContext(), GL_COMPUTE_SHADER, sourceCode))
+			mOpenGLShaderProgram(openGLRhi.loadShaderProgramFromSourceCode(GL_COMPUTE_SHADER, sourceCode))
 		{
 			// Return shader bytecode, if requested do to so
 			if (nullptr != shaderBytecode)
@@ -18806,7 +19909,7 @@ namespace
 
 		[[nodiscard]] bool mapBuffer([[maybe_unused]] const Rhi::Context& context, const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
 		{
-			// TODO(co) This buffer update isn't efficient, use e.g. persistent buffer mapping
+			// TODO(co) This buffer update isn't efficient, dynamic uniform, indirect and texture buffers are streamed via "OpenGLRhi::StreamingBuffer" if possible, do the same for the remaining buffer types
 
 			// Is "GL_ARB_direct_state_access" there?
 			if (extensions.isGL_ARB_direct_state_access())
@@ -18975,7 +20078,11 @@ namespace
 			void DrawIndexedGraphics(const void* data, Rhi::IRhi& rhi)
 			{
 				const Rhi::Command::DrawIndexedGraphics* realData = static_cast<const Rhi::Command::DrawIndexedGraphics*>(data);
-				if (nullptr != realData->indirectBuffer)
+				if (nullptr != realData->countBuffer)
+				{
+					static_cast<OpenGLRhi::OpenGLRhi&>(rhi).drawIndexedGraphicsCount(*realData->indirectBuffer, realData->indirectBufferOffset, realData->numberOfDraws, *realData->countBuffer, realData->countBufferOffset);
+				}
+				else if (nullptr != realData->indirectBuffer)
 				{
 					static_cast<OpenGLRhi::OpenGLRhi&>(rhi).drawIndexedGraphics(*realData->indirectBuffer, realData->indirectBufferOffset, realData->numberOfDraws);
 				}
@@ -19205,6 +20312,7 @@ namespace OpenGLRhi
 		mOpenGLRuntimeLinking(nullptr),
 		mOpenGLContext(nullptr),
 		mExtensions(nullptr),
+		mProgramBinaryCache(nullptr),
 		mShaderLanguage(nullptr),
 		mGraphicsRootSignature(nullptr),
 		mComputeRootSignature(nullptr),
@@ -19225,6 +20333,14 @@ namespace OpenGLRhi
 		mOpenGLProgramPipeline(0),
 		mOpenGLProgram(0),
 		mOpenGLIndirectBuffer(0),
+		// Resource binding state cache to avoid making redundant OpenGL calls
+		mOpenGLTextureUnits(nullptr),
+		mOpenGLSamplerUnits(nullptr),
+		mOpenGLUniformBufferBindings(nullptr),
+		mOpenGLShaderStorageBufferBindings(nullptr),
+		mNumberOfOpenGLTextureUnits(0),
+		mNumberOfOpenGLUniformBufferBindings(0),
+		mNumberOfOpenGLShaderStorageBufferBindings(0),
 		// Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		mOpenGLVertexProgram(0),
 		mDrawIdUniformLocation(-1),
@@ -19284,6 +20400,21 @@ namespace OpenGLRhi
 				// Initialize the capabilities
 				initializeCapabilities();
 
+				// Initialize the resource binding state cache
+				initializeBindingStateCache();
+
+				// Create the program binary cache, only worth it if the driver supports at least one program binary format
+				// -> Program binaries are only used for separate shader programs
+				if (mExtensions->isGL_ARB_get_program_binary() && mExtensions->isGL_ARB_separate_shader_objects())
+				{
+					GLint numberOfProgramBinaryFormats = 0;
+					glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfProgramBinaryFormats);
+					if (numberOfProgramBinaryFormats > 0)
+					{
+						mProgramBinaryCache = RHI_NEW(mContext, ProgramBinaryCache)(mContext);
+					}
+				}
+
 				// Create the default sampler state
 				mDefaultSamplerState = createSamplerState(Rhi::ISamplerState::getDefaultSamplerState());
 
@@ -19380,6 +20511,15 @@ namespace OpenGLRhi
 			mShaderLanguage->releaseReference();
 		}
 
+		// Destroy the resource binding state cache, in case we have one
+		if (nullptr != mOpenGLTextureUnits)
+		{
+			RHI_FREE(mContext, mOpenGLTextureUnits);
+		}
+
+		// Destroy the program binary cache instance, in case we have one
+		RHI_DELETE(mContext, ProgramBinaryCache, mProgramBinaryCache);
+
 		// Destroy the extensions instance
 		RHI_DELETE(mContext, Extensions, mExtensions);
 
@@ -19411,6 +20551,33 @@ namespace OpenGLRhi
 	}
 
 
+	GLuint OpenGLRhi::loadShaderProgramFromSourceCode(GLenum shaderType, const char* sourceCode, const Rhi::VertexAttributes* vertexAttributes)
+	{
+		// Try to create the shader program from a cached program binary, first
+		uint64_t programBinaryKey = 0;
+		if (nullptr != mProgramBinaryCache)
+		{
+			programBinaryKey = ProgramBinaryCache::calculateKey(shaderType, sourceCode, vertexAttributes);
+			const GLuint openGLProgram = mProgramBinaryCache->loadProgram(programBinaryKey);
+			if (0 != openGLProgram)
+			{
+				// Done
+				return openGLProgram;
+			}
+		}
+
+		// Compile and link the shader program from source code and remember the program binary for the next run
+		const GLuint openGLProgram = (nullptr != vertexAttributes) ? ::detail::loadShaderProgramFromSourcecode(mContext, *vertexAttributes, shaderType, sourceCode) : ::detail::loadShaderProgramFromSourceCode(mContext, shaderType, sourceCode);
+		if (0 != openGLProgram && nullptr != mProgramBinaryCache)
+		{
+			mProgramBinaryCache->storeProgram(programBinaryKey, openGLProgram);
+		}
+
+		// Done
+		return openGLProgram;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Graphics                                              ]
 	//[-------------------------------------------------------]
@@ -19534,6 +20701,10 @@ namespace OpenGLRhi
 				unsetGraphicsVertexArray();
 			}
 		}
+		else
+		{
+			countSkippedStateChange();
+		}
 	}
 
 	void OpenGLRhi::setGraphicsViewports([[maybe_unused]] uint32_t numberOfViewports, const Rhi::Viewport* viewports)
@@ -19949,6 +21120,32 @@ namespace OpenGLRhi
 		}
 	}
 
+	void OpenGLRhi::drawIndexedGraphicsCount(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t maximumNumberOfDraws, const Rhi::IIndirectBuffer& countBuffer, uint32_t countBufferOffset)
+	{
+		// Sanity checks
+		RHI_MATCH_CHECK(*this, indirectBuffer)
+		RHI_MATCH_CHECK(*this, countBuffer)
+		RHI_ASSERT(mContext, maximumNumberOfDraws > 0, "Maximum number of OpenGL draws must not be zero")
+		RHI_ASSERT(mContext, nullptr != mVertexArray, "OpenGL draw indexed needs a set vertex array")
+		RHI_ASSERT(mContext, nullptr != mVertexArray->getIndexBuffer(), "OpenGL draw indexed needs a set vertex array which contains an index buffer")
+		RHI_ASSERT(mContext, mExtensions->isGL_ARB_indirect_parameters(), "The GL_ARB_indirect_parameters OpenGL extension isn't supported")
+
+		{ // Bind indirect buffer
+			const GLuint openGLIndirectBuffer = static_cast<const IndirectBuffer&>(indirectBuffer).getOpenGLIndirectBuffer();
+			if (openGLIndirectBuffer != mOpenGLIndirectBuffer)
+			{
+				mOpenGLIndirectBuffer = openGLIndirectBuffer;
+				glBindBufferARB(GL_DRAW_INDIRECT_BUFFER, mOpenGLIndirectBuffer);
+			}
+		}
+
+		// Bind the count buffer, not cached since it's usually changing together with the indirect buffer anyway
+		glBindBufferARB(GL_PARAMETER_BUFFER_ARB, static_cast<const IndirectBuffer&>(countBuffer).getOpenGLIndirectBuffer());
+
+		// Multi-draw indirect with a draw count sourced from the GPU
+		glMultiDrawElementsIndirectCountARB(mOpenGLPrimitiveTopology, mVertexArray->getIndexBuffer()->getOpenGLType(), reinterpret_cast<void*>(static_cast<uintptr_t>(indirectBufferOffset)), static_cast<GLintptr>(countBufferOffset), static_cast<GLsizei>(maximumNumberOfDraws), 0);	// 0 = tightly packed
+	}
+
 	void OpenGLRhi::drawIndexedGraphicsEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset, uint32_t numberOfDraws)
 	{
 		// Sanity checks
@@ -20178,8 +21375,9 @@ namespace OpenGLRhi
 			glDispatchCompute(groupCountX, groupCountY, groupCountZ);
 
 			// TODO(co) Compute shader: Memory barrier currently fixed build in: Make sure writing to image has finished before read
+			// -> The command barrier is required for indirect draw arguments and draw counts written by a compute shader, e.g. GPU culling
 			glMemoryBarrierEXT(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
-			glMemoryBarrierEXT(GL_SHADER_STORAGE_BARRIER_BIT);
+			glMemoryBarrierEXT(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
 		}
 	}
 
@@ -20828,16 +22026,58 @@ namespace OpenGLRhi
 				return ::detail::mapBuffer(mContext, *mExtensions, GL_ELEMENT_ARRAY_BUFFER_ARB, GL_ELEMENT_ARRAY_BUFFER_BINDING_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer(), mapType, mappedSubresource);
+			{
+				TextureBuffer& textureBuffer = static_cast<TextureBuffer&>(resource);
+				if (textureBuffer.isStreaming())
+				{
+					if (!StreamingBuffer::isMapTypeSupported(mapType))
+					{
+						// Error!
+						RHI_LOG(mContext, CRITICAL, "OpenGL streaming buffers are write-only and can't be mapped for reading")
+						return false;
+					}
+					textureBuffer.mapStreamingBuffer(mapType, mappedSubresource);
+					return true;
+				}
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, textureBuffer.getOpenGLTextureBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
 				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+			{
+				IndirectBuffer& indirectBuffer = static_cast<IndirectBuffer&>(resource);
+				if (indirectBuffer.isStreaming())
+				{
+					if (!StreamingBuffer::isMapTypeSupported(mapType))
+					{
+						// Error!
+						RHI_LOG(mContext, CRITICAL, "OpenGL streaming buffers are write-only and can't be mapped for reading")
+						return false;
+					}
+					indirectBuffer.mapStreamingBuffer(mapType, mappedSubresource);
+					return true;
+				}
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, indirectBuffer.getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer(), mapType, mappedSubresource);
+			{
+				UniformBuffer& uniformBuffer = static_cast<UniformBuffer&>(resource);
+				if (uniformBuffer.isStreaming())
+				{
+					if (!StreamingBuffer::isMapTypeSupported(mapType))
+					{
+						// Error!
+						RHI_LOG(mContext, CRITICAL, "OpenGL streaming buffers are write-only and can't be mapped for reading")
+						return false;
+					}
+					uniformBuffer.mapStreamingBuffer(mapType, mappedSubresource);
+					return true;
+				}
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, uniformBuffer.getOpenGLUniformBuffer(), mapType, mappedSubresource);
+			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
 			{
@@ -20968,20 +22208,41 @@ namespace OpenGLRhi
 				break;
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer());
+			{
+				// Streamed buffer copies stay persistently mapped
+				const TextureBuffer& textureBuffer = static_cast<TextureBuffer&>(resource);
+				if (!textureBuffer.isStreaming())
+				{
+					::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, textureBuffer.getOpenGLTextureBuffer());
+				}
 				break;
+			}
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
 				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer());
 				break;
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer());
+			{
+				// Streamed buffer copies stay persistently mapped
+				const IndirectBuffer& indirectBuffer = static_cast<IndirectBuffer&>(resource);
+				if (!indirectBuffer.isStreaming())
+				{
+					::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, indirectBuffer.getOpenGLIndirectBuffer());
+				}
 				break;
+			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer());
+			{
+				// Streamed buffer copies stay persistently mapped
+				const UniformBuffer& uniformBuffer = static_cast<UniformBuffer&>(resource);
+				if (!uniformBuffer.isStreaming())
+				{
+					::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, uniformBuffer.getOpenGLUniformBuffer());
+				}
 				break;
+			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
 			{
@@ -21165,8 +22426,18 @@ namespace OpenGLRhi
 					while (waitForResult && GL_TRUE != openGLQueryResult);
 					if (GL_TRUE == openGLQueryResult)
 					{
-						glGetQueryObjectuivARB(openGLQuery, GL_QUERY_RESULT_ARB, &openGLQueryResult);
-						*reinterpret_cast<uint64_t*>(currentData) = openGLQueryResult;
+						if (Rhi::QueryType::TIMESTAMP == openGLQueryPool.getQueryType())
+						{
+							// Nanosecond timestamps don't fit into 32 bit
+							GLuint64 openGLQueryResult64 = 0;
+							glGetQueryObjectui64v(openGLQuery, GL_QUERY_RESULT_ARB, &openGLQueryResult64);
+							*reinterpret_cast<uint64_t*>(currentData) = openGLQueryResult64;
+						}
+						else
+						{
+							glGetQueryObjectuivARB(openGLQuery, GL_QUERY_RESULT_ARB, &openGLQueryResult);
+							*reinterpret_cast<uint64_t*>(currentData) = openGLQueryResult;
+						}
 					}
 					else
 					{
@@ -21199,11 +22470,133 @@ namespace OpenGLRhi
 		// Sanity check
 		RHI_ASSERT(mContext, !commandBuffer.isEmpty(), "The OpenGL command buffer to dispatch mustn't be empty")
 
+		// The OpenGL bindings might have been changed since the last dispatch, e.g. by resource creation or OpenGL reusing the names of destroyed resources
+		invalidateBindingStateCache();
+
 		// Dispatch command buffer
 		dispatchCommandBufferInternal(commandBuffer);
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t OpenGLRhi::getPipelineCacheData(uint32_t numberOfDataBytes, uint8_t* data)
+	{
+		return (nullptr != mProgramBinaryCache) ? mProgramBinaryCache->getData(numberOfDataBytes, data) : 0;
+	}
+
+	bool OpenGLRhi::setPipelineCacheData(uint32_t numberOfDataBytes, const uint8_t* data)
+	{
+		RHI_ASSERT(mContext, nullptr != data, "Invalid OpenGL pipeline cache data")
+		return (nullptr != mProgramBinaryCache && mProgramBinaryCache->setData(numberOfDataBytes, data));
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Bindless texture                                      ]
+	//[-------------------------------------------------------]
+	uint64_t OpenGLRhi::getBindlessTextureHandle(Rhi::ITexture& texture, Rhi::ISamplerState* samplerState)
+	{
+		// "GL_ARB_bindless_texture" required
+		if (!mExtensions->isGL_ARB_bindless_texture())
+		{
+			return 0;
+		}
+
+		// Sanity check
+		RHI_MATCH_CHECK(*this, texture)
+
+		// Get the OpenGL texture
+		GLuint openGLTexture = 0;
+		switch (texture.getResourceType())
+		{
+			case Rhi::ResourceType::TEXTURE_1D:
+				openGLTexture = static_cast<Texture1D&>(texture).getOpenGLTexture();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_1D_ARRAY:
+				openGLTexture = static_cast<Texture1DArray&>(texture).getOpenGLTexture();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_2D:
+				openGLTexture = static_cast<Texture2D&>(texture).getOpenGLTexture();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_2D_ARRAY:
+				openGLTexture = static_cast<Texture2DArray&>(texture).getOpenGLTexture();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_3D:
+				openGLTexture = static_cast<Texture3D&>(texture).getOpenGLTexture();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_CUBE:
+				openGLTexture = static_cast<TextureCube&>(texture).getOpenGLTexture();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_CUBE_ARRAY:
+				// Rejected: The OpenGL RHI has no cube array texture implementation, see "OpenGLRhi::TextureManager::createTextureCubeArray()"
+				RHI_ASSERT(mContext, false, "OpenGL cube array textures have no bindless texture handle")
+				break;
+
+			case Rhi::ResourceType::ROOT_SIGNATURE:
+			case Rhi::ResourceType::RESOURCE_GROUP:
+			case Rhi::ResourceType::GRAPHICS_PROGRAM:
+			case Rhi::ResourceType::VERTEX_ARRAY:
+			case Rhi::ResourceType::RENDER_PASS:
+			case Rhi::ResourceType::QUERY_POOL:
+			case Rhi::ResourceType::SWAP_CHAIN:
+			case Rhi::ResourceType::FRAMEBUFFER:
+			case Rhi::ResourceType::VERTEX_BUFFER:
+			case Rhi::ResourceType::INDEX_BUFFER:
+			case Rhi::ResourceType::TEXTURE_BUFFER:
+			case Rhi::ResourceType::STRUCTURED_BUFFER:
+			case Rhi::ResourceType::INDIRECT_BUFFER:
+			case Rhi::ResourceType::UNIFORM_BUFFER:
+			case Rhi::ResourceType::GRAPHICS_PIPELINE_STATE:
+			case Rhi::ResourceType::COMPUTE_PIPELINE_STATE:
+			case Rhi::ResourceType::SAMPLER_STATE:
+			case Rhi::ResourceType::VERTEX_SHADER:
+			case Rhi::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Rhi::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Rhi::ResourceType::GEOMETRY_SHADER:
+			case Rhi::ResourceType::FRAGMENT_SHADER:
+			case Rhi::ResourceType::TASK_SHADER:
+			case Rhi::ResourceType::MESH_SHADER:
+			case Rhi::ResourceType::COMPUTE_SHADER:
+				RHI_ASSERT(mContext, false, "Invalid OpenGL RHI implementation resource type")
+				break;
+		}
+		if (0 == openGLTexture)
+		{
+			return 0;
+		}
+
+		// Get the bindless handle, combined with the OpenGL sampler object if there's one
+		GLuint64 openGLHandle = 0;
+		if (nullptr != samplerState && mExtensions->isGL_ARB_sampler_objects())
+		{
+			RHI_MATCH_CHECK(*this, *samplerState)
+			openGLHandle = glGetTextureSamplerHandleARB(openGLTexture, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
+		}
+		else
+		{
+			openGLHandle = glGetTextureHandleARB(openGLTexture);
+		}
+
+		// The handle must be resident before shaders are allowed to use it
+		// -> The handle and its residency are automatically released as soon as the texture or sampler object gets destroyed
+		if (0 != openGLHandle && !glIsTextureHandleResidentARB(openGLHandle))
+		{
+			glMakeTextureHandleResidentARB(openGLHandle);
+		}
+
+		// Done
+		return static_cast<uint64_t>(openGLHandle);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private static methods                                ]
 	//[-------------------------------------------------------]
@@ -21478,6 +22871,12 @@ namespace OpenGLRhi
 		// We don't support the OpenGL program binaries since those are operation system and graphics driver version dependent, which renders them useless for pre-compiled shaders shipping
 		mCapabilities.shaderBytecode = mExtensions->isGL_ARB_gl_spirv();
 
+		// Bindless texture support requires "GL_ARB_bindless_texture", usually not exposed by software rasterizers
+		mCapabilities.bindlessTexture = mExtensions->isGL_ARB_bindless_texture();
+
+		// Draw indirect count requires "GL_ARB_indirect_parameters", Mesa llvmpipe exposes it as well
+		mCapabilities.drawIndirectCount = (mExtensions->isGL_ARB_multi_draw_indirect() && mExtensions->isGL_ARB_indirect_parameters());
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = mExtensions->isGL_ARB_vertex_shader();
 
@@ -21551,6 +22950,11 @@ namespace OpenGLRhi
 			const uint32_t numberOfResources = openGLResourceGroup->getNumberOfResources();
 			Rhi::IResource** resources = openGLResourceGroup->getResources();
 			const Rhi::RootParameter& rootParameter = rootSignature.getRootSignature().parameters[rootParameterIndex];
+			const bool useMultiBind = mExtensions->isGL_ARB_multi_bind();
+			BatchedBindings batchedTextureUnits;
+			BatchedBindings batchedSamplerUnits;
+			BatchedBindings batchedUniformBuffers;
+			BatchedBindings batchedShaderStorageBuffers;
 			for (uint32_t resourceIndex = 0; resourceIndex < numberOfResources; ++resourceIndex, ++resources)
 			{
 				Rhi::IResource* resource = *resources;
@@ -21587,108 +22991,54 @@ namespace OpenGLRhi
 
 									// TODO(co) Some security checks might be wise *maximum number of texture units*
 									// Evaluate the texture type
+									GLenum openGLTarget = GL_NONE;
+									GLuint openGLTexture = 0;
 									switch (resourceType)
 									{
 										case Rhi::ResourceType::TEXTURE_BUFFER:
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_BUFFER_ARB, static_cast<TextureBuffer*>(resource)->getOpenGLTexture());
-											}
+											openGLTarget = GL_TEXTURE_BUFFER_ARB;
+											openGLTexture = static_cast<TextureBuffer*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::TEXTURE_1D:
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<Texture1D*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_1D, static_cast<Texture1D*>(resource)->getOpenGLTexture());
-											}
+											openGLTarget = GL_TEXTURE_1D;
+											openGLTexture = static_cast<Texture1D*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::TEXTURE_1D_ARRAY:
 											// No texture 1D array extension check required, if we in here we already know it must exist
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<Texture1DArray*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_1D_ARRAY_EXT, static_cast<Texture1DArray*>(resource)->getOpenGLTexture());
-											}
+											openGLTarget = GL_TEXTURE_1D_ARRAY_EXT;
+											openGLTexture = static_cast<Texture1DArray*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::TEXTURE_2D:
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<Texture2D*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												const Texture2D* texture2D = static_cast<Texture2D*>(resource);
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D), texture2D->getOpenGLTexture());
-											}
+										{
+											const Texture2D* texture2D = static_cast<Texture2D*>(resource);
+											openGLTarget = static_cast<GLenum>((texture2D->getNumberOfMultisamples() > 1) ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D);
+											openGLTexture = texture2D->getOpenGLTexture();
 											break;
+										}
 
 										case Rhi::ResourceType::TEXTURE_2D_ARRAY:
 											// No texture 2D array extension check required, if we in here we already know it must exist
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_2D_ARRAY_EXT, static_cast<Texture2DArray*>(resource)->getOpenGLTexture());
-											}
+											openGLTarget = GL_TEXTURE_2D_ARRAY_EXT;
+											openGLTexture = static_cast<Texture2DArray*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::TEXTURE_3D:
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<Texture3D*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_3D, static_cast<Texture3D*>(resource)->getOpenGLTexture());
-											}
+											openGLTarget = GL_TEXTURE_3D;
+											openGLTexture = static_cast<Texture3D*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::TEXTURE_CUBE:
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<TextureCube*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_CUBE_MAP, static_cast<TextureCube*>(resource)->getOpenGLTexture());
-											}
+											openGLTarget = GL_TEXTURE_CUBE_MAP;
+											openGLTexture = static_cast<TextureCube*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::TEXTURE_CUBE_ARRAY:
 											// TODO(co) Implement me
-											/*
-											if (isArbDsa)
-											{
-												glBindTextureUnit(unit, static_cast<TextureCubeArray*>(resource)->getOpenGLTexture());
-											}
-											else
-											{
-												// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
-												glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, GL_TEXTURE_CUBE_MAP, static_cast<TextureCubeArray*>(resource)->getOpenGLTexture());
-											}
-											*/
+											// openGLTarget = GL_TEXTURE_CUBE_MAP;
+											// openGLTexture = static_cast<TextureCubeArray*>(resource)->getOpenGLTexture();
 											break;
 
 										case Rhi::ResourceType::ROOT_SIGNATURE:
@@ -21719,6 +23069,27 @@ namespace OpenGLRhi
 											break;
 									}
 
+									// Bind the OpenGL texture, if required
+									if (GL_NONE != openGLTarget && updateBindingStateCache(mOpenGLTextureUnits, mNumberOfOpenGLTextureUnits, unit, openGLTexture))
+									{
+										if (isArbDsa)
+										{
+											if (useMultiBind && unit < mNumberOfOpenGLTextureUnits)
+											{
+												batchedTextureUnits.add(unit);
+											}
+											else
+											{
+												glBindTextureUnit(unit, openGLTexture);
+											}
+										}
+										else
+										{
+											// "GL_TEXTURE0_ARB" is the first texture unit, while the unit we received is zero based
+											glBindMultiTextureEXT(GL_TEXTURE0_ARB + unit, openGLTarget, openGLTexture);
+										}
+									}
+
 									// Set the OpenGL sampler states, if required (texture buffer has no sampler state), it's valid that there's no sampler state (e.g. texel fetch instead of sampling might be used)
 									if (Rhi::ResourceType::TEXTURE_BUFFER != resourceType && nullptr != openGLResourceGroup->getSamplerState())
 									{
@@ -21728,8 +23099,19 @@ namespace OpenGLRhi
 											// Is "GL_ARB_sampler_objects" there?
 											if (mExtensions->isGL_ARB_sampler_objects())
 											{
-												// Effective sampler object (SO)
-												glBindSampler(descriptorRange.baseShaderRegister, static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler());
+												// Effective sampler object (SO), bind it if required
+												const GLuint openGLSampler = static_cast<const SamplerStateSo*>(samplerState)->getOpenGLSampler();
+												if (updateBindingStateCache(mOpenGLSamplerUnits, mNumberOfOpenGLTextureUnits, unit, openGLSampler))
+												{
+													if (useMultiBind && unit < mNumberOfOpenGLTextureUnits)
+													{
+														batchedSamplerUnits.add(unit);
+													}
+													else
+													{
+														glBindSampler(unit, openGLSampler);
+													}
+												}
 											}
 											else
 											{
@@ -22007,8 +23389,8 @@ namespace OpenGLRhi
 							// "glBindBufferBase()" unit parameter is zero based so we can simply use the value we received
 							const GLuint index = descriptorRange.baseShaderRegister;
 
-							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<VertexBuffer*>(resource)->getOpenGLArrayBuffer());
+							// Attach the buffer to the given SSBO binding point, if required
+							bindOpenGLBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<VertexBuffer*>(resource)->getOpenGLArrayBuffer(), batchedShaderStorageBuffers);
 						}
 						break;
 					}
@@ -22024,8 +23406,8 @@ namespace OpenGLRhi
 							// "glBindBufferBase()" unit parameter is zero based so we can simply use the value we received
 							const GLuint index = descriptorRange.baseShaderRegister;
 
-							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndexBuffer*>(resource)->getOpenGLElementArrayBuffer());
+							// Attach the buffer to the given SSBO binding point, if required
+							bindOpenGLBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndexBuffer*>(resource)->getOpenGLElementArrayBuffer(), batchedShaderStorageBuffers);
 						}
 						break;
 					}
@@ -22040,8 +23422,8 @@ namespace OpenGLRhi
 							// "glBindBufferBase()" unit parameter is zero based so we can simply use the value we received
 							const GLuint index = descriptorRange.baseShaderRegister;
 
-							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<StructuredBuffer*>(resource)->getOpenGLStructuredBuffer());
+							// Attach the buffer to the given SSBO binding point, if required
+							bindOpenGLBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<StructuredBuffer*>(resource)->getOpenGLStructuredBuffer(), batchedShaderStorageBuffers);
 						}
 						break;
 					}
@@ -22057,8 +23439,8 @@ namespace OpenGLRhi
 							// "glBindBufferBase()" unit parameter is zero based so we can simply use the value we received
 							const GLuint index = descriptorRange.baseShaderRegister;
 
-							// Attach the buffer to the given SSBO binding point
-							glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndirectBuffer*>(resource)->getOpenGLIndirectBuffer());
+							// Attach the buffer to the given SSBO binding point, if required
+							bindOpenGLBufferBase(GL_SHADER_STORAGE_BUFFER, index, static_cast<IndirectBuffer*>(resource)->getOpenGLIndirectBuffer(), batchedShaderStorageBuffers);
 						}
 						break;
 					}
@@ -22072,7 +23454,7 @@ namespace OpenGLRhi
 							// -> Direct3D 10 and Direct3D 11 have explicit binding points
 							RHI_ASSERT(mContext, Rhi::DescriptorRangeType::UBV == descriptorRange.rangeType, "OpenGL uniform buffer must bound at UBV descriptor range type")
 							RHI_ASSERT(mContext, nullptr != openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex(), "Invalid OpenGL resource index to uniform block binding index")
-							glBindBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer());
+							bindOpenGLBufferBase(GL_UNIFORM_BUFFER, openGLResourceGroup->getResourceIndexToUniformBlockBindingIndex()[resourceIndex], static_cast<UniformBuffer*>(resource)->getOpenGLUniformBuffer(), batchedUniformBuffers);
 						}
 						break;
 
@@ -22102,6 +23484,26 @@ namespace OpenGLRhi
 						break;
 				}
 			}
+
+			// Issue the deferred bindings, one "GL_ARB_multi_bind" call per run of consecutive binding points
+			GLuint first = 0;
+			GLsizei count = 0;
+			while (batchedTextureUnits.getNextRun(mOpenGLTextureUnits, first, count))
+			{
+				glBindTextures(first, count, &mOpenGLTextureUnits[first]);
+			}
+			while (batchedSamplerUnits.getNextRun(mOpenGLSamplerUnits, first, count))
+			{
+				glBindSamplers(first, count, &mOpenGLSamplerUnits[first]);
+			}
+			while (batchedUniformBuffers.getNextRun(mOpenGLUniformBufferBindings, first, count))
+			{
+				glBindBuffersBase(GL_UNIFORM_BUFFER, first, count, &mOpenGLUniformBufferBindings[first]);
+			}
+			while (batchedShaderStorageBuffers.getNextRun(mOpenGLShaderStorageBufferBindings, first, count))
+			{
+				glBindBuffersBase(GL_SHADER_STORAGE_BUFFER, first, count, &mOpenGLShaderStorageBufferBindings[first]);
+			}
 		}
 		else
 		{
@@ -22109,6 +23511,91 @@ namespace OpenGLRhi
 		}
 	}
 
+	void OpenGLRhi::initializeBindingStateCache()
+	{
+		GLint openGLValue = 0;
+
+		// Number of texture units, in OpenGL all shaders share the same texture units
+		glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &openGLValue);
+		mNumberOfOpenGLTextureUnits = static_cast<uint32_t>(openGLValue);
+
+		// Number of uniform buffer binding points
+		if (mExtensions->isGL_ARB_uniform_buffer_object())
+		{
+			openGLValue = 0;
+			glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &openGLValue);
+			mNumberOfOpenGLUniformBufferBindings = static_cast<uint32_t>(openGLValue);
+		}
+
+		// Number of shader storage buffer binding points
+		if (mExtensions->isGL_ARB_shader_storage_buffer_object())
+		{
+			openGLValue = 0;
+			glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &openGLValue);
+			mNumberOfOpenGLShaderStorageBufferBindings = static_cast<uint32_t>(openGLValue);
+		}
+
+		// Allocate a single memory block for all cached bindings
+		const uint32_t numberOfBindings = mNumberOfOpenGLTextureUnits * 2 + mNumberOfOpenGLUniformBufferBindings + mNumberOfOpenGLShaderStorageBufferBindings;
+		if (numberOfBindings > 0)
+		{
+			mOpenGLTextureUnits				   = RHI_MALLOC_TYPED(mContext, GLuint, numberOfBindings);
+			mOpenGLSamplerUnits				   = mOpenGLTextureUnits + mNumberOfOpenGLTextureUnits;
+			mOpenGLUniformBufferBindings	   = mOpenGLSamplerUnits + mNumberOfOpenGLTextureUnits;
+			mOpenGLShaderStorageBufferBindings = mOpenGLUniformBufferBindings + mNumberOfOpenGLUniformBufferBindings;
+			invalidateBindingStateCache();
+		}
+	}
+
+	void OpenGLRhi::invalidateBindingStateCache()
+	{
+		if (nullptr != mOpenGLTextureUnits)
+		{
+			// Each byte set to 0xFF results in "UNKNOWN_OPENGL_BINDING"
+			memset(mOpenGLTextureUnits, 0xFF, sizeof(GLuint) * (mNumberOfOpenGLTextureUnits * 2 + mNumberOfOpenGLUniformBufferBindings + mNumberOfOpenGLShaderStorageBufferBindings));
+		}
+	}
+
+	bool OpenGLRhi::updateBindingStateCache(GLuint* openGLBindings, uint32_t numberOfBindings, uint32_t index, GLuint openGLName)
+	{
+		// Binding points outside of the cache are always passed to OpenGL
+		if (index < numberOfBindings)
+		{
+			if (openGLBindings[index] == openGLName)
+			{
+				// Redundant binding, nothing to do in here
+				countSkippedStateChange();
+				return false;
+			}
+			openGLBindings[index] = openGLName;
+		}
+
+		// The OpenGL binding call is required
+		return true;
+	}
+
+	void OpenGLRhi::bindOpenGLBufferBase(GLenum openGLTarget, GLuint index, GLuint openGLBuffer, BatchedBindings& batchedBindings)
+	{
+		GLuint* openGLBindings = mOpenGLShaderStorageBufferBindings;
+		uint32_t numberOfBindings = mNumberOfOpenGLShaderStorageBufferBindings;
+		if (GL_UNIFORM_BUFFER == openGLTarget)
+		{
+			openGLBindings = mOpenGLUniformBufferBindings;
+			numberOfBindings = mNumberOfOpenGLUniformBufferBindings;
+		}
+		if (updateBindingStateCache(openGLBindings, numberOfBindings, index, openGLBuffer))
+		{
+			if (mExtensions->isGL_ARB_multi_bind() && index < numberOfBindings)
+			{
+				batchedBindings.add(index);
+			}
+			else
+			{
+				glBindBufferBase(openGLTarget, index, openGLBuffer);
+			}
+		}
+	}
+
 	void OpenGLRhi::setOpenGLGraphicsProgram(Rhi::IGraphicsProgram* graphicsProgram)
 	{
 		if (nullptr != graphicsProgram)
@@ -22141,6 +23628,10 @@ namespace OpenGLRhi
 					}
 					glBindProgramPipeline(mOpenGLProgramPipeline);
 				}
+				else
+				{
+					countSkippedStateChange();
+				}
 			}
 			else if (mExtensions->isGL_ARB_shader_objects())
 			{
@@ -22154,6 +23645,10 @@ namespace OpenGLRhi
 					mCurrentStartInstanceLocation = ~0u;
 					glUseProgram(mOpenGLProgram);
 				}
+				else
+				{
+					countSkippedStateChange();
+				}
 			}
 		}
 		else
@@ -22203,6 +23698,10 @@ namespace OpenGLRhi
 					mDrawIdUniformLocation = -1;
 					mCurrentStartInstanceLocation = ~0u;
 				}
+				else
+				{
+					countSkippedStateChange();
+				}
 			}
 			else if (mExtensions->isGL_ARB_shader_objects())
 			{
@@ -22216,6 +23715,10 @@ namespace OpenGLRhi
 					mDrawIdUniformLocation = -1;
 					mCurrentStartInstanceLocation = ~0u;
 				}
+				else
+				{
+					countSkippedStateChange();
+				}
 			}
 		}
 		else
@@ -154,6 +154,8 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	#include <array>
 	#include <vector>
+	#include <algorithm>
+	#include <numeric>
 	#include <sstream>
 PRAGMA_WARNING_POP
 
@@ -590,6 +592,7 @@ namespace VulkanRhi
 {
 	class VertexArray;
 	class RootSignature;
+	class ResourceGroup;
 	class VulkanContext;
 	class VulkanRuntimeLinking;
 }
@@ -699,6 +702,8 @@ FNPTR(vkCreateSemaphore)
 FNPTR(vkDestroySemaphore)
 FNPTR(vkCreateFence)
 FNPTR(vkDestroyFence)
+FNPTR(vkResetFences)
+FNPTR(vkGetFenceStatus)
 FNPTR(vkWaitForFences)
 FNPTR(vkCreateCommandPool)
 FNPTR(vkDestroyCommandPool)
@@ -714,6 +719,8 @@ FNPTR(vkCreateFramebuffer)
 FNPTR(vkDestroyFramebuffer)
 FNPTR(vkCreatePipelineCache)
 FNPTR(vkDestroyPipelineCache)
+FNPTR(vkGetPipelineCacheData)
+FNPTR(vkMergePipelineCaches)
 FNPTR(vkCreatePipelineLayout)
 FNPTR(vkDestroyPipelineLayout)
 FNPTR(vkCreateGraphicsPipelines)
@@ -773,6 +780,8 @@ FNPTR(vkAcquireNextImageKHR)
 FNPTR(vkQueuePresentKHR)
 // "VK_NV_mesh_shader"-extension
 FNPTR(vkCmdDrawMeshTasksNV)
+// "VK_KHR_draw_indirect_count"-extension
+FNPTR(vkCmdDrawIndexedIndirectCountKHR)
 
 
 
@@ -1002,7 +1011,7 @@ namespace
 			return false;
 		}
 
-		[[nodiscard]] VkPhysicalDevice selectPhysicalDevice(const Rhi::Context& context, const VkPhysicalDevices& vkPhysicalDevices, bool validationEnabled, bool& enableDebugMarker, bool& hasMeshShaderSupport)
+		[[nodiscard]] VkPhysicalDevice selectPhysicalDevice(const Rhi::Context& context, const VkPhysicalDevices& vkPhysicalDevices, bool validationEnabled, bool& enableDebugMarker, bool& hasMeshShaderSupport, bool& hasDrawIndirectCountSupport)
 		{
 			// TODO(co) I'am sure this selection can be improved (rating etc.)
 			for (const VkPhysicalDevice& vkPhysicalDevice : vkPhysicalDevices)
@@ -1046,6 +1055,7 @@ namespace
 					}
 				}
 				hasMeshShaderSupport = isExtensionAvailable(VK_NV_MESH_SHADER_EXTENSION_NAME, vkExtensionPropertiesVector);
+				hasDrawIndirectCountSupport = isExtensionAvailable(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME, vkExtensionPropertiesVector);
 
 				{ // Reject physical Vulkan devices basing on supported API version and some basic limits
 					VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
@@ -1110,7 +1120,7 @@ namespace
 			return VK_NULL_HANDLE;
 		}
 
-		[[nodiscard]] VkResult createVkDevice(const Rhi::Context& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, const VkDeviceQueueCreateInfo& vkDeviceQueueCreateInfo, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, VkDevice& vkDevice)
+		[[nodiscard]] VkResult createVkDevice(const Rhi::Context& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, uint32_t numberOfVkDeviceQueueCreateInfos, const VkDeviceQueueCreateInfo* vkDeviceQueueCreateInfos, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, bool hasDrawIndirectCountSupport, VkDevice& vkDevice)
 		{
 			// See http://vulkan.gpuinfo.org/listfeatures.php to check out GPU hardware capabilities
 			Vector<const char*> enabledExtensions;
@@ -1125,6 +1135,10 @@ namespace
 			{
 				enabledExtensions.emplace_back(VK_NV_MESH_SHADER_EXTENSION_NAME);
 			}
+			if (hasDrawIndirectCountSupport)
+			{
+				enabledExtensions.emplace_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+			}
 
 			// This will only be used if meshShadingSupported=true (see below)
 			VkPhysicalDeviceMeshShaderFeaturesNV vkPhysicalDeviceMeshShaderFeaturesNV = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV };
@@ -1193,8 +1207,8 @@ namespace
 				VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,									// sType (VkStructureType)
 				hasMeshShaderSupport ? &vkPhysicalDeviceMeshShaderFeaturesNV : nullptr,	// pNext (const void*)
 				0,																		// flags (VkDeviceCreateFlags)
-				1,																		// queueCreateInfoCount (uint32_t)
-				&vkDeviceQueueCreateInfo,												// pQueueCreateInfos (const VkDeviceQueueCreateInfo*)
+				numberOfVkDeviceQueueCreateInfos,										// queueCreateInfoCount (uint32_t)
+				vkDeviceQueueCreateInfos,												// pQueueCreateInfos (const VkDeviceQueueCreateInfo*)
 				enableValidation ? NUMBER_OF_VALIDATION_LAYERS : 0,						// enabledLayerCount (uint32_t)
 				enableValidation ? VALIDATION_LAYER_NAMES : nullptr,					// ppEnabledLayerNames (const char* const*)
 				static_cast<uint32_t>(enabledExtensions.size()),						// enabledExtensionCount (uint32_t)
@@ -1232,7 +1246,7 @@ namespace
 			return vkResult;
 		}
 
-		[[nodiscard]] VkDevice createVkDevice(const Rhi::Context& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, uint32_t& graphicsQueueFamilyIndex, uint32_t& presentQueueFamilyIndex)
+		[[nodiscard]] VkDevice createVkDevice(const Rhi::Context& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, bool hasDrawIndirectCountSupport, uint32_t& graphicsQueueFamilyIndex, uint32_t& presentQueueFamilyIndex, uint32_t& transferQueueFamilyIndex)
 		{
 			VkDevice vkDevice = VK_NULL_HANDLE;
 
@@ -1251,27 +1265,52 @@ namespace
 				{
 					if (vkQueueFamilyProperties[graphicsQueueIndex].queueFlags & VK_QUEUE_GRAPHICS_BIT)
 					{
+						// Find a dedicated transfer queue family, those are usually backed by DMA engines which can upload data while the graphics queue is busy
+						// -> Falls back to the graphics queue family if there's no dedicated transfer queue family
+						uint32_t transferQueueIndex = graphicsQueueIndex;
+						for (uint32_t i = 0; i < queueFamilyPropertyCount; ++i)
+						{
+							const VkQueueFlags vkQueueFlags = vkQueueFamilyProperties[i].queueFlags;
+							if ((vkQueueFlags & VK_QUEUE_TRANSFER_BIT) && 0 == (vkQueueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) && vkQueueFamilyProperties[i].queueCount > 0)
+							{
+								transferQueueIndex = i;
+								break;
+							}
+						}
+
 						// Create logical Vulkan device instance
 						static constexpr std::array<float, 1> queuePriorities = { { 0.0f } };
-						const VkDeviceQueueCreateInfo vkDeviceQueueCreateInfo =
+						const VkDeviceQueueCreateInfo vkDeviceQueueCreateInfos[2] =
 						{
-							VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// sType (VkStructureType)
-							nullptr,									// pNext (const void*)
-							0,											// flags (VkDeviceQueueCreateFlags)
-							graphicsQueueIndex,							// queueFamilyIndex (uint32_t)
-							1,											// queueCount (uint32_t)
-							queuePriorities.data()						// pQueuePriorities (const float*)
+							{
+								VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// sType (VkStructureType)
+								nullptr,									// pNext (const void*)
+								0,											// flags (VkDeviceQueueCreateFlags)
+								graphicsQueueIndex,							// queueFamilyIndex (uint32_t)
+								1,											// queueCount (uint32_t)
+								queuePriorities.data()						// pQueuePriorities (const float*)
+							},
+							{
+								VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// sType (VkStructureType)
+								nullptr,									// pNext (const void*)
+								0,											// flags (VkDeviceQueueCreateFlags)
+								transferQueueIndex,							// queueFamilyIndex (uint32_t)
+								1,											// queueCount (uint32_t)
+								queuePriorities.data()						// pQueuePriorities (const float*)
+							}
 						};
-						VkResult vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, vkDeviceQueueCreateInfo, enableValidation, enableDebugMarker, hasMeshShaderSupport, vkDevice);
+						const uint32_t numberOfVkDeviceQueueCreateInfos = (transferQueueIndex != graphicsQueueIndex) ? 2u : 1u;
+						VkResult vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, numberOfVkDeviceQueueCreateInfos, vkDeviceQueueCreateInfos, enableValidation, enableDebugMarker, hasMeshShaderSupport, hasDrawIndirectCountSupport, vkDevice);
 						if (VK_ERROR_LAYER_NOT_PRESENT == vkResult && enableValidation)
 						{
 							// Error! Since the show must go on, try creating a Vulkan device instance without validation enabled...
 							RHI_LOG(context, WARNING, "Failed to create the Vulkan device instance with validation enabled, layer is not present")
-							vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, vkDeviceQueueCreateInfo, false, enableDebugMarker, hasMeshShaderSupport, vkDevice);
+							vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, numberOfVkDeviceQueueCreateInfos, vkDeviceQueueCreateInfos, false, enableDebugMarker, hasMeshShaderSupport, hasDrawIndirectCountSupport, vkDevice);
 						}
 						// TODO(co) Error handling: Evaluate "vkResult"?
 						graphicsQueueFamilyIndex = graphicsQueueIndex;
 						presentQueueFamilyIndex = graphicsQueueIndex;	// TODO(co) Handle the case of the graphics queue doesn't support present
+						transferQueueFamilyIndex = transferQueueIndex;
 
 						// We're done, get us out of the loop
 						graphicsQueueIndex = queueFamilyPropertyCount;
@@ -2064,6 +2103,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	public:
 		typedef std::array<VkClearValue, 9>	VkClearValues;	///< 8 color render targets and one depth stencil render target
+		typedef Vector<VkBuffer>			VkBuffers;
 
 
 	//[-------------------------------------------------------]
@@ -2155,6 +2195,7 @@ namespace VulkanRhi
 		void drawGraphicsEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexedGraphics(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawIndexedGraphicsEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
+		void drawIndexedGraphicsCount(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t maximumNumberOfDraws, const Rhi::IIndirectBuffer& countBuffer, uint32_t countBufferOffset);
 		void drawMeshTasks(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		void drawMeshTasksEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset = 0, uint32_t numberOfDraws = 1);
 		//[-------------------------------------------------------]
@@ -2163,6 +2204,7 @@ namespace VulkanRhi
 		void setComputeRootSignature(Rhi::IRootSignature* rootSignature);
 		void setComputePipelineState(Rhi::IComputePipelineState* computePipelineState);
 		void setComputeResourceGroup(uint32_t rootParameterIndex, Rhi::IResourceGroup* resourceGroup);
+		void dispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -2222,6 +2264,15 @@ namespace VulkanRhi
 		//[ Operation                                             ]
 		//[-------------------------------------------------------]
 		virtual void dispatchCommandBuffer(const Rhi::CommandBuffer& commandBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] virtual uint32_t getPipelineCacheData(uint32_t numberOfDataBytes, uint8_t* data) override;
+		virtual bool setPipelineCacheData(uint32_t numberOfDataBytes, const uint8_t* data) override;
+		//[-------------------------------------------------------]
+		//[ Memory                                                ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] virtual bool getMemoryStatistics(Rhi::MemoryStatistics& memoryStatistics) const override;
 
 
 	//[-------------------------------------------------------]
@@ -2259,6 +2310,20 @@ namespace VulkanRhi
 		*/
 		void beginVulkanRenderPass();
 
+		/**
+		*  @brief
+		*    Insert Vulkan buffer memory barriers for the buffers written by previous compute dispatches
+		*
+		*  @param[in] dstVkPipelineStageFlags
+		*    Vulkan pipeline stages which are going to consume the written buffers
+		*  @param[in] dstVkAccessFlags
+		*    Vulkan access types which are going to consume the written buffers
+		*
+		*  @note
+		*    - Must be called outside a Vulkan render pass
+		*/
+		void insertComputeWriteBarriers(VkPipelineStageFlags dstVkPipelineStageFlags, VkAccessFlags dstVkAccessFlags);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -2273,6 +2338,9 @@ namespace VulkanRhi
 		Rhi::ISamplerState*	  mDefaultSamplerState;		///< Default rasterizer state (we keep a reference to it), can be a null pointer
 		bool				  mInsideVulkanRenderPass;	///< Some Vulkan commands like "vkCmdClearColorImage()" can only be executed outside a Vulkan render pass, so need to delay starting a Vulkan render pass
 		VkClearValues		  mVkClearValues;
+		float				  mTimestampPeriod;			///< Number of nanoseconds it takes for a timestamp query value to be incremented by 1 ("VkPhysicalDeviceLimits::timestampPeriod")
+		VkBuffers			  mComputeUnorderedAccessVkBuffers[8];	///< Per compute root parameter index the Vulkan buffers of the currently set compute resource group which are bound as unordered access view (UAV) and hence might be written by a compute dispatch
+		VkBuffers			  mComputeWrittenVkBuffers;				///< Vulkan buffers written by compute dispatches which still need a buffer memory barrier before they're consumed
 		//[-------------------------------------------------------]
 		//[ Input-assembler (IA) stage                            ]
 		//[-------------------------------------------------------]
@@ -2437,11 +2505,13 @@ namespace VulkanRhi
 		*    Vulkan device instance to load the function entry pointers for
 		*  @param[in] hasMeshShaderSupport
 		*    Has mesh shader support?
+		*  @param[in] hasDrawIndirectCountSupport
+		*    Has draw indirect count support?
 		*
 		*  @return
 		*    "true" if all went fine, else "false"
 		*/
-		[[nodiscard]] bool loadDeviceLevelVulkanEntryPoints(VkDevice vkDevice, bool hasMeshShaderSupport) const
+		[[nodiscard]] bool loadDeviceLevelVulkanEntryPoints(VkDevice vkDevice, bool hasMeshShaderSupport, bool hasDrawIndirectCountSupport) const
 		{
 			bool result = true;	// Success by default
 
@@ -2488,6 +2558,8 @@ namespace VulkanRhi
 			IMPORT_FUNC(vkDestroySemaphore)
 			IMPORT_FUNC(vkCreateFence)
 			IMPORT_FUNC(vkDestroyFence)
+			IMPORT_FUNC(vkResetFences)
+			IMPORT_FUNC(vkGetFenceStatus)
 			IMPORT_FUNC(vkWaitForFences)
 			IMPORT_FUNC(vkCreateCommandPool)
 			IMPORT_FUNC(vkDestroyCommandPool)
@@ -2503,6 +2575,8 @@ namespace VulkanRhi
 			IMPORT_FUNC(vkDestroyFramebuffer)
 			IMPORT_FUNC(vkCreatePipelineCache)
 			IMPORT_FUNC(vkDestroyPipelineCache)
+			IMPORT_FUNC(vkGetPipelineCacheData)
+			IMPORT_FUNC(vkMergePipelineCaches)
 			IMPORT_FUNC(vkCreatePipelineLayout)
 			IMPORT_FUNC(vkDestroyPipelineLayout)
 			IMPORT_FUNC(vkCreateGraphicsPipelines)
@@ -2559,6 +2633,11 @@ namespace VulkanRhi
 			{
 				IMPORT_FUNC(vkCmdDrawMeshTasksNV)
 			}
+			// "VK_KHR_draw_indirect_count"-extension
+			if (hasDrawIndirectCountSupport)
+			{
+				IMPORT_FUNC(vkCmdDrawIndexedIndirectCountKHR)
+			}
 
 			// Undefine the helper macro
 			#undef IMPORT_FUNC
@@ -2861,40 +2940,1337 @@ namespace VulkanRhi
 				#error "Unsupported platform"
 			#endif
 
-			// Undefine the helper macro
-			#undef IMPORT_FUNC
-			PRAGMA_WARNING_POP
+			// Undefine the helper macro
+			#undef IMPORT_FUNC
+			PRAGMA_WARNING_POP
+
+			// Done
+			return result;
+		}
+
+		/**
+		*  @brief
+		*    Setup debug callback
+		*/
+		void setupDebugCallback()
+		{
+			// Sanity check
+			RHI_ASSERT(mVulkanRhi.getContext(), mValidationEnabled, "Do only call this Vulkan method if validation is enabled")
+
+			// The report flags determine what type of messages for the layers will be displayed
+			// -> Use "VK_DEBUG_REPORT_FLAG_BITS_MAX_ENUM_EXT" to get everything, quite verbose
+			static constexpr VkDebugReportFlagsEXT vkDebugReportFlagsEXT = (VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT);
+
+			// Setup debug callback
+			const VkDebugReportCallbackCreateInfoEXT vkDebugReportCallbackCreateInfoEXT =
+			{
+				VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT,	// sType (VkStructureType)
+				nullptr,													// pNext (const void*)
+				vkDebugReportFlagsEXT,										// flags (VkDebugReportFlagsEXT)
+				::detail::debugReportCallback,								// pfnCallback (PFN_vkDebugReportCallbackEXT)
+				const_cast<Rhi::Context*>(&mVulkanRhi.getContext())			// pUserData (void*)
+			};
+			if (vkCreateDebugReportCallbackEXT(mVkInstance, &vkDebugReportCallbackCreateInfoEXT, mVulkanRhi.getVkAllocationCallbacks(), &mVkDebugReportCallbackEXT) != VK_SUCCESS)
+			{
+				RHI_LOG(mVulkanRhi.getContext(), WARNING, "Failed to create the Vulkan debug report callback")
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		VulkanRhi&				 mVulkanRhi;						///< Owner Vulkan RHI instance
+		bool					 mValidationEnabled;				///< Validation enabled?
+		void*					 mVulkanSharedLibrary;				///< Vulkan shared library, can be a null pointer
+		bool					 mEntryPointsRegistered;			///< Entry points successfully registered?
+		VkInstance				 mVkInstance;						///< Vulkan instance, stores all per-application states
+		VkDebugReportCallbackEXT mVkDebugReportCallbackEXT;			///< Vulkan debug report callback, can be a null handle
+		bool					 mInstanceLevelFunctionsRegistered;	///< Instance level Vulkan function pointers registered?
+		bool					 mInitialized;						///< Already initialized?
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ VulkanRhi/VulkanMemoryAllocator.h                     ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Vulkan device memory allocation handed out by the Vulkan memory allocator
+	*
+	*  @note
+	*    - The Vulkan device memory might be shared with other allocations, always use "offset" when binding
+	*/
+	struct VulkanMemoryAllocation final
+	{
+		VkDeviceMemory vkDeviceMemory;	///< Vulkan device memory the allocation lives in, "VK_NULL_HANDLE" if invalid
+		VkDeviceSize   offset;			///< Offset in bytes inside the Vulkan device memory
+		VkDeviceSize   size;			///< Number of reserved bytes, for sub-allocations this is the size class the allocation was rounded up to
+		uint8_t*	   mappedData;		///< Persistently mapped data already including "offset", null pointer if the memory type isn't host visible
+		uint32_t	   memoryTypeIndex;	///< Vulkan memory type index, ~0u if invalid
+		uint32_t	   blockIndex;		///< Memory block index inside the memory pool, ~0u for dedicated allocations
+		uint8_t		   poolIndex;		///< Memory pool index inside the memory type, see "VulkanMemoryAllocator::PoolType"
+		uint8_t		   order;			///< Size class of a sub-allocation, "VulkanMemoryAllocator::MINIMUM_ALLOCATION_SIZE << order" is the size class size
+
+		inline VulkanMemoryAllocation() :
+			vkDeviceMemory(VK_NULL_HANDLE),
+			offset(0),
+			size(0),
+			mappedData(nullptr),
+			memoryTypeIndex(~0u),
+			blockIndex(~0u),
+			poolIndex(0),
+			order(0)
+		{}
+
+		[[nodiscard]] inline bool isDedicated() const
+		{
+			return (~0u == blockIndex);
+		}
+	};
+
+	/**
+	*  @brief
+	*    Vulkan device memory allocator
+	*
+	*  @remarks
+	*    Calling "vkAllocateMemory()" once per resource is slow and quickly runs into "VkPhysicalDeviceLimits::maxMemoryAllocationCount"
+	*    (which is just 4096 on many implementations). So, per Vulkan memory type a few large memory blocks are allocated and resources are
+	*    sub-allocated out of them by using a binary buddy allocator: Each allocation is rounded up to a power-of-two size class, starting with
+	*    "MINIMUM_ALLOCATION_SIZE", which also automatically satisfies the alignment requirements. Buffers (linear) and images (optimal tiling)
+	*    are placed into separate memory pools so "VkPhysicalDeviceLimits::bufferImageGranularity" never needs to be taken into account.
+	*    Resources which are larger than half a memory block get a dedicated Vulkan device memory allocation.
+	*
+	*    Memory blocks of host visible memory types are persistently mapped, so mapping resources is free.
+	*
+	*  @note
+	*    - Not thread-safe, the Vulkan RHI doesn't support native multithreading (yet)
+	*/
+	class VulkanMemoryAllocator final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr VkDeviceSize MINIMUM_ALLOCATION_SIZE = 256;				///< Smallest size class in bytes, must be a power of two
+		static constexpr VkDeviceSize MAXIMUM_BLOCK_SIZE	  = 64 * 1024 * 1024;	///< Maximum Vulkan device memory block size in bytes, must be a power of two
+		static constexpr uint8_t	  NUMBER_OF_ORDERS		  = 19;					///< Number of size classes, "MINIMUM_ALLOCATION_SIZE << (NUMBER_OF_ORDERS - 1)" = "MAXIMUM_BLOCK_SIZE"
+		static constexpr uint32_t	  NUMBER_OF_EMPTY_FRAMES  = 120;				///< Number of frames the last empty memory block of a memory pool is kept around before it's released, see "releaseEmptyMemoryBlocks()"
+
+		/**
+		*  @brief
+		*    Memory pool type
+		*/
+		enum PoolType
+		{
+			LINEAR_POOL,	///< Buffers and linear tiling images
+			OPTIMAL_POOL,	///< Optimal tiling images
+			NUMBER_OF_POOL_TYPES
+		};
+
+		/**
+		*  @brief
+		*    Memory statistics of a Vulkan memory heap
+		*/
+		struct Statistics final
+		{
+			uint32_t	 numberOfBlocks;				///< Number of currently allocated memory blocks
+			uint32_t	 numberOfDedicatedAllocations;	///< Number of current dedicated allocations
+			uint32_t	 numberOfSubAllocations;		///< Number of current allocations which live inside memory blocks
+			VkDeviceSize numberOfAllocatedBytes;		///< Number of bytes allocated via "vkAllocateMemory()"
+			VkDeviceSize numberOfUsedBytes;				///< Number of bytes handed out to resources, including size class rounding
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] vulkanRhi
+		*    Owner Vulkan RHI instance
+		*  @param[in] vkPhysicalDevice
+		*    Vulkan physical device to use
+		*  @param[in] vkDevice
+		*    Vulkan device to use
+		*/
+		VulkanMemoryAllocator(VulkanRhi& vulkanRhi, VkPhysicalDevice vkPhysicalDevice, VkDevice vkDevice) :
+			mVulkanRhi(vulkanRhi),
+			mVkDevice(vkDevice),
+			mVkPhysicalDeviceMemoryProperties{},
+			mMaximumMemoryAllocationCount(4096),
+			mNumberOfVkDeviceMemories(0),
+			mStatistics{}
+		{
+			vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &mVkPhysicalDeviceMemoryProperties);
+			{
+				VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+				vkGetPhysicalDeviceProperties(vkPhysicalDevice, &vkPhysicalDeviceProperties);
+				mMaximumMemoryAllocationCount = vkPhysicalDeviceProperties.limits.maxMemoryAllocationCount;
+			}
+
+			// Choose the memory block size per memory type: Small heaps (e.g. 256 MiB device local host visible heaps) shouldn't be wasted by a single block
+			for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < mVkPhysicalDeviceMemoryProperties.memoryTypeCount; ++memoryTypeIndex)
+			{
+				const VkDeviceSize heapSize = mVkPhysicalDeviceMemoryProperties.memoryHeaps[mVkPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex].size;
+				uint8_t maximumOrder = NUMBER_OF_ORDERS - 1;
+				while (maximumOrder > 0 && (MINIMUM_ALLOCATION_SIZE << maximumOrder) > heapSize / 8)
+				{
+					--maximumOrder;
+				}
+				for (uint8_t poolIndex = 0; poolIndex < NUMBER_OF_POOL_TYPES; ++poolIndex)
+				{
+					mMemoryPools[memoryTypeIndex][poolIndex].maximumOrder = maximumOrder;
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~VulkanMemoryAllocator()
+		{
+			#ifdef RHI_DEBUG
+				const Statistics statistics = getTotalStatistics();
+				if (statistics.numberOfDedicatedAllocations + statistics.numberOfSubAllocations > 0)
+				{
+					RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "The Vulkan memory allocator is going to be destroyed while there are still %u dedicated allocations and %u sub-allocations alive", statistics.numberOfDedicatedAllocations, statistics.numberOfSubAllocations)
+				}
+			#endif
+			for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < mVkPhysicalDeviceMemoryProperties.memoryTypeCount; ++memoryTypeIndex)
+			{
+				for (uint8_t poolIndex = 0; poolIndex < NUMBER_OF_POOL_TYPES; ++poolIndex)
+				{
+					for (MemoryBlock& memoryBlock : mMemoryPools[memoryTypeIndex][poolIndex].memoryBlocks)
+					{
+						if (VK_NULL_HANDLE != memoryBlock.vkDeviceMemory)
+						{
+							freeVkDeviceMemory(memoryBlock.vkDeviceMemory, nullptr != memoryBlock.mappedData);
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan physical device memory properties
+		*
+		*  @return
+		*    The Vulkan physical device memory properties
+		*/
+		[[nodiscard]] inline const VkPhysicalDeviceMemoryProperties& getVkPhysicalDeviceMemoryProperties() const
+		{
+			return mVkPhysicalDeviceMemoryProperties;
+		}
+
+		/**
+		*  @brief
+		*    Find a Vulkan memory type index
+		*
+		*  @param[in] typeFilter
+		*    Bit mask of the allowed memory types, usually "VkMemoryRequirements::memoryTypeBits"
+		*  @param[in] vkMemoryPropertyFlags
+		*    Vulkan memory property flags the memory type must have
+		*
+		*  @return
+		*    Vulkan memory type index, ~0u on error
+		*/
+		[[nodiscard]] uint32_t findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags vkMemoryPropertyFlags) const
+		{
+			for (uint32_t i = 0; i < mVkPhysicalDeviceMemoryProperties.memoryTypeCount; ++i)
+			{
+				if ((typeFilter & (1 << i)) && (mVkPhysicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & vkMemoryPropertyFlags) == vkMemoryPropertyFlags)
+				{
+					return i;
+				}
+			}
+
+			// Error!
+			RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to find suitable Vulkan memory type")
+			return ~0u;
+		}
+
+		/**
+		*  @brief
+		*    Allocate Vulkan device memory
+		*
+		*  @param[in] vkMemoryRequirements
+		*    Vulkan memory requirements of the resource
+		*  @param[in] vkMemoryPropertyFlags
+		*    Vulkan memory property flags the memory must have
+		*  @param[in] poolType
+		*    Memory pool type, "OPTIMAL_POOL" for optimal tiling images else "LINEAR_POOL"
+		*  @param[out] vulkanMemoryAllocation
+		*    Receives the Vulkan memory allocation, left untouched on error
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		[[nodiscard]] bool allocate(const VkMemoryRequirements& vkMemoryRequirements, VkMemoryPropertyFlags vkMemoryPropertyFlags, PoolType poolType, VulkanMemoryAllocation& vulkanMemoryAllocation)
+		{
+			const uint32_t memoryTypeIndex = findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags);
+			if (~0u == memoryTypeIndex)
+			{
+				// Error!
+				return false;
+			}
+			const bool hostVisible = (mVkPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+			MemoryPool& memoryPool = mMemoryPools[memoryTypeIndex][poolType];
+
+			// Get the size class, the buddy allocator hands out offsets which are aligned to the size class
+			uint8_t order = 0;
+			{
+				const VkDeviceSize numberOfBytes = std::max(vkMemoryRequirements.size, vkMemoryRequirements.alignment);
+				while ((MINIMUM_ALLOCATION_SIZE << order) < numberOfBytes && order < NUMBER_OF_ORDERS - 1)
+				{
+					++order;
+				}
+			}
+
+			// Large resources get a dedicated allocation
+			if ((MINIMUM_ALLOCATION_SIZE << order) > ((MINIMUM_ALLOCATION_SIZE << memoryPool.maximumOrder) >> 1))
+			{
+				return allocateDedicated(vkMemoryRequirements.size, memoryTypeIndex, hostVisible, vulkanMemoryAllocation);
+			}
+
+			// Try to sub-allocate inside an existing memory block
+			uint32_t blockIndex = ~0u;
+			VkDeviceSize offset = 0;
+			const uint32_t numberOfMemoryBlocks = static_cast<uint32_t>(memoryPool.memoryBlocks.size());
+			for (uint32_t i = 0; i < numberOfMemoryBlocks; ++i)
+			{
+				if (VK_NULL_HANDLE != memoryPool.memoryBlocks[i].vkDeviceMemory && allocateFromMemoryBlock(memoryPool.memoryBlocks[i], memoryPool.maximumOrder, order, offset))
+				{
+					blockIndex = i;
+					break;
+				}
+			}
+
+			// Create a new memory block, reuse a released slot if possible so block indices of living allocations stay valid
+			if (~0u == blockIndex)
+			{
+				MemoryBlock memoryBlock;
+				if (!allocateVkDeviceMemory(MINIMUM_ALLOCATION_SIZE << memoryPool.maximumOrder, memoryTypeIndex, hostVisible, memoryBlock.vkDeviceMemory, memoryBlock.mappedData))
+				{
+					// We might be out of device memory for a whole block, but maybe there's still enough memory left for the resource itself
+					return allocateDedicated(vkMemoryRequirements.size, memoryTypeIndex, hostVisible, vulkanMemoryAllocation);
+				}
+				memoryBlock.freeOffsets[memoryPool.maximumOrder].push_back(0);
+				for (uint32_t i = 0; i < numberOfMemoryBlocks; ++i)
+				{
+					if (VK_NULL_HANDLE == memoryPool.memoryBlocks[i].vkDeviceMemory)
+					{
+						blockIndex = i;
+						break;
+					}
+				}
+				if (~0u == blockIndex)
+				{
+					blockIndex = numberOfMemoryBlocks;
+					memoryPool.memoryBlocks.push_back(std::move(memoryBlock));
+				}
+				else
+				{
+					memoryPool.memoryBlocks[blockIndex] = std::move(memoryBlock);
+				}
+				Statistics& statistics = getHeapStatistics(memoryTypeIndex);
+				++statistics.numberOfBlocks;
+				statistics.numberOfAllocatedBytes += MINIMUM_ALLOCATION_SIZE << memoryPool.maximumOrder;
+				[[maybe_unused]] const bool result = allocateFromMemoryBlock(memoryPool.memoryBlocks[blockIndex], memoryPool.maximumOrder, order, offset);
+				RHI_ASSERT(mVulkanRhi.getContext(), result, "Failed to sub-allocate from a new Vulkan memory block")
+			}
+
+			// Done
+			MemoryBlock& memoryBlock = memoryPool.memoryBlocks[blockIndex];
+			++memoryBlock.numberOfAllocations;
+			memoryBlock.numberOfEmptyFrames = 0;
+			vulkanMemoryAllocation.vkDeviceMemory  = memoryBlock.vkDeviceMemory;
+			vulkanMemoryAllocation.offset		   = offset;
+			vulkanMemoryAllocation.size			   = MINIMUM_ALLOCATION_SIZE << order;
+			vulkanMemoryAllocation.mappedData	   = (nullptr != memoryBlock.mappedData) ? (memoryBlock.mappedData + offset) : nullptr;
+			vulkanMemoryAllocation.memoryTypeIndex = memoryTypeIndex;
+			vulkanMemoryAllocation.blockIndex	   = blockIndex;
+			vulkanMemoryAllocation.poolIndex	   = static_cast<uint8_t>(poolType);
+			vulkanMemoryAllocation.order		   = order;
+			Statistics& statistics = getHeapStatistics(memoryTypeIndex);
+			++statistics.numberOfSubAllocations;
+			statistics.numberOfUsedBytes += vulkanMemoryAllocation.size;
+			return true;
+		}
+
+		/**
+		*  @brief
+		*    Free Vulkan device memory
+		*
+		*  @param[in, out] vulkanMemoryAllocation
+		*    Vulkan memory allocation to free, will be reset, invalid allocations are ignored
+		*
+		*  @note
+		*    - Memory blocks which became empty are released as long as there's another memory block left inside the memory pool, the last one is released by "releaseEmptyMemoryBlocks()"
+		*/
+		void free(VulkanMemoryAllocation& vulkanMemoryAllocation)
+		{
+			if (VK_NULL_HANDLE == vulkanMemoryAllocation.vkDeviceMemory)
+			{
+				return;
+			}
+			Statistics& statistics = getHeapStatistics(vulkanMemoryAllocation.memoryTypeIndex);
+			statistics.numberOfUsedBytes -= vulkanMemoryAllocation.size;
+			if (vulkanMemoryAllocation.isDedicated())
+			{
+				freeVkDeviceMemory(vulkanMemoryAllocation.vkDeviceMemory, nullptr != vulkanMemoryAllocation.mappedData);
+				--statistics.numberOfDedicatedAllocations;
+				statistics.numberOfAllocatedBytes -= vulkanMemoryAllocation.size;
+			}
+			else
+			{
+				MemoryPool& memoryPool = mMemoryPools[vulkanMemoryAllocation.memoryTypeIndex][vulkanMemoryAllocation.poolIndex];
+				RHI_ASSERT(mVulkanRhi.getContext(), vulkanMemoryAllocation.blockIndex < memoryPool.memoryBlocks.size(), "Invalid Vulkan memory block index")
+				MemoryBlock& memoryBlock = memoryPool.memoryBlocks[vulkanMemoryAllocation.blockIndex];
+				RHI_ASSERT(mVulkanRhi.getContext(), memoryBlock.vkDeviceMemory == vulkanMemoryAllocation.vkDeviceMemory, "Invalid Vulkan memory block")
+				freeInsideMemoryBlock(memoryBlock, memoryPool.maximumOrder, vulkanMemoryAllocation.order, vulkanMemoryAllocation.offset);
+				--statistics.numberOfSubAllocations;
+				--memoryBlock.numberOfAllocations;
+
+				// Release the memory block in case it's empty, but always keep one memory block around to avoid allocation ping-pong
+				if (0 == memoryBlock.numberOfAllocations && getNumberOfLivingMemoryBlocks(memoryPool) > 1)
+				{
+					releaseMemoryBlock(memoryBlock, vulkanMemoryAllocation.memoryTypeIndex, memoryPool.maximumOrder);
+				}
+			}
+			vulkanMemoryAllocation = VulkanMemoryAllocation();
+		}
+
+		/**
+		*  @brief
+		*    Release memory blocks which stayed empty for "NUMBER_OF_EMPTY_FRAMES" frames
+		*
+		*  @note
+		*    - Call this once per presented frame
+		*    - "free()" keeps the last empty memory block of a memory pool around to avoid allocation ping-pong, this gives it back to the Vulkan implementation once it's no longer needed (e.g. after unloading a level)
+		*/
+		void releaseEmptyMemoryBlocks()
+		{
+			for (uint32_t memoryTypeIndex = 0; memoryTypeIndex < mVkPhysicalDeviceMemoryProperties.memoryTypeCount; ++memoryTypeIndex)
+			{
+				for (uint8_t poolIndex = 0; poolIndex < NUMBER_OF_POOL_TYPES; ++poolIndex)
+				{
+					MemoryPool& memoryPool = mMemoryPools[memoryTypeIndex][poolIndex];
+					for (MemoryBlock& memoryBlock : memoryPool.memoryBlocks)
+					{
+						if (VK_NULL_HANDLE != memoryBlock.vkDeviceMemory && 0 == memoryBlock.numberOfAllocations && ++memoryBlock.numberOfEmptyFrames >= NUMBER_OF_EMPTY_FRAMES)
+						{
+							releaseMemoryBlock(memoryBlock, memoryTypeIndex, memoryPool.maximumOrder);
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the memory statistics summed up over all Vulkan memory heaps
+		*
+		*  @return
+		*    The memory statistics summed up over all Vulkan memory heaps
+		*/
+		[[nodiscard]] Statistics getTotalStatistics() const
+		{
+			Statistics totalStatistics = {};
+			for (uint32_t heapIndex = 0; heapIndex < mVkPhysicalDeviceMemoryProperties.memoryHeapCount; ++heapIndex)
+			{
+				const Statistics& statistics = mStatistics[heapIndex];
+				totalStatistics.numberOfBlocks				 += statistics.numberOfBlocks;
+				totalStatistics.numberOfDedicatedAllocations += statistics.numberOfDedicatedAllocations;
+				totalStatistics.numberOfSubAllocations		 += statistics.numberOfSubAllocations;
+				totalStatistics.numberOfAllocatedBytes		 += statistics.numberOfAllocatedBytes;
+				totalStatistics.numberOfUsedBytes			 += statistics.numberOfUsedBytes;
+			}
+			return totalStatistics;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		explicit VulkanMemoryAllocator(const VulkanMemoryAllocator& source) = delete;
+		VulkanMemoryAllocator& operator =(const VulkanMemoryAllocator& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef Vector<VkDeviceSize> FreeOffsets;
+
+		struct MemoryBlock final
+		{
+			VkDeviceMemory vkDeviceMemory = VK_NULL_HANDLE;	///< "VK_NULL_HANDLE" if the memory block slot was released
+			uint8_t*	   mappedData = nullptr;				///< Persistently mapped data, null pointer if the memory type isn't host visible
+			uint32_t	   numberOfAllocations = 0;			///< Number of living sub-allocations
+			uint32_t	   numberOfEmptyFrames = 0;			///< Number of frames the memory block has been empty
+			FreeOffsets	   freeOffsets[NUMBER_OF_ORDERS];	///< Per size class the offsets of the free buddies
+		};
+		typedef Vector<MemoryBlock> MemoryBlocks;
+
+		struct MemoryPool final
+		{
+			MemoryBlocks memoryBlocks;
+			uint8_t		 maximumOrder = NUMBER_OF_ORDERS - 1;	///< Size class of a whole memory block
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] inline Statistics& getHeapStatistics(uint32_t memoryTypeIndex)
+		{
+			return mStatistics[mVkPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex];
+		}
+
+		[[nodiscard]] bool allocateVkDeviceMemory(VkDeviceSize numberOfBytes, uint32_t memoryTypeIndex, bool map, VkDeviceMemory& vkDeviceMemory, uint8_t*& mappedData)
+		{
+			if (mNumberOfVkDeviceMemories >= mMaximumMemoryAllocationCount)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "The maximum number of %u Vulkan device memory allocations has been reached", mMaximumMemoryAllocationCount)
+				return false;
+			}
+			const VkMemoryAllocateInfo vkMemoryAllocateInfo =
+			{
+				VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	// sType (VkStructureType)
+				nullptr,								// pNext (const void*)
+				numberOfBytes,							// allocationSize (VkDeviceSize)
+				memoryTypeIndex							// memoryTypeIndex (uint32_t)
+			};
+			if (vkAllocateMemory(mVkDevice, &vkMemoryAllocateInfo, mVulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+			{
+				// Error!
+				vkDeviceMemory = VK_NULL_HANDLE;
+				return false;
+			}
+			mappedData = nullptr;
+			if (map)
+			{
+				void* data = nullptr;
+				if (vkMapMemory(mVkDevice, vkDeviceMemory, 0, VK_WHOLE_SIZE, 0, &data) != VK_SUCCESS)
+				{
+					// Error!
+					RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to map the Vulkan memory")
+					vkFreeMemory(mVkDevice, vkDeviceMemory, mVulkanRhi.getVkAllocationCallbacks());
+					vkDeviceMemory = VK_NULL_HANDLE;
+					return false;
+				}
+				mappedData = static_cast<uint8_t*>(data);
+			}
+			++mNumberOfVkDeviceMemories;
+			return true;
+		}
+
+		void freeVkDeviceMemory(VkDeviceMemory vkDeviceMemory, bool mapped)
+		{
+			if (mapped)
+			{
+				vkUnmapMemory(mVkDevice, vkDeviceMemory);
+			}
+			vkFreeMemory(mVkDevice, vkDeviceMemory, mVulkanRhi.getVkAllocationCallbacks());
+			--mNumberOfVkDeviceMemories;
+		}
+
+		[[nodiscard]] bool allocateDedicated(VkDeviceSize numberOfBytes, uint32_t memoryTypeIndex, bool hostVisible, VulkanMemoryAllocation& vulkanMemoryAllocation)
+		{
+			VkDeviceMemory vkDeviceMemory = VK_NULL_HANDLE;
+			uint8_t* mappedData = nullptr;
+			if (!allocateVkDeviceMemory(numberOfBytes, memoryTypeIndex, hostVisible, vkDeviceMemory, mappedData))
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to allocate %u bytes of Vulkan device memory", static_cast<uint32_t>(numberOfBytes))
+				return false;
+			}
+			vulkanMemoryAllocation.vkDeviceMemory  = vkDeviceMemory;
+			vulkanMemoryAllocation.offset		   = 0;
+			vulkanMemoryAllocation.size			   = numberOfBytes;
+			vulkanMemoryAllocation.mappedData	   = mappedData;
+			vulkanMemoryAllocation.memoryTypeIndex = memoryTypeIndex;
+			vulkanMemoryAllocation.blockIndex	   = ~0u;
+			vulkanMemoryAllocation.poolIndex	   = 0;
+			vulkanMemoryAllocation.order		   = 0;
+			Statistics& statistics = getHeapStatistics(memoryTypeIndex);
+			++statistics.numberOfDedicatedAllocations;
+			statistics.numberOfAllocatedBytes += numberOfBytes;
+			statistics.numberOfUsedBytes += numberOfBytes;
+			return true;
+		}
+
+		[[nodiscard]] bool allocateFromMemoryBlock(MemoryBlock& memoryBlock, uint8_t maximumOrder, uint8_t order, VkDeviceSize& offset)
+		{
+			// Find the smallest free buddy which is large enough
+			uint8_t currentOrder = order;
+			while (currentOrder <= maximumOrder && memoryBlock.freeOffsets[currentOrder].empty())
+			{
+				++currentOrder;
+			}
+			if (currentOrder > maximumOrder)
+			{
+				// Memory block is full
+				return false;
+			}
+			offset = memoryBlock.freeOffsets[currentOrder].back();
+			memoryBlock.freeOffsets[currentOrder].pop_back();
+
+			// Split it down to the requested size class, the upper halves become free buddies
+			while (currentOrder > order)
+			{
+				--currentOrder;
+				memoryBlock.freeOffsets[currentOrder].push_back(offset + (MINIMUM_ALLOCATION_SIZE << currentOrder));
+			}
+			return true;
+		}
+
+		void freeInsideMemoryBlock(MemoryBlock& memoryBlock, uint8_t maximumOrder, uint8_t order, VkDeviceSize offset)
+		{
+			// Merge with free buddies as long as possible
+			while (order < maximumOrder)
+			{
+				const VkDeviceSize buddyOffset = offset ^ (MINIMUM_ALLOCATION_SIZE << order);
+				FreeOffsets& freeOffsets = memoryBlock.freeOffsets[order];
+				FreeOffsets::iterator iterator = std::find(freeOffsets.begin(), freeOffsets.end(), buddyOffset);
+				if (freeOffsets.end() == iterator)
+				{
+					break;
+				}
+				*iterator = freeOffsets.back();
+				freeOffsets.pop_back();
+				offset = std::min(offset, buddyOffset);
+				++order;
+			}
+			memoryBlock.freeOffsets[order].push_back(offset);
+		}
+
+		[[nodiscard]] uint32_t getNumberOfLivingMemoryBlocks(const MemoryPool& memoryPool) const
+		{
+			uint32_t numberOfLivingMemoryBlocks = 0;
+			for (const MemoryBlock& memoryBlock : memoryPool.memoryBlocks)
+			{
+				if (VK_NULL_HANDLE != memoryBlock.vkDeviceMemory)
+				{
+					++numberOfLivingMemoryBlocks;
+				}
+			}
+			return numberOfLivingMemoryBlocks;
+		}
+
+		void releaseMemoryBlock(MemoryBlock& memoryBlock, uint32_t memoryTypeIndex, uint8_t maximumOrder)
+		{
+			freeVkDeviceMemory(memoryBlock.vkDeviceMemory, nullptr != memoryBlock.mappedData);
+			memoryBlock.vkDeviceMemory = VK_NULL_HANDLE;
+			memoryBlock.mappedData = nullptr;
+			for (FreeOffsets& freeOffsets : memoryBlock.freeOffsets)
+			{
+				freeOffsets.clear();
+			}
+			Statistics& statistics = getHeapStatistics(memoryTypeIndex);
+			--statistics.numberOfBlocks;
+			statistics.numberOfAllocatedBytes -= MINIMUM_ALLOCATION_SIZE << maximumOrder;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		VulkanRhi&						 mVulkanRhi;								///< Owner Vulkan RHI instance
+		VkDevice						 mVkDevice;									///< Vulkan device instance
+		VkPhysicalDeviceMemoryProperties mVkPhysicalDeviceMemoryProperties;			///< Cached Vulkan physical device memory properties
+		uint32_t						 mMaximumMemoryAllocationCount;				///< "VkPhysicalDeviceLimits::maxMemoryAllocationCount"
+		uint32_t						 mNumberOfVkDeviceMemories;					///< Current number of Vulkan device memory allocations
+		MemoryPool						 mMemoryPools[VK_MAX_MEMORY_TYPES][NUMBER_OF_POOL_TYPES];
+		Statistics						 mStatistics[VK_MAX_MEMORY_HEAPS];			///< Memory statistics per Vulkan memory heap
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ VulkanRhi/VulkanUploadContext.h                       ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Vulkan upload context
+	*
+	*  @remarks
+	*    Batches resource uploads so that creating resources doesn't result in a full CPU/GPU synchronization per resource:
+	*    - Upload data is written into a persistently mapped staging ring buffer, uploads which don't fit into the ring buffer get a temporary staging buffer
+	*    - All upload commands are recorded into the command buffers of the current upload batch which is submitted once per frame, or when the staging ring buffer runs full
+	*    - Each submitted upload batch has a Vulkan fence, once it's signaled the staging ring buffer space of the upload batch is retired
+	*    - If the Vulkan device has a dedicated transfer queue family, copies are done on the transfer queue and images are handed over to the
+	*      graphics queue via queue family ownership transfer barriers. Mipmap generation and similar operations requiring a graphics queue are
+	*      recorded into a separate graphics command buffer which waits for the transfer queue using a semaphore.
+	*
+	*  @note
+	*    - Not thread-safe, the Vulkan RHI doesn't support native multithreading (yet)
+	*/
+	class VulkanUploadContext final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr VkDeviceSize STAGING_RING_BUFFER_SIZE = 32 * 1024 * 1024;	///< Staging ring buffer size in bytes
+		static constexpr uint32_t	  NUMBER_OF_UPLOAD_BATCHES = 3;					///< Number of upload batches which can be in flight at the same time
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] vulkanRhi
+		*    Owner Vulkan RHI instance
+		*  @param[in] vulkanMemoryAllocator
+		*    Vulkan memory allocator to use, must stay valid as long as the upload context instance exists
+		*  @param[in] vkDevice
+		*    Vulkan device to use
+		*  @param[in] graphicsQueueFamilyIndex
+		*    Graphics queue family index
+		*  @param[in] graphicsVkQueue
+		*    Vulkan graphics queue
+		*  @param[in] transferQueueFamilyIndex
+		*    Transfer queue family index, identical to the graphics queue family index if there's no dedicated transfer queue family
+		*  @param[in] transferVkQueue
+		*    Vulkan transfer queue
+		*/
+		VulkanUploadContext(VulkanRhi& vulkanRhi, VulkanMemoryAllocator& vulkanMemoryAllocator, VkDevice vkDevice, uint32_t graphicsQueueFamilyIndex, VkQueue graphicsVkQueue, uint32_t transferQueueFamilyIndex, VkQueue transferVkQueue) :
+			mVulkanRhi(vulkanRhi),
+			mVulkanMemoryAllocator(vulkanMemoryAllocator),
+			mVkDevice(vkDevice),
+			mGraphicsQueueFamilyIndex(graphicsQueueFamilyIndex),
+			mGraphicsVkQueue(graphicsVkQueue),
+			mTransferQueueFamilyIndex(transferQueueFamilyIndex),
+			mTransferVkQueue(transferVkQueue),
+			mGraphicsVkCommandPool(VK_NULL_HANDLE),
+			mTransferVkCommandPool(VK_NULL_HANDLE),
+			mStagingRingVkBuffer(VK_NULL_HANDLE),
+			mStagingRingBufferHead(0),
+			mStagingRingBufferTail(0),
+			mCurrentUploadBatchIndex(0)
+		{
+			const Rhi::Context& context = mVulkanRhi.getContext();
+			const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanRhi.getVkAllocationCallbacks();
+			mGraphicsVkCommandPool = ::detail::createVkCommandPool(context, vkAllocationCallbacks, mVkDevice, mGraphicsQueueFamilyIndex);
+			mTransferVkCommandPool = hasDedicatedTransferQueue() ? ::detail::createVkCommandPool(context, vkAllocationCallbacks, mVkDevice, mTransferQueueFamilyIndex) : mGraphicsVkCommandPool;
+
+			// Create the upload batches
+			static constexpr VkFenceCreateInfo vkFenceCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// sType (VkStructureType)
+				nullptr,								// pNext (const void*)
+				0										// flags (VkFenceCreateFlags)
+			};
+			static constexpr VkSemaphoreCreateInfo vkSemaphoreCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,	// sType (VkStructureType)
+				nullptr,									// pNext (const void*)
+				0											// flags (VkSemaphoreCreateFlags)
+			};
+			for (UploadBatch& uploadBatch : mUploadBatches)
+			{
+				uploadBatch.graphicsVkCommandBuffer = ::detail::createVkCommandBuffer(context, mVkDevice, mGraphicsVkCommandPool);
+				if (hasDedicatedTransferQueue())
+				{
+					uploadBatch.transferVkCommandBuffer = ::detail::createVkCommandBuffer(context, mVkDevice, mTransferVkCommandPool);
+					if (vkCreateSemaphore(mVkDevice, &vkSemaphoreCreateInfo, vkAllocationCallbacks, &uploadBatch.vkSemaphore) != VK_SUCCESS)
+					{
+						RHI_LOG(context, CRITICAL, "Failed to create Vulkan upload semaphore")
+					}
+				}
+				else
+				{
+					uploadBatch.transferVkCommandBuffer = uploadBatch.graphicsVkCommandBuffer;
+				}
+				if (vkCreateFence(mVkDevice, &vkFenceCreateInfo, vkAllocationCallbacks, &uploadBatch.vkFence) != VK_SUCCESS)
+				{
+					RHI_LOG(context, CRITICAL, "Failed to create Vulkan upload fence")
+				}
+			}
+
+			// Create the persistently mapped staging ring buffer
+			if (!createStagingBuffer(STAGING_RING_BUFFER_SIZE, mStagingRingVkBuffer, mStagingRingVulkanMemoryAllocation))
+			{
+				RHI_LOG(context, WARNING, "Failed to create the Vulkan staging ring buffer, falling back to temporary staging buffers")
+			}
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~VulkanUploadContext()
+		{
+			// Wait until all uploads are done
+			waitIdle();
+
+			// Destroy the staging ring buffer
+			if (VK_NULL_HANDLE != mStagingRingVkBuffer)
+			{
+				vkDestroyBuffer(mVkDevice, mStagingRingVkBuffer, mVulkanRhi.getVkAllocationCallbacks());
+				mVulkanMemoryAllocator.free(mStagingRingVulkanMemoryAllocation);
+			}
+
+			// Destroy the upload batches
+			for (UploadBatch& uploadBatch : mUploadBatches)
+			{
+				if (VK_NULL_HANDLE != uploadBatch.vkFence)
+				{
+					vkDestroyFence(mVkDevice, uploadBatch.vkFence, mVulkanRhi.getVkAllocationCallbacks());
+				}
+				if (VK_NULL_HANDLE != uploadBatch.vkSemaphore)
+				{
+					vkDestroySemaphore(mVkDevice, uploadBatch.vkSemaphore, mVulkanRhi.getVkAllocationCallbacks());
+				}
+			}
+			if (hasDedicatedTransferQueue() && VK_NULL_HANDLE != mTransferVkCommandPool)
+			{
+				vkDestroyCommandPool(mVkDevice, mTransferVkCommandPool, mVulkanRhi.getVkAllocationCallbacks());
+			}
+			if (VK_NULL_HANDLE != mGraphicsVkCommandPool)
+			{
+				vkDestroyCommandPool(mVkDevice, mGraphicsVkCommandPool, mVulkanRhi.getVkAllocationCallbacks());
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not a dedicated transfer queue is used for uploads
+		*
+		*  @return
+		*    "true" if a dedicated transfer queue is used for uploads, else "false"
+		*/
+		[[nodiscard]] inline bool hasDedicatedTransferQueue() const
+		{
+			return (mTransferQueueFamilyIndex != mGraphicsQueueFamilyIndex);
+		}
+
+		/**
+		*  @brief
+		*    Allocate staging memory for an upload of the current upload batch
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate
+		*  @param[in] alignment
+		*    Required alignment of the offset inside the staging buffer, doesn't need to be a power of two
+		*  @param[out] vkBuffer
+		*    Receives the Vulkan staging buffer to copy from
+		*  @param[out] offset
+		*    Receives the offset inside the Vulkan staging buffer
+		*
+		*  @return
+		*    Pointer to the persistently mapped staging memory to write the upload data into, null pointer on error
+		*
+		*  @note
+		*    - The staging memory stays valid until the current upload batch has been retired, don't keep the pointer around
+		*    - If there's no free space inside the staging ring buffer, previous upload batches are submitted and the oldest one is waited for
+		*/
+		[[nodiscard]] uint8_t* allocateStagingMemory(VkDeviceSize numberOfBytes, VkDeviceSize alignment, VkBuffer& vkBuffer, VkDeviceSize& offset)
+		{
+			// Uploads which would fill more than half of the staging ring buffer get a temporary staging buffer
+			if (numberOfBytes <= STAGING_RING_BUFFER_SIZE / 2 && VK_NULL_HANDLE != mStagingRingVkBuffer)
+			{
+				for (;;)
+				{
+					// Free space inside the staging ring buffer?
+					if (allocateFromStagingRingBuffer(numberOfBytes, alignment, offset))
+					{
+						vkBuffer = mStagingRingVkBuffer;
+						return mStagingRingVulkanMemoryAllocation.mappedData + offset;
+					}
+
+					// The staging ring buffer is full: Submit the current upload batch and wait for the oldest one in flight
+					if (!mUploadBatches[mCurrentUploadBatchIndex].recording && !retireOldestUploadBatch())
+					{
+						// Nothing left in flight which could give us free space, can't happen with the size limit above
+						break;
+					}
+					flush();
+				}
+			}
+
+			// Create a temporary staging buffer which is destroyed as soon as the current upload batch has been retired
+			UploadBatch& uploadBatch = getCurrentUploadBatch();
+			TemporaryStagingBuffer temporaryStagingBuffer;
+			if (!createStagingBuffer(numberOfBytes, temporaryStagingBuffer.vkBuffer, temporaryStagingBuffer.vulkanMemoryAllocation))
+			{
+				// Error!
+				return nullptr;
+			}
+			uploadBatch.temporaryStagingBuffers.push_back(temporaryStagingBuffer);
+			vkBuffer = temporaryStagingBuffer.vkBuffer;
+			offset = 0;
+			return temporaryStagingBuffer.vulkanMemoryAllocation.mappedData;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan command buffer to record copy commands of the current upload batch into
+		*
+		*  @return
+		*    The Vulkan command buffer to record copy commands into, executed on the transfer queue
+		*/
+		[[nodiscard]] inline VkCommandBuffer getTransferVkCommandBuffer()
+		{
+			return getCurrentUploadBatch().transferVkCommandBuffer;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan command buffer to record graphics commands of the current upload batch into
+		*
+		*  @return
+		*    The Vulkan command buffer to record graphics commands like image blits into, executed on the graphics queue after the transfer command buffer
+		*/
+		[[nodiscard]] inline VkCommandBuffer getGraphicsVkCommandBuffer()
+		{
+			return getCurrentUploadBatch().graphicsVkCommandBuffer;
+		}
+
+		/**
+		*  @brief
+		*    Record the transition of an image which was filled by using the transfer command buffer into its final layout
+		*
+		*  @param[in] vkImage
+		*    Vulkan image to hand over
+		*  @param[in] vkImageSubresourceRange
+		*    Vulkan image subresource range to hand over
+		*  @param[in] newVkImageLayout
+		*    New Vulkan image layout, the old layout must be "VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL"
+		*  @param[in] dstVkAccessFlags
+		*    Vulkan access flags of the following usage on the graphics queue
+		*
+		*  @note
+		*    - In case of a dedicated transfer queue the queue family ownership is released inside the transfer command buffer and acquired inside the graphics command buffer
+		*/
+		void handOverVkImage(VkImage vkImage, const VkImageSubresourceRange& vkImageSubresourceRange, VkImageLayout newVkImageLayout, VkAccessFlags dstVkAccessFlags)
+		{
+			UploadBatch& uploadBatch = getCurrentUploadBatch();
+			VkImageMemoryBarrier vkImageMemoryBarrier =
+			{
+				VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,	// sType (VkStructureType)
+				nullptr,								// pNext (const void*)
+				VK_ACCESS_TRANSFER_WRITE_BIT,			// srcAccessMask (VkAccessFlags)
+				dstVkAccessFlags,						// dstAccessMask (VkAccessFlags)
+				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,	// oldLayout (VkImageLayout)
+				newVkImageLayout,						// newLayout (VkImageLayout)
+				VK_QUEUE_FAMILY_IGNORED,				// srcQueueFamilyIndex (uint32_t)
+				VK_QUEUE_FAMILY_IGNORED,				// dstQueueFamilyIndex (uint32_t)
+				vkImage,								// image (VkImage)
+				vkImageSubresourceRange					// subresourceRange (VkImageSubresourceRange)
+			};
+			if (hasDedicatedTransferQueue())
+			{
+				// Release on the transfer queue
+				vkImageMemoryBarrier.dstAccessMask		 = 0;
+				vkImageMemoryBarrier.srcQueueFamilyIndex = mTransferQueueFamilyIndex;
+				vkImageMemoryBarrier.dstQueueFamilyIndex = mGraphicsQueueFamilyIndex;
+				vkCmdPipelineBarrier(uploadBatch.transferVkCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &vkImageMemoryBarrier);
+
+				// Acquire on the graphics queue
+				vkImageMemoryBarrier.srcAccessMask = 0;
+				vkImageMemoryBarrier.dstAccessMask = dstVkAccessFlags;
+				vkCmdPipelineBarrier(uploadBatch.graphicsVkCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &vkImageMemoryBarrier);
+			}
+			else
+			{
+				vkCmdPipelineBarrier(uploadBatch.graphicsVkCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, &vkImageMemoryBarrier);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Submit the current upload batch, if there's one
+		*
+		*  @remarks
+		*    Must be called before command buffers using the uploaded resources are submitted to the graphics queue. Uploads are ordered
+		*    before later graphics queue submissions, so there's no need to wait on the CPU side.
+		*/
+		void flush()
+		{
+			UploadBatch& uploadBatch = mUploadBatches[mCurrentUploadBatchIndex];
+			if (!uploadBatch.recording)
+			{
+				// Nothing to do in here
+				return;
+			}
+			uploadBatch.recording = false;
+			uploadBatch.stagingRingBufferEnd = mStagingRingBufferHead;
+
+			// Submit the transfer command buffer to the dedicated transfer queue
+			if (hasDedicatedTransferQueue())
+			{
+				vkEndCommandBuffer(uploadBatch.transferVkCommandBuffer);
+				const VkSubmitInfo vkSubmitInfo =
+				{
+					VK_STRUCTURE_TYPE_SUBMIT_INFO,				// sType (VkStructureType)
+					nullptr,									// pNext (const void*)
+					0,											// waitSemaphoreCount (uint32_t)
+					nullptr,									// pWaitSemaphores (const VkSemaphore*)
+					nullptr,									// pWaitDstStageMask (const VkPipelineStageFlags*)
+					1,											// commandBufferCount (uint32_t)
+					&uploadBatch.transferVkCommandBuffer,		// pCommandBuffers (const VkCommandBuffer*)
+					1,											// signalSemaphoreCount (uint32_t)
+					&uploadBatch.vkSemaphore					// pSignalSemaphores (const VkSemaphore*)
+				};
+				if (vkQueueSubmit(mTransferVkQueue, 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+				{
+					// Error!
+					RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Vulkan transfer queue submit failed")
+				}
+			}
+
+			// Submit the graphics command buffer, the fence signals the completion of the whole upload batch
+			vkEndCommandBuffer(uploadBatch.graphicsVkCommandBuffer);
+			static constexpr VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			const VkSubmitInfo vkSubmitInfo =
+			{
+				VK_STRUCTURE_TYPE_SUBMIT_INFO,										// sType (VkStructureType)
+				nullptr,															// pNext (const void*)
+				hasDedicatedTransferQueue() ? 1u : 0u,								// waitSemaphoreCount (uint32_t)
+				hasDedicatedTransferQueue() ? &uploadBatch.vkSemaphore : nullptr,	// pWaitSemaphores (const VkSemaphore*)
+				hasDedicatedTransferQueue() ? &waitDstStageMask : nullptr,			// pWaitDstStageMask (const VkPipelineStageFlags*)
+				1,																	// commandBufferCount (uint32_t)
+				&uploadBatch.graphicsVkCommandBuffer,								// pCommandBuffers (const VkCommandBuffer*)
+				0,																	// signalSemaphoreCount (uint32_t)
+				nullptr																// pSignalSemaphores (const VkSemaphore*)
+			};
+			if (vkQueueSubmit(mGraphicsVkQueue, 1, &vkSubmitInfo, uploadBatch.vkFence) != VK_SUCCESS)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Vulkan upload queue submit failed")
+			}
+			uploadBatch.inFlight = true;
+
+			// Move on to the next upload batch
+			mCurrentUploadBatchIndex = (mCurrentUploadBatchIndex + 1) % NUMBER_OF_UPLOAD_BATCHES;
+		}
+
+		/**
+		*  @brief
+		*    Retire all upload batches the GPU has finished with, doesn't block
+		*
+		*  @note
+		*    - Upload batches are retired strictly in submission order, stopping at the first one which isn't done, yet, since the staging ring buffer tail must only move forward
+		*/
+		void retireFinishedUploadBatches()
+		{
+			for (uint32_t i = 0; i < NUMBER_OF_UPLOAD_BATCHES; ++i)
+			{
+				UploadBatch& uploadBatch = getUploadBatchInSubmissionOrder(i);
+				if (uploadBatch.inFlight)
+				{
+					if (vkGetFenceStatus(mVkDevice, uploadBatch.vkFence) != VK_SUCCESS)
+					{
+						// Not done, yet, so newer upload batches can't be retired either
+						break;
+					}
+					retireUploadBatch(uploadBatch);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Submit the current upload batch and wait until all upload batches are done
+		*
+		*  @note
+		*    - Required before e.g. destroying a resource which might still be referenced by an upload batch in flight
+		*/
+		void waitIdle()
+		{
+			flush();
+			for (uint32_t i = 0; i < NUMBER_OF_UPLOAD_BATCHES; ++i)
+			{
+				UploadBatch& uploadBatch = getUploadBatchInSubmissionOrder(i);
+				if (uploadBatch.inFlight)
+				{
+					vkWaitForFences(mVkDevice, 1, &uploadBatch.vkFence, VK_TRUE, UINT64_MAX);
+					retireUploadBatch(uploadBatch);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Destroy a Vulkan image and free its memory as soon as no upload batch references it anymore
+		*
+		*  @param[in] vkImage
+		*    Vulkan image to destroy, must be valid
+		*  @param[in] vulkanMemoryAllocation
+		*    Vulkan memory allocation of the image to free, reset on return
+		*
+		*  @note
+		*    - Doesn't block: If there are pending uploads, the release is added to the newest upload batch which is recorded or in flight and performed when it gets retired, since upload batches are retired in submission order all older ones are done by then
+		*/
+		void destroyAndFreeVkImage(VkImage vkImage, VulkanMemoryAllocation& vulkanMemoryAllocation)
+		{
+			// Find the newest upload batch which is recorded or in flight, it's either the current one or the previously submitted one
+			UploadBatch* uploadBatch = nullptr;
+			if (mUploadBatches[mCurrentUploadBatchIndex].recording)
+			{
+				uploadBatch = &mUploadBatches[mCurrentUploadBatchIndex];
+			}
+			else
+			{
+				UploadBatch& previousUploadBatch = mUploadBatches[(mCurrentUploadBatchIndex + NUMBER_OF_UPLOAD_BATCHES - 1) % NUMBER_OF_UPLOAD_BATCHES];
+				if (previousUploadBatch.inFlight)
+				{
+					uploadBatch = &previousUploadBatch;
+				}
+			}
+
+			// Release now or defer the release until the upload batch gets retired
+			if (nullptr != uploadBatch)
+			{
+				uploadBatch->retiredImages.push_back({vkImage, vulkanMemoryAllocation});
+				vulkanMemoryAllocation = VulkanMemoryAllocation();
+			}
+			else
+			{
+				vkDestroyImage(mVkDevice, vkImage, mVulkanRhi.getVkAllocationCallbacks());
+				mVulkanMemoryAllocator.free(vulkanMemoryAllocation);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not there are uploads which are recorded or in flight
+		*
+		*  @return
+		*    "true" if there are pending uploads, else "false"
+		*/
+		[[nodiscard]] bool hasPendingUploads() const
+		{
+			for (const UploadBatch& uploadBatch : mUploadBatches)
+			{
+				if (uploadBatch.recording || uploadBatch.inFlight)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		explicit VulkanUploadContext(const VulkanUploadContext& source) = delete;
+		VulkanUploadContext& operator =(const VulkanUploadContext& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct TemporaryStagingBuffer final
+		{
+			VkBuffer			   vkBuffer = VK_NULL_HANDLE;
+			VulkanMemoryAllocation vulkanMemoryAllocation;
+		};
+		typedef Vector<TemporaryStagingBuffer> TemporaryStagingBuffers;
+
+		struct RetiredImage final
+		{
+			VkImage				   vkImage = VK_NULL_HANDLE;
+			VulkanMemoryAllocation vulkanMemoryAllocation;
+		};
+		typedef Vector<RetiredImage> RetiredImages;
+
+		struct UploadBatch final
+		{
+			VkCommandBuffer			transferVkCommandBuffer = VK_NULL_HANDLE;	///< Identical to "graphicsVkCommandBuffer" if there's no dedicated transfer queue
+			VkCommandBuffer			graphicsVkCommandBuffer = VK_NULL_HANDLE;
+			VkSemaphore				vkSemaphore = VK_NULL_HANDLE;				///< Signaled by the transfer queue submission, only used with a dedicated transfer queue
+			VkFence					vkFence = VK_NULL_HANDLE;					///< Signaled as soon as the whole upload batch is done
+			VkDeviceSize			stagingRingBufferEnd = 0;					///< Staging ring buffer head at the time the upload batch was submitted
+			bool					recording = false;							///< Are commands currently recorded into the upload batch?
+			bool					inFlight = false;							///< Was the upload batch submitted but not yet retired?
+			TemporaryStagingBuffers temporaryStagingBuffers;					///< Temporary staging buffers to destroy when the upload batch gets retired
+			RetiredImages			retiredImages;								///< Images which were destroyed by their owners while the upload batch was recorded or in flight, released when the upload batch gets retired
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] bool createStagingBuffer(VkDeviceSize numberOfBytes, VkBuffer& vkBuffer, VulkanMemoryAllocation& vulkanMemoryAllocation)
+		{
+			const VkBufferCreateInfo vkBufferCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,	// sType (VkStructureType)
+				nullptr,								// pNext (const void*)
+				0,										// flags (VkBufferCreateFlags)
+				numberOfBytes,							// size (VkDeviceSize)
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,		// usage (VkBufferUsageFlags)
+				VK_SHARING_MODE_EXCLUSIVE,				// sharingMode (VkSharingMode)
+				0,										// queueFamilyIndexCount (uint32_t)
+				nullptr									// pQueueFamilyIndices (const uint32_t*)
+			};
+			if (vkCreateBuffer(mVkDevice, &vkBufferCreateInfo, mVulkanRhi.getVkAllocationCallbacks(), &vkBuffer) != VK_SUCCESS)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan staging buffer")
+				vkBuffer = VK_NULL_HANDLE;
+				return false;
+			}
+			VkMemoryRequirements vkMemoryRequirements = {};
+			vkGetBufferMemoryRequirements(mVkDevice, vkBuffer, &vkMemoryRequirements);
+			if (!mVulkanMemoryAllocator.allocate(vkMemoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, VulkanMemoryAllocator::LINEAR_POOL, vulkanMemoryAllocation))
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan staging buffer memory")
+				vkDestroyBuffer(mVkDevice, vkBuffer, mVulkanRhi.getVkAllocationCallbacks());
+				vkBuffer = VK_NULL_HANDLE;
+				return false;
+			}
+			vkBindBufferMemory(mVkDevice, vkBuffer, vulkanMemoryAllocation.vkDeviceMemory, vulkanMemoryAllocation.offset);
+			return true;
+		}
+
+		[[nodiscard]] bool allocateFromStagingRingBuffer(VkDeviceSize numberOfBytes, VkDeviceSize alignment, VkDeviceSize& offset)
+		{
+			// The ring buffer is empty if head and tail are identical, so an allocation must never make them identical again
+			const VkDeviceSize alignedHead = (mStagingRingBufferHead + alignment - 1) / alignment * alignment;
+			if (mStagingRingBufferHead >= mStagingRingBufferTail)
+			{
+				// Free space at the end of the ring buffer?
+				if (alignedHead + numberOfBytes <= STAGING_RING_BUFFER_SIZE)
+				{
+					offset = alignedHead;
+					mStagingRingBufferHead = alignedHead + numberOfBytes;
+					return true;
+				}
+
+				// Free space at the beginning of the ring buffer? The skipped bytes at the end are retired together with the upload batch.
+				if (numberOfBytes < mStagingRingBufferTail)
+				{
+					offset = 0;
+					mStagingRingBufferHead = numberOfBytes;
+					return true;
+				}
+			}
+			else if (alignedHead + numberOfBytes < mStagingRingBufferTail)
+			{
+				offset = alignedHead;
+				mStagingRingBufferHead = alignedHead + numberOfBytes;
+				return true;
+			}
 
-			// Done
-			return result;
+			// The staging ring buffer is full
+			return false;
 		}
 
-		/**
-		*  @brief
-		*    Setup debug callback
-		*/
-		void setupDebugCallback()
+		[[nodiscard]] UploadBatch& getCurrentUploadBatch()
 		{
-			// Sanity check
-			RHI_ASSERT(mVulkanRhi.getContext(), mValidationEnabled, "Do only call this Vulkan method if validation is enabled")
+			UploadBatch& uploadBatch = mUploadBatches[mCurrentUploadBatchIndex];
+			if (!uploadBatch.recording)
+			{
+				// The upload batch might still be in flight from the last round
+				if (uploadBatch.inFlight)
+				{
+					vkWaitForFences(mVkDevice, 1, &uploadBatch.vkFence, VK_TRUE, UINT64_MAX);
+					retireUploadBatch(uploadBatch);
+				}
 
-			// The report flags determine what type of messages for the layers will be displayed
-			// -> Use "VK_DEBUG_REPORT_FLAG_BITS_MAX_ENUM_EXT" to get everything, quite verbose
-			static constexpr VkDebugReportFlagsEXT vkDebugReportFlagsEXT = (VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT);
+				// Begin recording, this automatically resets the Vulkan command buffers
+				static constexpr VkCommandBufferBeginInfo vkCommandBufferBeginInfo =
+				{
+					VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,	// sType (VkStructureType)
+					nullptr,										// pNext (const void*)
+					VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,	// flags (VkCommandBufferUsageFlags)
+					nullptr											// pInheritanceInfo (const VkCommandBufferInheritanceInfo*)
+				};
+				vkBeginCommandBuffer(uploadBatch.graphicsVkCommandBuffer, &vkCommandBufferBeginInfo);
+				if (hasDedicatedTransferQueue())
+				{
+					vkBeginCommandBuffer(uploadBatch.transferVkCommandBuffer, &vkCommandBufferBeginInfo);
+				}
+				uploadBatch.recording = true;
+			}
+			return uploadBatch;
+		}
 
-			// Setup debug callback
-			const VkDebugReportCallbackCreateInfoEXT vkDebugReportCallbackCreateInfoEXT =
+		[[nodiscard]] inline UploadBatch& getUploadBatchInSubmissionOrder(uint32_t index)
+		{
+			// The upload batches are submitted in round-robin order: The current one is either recorded and hence the newest one, or it's
+			// still in flight from the last round and hence the oldest one, either way the in flight upload batches follow in submission order
+			return mUploadBatches[(mCurrentUploadBatchIndex + index) % NUMBER_OF_UPLOAD_BATCHES];
+		}
+
+		[[nodiscard]] bool retireOldestUploadBatch()
+		{
+			for (uint32_t i = 0; i < NUMBER_OF_UPLOAD_BATCHES; ++i)
 			{
-				VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT,	// sType (VkStructureType)
-				nullptr,													// pNext (const void*)
-				vkDebugReportFlagsEXT,										// flags (VkDebugReportFlagsEXT)
-				::detail::debugReportCallback,								// pfnCallback (PFN_vkDebugReportCallbackEXT)
-				const_cast<Rhi::Context*>(&mVulkanRhi.getContext())			// pUserData (void*)
-			};
-			if (vkCreateDebugReportCallbackEXT(mVkInstance, &vkDebugReportCallbackCreateInfoEXT, mVulkanRhi.getVkAllocationCallbacks(), &mVkDebugReportCallbackEXT) != VK_SUCCESS)
+				UploadBatch& uploadBatch = getUploadBatchInSubmissionOrder(i);
+				if (uploadBatch.inFlight)
+				{
+					vkWaitForFences(mVkDevice, 1, &uploadBatch.vkFence, VK_TRUE, UINT64_MAX);
+					retireUploadBatch(uploadBatch);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void retireUploadBatch(UploadBatch& uploadBatch)
+		{
+			RHI_ASSERT(mVulkanRhi.getContext(), uploadBatch.inFlight, "Invalid Vulkan upload batch to retire")
+			vkResetFences(mVkDevice, 1, &uploadBatch.vkFence);
+			uploadBatch.inFlight = false;
+
+			// Give the staging ring buffer space back, upload batches are retired in submission order
+			mStagingRingBufferTail = uploadBatch.stagingRingBufferEnd;
+			if (!hasPendingUploads() && mStagingRingBufferTail == mStagingRingBufferHead)
 			{
-				RHI_LOG(mVulkanRhi.getContext(), WARNING, "Failed to create the Vulkan debug report callback")
+				mStagingRingBufferHead = mStagingRingBufferTail = 0;
+			}
+
+			// Destroy temporary staging buffers
+			for (TemporaryStagingBuffer& temporaryStagingBuffer : uploadBatch.temporaryStagingBuffers)
+			{
+				vkDestroyBuffer(mVkDevice, temporaryStagingBuffer.vkBuffer, mVulkanRhi.getVkAllocationCallbacks());
+				mVulkanMemoryAllocator.free(temporaryStagingBuffer.vulkanMemoryAllocation);
+			}
+			uploadBatch.temporaryStagingBuffers.clear();
+
+			// Destroy images whose owners are gone
+			for (RetiredImage& retiredImage : uploadBatch.retiredImages)
+			{
+				vkDestroyImage(mVkDevice, retiredImage.vkImage, mVulkanRhi.getVkAllocationCallbacks());
+				mVulkanMemoryAllocator.free(retiredImage.vulkanMemoryAllocation);
 			}
+			uploadBatch.retiredImages.clear();
 		}
 
 
@@ -2902,14 +4278,21 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VulkanRhi&				 mVulkanRhi;						///< Owner Vulkan RHI instance
-		bool					 mValidationEnabled;				///< Validation enabled?
-		void*					 mVulkanSharedLibrary;				///< Vulkan shared library, can be a null pointer
-		bool					 mEntryPointsRegistered;			///< Entry points successfully registered?
-		VkInstance				 mVkInstance;						///< Vulkan instance, stores all per-application states
-		VkDebugReportCallbackEXT mVkDebugReportCallbackEXT;			///< Vulkan debug report callback, can be a null handle
-		bool					 mInstanceLevelFunctionsRegistered;	///< Instance level Vulkan function pointers registered?
-		bool					 mInitialized;						///< Already initialized?
+		VulkanRhi&			   mVulkanRhi;							///< Owner Vulkan RHI instance
+		VulkanMemoryAllocator& mVulkanMemoryAllocator;				///< Vulkan memory allocator instance
+		VkDevice			   mVkDevice;							///< Vulkan device instance
+		uint32_t			   mGraphicsQueueFamilyIndex;			///< Graphics queue family index
+		VkQueue				   mGraphicsVkQueue;					///< Vulkan graphics queue
+		uint32_t			   mTransferQueueFamilyIndex;			///< Transfer queue family index, identical to the graphics queue family index if there's no dedicated transfer queue
+		VkQueue				   mTransferVkQueue;					///< Vulkan transfer queue
+		VkCommandPool		   mGraphicsVkCommandPool;				///< Vulkan command pool for the graphics queue family
+		VkCommandPool		   mTransferVkCommandPool;				///< Vulkan command pool for the transfer queue family, identical to "mGraphicsVkCommandPool" if there's no dedicated transfer queue
+		VkBuffer			   mStagingRingVkBuffer;				///< Vulkan staging ring buffer, can be a null handle
+		VulkanMemoryAllocation mStagingRingVulkanMemoryAllocation;	///< Persistently mapped memory of the staging ring buffer
+		VkDeviceSize		   mStagingRingBufferHead;				///< Offset of the next staging ring buffer allocation
+		VkDeviceSize		   mStagingRingBufferTail;				///< Offset of the oldest staging ring buffer allocation which hasn't been retired, yet
+		UploadBatch			   mUploadBatches[NUMBER_OF_UPLOAD_BATCHES];
+		uint32_t			   mCurrentUploadBatchIndex;			///< Index of the upload batch new uploads are recorded into
 
 
 	};
@@ -2945,33 +4328,39 @@ namespace VulkanRhi
 			mVkDevice(VK_NULL_HANDLE),
 			mGraphicsQueueFamilyIndex(~0u),
 			mPresentQueueFamilyIndex(~0u),
+			mTransferQueueFamilyIndex(~0u),
 			mGraphicsVkQueue(VK_NULL_HANDLE),
 			mPresentVkQueue(VK_NULL_HANDLE),
+			mTransferVkQueue(VK_NULL_HANDLE),
 			mVkCommandPool(VK_NULL_HANDLE),
-			mVkCommandBuffer(VK_NULL_HANDLE)
+			mVkCommandBuffer(VK_NULL_HANDLE),
+			mVulkanMemoryAllocator(nullptr),
+			mVulkanUploadContext(nullptr),
+			mVkPipelineCache(VK_NULL_HANDLE)
 		{
 			const VulkanRuntimeLinking& vulkanRuntimeLinking = mVulkanRhi.getVulkanRuntimeLinking();
 
 			// Get the physical Vulkan device this context should use
 			bool enableDebugMarker = true;	// TODO(co) Make it possible to setup from the outside whether or not the "VK_EXT_debug_marker"-extension should be used (e.g. retail shipped games might not want to have this enabled)
 			bool hasMeshShaderSupport = false;
+			bool hasDrawIndirectCountSupport = false;
 			{
 				detail::VkPhysicalDevices vkPhysicalDevices;
 				::detail::enumeratePhysicalDevices(vulkanRhi.getContext(), vulkanRuntimeLinking.getVkInstance(), vkPhysicalDevices);
 				if (!vkPhysicalDevices.empty())
 				{
-					mVkPhysicalDevice = ::detail::selectPhysicalDevice(vulkanRhi.getContext(), vkPhysicalDevices, vulkanRhi.getVulkanRuntimeLinking().isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport);
+					mVkPhysicalDevice = ::detail::selectPhysicalDevice(vulkanRhi.getContext(), vkPhysicalDevices, vulkanRhi.getVulkanRuntimeLinking().isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, hasDrawIndirectCountSupport);
 				}
 			}
 
 			// Create the logical Vulkan device instance
 			if (VK_NULL_HANDLE != mVkPhysicalDevice)
 			{
-				mVkDevice = ::detail::createVkDevice(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex);
+				mVkDevice = ::detail::createVkDevice(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, hasDrawIndirectCountSupport, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex, mTransferQueueFamilyIndex);
 				if (VK_NULL_HANDLE != mVkDevice)
 				{
 					// Load device based instance level Vulkan function pointers
-					if (mVulkanRhi.getVulkanRuntimeLinking().loadDeviceLevelVulkanEntryPoints(mVkDevice, hasMeshShaderSupport))
+					if (mVulkanRhi.getVulkanRuntimeLinking().loadDeviceLevelVulkanEntryPoints(mVkDevice, hasMeshShaderSupport, hasDrawIndirectCountSupport))
 					{
 						// Get the Vulkan device graphics queue that command buffers are submitted to
 						vkGetDeviceQueue(mVkDevice, mGraphicsQueueFamilyIndex, 0, &mGraphicsVkQueue);
@@ -2981,6 +4370,30 @@ namespace VulkanRhi
 							vkGetDeviceQueue(mVkDevice, mPresentQueueFamilyIndex, 0, &mPresentVkQueue);
 							if (VK_NULL_HANDLE != mPresentVkQueue)
 							{
+								// Get the Vulkan device transfer queue, identical to the graphics queue if there's no dedicated transfer queue family
+								vkGetDeviceQueue(mVkDevice, mTransferQueueFamilyIndex, 0, &mTransferVkQueue);
+
+								// Create the Vulkan memory allocator and upload context instances
+								mVulkanMemoryAllocator = RHI_NEW(mVulkanRhi.getContext(), VulkanMemoryAllocator)(mVulkanRhi, mVkPhysicalDevice, mVkDevice);
+								mVulkanUploadContext = RHI_NEW(mVulkanRhi.getContext(), VulkanUploadContext)(mVulkanRhi, *mVulkanMemoryAllocator, mVkDevice, mGraphicsQueueFamilyIndex, mGraphicsVkQueue, mTransferQueueFamilyIndex, mTransferVkQueue);
+
+								{ // Create the Vulkan pipeline cache instance used for all pipelines, it's initially empty and can be filled via "Rhi::IRhi::setPipelineCacheData()"
+									const VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+									{
+										VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// sType (VkStructureType)
+										nullptr,										// pNext (const void*)
+										0,												// flags (VkPipelineCacheCreateFlags)
+										0,												// initialDataSize (size_t)
+										nullptr											// pInitialData (const void*)
+									};
+									if (vkCreatePipelineCache(mVkDevice, &vkPipelineCacheCreateInfo, mVulkanRhi.getVkAllocationCallbacks(), &mVkPipelineCache) != VK_SUCCESS)
+									{
+										// Not fatal, pipelines can be created without pipeline cache
+										RHI_LOG(vulkanRhi.getContext(), WARNING, "Failed to create the Vulkan pipeline cache")
+										mVkPipelineCache = VK_NULL_HANDLE;
+									}
+								}
+
 								// Create Vulkan command pool instance
 								mVkCommandPool = ::detail::createVkCommandPool(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkDevice, mGraphicsQueueFamilyIndex);
 								if (VK_NULL_HANDLE != mVkCommandPool)
@@ -3022,6 +4435,18 @@ namespace VulkanRhi
 					vkDestroyCommandPool(mVkDevice, mVkCommandPool, mVulkanRhi.getVkAllocationCallbacks());
 				}
 				vkDeviceWaitIdle(mVkDevice);
+				if (VK_NULL_HANDLE != mVkPipelineCache)
+				{
+					vkDestroyPipelineCache(mVkDevice, mVkPipelineCache, mVulkanRhi.getVkAllocationCallbacks());
+				}
+				if (nullptr != mVulkanUploadContext)
+				{
+					RHI_DELETE(mVulkanRhi.getContext(), VulkanUploadContext, mVulkanUploadContext);
+				}
+				if (nullptr != mVulkanMemoryAllocator)
+				{
+					RHI_DELETE(mVulkanRhi.getContext(), VulkanMemoryAllocator, mVulkanMemoryAllocator);
+				}
 				vkDestroyDevice(mVkDevice, mVulkanRhi.getVkAllocationCallbacks());
 			}
 		}
@@ -3122,6 +4547,30 @@ namespace VulkanRhi
 			return mPresentVkQueue;
 		}
 
+		/**
+		*  @brief
+		*    Return the used transfer queue family index
+		*
+		*  @return
+		*    Transfer queue family index, identical to the graphics queue family index if there's no dedicated transfer queue family, ~0u if invalid
+		*/
+		[[nodiscard]] inline uint32_t getTransferQueueFamilyIndex() const
+		{
+			return mTransferQueueFamilyIndex;
+		}
+
+		/**
+		*  @brief
+		*    Return the handle to the Vulkan device transfer queue
+		*
+		*  @return
+		*    Handle to the Vulkan device transfer queue, identical to the graphics queue if there's no dedicated transfer queue family
+		*/
+		[[nodiscard]] inline VkQueue getTransferVkQueue() const
+		{
+			return mTransferVkQueue;
+		}
+
 		/**
 		*  @brief
 		*    Return the used Vulkan command buffer pool instance
@@ -3146,22 +4595,40 @@ namespace VulkanRhi
 			return mVkCommandBuffer;
 		}
 
-		// TODO(co) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-		[[nodiscard]] uint32_t findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags vkMemoryPropertyFlags) const
+		/**
+		*  @brief
+		*    Return the Vulkan pipeline cache instance
+		*
+		*  @return
+		*    The Vulkan pipeline cache instance used for all pipelines, can be a null handle
+		*/
+		[[nodiscard]] inline VkPipelineCache getVkPipelineCache() const
 		{
-			VkPhysicalDeviceMemoryProperties vkPhysicalDeviceMemoryProperties;
-			vkGetPhysicalDeviceMemoryProperties(mVkPhysicalDevice, &vkPhysicalDeviceMemoryProperties);
-			for (uint32_t i = 0; i < vkPhysicalDeviceMemoryProperties.memoryTypeCount; ++i)
-			{
-				if ((typeFilter & (1 << i)) && (vkPhysicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & vkMemoryPropertyFlags) == vkMemoryPropertyFlags)
-				{
-					return i;
-				}
-			}
+			return mVkPipelineCache;
+		}
 
-			// Error!
-			RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to find suitable Vulkan memory type")
-			return ~0u;
+		/**
+		*  @brief
+		*    Return the Vulkan memory allocator instance
+		*
+		*  @return
+		*    The Vulkan memory allocator instance, do not free the memory the reference is pointing to
+		*/
+		[[nodiscard]] inline VulkanMemoryAllocator& getVulkanMemoryAllocator() const
+		{
+			return *mVulkanMemoryAllocator;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan upload context instance
+		*
+		*  @return
+		*    The Vulkan upload context instance, do not free the memory the reference is pointing to
+		*/
+		[[nodiscard]] inline VulkanUploadContext& getVulkanUploadContext() const
+		{
+			return *mVulkanUploadContext;
 		}
 
 		[[nodiscard]] inline VkCommandBuffer createVkCommandBuffer() const
@@ -3190,15 +4657,20 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VulkanRhi&		 mVulkanRhi;				///< Owner Vulkan RHI instance
-		VkPhysicalDevice mVkPhysicalDevice;			///< Vulkan physical device this context is using
-		VkDevice		 mVkDevice;					///< Vulkan device instance this context is using (equivalent of a OpenGL context or Direct3D 11 device)
-		uint32_t		 mGraphicsQueueFamilyIndex;	///< Graphics queue family index, ~0u if invalid
-		uint32_t		 mPresentQueueFamilyIndex;	///< Present queue family index, ~0u if invalid
-		VkQueue			 mGraphicsVkQueue;			///< Handle to the Vulkan device graphics queue that command buffers are submitted to
-		VkQueue			 mPresentVkQueue;			///< Handle to the Vulkan device present queue
-		VkCommandPool	 mVkCommandPool;			///< Vulkan command buffer pool instance
-		VkCommandBuffer  mVkCommandBuffer;			///< Vulkan command buffer instance
+		VulkanRhi&			   mVulkanRhi;					///< Owner Vulkan RHI instance
+		VkPhysicalDevice	   mVkPhysicalDevice;			///< Vulkan physical device this context is using
+		VkDevice			   mVkDevice;					///< Vulkan device instance this context is using (equivalent of a OpenGL context or Direct3D 11 device)
+		uint32_t			   mGraphicsQueueFamilyIndex;	///< Graphics queue family index, ~0u if invalid
+		uint32_t			   mPresentQueueFamilyIndex;	///< Present queue family index, ~0u if invalid
+		uint32_t			   mTransferQueueFamilyIndex;	///< Transfer queue family index, ~0u if invalid
+		VkQueue				   mGraphicsVkQueue;			///< Handle to the Vulkan device graphics queue that command buffers are submitted to
+		VkQueue				   mPresentVkQueue;				///< Handle to the Vulkan device present queue
+		VkQueue				   mTransferVkQueue;			///< Handle to the Vulkan device transfer queue
+		VkCommandPool		   mVkCommandPool;				///< Vulkan command buffer pool instance
+		VkCommandBuffer		   mVkCommandBuffer;			///< Vulkan command buffer instance
+		VulkanMemoryAllocator* mVulkanMemoryAllocator;		///< Vulkan memory allocator instance, can be a null pointer
+		VulkanUploadContext*   mVulkanUploadContext;		///< Vulkan upload context instance, can be a null pointer
+		VkPipelineCache		   mVkPipelineCache;			///< Vulkan pipeline cache instance used for all pipelines, can be a null handle
 
 
 	};
@@ -3604,7 +5076,9 @@ namespace VulkanRhi
 				VK_FORMAT_R8G8B8A8_UINT,		// Rhi::VertexAttributeFormat::R8G8B8A8_UINT
 				VK_FORMAT_R16G16_SINT,			// Rhi::VertexAttributeFormat::SHORT_2
 				VK_FORMAT_R16G16B16A16_SINT,	// Rhi::VertexAttributeFormat::SHORT_4
-				VK_FORMAT_R32_UINT				// Rhi::VertexAttributeFormat::UINT_1
+				VK_FORMAT_R32_UINT,				// Rhi::VertexAttributeFormat::UINT_1
+				VK_FORMAT_R16G16B16A16_UNORM,	// Rhi::VertexAttributeFormat::R16G16B16A16_UNORM
+				VK_FORMAT_R16G16_SFLOAT			// Rhi::VertexAttributeFormat::HALF_2
 			};
 			return MAPPING[static_cast<int>(vertexAttributeFormat)];
 		}
@@ -4065,8 +5539,7 @@ namespace VulkanRhi
 		//[-------------------------------------------------------]
 		//[ Buffer                                                ]
 		//[-------------------------------------------------------]
-		// TODO(co) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-		static void createAndAllocateVkBuffer(const VulkanRhi& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory)
+		static void createAndAllocateVkBuffer(const VulkanRhi& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, VulkanMemoryAllocation& vulkanMemoryAllocation)
 		{
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 			const VkDevice vkDevice = vulkanContext.getVkDevice();
@@ -4088,30 +5561,22 @@ namespace VulkanRhi
 				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan buffer")
 			}
 
-			// Allocate memory for the Vulkan buffer
+			// Sub-allocate memory for the Vulkan buffer
 			VkMemoryRequirements vkMemoryRequirements = {};
 			vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &vkMemoryRequirements);
-			const VkMemoryAllocateInfo vkMemoryAllocateInfo =
-			{
-				VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,															// sType (VkStructureType)
-				nullptr,																						// pNext (const void*)
-				vkMemoryRequirements.size,																		// allocationSize (VkDeviceSize)
-				vulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags)	// memoryTypeIndex (uint32_t)
-			};
-			if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+			if (!vulkanContext.getVulkanMemoryAllocator().allocate(vkMemoryRequirements, vkMemoryPropertyFlags, VulkanMemoryAllocator::LINEAR_POOL, vulkanMemoryAllocation))
 			{
 				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan buffer memory")
+				return;
 			}
 
-			// Bind and fill memory
-			vkBindBufferMemory(vkDevice, vkBuffer, vkDeviceMemory, 0);
+			// Bind and fill memory, host visible memory is persistently mapped by the Vulkan memory allocator
+			vkBindBufferMemory(vkDevice, vkBuffer, vulkanMemoryAllocation.vkDeviceMemory, vulkanMemoryAllocation.offset);
 			if (nullptr != data)
 			{
-				void* mappedData = nullptr;
-				if (vkMapMemory(vkDevice, vkDeviceMemory, 0, vkBufferCreateInfo.size, 0, &mappedData) == VK_SUCCESS)
+				if (nullptr != vulkanMemoryAllocation.mappedData)
 				{
-					memcpy(mappedData, data, static_cast<size_t>(vkBufferCreateInfo.size));
-					vkUnmapMemory(vkDevice, vkDeviceMemory);
+					memcpy(vulkanMemoryAllocation.mappedData, data, static_cast<size_t>(vkBufferCreateInfo.size));
 				}
 				else
 				{
@@ -4120,16 +5585,13 @@ namespace VulkanRhi
 			}
 		}
 
-		static void destroyAndFreeVkBuffer(const VulkanRhi& vulkanRhi, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory)
+		static void destroyAndFreeVkBuffer(const VulkanRhi& vulkanRhi, VkBuffer& vkBuffer, VulkanMemoryAllocation& vulkanMemoryAllocation)
 		{
 			if (VK_NULL_HANDLE != vkBuffer)
 			{
-				const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
-				vkDestroyBuffer(vkDevice, vkBuffer, vulkanRhi.getVkAllocationCallbacks());
-				if (VK_NULL_HANDLE != vkDeviceMemory)
-				{
-					vkFreeMemory(vkDevice, vkDeviceMemory, vulkanRhi.getVkAllocationCallbacks());
-				}
+				const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
+				vkDestroyBuffer(vulkanContext.getVkDevice(), vkBuffer, vulkanRhi.getVkAllocationCallbacks());
+				vulkanContext.getVulkanMemoryAllocator().free(vulkanMemoryAllocation);
 			}
 		}
 
@@ -4149,8 +5611,8 @@ namespace VulkanRhi
 			return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 		}
 
-		// TODO(co) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-		static VkFormat createAndFillVkImage(const VulkanRhi& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, uint8_t numberOfMultisamples, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView)
+		// Provided data is copied into the staging ring buffer of the Vulkan upload context and uploaded as part of the current upload batch, doesn't block
+		static VkFormat createAndFillVkImage(const VulkanRhi& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, uint8_t numberOfMultisamples, VkImage& vkImage, VulkanMemoryAllocation& vulkanMemoryAllocation, VkImageView& vkImageView)
 		{
 			// Calculate the number of mipmaps
 			const bool dataContainsMipmaps = (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS);
@@ -4220,7 +5682,7 @@ namespace VulkanRhi
 
 			{ // Create and fill Vulkan image
 				const VkImageCreateFlags vkImageCreateFlags = (VK_IMAGE_VIEW_TYPE_CUBE == vkImageViewType || VK_IMAGE_VIEW_TYPE_CUBE_ARRAY == vkImageViewType) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0u;
-				createAndAllocateVkImage(vulkanRhi, vkImageCreateFlags, vkImageType, VkExtent3D{vkExtent3D.width, vkExtent3D.height, depth}, numberOfMipmaps, layerCount, vkFormat, vkSampleCountFlagBits, VK_IMAGE_TILING_OPTIMAL, vkImageUsageFlags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, vkDeviceMemory);
+				createAndAllocateVkImage(vulkanRhi, vkImageCreateFlags, vkImageType, VkExtent3D{vkExtent3D.width, vkExtent3D.height, depth}, numberOfMipmaps, layerCount, vkFormat, vkSampleCountFlagBits, VK_IMAGE_TILING_OPTIMAL, vkImageUsageFlags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, vulkanMemoryAllocation);
 			}
 
 			// Create the Vulkan image view
@@ -4232,20 +5694,29 @@ namespace VulkanRhi
 			// Upload all mipmaps
 			if (nullptr != data)
 			{
-				// Create Vulkan staging buffer
+				VulkanUploadContext& vulkanUploadContext = vulkanRhi.getVulkanContext().getVulkanUploadContext();
+				const uint32_t numberOfUploadedMipmaps = generateMipmaps ? 1 : numberOfMipmaps;
+
+				// Copy the data into staging memory
+				// -> "VkBufferImageCopy::bufferOffset" must be a multiple of four and of the texel block size
 				VkBuffer stagingVkBuffer = VK_NULL_HANDLE;
-				VkDeviceMemory stagingVkDeviceMemory = VK_NULL_HANDLE;
-				createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, stagingVkBuffer, stagingVkDeviceMemory);
+				VkDeviceSize stagingOffset = 0;
+				const VkDeviceSize stagingAlignment = Rhi::TextureFormat::isCompressed(textureFormat) ? 16 : std::lcm<VkDeviceSize>(4, Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat));
+				uint8_t* stagingData = vulkanUploadContext.allocateStagingMemory(numberOfBytes, stagingAlignment, stagingVkBuffer, stagingOffset);
+				if (nullptr == stagingData)
+				{
+					// Error!
+					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to allocate Vulkan staging memory for a texture upload")
+					return vkFormat;
+				}
+				memcpy(stagingData, data, numberOfBytes);
 
 				{ // Upload all mipmaps
-					const uint32_t numberOfUploadedMipmaps = generateMipmaps ? 1 : numberOfMipmaps;
-
-					// Create and begin Vulkan command buffer
-					VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
-					transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_PREINITIALIZED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+					const VkCommandBuffer transferVkCommandBuffer = vulkanUploadContext.getTransferVkCommandBuffer();
+					transitionVkImageLayout(vulkanRhi, transferVkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_PREINITIALIZED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
 					// Upload all mipmaps
-					uint32_t bufferOffset  = 0;
+					VkDeviceSize bufferOffset = stagingOffset;
 					uint32_t currentWidth  = vkExtent3D.width;
 					uint32_t currentHeight = vkExtent3D.height;
 					uint32_t currentDepth  = depth;
@@ -4277,35 +5748,30 @@ namespace VulkanRhi
 					}
 
 					// Copy Vulkan buffer to Vulkan image
-					vkCmdCopyBufferToImage(vkCommandBuffer, stagingVkBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(vkBufferImageCopyList.size()), vkBufferImageCopyList.data());
+					vkCmdCopyBufferToImage(transferVkCommandBuffer, stagingVkBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(vkBufferImageCopyList.size()), vkBufferImageCopyList.data());
 
-					// End and destroy Vulkan command buffer
+					// Hand the uploaded mipmaps over to the graphics queue
+					const VkImageSubresourceRange vkImageSubresourceRange =
+					{
+						vkImageAspectFlags,			// aspectMask (VkImageAspectFlags)
+						0,							// baseMipLevel (uint32_t)
+						numberOfUploadedMipmaps,	// levelCount (uint32_t)
+						0,							// baseArrayLayer (uint32_t)
+						layerCount					// layerCount (uint32_t)
+					};
 					if (generateMipmaps)
 					{
-						const VkImageSubresourceRange vkImageSubresourceRange =
-						{
-							vkImageAspectFlags,	// aspectMask (VkImageAspectFlags)
-							0,					// baseMipLevel (uint32_t)
-							1,					// levelCount (uint32_t)
-							0,					// baseArrayLayer (uint32_t)
-							layerCount			// layerCount (uint32_t)
-						};
-						transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, vkImageSubresourceRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+						vulkanUploadContext.handOverVkImage(vkImage, vkImageSubresourceRange, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_ACCESS_TRANSFER_READ_BIT);
 					}
 					else
 					{
-						transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+						vulkanUploadContext.handOverVkImage(vkImage, vkImageSubresourceRange, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_READ_BIT);
 					}
-					endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
 				}
 
-				// Destroy Vulkan staging buffer
-				destroyAndFreeVkBuffer(vulkanRhi, stagingVkBuffer, stagingVkDeviceMemory);
-
 				// Generate a complete texture mip-chain at runtime from a base image using image blits and proper image barriers
 				// -> Basing on https://github.com/SaschaWillems/Vulkan/tree/master/examples/texturemipmapgen and "Mipmap generation : Transfers, transition layout" by Antoine MORRIER published January 12, 2017 at http://cpp-rendering.io/mipmap-generation/
 				// -> We copy down the whole mip chain doing a blit from mip-1 to mip. An alternative way would be to always blit from the first mip level and sample that one down.
-				// TODO(co) Some GPUs also offer "asynchronous transfer queues" (check for queue families with only the "VK_QUEUE_TRANSFER_BIT" set) that may be used to speed up such operations
 				if (generateMipmaps)
 				{
 					#ifdef RHI_DEBUG
@@ -4320,8 +5786,8 @@ namespace VulkanRhi
 					}
 					#endif
 
-					// Create and begin Vulkan command buffer
-					VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
+					// Record into the graphics command buffer of the current upload batch, blits aren't supported by transfer queues
+					const VkCommandBuffer vkCommandBuffer = vulkanUploadContext.getGraphicsVkCommandBuffer();
 
 					// Copy down mips from n-1 to n
 					for (uint32_t i = 1; i < numberOfMipmaps; ++i)
@@ -4379,9 +5845,6 @@ namespace VulkanRhi
 						};
 						transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, vkImageSubresourceRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 					}
-
-					// End and destroy Vulkan command buffer
-					endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
 				}
 			}
 
@@ -4389,7 +5852,7 @@ namespace VulkanRhi
 			return vkFormat;
 		}
 
-		static void createAndAllocateVkImage(const VulkanRhi& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, uint32_t mipLevels, uint32_t arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory)
+		static void createAndAllocateVkImage(const VulkanRhi& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, uint32_t mipLevels, uint32_t arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, VulkanMemoryAllocation& vulkanMemoryAllocation)
 		{
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 			const VkDevice vkDevice = vulkanContext.getVkDevice();
@@ -4419,50 +5882,39 @@ namespace VulkanRhi
 				}
 			}
 
-			{ // Allocate Vulkan memory
+			{ // Sub-allocate Vulkan memory
 				VkMemoryRequirements vkMemoryRequirements = {};
 				vkGetImageMemoryRequirements(vkDevice, vkImage, &vkMemoryRequirements);
-				const VkMemoryAllocateInfo vkMemoryAllocateInfo =
-				{
-					VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,															// sType (VkStructureType)
-					nullptr,																						// pNext (const void*)
-					vkMemoryRequirements.size,																		// allocationSize (VkDeviceSize)
-					vulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags)	// memoryTypeIndex (uint32_t)
-				};
-				if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+				const VulkanMemoryAllocator::PoolType poolType = (VK_IMAGE_TILING_OPTIMAL == vkImageTiling) ? VulkanMemoryAllocator::OPTIMAL_POOL : VulkanMemoryAllocator::LINEAR_POOL;
+				if (!vulkanContext.getVulkanMemoryAllocator().allocate(vkMemoryRequirements, vkMemoryPropertyFlags, poolType, vulkanMemoryAllocation))
 				{
 					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan memory")
 				}
-				if (vkBindImageMemory(vkDevice, vkImage, vkDeviceMemory, 0) != VK_SUCCESS)
+				else if (vkBindImageMemory(vkDevice, vkImage, vulkanMemoryAllocation.vkDeviceMemory, vulkanMemoryAllocation.offset) != VK_SUCCESS)
 				{
 					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to bind the Vulkan image memory")
 				}
 			}
 		}
 
-		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory)
+		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VulkanMemoryAllocation& vulkanMemoryAllocation)
 		{
 			if (VK_NULL_HANDLE != vkImage)
 			{
-				const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
-				vkDestroyImage(vkDevice, vkImage, vulkanRhi.getVkAllocationCallbacks());
+				// The image might still be referenced by an upload batch which is recorded or in flight, in this case the release is deferred
+				vulkanRhi.getVulkanContext().getVulkanUploadContext().destroyAndFreeVkImage(vkImage, vulkanMemoryAllocation);
 				vkImage = VK_NULL_HANDLE;
-				if (VK_NULL_HANDLE != vkDeviceMemory)
-				{
-					vkFreeMemory(vkDevice, vkDeviceMemory, vulkanRhi.getVkAllocationCallbacks());
-					vkDeviceMemory = VK_NULL_HANDLE;
-				}
 			}
 		}
 
-		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView)
+		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VulkanMemoryAllocation& vulkanMemoryAllocation, VkImageView& vkImageView)
 		{
 			if (VK_NULL_HANDLE != vkImageView)
 			{
 				vkDestroyImageView(vulkanRhi.getVulkanContext().getVkDevice(), vkImageView, vulkanRhi.getVkAllocationCallbacks());
 				vkImageView = VK_NULL_HANDLE;
 			}
-			destroyAndFreeVkImage(vulkanRhi, vkImage, vkDeviceMemory);
+			destroyAndFreeVkImage(vulkanRhi, vkImage, vulkanMemoryAllocation);
 		}
 
 		static void createVkImageView(const VulkanRhi& vulkanRhi, VkImage vkImage, VkImageViewType vkImageViewType, uint32_t levelCount, uint32_t layerCount, VkFormat vkFormat, VkImageAspectFlags vkImageAspectFlags, VkImageView& vkImageView)
@@ -4514,6 +5966,15 @@ namespace VulkanRhi
 					vkDebugMarkerSetObjectNameEXT(vkDevice, &vkDebugMarkerObjectNameInfoEXT);
 				}
 			}
+
+			static void setDebugObjectName(VkDevice vkDevice, const VulkanMemoryAllocation& vulkanMemoryAllocation, const char* objectName)
+			{
+				// Sub-allocations share their Vulkan device memory with other resources, so only dedicated allocations can be named
+				if (vulkanMemoryAllocation.isDedicated())
+				{
+					setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)vulkanMemoryAllocation.vkDeviceMemory, objectName);
+				}
+			}
 		#endif
 
 
@@ -4550,10 +6011,9 @@ namespace VulkanRhi
 			IRootSignature(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mRootSignature(rootSignature),
 			mVkPipelineLayout(VK_NULL_HANDLE),
-			mVkDescriptorPool(VK_NULL_HANDLE)
+			mNumberOfVkDescriptorPoolSizes(0),
+			mCurrentDescriptorPoolPageIndex(0)
 		{
-			static constexpr uint32_t maxSets = 4242;	// TODO(co) We probably need to get this provided from the outside
-
 			// Copy the parameter data
 			const Rhi::Context& context = vulkanRhi.getContext();
 			const uint32_t numberOfRootParameters = mRootSignature.numberOfParameters;
@@ -4794,17 +6254,16 @@ namespace VulkanRhi
 				}
 			}
 
-			{ // Create the Vulkan descriptor pool
-				typedef std::array<VkDescriptorPoolSize, 3> VkDescriptorPoolSizes;
-				VkDescriptorPoolSizes vkDescriptorPoolSizes;
-				uint32_t numberOfVkDescriptorPoolSizes = 0;
+			{ // Gather the Vulkan descriptor pool sizes of a single descriptor set, the descriptor pool pages are created on demand
+				VkDescriptorPoolSizes& vkDescriptorPoolSizes = mVkDescriptorPoolSizes;
+				uint32_t& numberOfVkDescriptorPoolSizes = mNumberOfVkDescriptorPoolSizes;
 
 				// "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER"
 				if (numberOfCombinedImageSamplers > 0)
 				{
 					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
 					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfCombinedImageSamplers;		// descriptorCount (uint32_t)
+					vkDescriptorPoolSize.descriptorCount = numberOfCombinedImageSamplers;				// descriptorCount (uint32_t)
 					++numberOfVkDescriptorPoolSizes;
 				}
 
@@ -4813,7 +6272,7 @@ namespace VulkanRhi
 				{
 					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
 					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfUniformTexelBuffers;	// descriptorCount (uint32_t)
+					vkDescriptorPoolSize.descriptorCount = numberOfUniformTexelBuffers;				// descriptorCount (uint32_t)
 					++numberOfVkDescriptorPoolSizes;
 				}
 
@@ -4822,7 +6281,7 @@ namespace VulkanRhi
 				{
 					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
 					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageTexelBuffers;	// descriptorCount (uint32_t)
+					vkDescriptorPoolSize.descriptorCount = numberOfStorageTexelBuffers;				// descriptorCount (uint32_t)
 					++numberOfVkDescriptorPoolSizes;
 				}
 
@@ -4831,7 +6290,7 @@ namespace VulkanRhi
 				{
 					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
 					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfUniformBuffers;	// descriptorCount (uint32_t)
+					vkDescriptorPoolSize.descriptorCount = numberOfUniformBuffers;				// descriptorCount (uint32_t)
 					++numberOfVkDescriptorPoolSizes;
 				}
 
@@ -4840,7 +6299,7 @@ namespace VulkanRhi
 				{
 					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
 					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageImage;		// descriptorCount (uint32_t)
+					vkDescriptorPoolSize.descriptorCount = numberOfStorageImage;				// descriptorCount (uint32_t)
 					++numberOfVkDescriptorPoolSizes;
 				}
 
@@ -4849,27 +6308,9 @@ namespace VulkanRhi
 				{
 					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
 					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageBuffers;	// descriptorCount (uint32_t)
+					vkDescriptorPoolSize.descriptorCount = numberOfStorageBuffers;				// descriptorCount (uint32_t)
 					++numberOfVkDescriptorPoolSizes;
 				}
-
-				// Create the Vulkan descriptor pool
-				if (numberOfVkDescriptorPoolSizes > 0)
-				{
-					const VkDescriptorPoolCreateInfo VkDescriptorPoolCreateInfo =
-					{
-						VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,		// sType (VkStructureType)
-						nullptr,											// pNext (const void*)
-						VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,	// flags (VkDescriptorPoolCreateFlags)
-						maxSets,											// maxSets (uint32_t)
-						numberOfVkDescriptorPoolSizes,						// poolSizeCount (uint32_t)
-						vkDescriptorPoolSizes.data()						// pPoolSizes (const VkDescriptorPoolSize*)
-					};
-					if (vkCreateDescriptorPool(vkDevice, &VkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkDescriptorPool) != VK_SUCCESS)
-					{
-						RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan descriptor pool")
-					}
-				}
 			}
 
 			// Assign a default name to the resource for debugging purposes
@@ -4882,7 +6323,6 @@ namespace VulkanRhi
 						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT_EXT, (uint64_t)vkDescriptorSetLayout, detailedDebugName);
 					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT, (uint64_t)mVkPipelineLayout, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT, (uint64_t)mVkDescriptorPool, detailedDebugName);
 				}
 			#endif
 		}
@@ -4896,10 +6336,12 @@ namespace VulkanRhi
 			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 
-			// Destroy the Vulkan descriptor pool
-			if (VK_NULL_HANDLE != mVkDescriptorPool)
+			// Destroy the Vulkan descriptor pool pages, all resource groups are referencing the root signature so they must be gone by now
+			RHI_ASSERT(vulkanRhi.getContext(), mCachedResourceGroups.empty(), "Vulkan root signature is destroyed while there are still cached resource groups")
+			for (const DescriptorPoolPage& descriptorPoolPage : mDescriptorPoolPages)
 			{
-				vkDestroyDescriptorPool(vkDevice, mVkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
+				RHI_ASSERT(vulkanRhi.getContext(), 0 == descriptorPoolPage.numberOfDescriptorSets, "Vulkan root signature is destroyed while there are still allocated descriptor sets")
+				vkDestroyDescriptorPool(vkDevice, descriptorPoolPage.vkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
 			}
 
 			// Destroy the Vulkan pipeline layout
@@ -4960,14 +6402,44 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan descriptor pool
+		*    Free a Vulkan descriptor set which was allocated by "createResourceGroup()"
 		*
-		*  @return
-		*    The Vulkan descriptor pool
+		*  @param[in] vkDescriptorPool
+		*    Vulkan descriptor pool page the descriptor set was allocated from
+		*  @param[in] vkDescriptorSet
+		*    Vulkan descriptor set to free
+		*/
+		void freeVkDescriptorSet(VkDescriptorPool vkDescriptorPool, VkDescriptorSet vkDescriptorSet)
+		{
+			for (DescriptorPoolPage& descriptorPoolPage : mDescriptorPoolPages)
+			{
+				if (descriptorPoolPage.vkDescriptorPool == vkDescriptorPool)
+				{
+					RHI_ASSERT(getRhi().getContext(), descriptorPoolPage.numberOfDescriptorSets > 0, "Invalid number of Vulkan descriptor sets inside the descriptor pool page")
+					vkFreeDescriptorSets(static_cast<VulkanRhi&>(getRhi()).getVulkanContext().getVkDevice(), vkDescriptorPool, 1, &vkDescriptorSet);
+					--descriptorPoolPage.numberOfDescriptorSets;
+					return;
+				}
+			}
+			RHI_ASSERT(getRhi().getContext(), false, "Unknown Vulkan descriptor pool page")
+		}
+
+		/**
+		*  @brief
+		*    Remove a resource group from the descriptor set cache
+		*
+		*  @param[in] hash
+		*    Hash of the resource group bindings
+		*  @param[in] resourceGroup
+		*    Resource group to remove, nothing happens if it's not the one which is cached under the given hash
 		*/
-		[[nodiscard]] inline VkDescriptorPool getVkDescriptorPool() const
+		void removeCachedResourceGroup(uint64_t hash, const ResourceGroup& resourceGroup)
 		{
-			return mVkDescriptorPool;
+			CachedResourceGroups::iterator iterator = std::lower_bound(mCachedResourceGroups.begin(), mCachedResourceGroups.end(), hash, [](const CachedResourceGroup& cachedResourceGroup, uint64_t value) { return cachedResourceGroup.hash < value; });
+			if (iterator != mCachedResourceGroups.end() && iterator->hash == hash && iterator->resourceGroup == &resourceGroup)
+			{
+				mCachedResourceGroups.erase(iterator);
+			}
 		}
 
 
@@ -4978,31 +6450,156 @@ namespace VulkanRhi
 		[[nodiscard]] virtual Rhi::IResourceGroup* createResourceGroup(uint32_t rootParameterIndex, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates = nullptr RHI_RESOURCE_DEBUG_NAME_PARAMETER) override;
 
 
-	//[-------------------------------------------------------]
-	//[ Protected virtual Rhi::RefCount methods               ]
-	//[-------------------------------------------------------]
-	protected:
-		inline virtual void selfDestruct() override
+	//[-------------------------------------------------------]
+	//[ Protected virtual Rhi::RefCount methods               ]
+	//[-------------------------------------------------------]
+	protected:
+		inline virtual void selfDestruct() override
+		{
+			RHI_DELETE(getRhi().getContext(), RootSignature, this);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t MINIMUM_DESCRIPTOR_POOL_PAGE_SIZE = 64;	///< Maximum number of descriptor sets inside the first descriptor pool page, each following page doubles the size
+		static constexpr uint32_t MAXIMUM_DESCRIPTOR_POOL_PAGE_SIZE = 4096;	///< Upper limit for the maximum number of descriptor sets inside a descriptor pool page
+
+		typedef Vector<VkDescriptorSetLayout> VkDescriptorSetLayouts;
+		typedef std::array<VkDescriptorPoolSize, 6> VkDescriptorPoolSizes;
+		struct DescriptorPoolPage final
+		{
+			VkDescriptorPool vkDescriptorPool;
+			uint32_t		 maximumNumberOfDescriptorSets;
+			uint32_t		 numberOfDescriptorSets;
+		};
+		typedef Vector<DescriptorPoolPage> DescriptorPoolPages;
+		struct CachedResourceGroup final
+		{
+			uint64_t	   hash;
+			ResourceGroup* resourceGroup;
+		};
+		typedef Vector<CachedResourceGroup> CachedResourceGroups;	///< Sorted by hash
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit RootSignature(const RootSignature& source) = delete;
+		RootSignature& operator =(const RootSignature& source) = delete;
+
+		[[nodiscard]] bool createDescriptorPoolPage()
+		{
+			// Each page is twice as big as the previous one to keep the number of pages low for big scenes
+			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
+			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
+			const uint32_t maximumNumberOfDescriptorSets = mDescriptorPoolPages.empty() ? MINIMUM_DESCRIPTOR_POOL_PAGE_SIZE : std::min(mDescriptorPoolPages.back().maximumNumberOfDescriptorSets * 2, MAXIMUM_DESCRIPTOR_POOL_PAGE_SIZE);
+			VkDescriptorPoolSizes vkDescriptorPoolSizes = mVkDescriptorPoolSizes;
+			for (uint32_t i = 0; i < mNumberOfVkDescriptorPoolSizes; ++i)
+			{
+				vkDescriptorPoolSizes[i].descriptorCount *= maximumNumberOfDescriptorSets;
+			}
+			const VkDescriptorPoolCreateInfo vkDescriptorPoolCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,		// sType (VkStructureType)
+				nullptr,											// pNext (const void*)
+				VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,	// flags (VkDescriptorPoolCreateFlags)
+				maximumNumberOfDescriptorSets,						// maxSets (uint32_t)
+				mNumberOfVkDescriptorPoolSizes,						// poolSizeCount (uint32_t)
+				vkDescriptorPoolSizes.data()						// pPoolSizes (const VkDescriptorPoolSize*)
+			};
+			VkDescriptorPool vkDescriptorPool = VK_NULL_HANDLE;
+			if (vkCreateDescriptorPool(vkDevice, &vkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDescriptorPool) != VK_SUCCESS)
+			{
+				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan descriptor pool")
+				return false;
+			}
+			mDescriptorPoolPages.push_back({ vkDescriptorPool, maximumNumberOfDescriptorSets, 0 });
+
+			// Assign a default name to the resource for debugging purposes
+			#ifdef RHI_DEBUG
+				if (nullptr != vkDebugMarkerSetObjectNameEXT)
+				{
+					const char* debugName = getDebugName();
+					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Root signature", 17)	// 17 = "Root signature: " including terminating zero
+					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT, (uint64_t)vkDescriptorPool, detailedDebugName);
+				}
+			#endif
+
+			// Done
+			return true;
+		}
+
+		[[nodiscard]] VkDescriptorSet allocateVkDescriptorSet(uint32_t rootParameterIndex, VkDescriptorPool& vkDescriptorPool)
+		{
+			const VkDevice vkDevice = static_cast<VulkanRhi&>(getRhi()).getVulkanContext().getVkDevice();
+			VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
+			{
+				VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// sType (VkStructureType)
+				nullptr,										// pNext (const void*)
+				VK_NULL_HANDLE,									// descriptorPool (VkDescriptorPool)
+				1,												// descriptorSetCount (uint32_t)
+				&mVkDescriptorSetLayouts[rootParameterIndex]	// pSetLayouts (const VkDescriptorSetLayout*)
+			};
+
+			// Try the current page first, then all other pages which might have free space due to freed descriptor sets and finally a new page
+			const uint32_t numberOfDescriptorPoolPages = static_cast<uint32_t>(mDescriptorPoolPages.size());
+			for (uint32_t i = 0; i <= numberOfDescriptorPoolPages; ++i)
+			{
+				if (i == numberOfDescriptorPoolPages)
+				{
+					if (!createDescriptorPoolPage())
+					{
+						break;
+					}
+					mCurrentDescriptorPoolPageIndex = numberOfDescriptorPoolPages;
+				}
+				DescriptorPoolPage& descriptorPoolPage = mDescriptorPoolPages[(i == numberOfDescriptorPoolPages) ? mCurrentDescriptorPoolPageIndex : (mCurrentDescriptorPoolPageIndex + i) % numberOfDescriptorPoolPages];
+				if (descriptorPoolPage.numberOfDescriptorSets < descriptorPoolPage.maximumNumberOfDescriptorSets)
+				{
+					// "VK_ERROR_OUT_OF_POOL_MEMORY" or "VK_ERROR_FRAGMENTED_POOL" just means we have to continue with the next page
+					VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
+					vkDescriptorSetAllocateInfo.descriptorPool = descriptorPoolPage.vkDescriptorPool;
+					if (vkAllocateDescriptorSets(vkDevice, &vkDescriptorSetAllocateInfo, &vkDescriptorSet) == VK_SUCCESS)
+					{
+						++descriptorPoolPage.numberOfDescriptorSets;
+						mCurrentDescriptorPoolPageIndex = static_cast<uint32_t>(&descriptorPoolPage - mDescriptorPoolPages.data());
+						vkDescriptorPool = descriptorPoolPage.vkDescriptorPool;
+						return vkDescriptorSet;
+					}
+				}
+			}
+
+			// Error!
+			vkDescriptorPool = VK_NULL_HANDLE;
+			return VK_NULL_HANDLE;
+		}
+
+		[[nodiscard]] static uint64_t calculateResourceGroupHash(uint32_t rootParameterIndex, uint32_t numberOfResources, Rhi::IResource* const* resources, Rhi::ISamplerState* const* samplerStates)
 		{
-			RHI_DELETE(getRhi().getContext(), RootSignature, this);
+			// FNV-1a over the bindings, resource pointers are fine since the cached resource group keeps a reference to the resources
+			uint64_t hash = 0xcbf29ce484222325u;
+			const auto hashValue = [&hash](uint64_t value)
+			{
+				for (uint32_t i = 0; i < sizeof(uint64_t); ++i, value >>= 8)
+				{
+					hash = (hash ^ (value & 0xffu)) * 0x00000100000001B3u;
+				}
+			};
+			hashValue(rootParameterIndex);
+			hashValue(numberOfResources);
+			for (uint32_t resourceIndex = 0; resourceIndex < numberOfResources; ++resourceIndex)
+			{
+				hashValue(reinterpret_cast<uintptr_t>(resources[resourceIndex]));
+				hashValue(reinterpret_cast<uintptr_t>((nullptr != samplerStates) ? samplerStates[resourceIndex] : nullptr));
+			}
+			return hash;
 		}
 
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	private:
-		explicit RootSignature(const RootSignature& source) = delete;
-		RootSignature& operator =(const RootSignature& source) = delete;
-
-
-	//[-------------------------------------------------------]
-	//[ Private definitions                                   ]
-	//[-------------------------------------------------------]
-	private:
-		typedef Vector<VkDescriptorSetLayout> VkDescriptorSetLayouts;
-
-
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -5010,7 +6607,11 @@ namespace VulkanRhi
 		Rhi::RootSignature	   mRootSignature;
 		VkDescriptorSetLayouts mVkDescriptorSetLayouts;
 		VkPipelineLayout	   mVkPipelineLayout;
-		VkDescriptorPool	   mVkDescriptorPool;
+		VkDescriptorPoolSizes  mVkDescriptorPoolSizes;			///< Descriptor pool sizes of a single descriptor set, the first "mNumberOfVkDescriptorPoolSizes" entries are valid
+		uint32_t			   mNumberOfVkDescriptorPoolSizes;
+		DescriptorPoolPages	   mDescriptorPoolPages;			///< Descriptor pool pages, growing on demand
+		uint32_t			   mCurrentDescriptorPoolPageIndex;	///< Index of the descriptor pool page to try first when allocating a descriptor set
+		CachedResourceGroups   mCachedResourceGroups;			///< Resource groups with identical bindings share one descriptor set, we don't own the resource groups
 
 
 	};
@@ -5051,14 +6652,14 @@ namespace VulkanRhi
 		VertexBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IVertexBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemoryAllocation()
 		{
 			int vkBufferUsageFlagBits = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 			if ((bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0)
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemoryAllocation);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5067,7 +6668,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "VBO", 6)	// 6 = "VBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 				}
 			#endif
 		}
@@ -5078,7 +6679,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~VertexBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemoryAllocation);
 		}
 
 		/**
@@ -5095,14 +6696,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the Vulkan memory allocation
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The Vulkan memory allocation
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemoryAllocation& getVulkanMemoryAllocation() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemoryAllocation;
 		}
 
 
@@ -5128,8 +6729,8 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkBuffer	   mVkBuffer;		///< Vulkan vertex buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan vertex memory
+		VkBuffer			   mVkBuffer;				///< Vulkan vertex buffer
+		VulkanMemoryAllocation mVulkanMemoryAllocation;	///< Vulkan vertex memory
 
 
 	};
@@ -5173,14 +6774,14 @@ namespace VulkanRhi
 			IIndexBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkIndexType(Mapping::getVulkanType(vulkanRhi.getContext(), indexBufferFormat)),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemoryAllocation()
 		{
 			int vkBufferUsageFlagBits = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
 			if ((bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0)
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemoryAllocation);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5189,7 +6790,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IBO", 6)	// 6 = "IBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 				}
 			#endif
 		}
@@ -5200,7 +6801,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~IndexBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemoryAllocation);
 		}
 
 		/**
@@ -5229,14 +6830,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the Vulkan memory allocation
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The Vulkan memory allocation
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemoryAllocation& getVulkanMemoryAllocation() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemoryAllocation;
 		}
 
 
@@ -5263,8 +6864,8 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		VkIndexType	   mVkIndexType;	///< Vulkan vertex type
-		VkBuffer	   mVkBuffer;		///< Vulkan vertex buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan vertex memory
+		VkBuffer			   mVkBuffer;				///< Vulkan vertex buffer
+		VulkanMemoryAllocation mVulkanMemoryAllocation;	///< Vulkan vertex memory
 
 
 	};
@@ -5506,7 +7107,7 @@ namespace VulkanRhi
 		TextureBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITextureBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkBufferView(VK_NULL_HANDLE)
 		{
 			// Sanity check
@@ -5522,7 +7123,7 @@ namespace VulkanRhi
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemoryAllocation);
 
 			// Create Vulkan buffer view
 			if ((bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0 || (bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0)
@@ -5550,7 +7151,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "TBO", 6)	// 6 = "TBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_VIEW_EXT, (uint64_t)mVkBufferView, detailedDebugName);
 				}
 			#endif
@@ -5567,7 +7168,7 @@ namespace VulkanRhi
 			{
 				vkDestroyBufferView(vulkanRhi.getVulkanContext().getVkDevice(), mVkBufferView, vulkanRhi.getVkAllocationCallbacks());
 			}
-			Helper::destroyAndFreeVkBuffer(vulkanRhi, mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(vulkanRhi, mVkBuffer, mVulkanMemoryAllocation);
 		}
 
 		/**
@@ -5584,14 +7185,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the Vulkan memory allocation
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The Vulkan memory allocation
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemoryAllocation& getVulkanMemoryAllocation() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemoryAllocation;
 		}
 
 		/**
@@ -5629,9 +7230,9 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkBuffer	   mVkBuffer;		///< Vulkan uniform texel buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform texel memory
-		VkBufferView   mVkBufferView;	///< Vulkan buffer view
+		VkBuffer			   mVkBuffer;				///< Vulkan uniform texel buffer
+		VulkanMemoryAllocation mVulkanMemoryAllocation;	///< Vulkan uniform texel memory
+		VkBufferView		   mVkBufferView;			///< Vulkan buffer view
 
 
 	};
@@ -5672,14 +7273,14 @@ namespace VulkanRhi
 		StructuredBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, [[maybe_unused]] Rhi::BufferUsage bufferUsage, [[maybe_unused]] uint32_t numberOfStructureBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IStructuredBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemoryAllocation()
 		{
 			// Sanity checks
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % numberOfStructureBytes) == 0, "The Vulkan structured buffer size must be a multiple of the given number of structure bytes")
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The Vulkan structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
 
 			// Create the structured buffer
-			Helper::createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemoryAllocation);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5688,7 +7289,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "SBO", 6)	// 6 = "SBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 				}
 			#endif
 		}
@@ -5699,7 +7300,7 @@ namespace VulkanRhi
 		*/
 		virtual ~StructuredBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemoryAllocation);
 		}
 
 		/**
@@ -5716,14 +7317,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the Vulkan memory allocation
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The Vulkan memory allocation
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemoryAllocation& getVulkanMemoryAllocation() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemoryAllocation;
 		}
 
 
@@ -5749,8 +7350,8 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkBuffer	   mVkBuffer;		///< Vulkan uniform texel buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform texel memory
+		VkBuffer			   mVkBuffer;				///< Vulkan uniform texel buffer
+		VulkanMemoryAllocation mVulkanMemoryAllocation;	///< Vulkan uniform texel memory
 
 
 	};
@@ -5791,7 +7392,7 @@ namespace VulkanRhi
 		IndirectBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, uint32_t indirectBufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IIndirectBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemoryAllocation()
 		{
 			// Sanity checks
 			RHI_ASSERT(vulkanRhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Vulkan flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
@@ -5805,7 +7406,7 @@ namespace VulkanRhi
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemoryAllocation);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5814,7 +7415,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IndirectBufferObject", 23)	// 23 = "IndirectBufferObject: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 				}
 			#endif
 		}
@@ -5825,7 +7426,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~IndirectBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemoryAllocation);
 		}
 
 		/**
@@ -5842,14 +7443,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the Vulkan memory allocation
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The Vulkan memory allocation
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemoryAllocation& getVulkanMemoryAllocation() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemoryAllocation;
 		}
 
 
@@ -5885,8 +7486,8 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkBuffer	   mVkBuffer;		///< Vulkan indirect buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan indirect memory
+		VkBuffer			   mVkBuffer;				///< Vulkan indirect buffer
+		VulkanMemoryAllocation mVulkanMemoryAllocation;	///< Vulkan indirect memory
 
 
 	};
@@ -5925,9 +7526,9 @@ namespace VulkanRhi
 		UniformBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, [[maybe_unused]] Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IUniformBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemoryAllocation()
 		{
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemoryAllocation);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5936,7 +7537,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "UBO", 6)	// 6 = "UBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 				}
 			#endif
 		}
@@ -5947,7 +7548,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~UniformBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemoryAllocation);
 		}
 
 		/**
@@ -5964,14 +7565,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the Vulkan memory allocation
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The Vulkan memory allocation
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemoryAllocation& getVulkanMemoryAllocation() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemoryAllocation;
 		}
 
 
@@ -5997,8 +7598,8 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkBuffer	   mVkBuffer;		///< Vulkan uniform buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform memory
+		VkBuffer			   mVkBuffer;				///< Vulkan uniform buffer
+		VulkanMemoryAllocation mVulkanMemoryAllocation;	///< Vulkan uniform memory
 
 
 	};
@@ -6184,10 +7785,10 @@ namespace VulkanRhi
 			ITexture1D(vulkanRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D, { width, 1, 1 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D, { width, 1, 1 }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemoryAllocation, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6196,7 +7797,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "1D texture", 13)	// 13 = "1D texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6208,7 +7809,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture1D() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -6258,10 +7859,10 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkImage		   mVkImage;
-		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
-		VkImageView	   mVkImageView;
+		VkImage				   mVkImage;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
 
 
 	};
@@ -6305,9 +7906,9 @@ namespace VulkanRhi
 			ITexture1DArray(vulkanRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE),
-			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D_ARRAY, { width, 1, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
+			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D_ARRAY, { width, 1, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemoryAllocation, mVkImageView))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6316,7 +7917,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "1D texture array", 19)	// 19 = "1D texture array: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6328,7 +7929,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture1DArray() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -6390,11 +7991,11 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkImage		   mVkImage;
-		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
-		VkImageView	   mVkImageView;
-		VkFormat	   mVkFormat;
+		VkImage				   mVkImage;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
+		VkFormat			   mVkFormat;
 
 
 	};
@@ -6461,10 +8062,10 @@ namespace VulkanRhi
 			ITexture2D(vulkanRhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVrVulkanTextureData{},
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			mVrVulkanTextureData.m_nFormat = Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D, { width, height, 1 }, textureFormat, data, textureFlags, numberOfMultisamples, mVrVulkanTextureData.m_nImage, mVkDeviceMemory, mVkImageView);
+			mVrVulkanTextureData.m_nFormat = Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D, { width, height, 1 }, textureFormat, data, textureFlags, numberOfMultisamples, mVrVulkanTextureData.m_nImage, mVulkanMemoryAllocation, mVkImageView);
 
 			// Fill the rest of the "VRVulkanTextureData_t"-structure
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
@@ -6487,7 +8088,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "2D texture", 13)	// 13 = "2D texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVrVulkanTextureData.m_nImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6499,7 +8100,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture2D() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVrVulkanTextureData.m_nImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVrVulkanTextureData.m_nImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -6585,10 +8186,10 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VRVulkanTextureData_t mVrVulkanTextureData;
-		VkImageLayout		  mVkImageLayout;
-		VkDeviceMemory		  mVkDeviceMemory;
-		VkImageView			  mVkImageView;
+		VRVulkanTextureData_t  mVrVulkanTextureData;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
 
 
 	};
@@ -6634,9 +8235,9 @@ namespace VulkanRhi
 			ITexture2DArray(vulkanRhi, width, height, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE),
-			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY, { width, height, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
+			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY, { width, height, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemoryAllocation, mVkImageView))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6645,7 +8246,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "2D texture array", 19)	// 19 = "2D texture array: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6657,7 +8258,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture2DArray() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -6719,11 +8320,11 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkImage		   mVkImage;
-		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
-		VkImageView	   mVkImageView;
-		VkFormat	   mVkFormat;
+		VkImage				   mVkImage;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
+		VkFormat			   mVkFormat;
 
 
 	};
@@ -6769,10 +8370,10 @@ namespace VulkanRhi
 			ITexture3D(vulkanRhi, width, height, depth RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_3D, VK_IMAGE_VIEW_TYPE_3D, { width, height, depth }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_3D, VK_IMAGE_VIEW_TYPE_3D, { width, height, depth }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemoryAllocation, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6781,7 +8382,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "3D texture", 13)	// 13 = "3D texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6793,7 +8394,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture3D() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -6843,10 +8444,10 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkImage		   mVkImage;
-		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
-		VkImageView	   mVkImageView;
+		VkImage				   mVkImage;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
 
 
 	};
@@ -6888,10 +8489,10 @@ namespace VulkanRhi
 			ITextureCube(vulkanRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE, { width, width, 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE, { width, width, 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemoryAllocation, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6900,7 +8501,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Cube texture", 15)	// 15 = "Cube texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6912,7 +8513,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~TextureCube() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -6962,10 +8563,10 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkImage		   mVkImage;
-		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
-		VkImageView	   mVkImageView;
+		VkImage				   mVkImage;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
 
 
 	};
@@ -7009,10 +8610,10 @@ namespace VulkanRhi
 			ITextureCubeArray(vulkanRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemoryAllocation(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE_ARRAY, { width, width, numberOfSlices * 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE_ARRAY, { width, width, numberOfSlices * 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemoryAllocation, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -7021,7 +8622,7 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Cube texture array", 21)	// 21 = "Cube texture array: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					Helper::setDebugObjectName(vkDevice, mVulkanMemoryAllocation, detailedDebugName);
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -7033,7 +8634,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~TextureCubeArray() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemoryAllocation, mVkImageView);
 		}
 
 		/**
@@ -7083,10 +8684,10 @@ namespace VulkanRhi
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VkImage		   mVkImage;
-		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
-		VkImageView	   mVkImageView;
+		VkImage				   mVkImage;
+		VkImageLayout		   mVkImageLayout;
+		VulkanMemoryAllocation mVulkanMemoryAllocation;
+		VkImageView			   mVkImageView;
 
 
 	};
@@ -7877,7 +9478,7 @@ namespace VulkanRhi
 			// Depth render target related
 			mDepthVkFormat(Mapping::getVulkanFormat(static_cast<RenderPass&>(renderPass).getDepthStencilAttachmentTextureFormat())),
 			mDepthVkImage(VK_NULL_HANDLE),
-			mDepthVkDeviceMemory(VK_NULL_HANDLE),
+			mDepthVulkanMemoryAllocation(),
 			mDepthVkImageView(VK_NULL_HANDLE)
 		{
 			// Create the Vulkan presentation surface instance depending on the operation system
@@ -8096,6 +9697,9 @@ namespace VulkanRhi
 			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 
+			// Submit the uploads of this frame, they're ordered before the frame command buffer on the graphics queue
+			vulkanContext.getVulkanUploadContext().flush();
+
 			{ // Queue submit
 				const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 				const VkCommandBuffer vkCommandBuffer = vulkanContext.getVkCommandBuffer();
@@ -8150,6 +9754,10 @@ namespace VulkanRhi
 				vkQueueWaitIdle(vulkanContext.getPresentVkQueue());
 			}
 
+			// Give staging memory of finished uploads and memory blocks which are no longer needed back, doesn't block
+			vulkanContext.getVulkanUploadContext().retireFinishedUploadBatches();
+			vulkanContext.getVulkanMemoryAllocator().releaseEmptyMemoryBlocks();
+
 			// Acquire next image
 			acquireNextImage(true);
 		}
@@ -8425,7 +10033,7 @@ namespace VulkanRhi
 			if (VK_FORMAT_UNDEFINED != mDepthVkFormat)
 			{
 				const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
-				Helper::createAndAllocateVkImage(vulkanRhi, 0, VK_IMAGE_TYPE_2D, { vkExtent2D.width, vkExtent2D.height, 1 }, 1, 1, mDepthVkFormat, static_cast<RenderPass&>(getRenderPass()).getVkSampleCountFlagBits(), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthVkImage, mDepthVkDeviceMemory);
+				Helper::createAndAllocateVkImage(vulkanRhi, 0, VK_IMAGE_TYPE_2D, { vkExtent2D.width, vkExtent2D.height, 1 }, 1, 1, mDepthVkFormat, static_cast<RenderPass&>(getRenderPass()).getVkSampleCountFlagBits(), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthVkImage, mDepthVulkanMemoryAllocation);
 				Helper::createVkImageView(vulkanRhi, mDepthVkImage, VK_IMAGE_VIEW_TYPE_2D, 1, 1, mDepthVkFormat, VK_IMAGE_ASPECT_DEPTH_BIT, mDepthVkImageView);
 				// TODO(co) File "unrimp\source\rhi\private\vulkanrhi\vulkanrhi.cpp" | Line 1036 | Critical: Vulkan debug report callback: Object type: "VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT" Object: "103612336" Location: "0" Message code: "461375810" Layer prefix: "Validation" Message: " [ VUID-vkCmdPipelineBarrier-pMemoryBarriers-01185 ] Object: 0x62cffb0 (Type = 6) | vkCmdPipelineBarrier(): pImageMemBarriers[0].dstAccessMask (0x600) is not supported by dstStageMask (0x1). The spec valid usage text states 'Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not have any access flag included in its dstAccessMask member if that bit is not supported by any of the pipeline stages in dstStageMask, as specified in the table of supported access types.' (https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#VUID-vkCmdPipelineBarrier-pMemoryBarriers-01185)" 
 				//Helper::transitionVkImageLayout(vulkanRhi, mDepthVkImage, VK_IMAGE_ASPECT_DEPTH_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
@@ -8436,9 +10044,9 @@ namespace VulkanRhi
 		{
 			if (VK_NULL_HANDLE != mDepthVkImage)
 			{
-				RHI_ASSERT(getRhi().getContext(), VK_NULL_HANDLE != mDepthVkDeviceMemory, "Invalid Vulkan depth device memory")
+				RHI_ASSERT(getRhi().getContext(), VK_NULL_HANDLE != mDepthVulkanMemoryAllocation.vkDeviceMemory, "Invalid Vulkan depth device memory")
 				RHI_ASSERT(getRhi().getContext(), VK_NULL_HANDLE != mDepthVkImageView, "Invalid Vulkan depth image view")
-				Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mDepthVkImage, mDepthVkDeviceMemory, mDepthVkImageView);
+				Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mDepthVkImage, mDepthVulkanMemoryAllocation, mDepthVkImageView);
 			}
 		}
 
@@ -8475,7 +10083,7 @@ namespace VulkanRhi
 		// Depth render target related
 		VkFormat		mDepthVkFormat;	///< Can be "VK_FORMAT_UNDEFINED" if no depth stencil buffer is needed
 		VkImage			mDepthVkImage;
-		VkDeviceMemory  mDepthVkDeviceMemory;
+		VulkanMemoryAllocation mDepthVulkanMemoryAllocation;
 		VkImageView		mDepthVkImageView;
 
 
@@ -10673,7 +12281,7 @@ namespace VulkanRhi
 				VK_NULL_HANDLE,														// basePipelineHandle (VkPipeline)
 				0																	// basePipelineIndex (int32_t)
 			};
-			if (vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
+			if (vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), vulkanRhi.getVulkanContext().getVkPipelineCache(), 1, &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
 			{
 				// Assign a default name to the resource for debugging purposes
 				#ifdef RHI_DEBUG
@@ -10815,7 +12423,7 @@ namespace VulkanRhi
 				VK_NULL_HANDLE,															// basePipelineHandle (VkPipeline)
 				0																		// basePipelineIndex (int32_t)
 			};
-			if (vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
+			if (vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), vulkanRhi.getVulkanContext().getVkPipelineCache(), 1, &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
 			{
 				// Assign a default name to the resource for debugging purposes
 				#ifdef RHI_DEBUG
@@ -10921,8 +12529,12 @@ namespace VulkanRhi
 		*    Root signature
 		*  @param[in] rootParameterIndex
 		*    Root parameter index
+		*  @param[in] vkDescriptorPool
+		*    Vulkan descriptor pool page of the root signature the descriptor set was allocated from, can be a null handle
 		*  @param[in] vkDescriptorSet
-		*    Wrapped Vulkan descriptor set
+		*    Wrapped Vulkan descriptor set, can be a null handle
+		*  @param[in] hash
+		*    Hash of the bindings, used to remove the resource group from the descriptor set cache of the root signature
 		*  @param[in] numberOfResources
 		*    Number of resources, having no resources is invalid
 		*  @param[in] resources
@@ -10930,10 +12542,13 @@ namespace VulkanRhi
 		*  @param[in] samplerStates
 		*    If not a null pointer at least "numberOfResources" sampler state pointers, must be valid if there's at least one texture resource, the resource group will keep a reference to the sampler states
 		*/
-		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, VkDescriptorPool vkDescriptorPool, VkDescriptorSet vkDescriptorSet, uint64_t hash, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IResourceGroup(rootSignature.getRhi() RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mRootSignature(rootSignature),
+			mRootParameterIndex(rootParameterIndex),
+			mVkDescriptorPool(vkDescriptorPool),
 			mVkDescriptorSet(vkDescriptorSet),
+			mHash(hash),
 			mNumberOfResources(numberOfResources),
 			mResources(RHI_MALLOC_TYPED(rootSignature.getRhi().getContext(), Rhi::IResource*, mNumberOfResources)),
 			mSamplerStates(nullptr)
@@ -10955,6 +12570,16 @@ namespace VulkanRhi
 					}
 				}
 			}
+
+			// Gather all Vulkan descriptor writes so the descriptor set can be updated using a single call, reserve so pointers to the elements stay valid
+			Vector<VkDescriptorBufferInfo> vkDescriptorBufferInfos;
+			Vector<VkDescriptorImageInfo> vkDescriptorImageInfos;
+			Vector<VkBufferView> vkBufferViews;
+			Vector<VkWriteDescriptorSet> vkWriteDescriptorSets;
+			vkDescriptorBufferInfos.reserve(mNumberOfResources);
+			vkDescriptorImageInfos.reserve(mNumberOfResources);
+			vkBufferViews.reserve(mNumberOfResources);
+			vkWriteDescriptorSets.reserve(mNumberOfResources);
 			for (uint32_t resourceIndex = 0; resourceIndex < mNumberOfResources; ++resourceIndex, ++resources)
 			{
 				Rhi::IResource* resource = *resources;
@@ -10975,20 +12600,21 @@ namespace VulkanRhi
 							0,														// offset (VkDeviceSize)
 							VK_WHOLE_SIZE											// range (VkDeviceSize)
 						};
+						vkDescriptorBufferInfos.push_back(vkDescriptorBufferInfo);
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
-							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
-							nullptr,									// pNext (const void*)
-							mVkDescriptorSet,							// dstSet (VkDescriptorSet)
-							resourceIndex,								// dstBinding (uint32_t)
-							0,											// dstArrayElement (uint32_t)
-							1,											// descriptorCount (uint32_t)
-							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,			// descriptorType (VkDescriptorType)
-							nullptr,									// pImageInfo (const VkDescriptorImageInfo*)
-							&vkDescriptorBufferInfo,					// pBufferInfo (const VkDescriptorBufferInfo*)
-							nullptr										// pTexelBufferView (const VkBufferView*)
+							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
+							nullptr,								// pNext (const void*)
+							mVkDescriptorSet,						// dstSet (VkDescriptorSet)
+							resourceIndex,							// dstBinding (uint32_t)
+							0,										// dstArrayElement (uint32_t)
+							1,										// descriptorCount (uint32_t)
+							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,		// descriptorType (VkDescriptorType)
+							nullptr,								// pImageInfo (const VkDescriptorImageInfo*)
+							&vkDescriptorBufferInfos.back(),		// pBufferInfo (const VkDescriptorBufferInfo*)
+							nullptr									// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11000,20 +12626,21 @@ namespace VulkanRhi
 							0,													// offset (VkDeviceSize)
 							VK_WHOLE_SIZE										// range (VkDeviceSize)
 						};
+						vkDescriptorBufferInfos.push_back(vkDescriptorBufferInfo);
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
-							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
-							nullptr,									// pNext (const void*)
-							mVkDescriptorSet,							// dstSet (VkDescriptorSet)
-							resourceIndex,								// dstBinding (uint32_t)
-							0,											// dstArrayElement (uint32_t)
-							1,											// descriptorCount (uint32_t)
-							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,			// descriptorType (VkDescriptorType)
-							nullptr,									// pImageInfo (const VkDescriptorImageInfo*)
-							&vkDescriptorBufferInfo,					// pBufferInfo (const VkDescriptorBufferInfo*)
-							nullptr										// pTexelBufferView (const VkBufferView*)
+							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
+							nullptr,								// pNext (const void*)
+							mVkDescriptorSet,						// dstSet (VkDescriptorSet)
+							resourceIndex,							// dstBinding (uint32_t)
+							0,										// dstArrayElement (uint32_t)
+							1,										// descriptorCount (uint32_t)
+							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,		// descriptorType (VkDescriptorType)
+							nullptr,								// pImageInfo (const VkDescriptorImageInfo*)
+							&vkDescriptorBufferInfos.back(),		// pBufferInfo (const VkDescriptorBufferInfo*)
+							nullptr									// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11021,7 +12648,7 @@ namespace VulkanRhi
 					{
 						const Rhi::DescriptorRange& descriptorRange = reinterpret_cast<const Rhi::DescriptorRange*>(rootSignature.getRootSignature().parameters[rootParameterIndex].descriptorTable.descriptorRanges)[resourceIndex];
 						RHI_ASSERT(vulkanRhi.getContext(), Rhi::DescriptorRangeType::SRV == descriptorRange.rangeType || Rhi::DescriptorRangeType::UAV == descriptorRange.rangeType, "Vulkan texture buffer must bound at SRV or UAV descriptor range type")
-						const VkBufferView vkBufferView = static_cast<TextureBuffer*>(resource)->getVkBufferView();
+						vkBufferViews.push_back(static_cast<TextureBuffer*>(resource)->getVkBufferView());
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,																												// sType (VkStructureType)
@@ -11033,9 +12660,9 @@ namespace VulkanRhi
 							(Rhi::DescriptorRangeType::SRV == descriptorRange.rangeType) ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER,	// descriptorType (VkDescriptorType)
 							nullptr,																																			// pImageInfo (const VkDescriptorImageInfo*)
 							nullptr,																																			// pBufferInfo (const VkDescriptorBufferInfo*)
-							&vkBufferView																																		// pTexelBufferView (const VkBufferView*)
+							&vkBufferViews.back()																																// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11049,6 +12676,7 @@ namespace VulkanRhi
 							0,															// offset (VkDeviceSize)
 							VK_WHOLE_SIZE												// range (VkDeviceSize)
 						};
+						vkDescriptorBufferInfos.push_back(vkDescriptorBufferInfo);
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
@@ -11059,10 +12687,10 @@ namespace VulkanRhi
 							1,										// descriptorCount (uint32_t)
 							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,		// descriptorType (VkDescriptorType)
 							nullptr,								// pImageInfo (const VkDescriptorImageInfo*)
-							&vkDescriptorBufferInfo,				// pBufferInfo (const VkDescriptorBufferInfo*)
+							&vkDescriptorBufferInfos.back(),		// pBufferInfo (const VkDescriptorBufferInfo*)
 							nullptr									// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11074,20 +12702,21 @@ namespace VulkanRhi
 							0,														// offset (VkDeviceSize)
 							VK_WHOLE_SIZE											// range (VkDeviceSize)
 						};
+						vkDescriptorBufferInfos.push_back(vkDescriptorBufferInfo);
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
-							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
-							nullptr,									// pNext (const void*)
-							mVkDescriptorSet,							// dstSet (VkDescriptorSet)
-							resourceIndex,								// dstBinding (uint32_t)
-							0,											// dstArrayElement (uint32_t)
-							1,											// descriptorCount (uint32_t)
-							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,			// descriptorType (VkDescriptorType)
-							nullptr,									// pImageInfo (const VkDescriptorImageInfo*)
-							&vkDescriptorBufferInfo,					// pBufferInfo (const VkDescriptorBufferInfo*)
-							nullptr										// pTexelBufferView (const VkBufferView*)
+							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
+							nullptr,								// pNext (const void*)
+							mVkDescriptorSet,						// dstSet (VkDescriptorSet)
+							resourceIndex,							// dstBinding (uint32_t)
+							0,										// dstArrayElement (uint32_t)
+							1,										// descriptorCount (uint32_t)
+							VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,		// descriptorType (VkDescriptorType)
+							nullptr,								// pImageInfo (const VkDescriptorImageInfo*)
+							&vkDescriptorBufferInfos.back(),		// pBufferInfo (const VkDescriptorBufferInfo*)
+							nullptr									// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11099,6 +12728,7 @@ namespace VulkanRhi
 							0,														// offset (VkDeviceSize)
 							VK_WHOLE_SIZE											// range (VkDeviceSize)
 						};
+						vkDescriptorBufferInfos.push_back(vkDescriptorBufferInfo);
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
@@ -11109,10 +12739,10 @@ namespace VulkanRhi
 							1,										// descriptorCount (uint32_t)
 							VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,		// descriptorType (VkDescriptorType)
 							nullptr,								// pImageInfo (const VkDescriptorImageInfo*)
-							&vkDescriptorBufferInfo,				// pBufferInfo (const VkDescriptorBufferInfo*)
+							&vkDescriptorBufferInfos.back(),		// pBufferInfo (const VkDescriptorBufferInfo*)
 							nullptr									// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11224,6 +12854,7 @@ namespace VulkanRhi
 							vkImageView,																// imageView (VkImageView)
 							vkImageLayout																// imageLayout (VkImageLayout)
 						};
+						vkDescriptorImageInfos.push_back(vkDescriptorImageInfo);
 						const VkWriteDescriptorSet vkWriteDescriptorSet =
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,																		// sType (VkStructureType)
@@ -11233,11 +12864,11 @@ namespace VulkanRhi
 							0,																											// dstArrayElement (uint32_t)
 							1,																											// descriptorCount (uint32_t)
 							(nullptr != samplerState) ? VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,	// descriptorType (VkDescriptorType)
-							&vkDescriptorImageInfo,																						// pImageInfo (const VkDescriptorImageInfo*)
+							&vkDescriptorImageInfos.back(),																				// pImageInfo (const VkDescriptorImageInfo*)
 							nullptr,																									// pBufferInfo (const VkDescriptorBufferInfo*)
 							nullptr																										// pTexelBufferView (const VkBufferView*)
 						};
-						vkUpdateDescriptorSets(vkDevice, 1, &vkWriteDescriptorSet, 0, nullptr);
+						vkWriteDescriptorSets.push_back(vkWriteDescriptorSet);
 						break;
 					}
 
@@ -11267,6 +12898,10 @@ namespace VulkanRhi
 						break;
 				}
 			}
+			if (!vkWriteDescriptorSets.empty())
+			{
+				vkUpdateDescriptorSets(vkDevice, static_cast<uint32_t>(vkWriteDescriptorSets.size()), vkWriteDescriptorSets.data(), 0, nullptr);
+			}
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -11284,6 +12919,9 @@ namespace VulkanRhi
 		*/
 		virtual ~ResourceGroup() override
 		{
+			// Remove us from the descriptor set cache before the resources the hash is based on might get destroyed
+			mRootSignature.removeCachedResourceGroup(mHash, *this);
+
 			// Remove our reference from the RHI resources
 			const Rhi::Context& context = getRhi().getContext();
 			if (nullptr != mSamplerStates)
@@ -11307,7 +12945,7 @@ namespace VulkanRhi
 			// Free Vulkan descriptor set
 			if (VK_NULL_HANDLE != mVkDescriptorSet)
 			{
-				vkFreeDescriptorSets(static_cast<VulkanRhi&>(mRootSignature.getRhi()).getVulkanContext().getVkDevice(), mRootSignature.getVkDescriptorPool(), 1, &mVkDescriptorSet);
+				mRootSignature.freeVkDescriptorSet(mVkDescriptorPool, mVkDescriptorSet);
 			}
 			mRootSignature.releaseReference();
 		}
@@ -11324,6 +12962,65 @@ namespace VulkanRhi
 			return mVkDescriptorSet;
 		}
 
+		/**
+		*  @brief
+		*    Gather the Vulkan buffers which are bound as unordered access view (UAV) and hence might be written by shaders
+		*
+		*  @param[out] vkBuffers
+		*    Receives the Vulkan buffers, the given vector isn't cleared
+		*/
+		void getUnorderedAccessVkBuffers(VulkanRhi::VkBuffers& vkBuffers) const
+		{
+			const Rhi::DescriptorRange* descriptorRanges = reinterpret_cast<const Rhi::DescriptorRange*>(mRootSignature.getRootSignature().parameters[mRootParameterIndex].descriptorTable.descriptorRanges);
+			for (uint32_t resourceIndex = 0; resourceIndex < mNumberOfResources; ++resourceIndex)
+			{
+				if (Rhi::DescriptorRangeType::UAV == descriptorRanges[resourceIndex].rangeType)
+				{
+					const Rhi::IResource* resource = mResources[resourceIndex];
+					if (resource->getResourceType() == Rhi::ResourceType::INDIRECT_BUFFER)
+					{
+						vkBuffers.push_back(static_cast<const IndirectBuffer*>(resource)->getVkBuffer());
+					}
+					else if (resource->getResourceType() == Rhi::ResourceType::STRUCTURED_BUFFER)
+					{
+						vkBuffers.push_back(static_cast<const StructuredBuffer*>(resource)->getVkBuffer());
+					}
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the resource group has the given bindings
+		*
+		*  @param[in] rootParameterIndex
+		*    Root parameter index
+		*  @param[in] numberOfResources
+		*    Number of resources
+		*  @param[in] resources
+		*    At least "numberOfResources" resource pointers
+		*  @param[in] samplerStates
+		*    If not a null pointer at least "numberOfResources" sampler state pointers
+		*
+		*  @return
+		*    "true" if the resource group has the given bindings, else "false"
+		*/
+		[[nodiscard]] bool hasBindings(uint32_t rootParameterIndex, uint32_t numberOfResources, Rhi::IResource* const* resources, Rhi::ISamplerState* const* samplerStates) const
+		{
+			if (mRootParameterIndex != rootParameterIndex || mNumberOfResources != numberOfResources || (nullptr == mSamplerStates) != (nullptr == samplerStates))
+			{
+				return false;
+			}
+			for (uint32_t resourceIndex = 0; resourceIndex < mNumberOfResources; ++resourceIndex)
+			{
+				if (mResources[resourceIndex] != resources[resourceIndex] || (nullptr != mSamplerStates && mSamplerStates[resourceIndex] != samplerStates[resourceIndex]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -11348,7 +13045,10 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		RootSignature&		 mRootSignature;		///< Root signature
-		VkDescriptorSet		 mVkDescriptorSet;		///< "mVkDescriptorPool" of the root signature is the owner which manages the memory, can be a null handle (e.g. for a sampler resource group)
+		uint32_t			 mRootParameterIndex;	///< Root parameter index
+		VkDescriptorPool	 mVkDescriptorPool;		///< Descriptor pool page of the root signature which is the owner of "mVkDescriptorSet", can be a null handle
+		VkDescriptorSet		 mVkDescriptorSet;		///< "mVkDescriptorPool" is the owner which manages the memory, can be a null handle (e.g. for a sampler resource group)
+		uint64_t			 mHash;					///< Hash of the bindings, key inside the descriptor set cache of the root signature
 		uint32_t			 mNumberOfResources;	///< Number of resources this resource group groups together
 		Rhi::IResource**	 mResources;			///< RHI resource, we keep a reference to it
 		Rhi::ISamplerState** mSamplerStates;		///< Sampler states, we keep a reference to it
@@ -11363,31 +13063,38 @@ namespace VulkanRhi
 		const Rhi::Context& context = vulkanRhi.getContext();
 
 		// Sanity checks
-		RHI_ASSERT(context, VK_NULL_HANDLE != mVkDescriptorPool, "The Vulkan descriptor pool instance must be valid")
+		RHI_ASSERT(context, 0 != mNumberOfVkDescriptorPoolSizes, "The Vulkan descriptor pool sizes must be valid")
 		RHI_ASSERT(context, rootParameterIndex < mVkDescriptorSetLayouts.size(), "The Vulkan root parameter index is out-of-bounds")
 		RHI_ASSERT(context, numberOfResources > 0, "The number of Vulkan resources must not be zero")
 		RHI_ASSERT(context, nullptr != resources, "The Vulkan resource pointers must be valid")
 
+		// Resource groups are immutable, so a resource group with identical bindings can share the already written descriptor set
+		const uint64_t hash = calculateResourceGroupHash(rootParameterIndex, numberOfResources, resources, samplerStates);
+		CachedResourceGroups::iterator iterator = std::lower_bound(mCachedResourceGroups.begin(), mCachedResourceGroups.end(), hash, [](const CachedResourceGroup& cachedResourceGroup, uint64_t value) { return cachedResourceGroup.hash < value; });
+		if (iterator != mCachedResourceGroups.end() && iterator->hash == hash && iterator->resourceGroup->hasBindings(rootParameterIndex, numberOfResources, resources, samplerStates))
+		{
+			return iterator->resourceGroup;
+		}
+
 		// Allocate Vulkan descriptor set
+		VkDescriptorPool vkDescriptorPool = VK_NULL_HANDLE;
 		VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
 		if ((*resources)->getResourceType() != Rhi::ResourceType::SAMPLER_STATE)
 		{
-			const VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
-			{
-				VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// sType (VkStructureType)
-				nullptr,										// pNext (const void*)
-				mVkDescriptorPool,								// descriptorPool (VkDescriptorPool)
-				1,												// descriptorSetCount (uint32_t)
-				&mVkDescriptorSetLayouts[rootParameterIndex]	// pSetLayouts (const VkDescriptorSetLayout*)
-			};
-			if (vkAllocateDescriptorSets(vulkanRhi.getVulkanContext().getVkDevice(), &vkDescriptorSetAllocateInfo, &vkDescriptorSet) != VK_SUCCESS)
+			vkDescriptorSet = allocateVkDescriptorSet(rootParameterIndex, vkDescriptorPool);
+			if (VK_NULL_HANDLE == vkDescriptorSet)
 			{
 				RHI_LOG(context, CRITICAL, "Failed to allocate the Vulkan descriptor set")
 			}
 		}
 
-		// Create resource group
-		return RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, vkDescriptorSet, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+		// Create resource group and register it inside the descriptor set cache, on a hash collision the already cached resource group wins
+		ResourceGroup* resourceGroup = RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, vkDescriptorPool, vkDescriptorSet, hash, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+		if (iterator == mCachedResourceGroups.end() || iterator->hash != hash)
+		{
+			mCachedResourceGroups.insert(iterator, { hash, resourceGroup });
+		}
+		return resourceGroup;
 	}
 
 
@@ -11520,7 +13227,11 @@ namespace
 			void DrawIndexedGraphics(const void* data, Rhi::IRhi& rhi)
 			{
 				const Rhi::Command::DrawIndexedGraphics* realData = static_cast<const Rhi::Command::DrawIndexedGraphics*>(data);
-				if (nullptr != realData->indirectBuffer)
+				if (nullptr != realData->countBuffer)
+				{
+					static_cast<VulkanRhi::VulkanRhi&>(rhi).drawIndexedGraphicsCount(*realData->indirectBuffer, realData->indirectBufferOffset, realData->numberOfDraws, *realData->countBuffer, realData->countBufferOffset);
+				}
+				else if (nullptr != realData->indirectBuffer)
 				{
 					static_cast<VulkanRhi::VulkanRhi&>(rhi).drawIndexedGraphics(*realData->indirectBuffer, realData->indirectBufferOffset, realData->numberOfDraws);
 				}
@@ -11567,7 +13278,7 @@ namespace
 			void DispatchCompute(const void* data, Rhi::IRhi& rhi)
 			{
 				const Rhi::Command::DispatchCompute* realData = static_cast<const Rhi::Command::DispatchCompute*>(data);
-				vkCmdDispatch(static_cast<VulkanRhi::VulkanRhi&>(rhi).getVulkanContext().getVkCommandBuffer(), realData->groupCountX, realData->groupCountY, realData->groupCountZ);
+				static_cast<VulkanRhi::VulkanRhi&>(rhi).dispatchCompute(realData->groupCountX, realData->groupCountY, realData->groupCountZ);
 			}
 
 			//[-------------------------------------------------------]
@@ -11780,6 +13491,7 @@ namespace VulkanRhi
 		mDefaultSamplerState(nullptr),
 		mInsideVulkanRenderPass(false),
 		mVkClearValues{},
+		mTimestampPeriod(1.0f),
 		mVertexArray(nullptr),
 		mRenderTarget(nullptr)
 	{
@@ -12187,6 +13899,26 @@ namespace VulkanRhi
 		vkCmdDrawIndexedIndirect(getVulkanContext().getVkCommandBuffer(), static_cast<const IndirectBuffer&>(indirectBuffer).getVkBuffer(), indirectBufferOffset, numberOfDraws, sizeof(VkDrawIndexedIndirectCommand));
 	}
 
+	void VulkanRhi::drawIndexedGraphicsCount(const Rhi::IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t maximumNumberOfDraws, const Rhi::IIndirectBuffer& countBuffer, uint32_t countBufferOffset)
+	{
+		// Sanity checks
+		RHI_MATCH_CHECK(*this, indirectBuffer)
+		RHI_MATCH_CHECK(*this, countBuffer)
+		RHI_ASSERT(mContext, maximumNumberOfDraws > 0, "Maximum number of Vulkan draws must not be zero")
+		RHI_ASSERT(mContext, nullptr != mVertexArray, "Vulkan draw indexed needs a set vertex array")
+		RHI_ASSERT(mContext, nullptr != mVertexArray->getIndexBuffer(), "Vulkan draw indexed needs a set vertex array which contains an index buffer")
+		RHI_ASSERT(mContext, nullptr != vkCmdDrawIndexedIndirectCountKHR, "The VK_KHR_draw_indirect_count Vulkan extension isn't supported")
+
+		// Start Vulkan render pass, if necessary
+		if (!mInsideVulkanRenderPass)
+		{
+			beginVulkanRenderPass();
+		}
+
+		// Vulkan draw indexed indirect count command
+		vkCmdDrawIndexedIndirectCountKHR(getVulkanContext().getVkCommandBuffer(), static_cast<const IndirectBuffer&>(indirectBuffer).getVkBuffer(), indirectBufferOffset, static_cast<const IndirectBuffer&>(countBuffer).getVkBuffer(), countBufferOffset, maximumNumberOfDraws, sizeof(VkDrawIndexedIndirectCommand));
+	}
+
 	void VulkanRhi::drawIndexedGraphicsEmulated(const uint8_t* emulationData, uint32_t indirectBufferOffset, uint32_t numberOfDraws)
 	{
 		// Sanity checks
@@ -12280,6 +14012,10 @@ namespace VulkanRhi
 		{
 			mComputeRootSignature->releaseReference();
 		}
+		for (VkBuffers& vkBuffers : mComputeUnorderedAccessVkBuffers)
+		{
+			vkBuffers.clear();
+		}
 		mComputeRootSignature = static_cast<RootSignature*>(rootSignature);
 		if (nullptr != mComputeRootSignature)
 		{
@@ -12331,6 +14067,11 @@ namespace VulkanRhi
 			{
 				vkCmdBindDescriptorSets(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_BIND_POINT_COMPUTE, mComputeRootSignature->getVkPipelineLayout(), rootParameterIndex, 1, &vkDescriptorSet, 0, nullptr);
 			}
+
+			// Remember the buffers a compute dispatch might write to
+			RHI_ASSERT(mContext, rootParameterIndex < ::detail::countof(mComputeUnorderedAccessVkBuffers), "The Vulkan RHI implementation compute root parameter index is out of bounds")
+			mComputeUnorderedAccessVkBuffers[rootParameterIndex].clear();
+			static_cast<ResourceGroup*>(resourceGroup)->getUnorderedAccessVkBuffers(mComputeUnorderedAccessVkBuffers[rootParameterIndex]);
 		}
 		else
 		{
@@ -12338,6 +14079,27 @@ namespace VulkanRhi
 		}
 	}
 
+	void VulkanRhi::dispatchCompute(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+	{
+		// Buffers written by a previous dispatch might be consumed by this one, e.g. GPU culling draw counts which are cleared by one dispatch and incremented by the next one
+		insertComputeWriteBarriers(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+		// Vulkan dispatch command
+		vkCmdDispatch(getVulkanContext().getVkCommandBuffer(), groupCountX, groupCountY, groupCountZ);
+
+		// The barrier for the written buffers is inserted right before they're consumed, e.g. as indirect draw arguments by the draw calls of the next Vulkan render pass
+		for (const VkBuffers& vkBuffers : mComputeUnorderedAccessVkBuffers)
+		{
+			for (VkBuffer vkBuffer : vkBuffers)
+			{
+				if (std::find(mComputeWrittenVkBuffers.cbegin(), mComputeWrittenVkBuffers.cend(), vkBuffer) == mComputeWrittenVkBuffers.cend())
+				{
+					mComputeWrittenVkBuffers.push_back(vkBuffer);
+				}
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Resource                                              ]
@@ -12630,42 +14392,48 @@ namespace VulkanRhi
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<VertexBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data       = static_cast<VertexBuffer&>(resource).getVulkanMemoryAllocation().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::INDEX_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<IndexBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data       = static_cast<IndexBuffer&>(resource).getVulkanMemoryAllocation().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<TextureBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data       = static_cast<TextureBuffer&>(resource).getVulkanMemoryAllocation().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<StructuredBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data       = static_cast<StructuredBuffer&>(resource).getVulkanMemoryAllocation().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<IndirectBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data       = static_cast<IndirectBuffer&>(resource).getVulkanMemoryAllocation().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<UniformBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data       = static_cast<UniformBuffer&>(resource).getVulkanMemoryAllocation().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
@@ -12746,40 +14514,13 @@ namespace VulkanRhi
 		switch (resource.getResourceType())
 		{
 			case Rhi::ResourceType::VERTEX_BUFFER:
-			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<VertexBuffer&>(resource).getVkDeviceMemory());
-				break;
-			}
-
 			case Rhi::ResourceType::INDEX_BUFFER:
-			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<IndexBuffer&>(resource).getVkDeviceMemory());
-				break;
-			}
-
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<TextureBuffer&>(resource).getVkDeviceMemory());
-				break;
-			}
-
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
-			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<StructuredBuffer&>(resource).getVkDeviceMemory());
-				break;
-			}
-
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<IndirectBuffer&>(resource).getVkDeviceMemory());
-				break;
-			}
-
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<UniformBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, buffer memory is persistently mapped by the Vulkan memory allocator
 				break;
-			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
 			{
@@ -12884,7 +14625,6 @@ namespace VulkanRhi
 		switch (vulkanQueryPool.getQueryType())
 		{
 			case Rhi::QueryType::OCCLUSION:
-			case Rhi::QueryType::TIMESTAMP:	// TODO(co) Convert time to nanoseconds, see e.g. http://vulkan-spec-chunked.ahcox.com/ch16s05.html - VkPhysicalDeviceLimits::timestampPeriod - The number of nanoseconds it takes for a timestamp value to be incremented by 1
 			{
 				// Get Vulkan query pool results
 				const VkQueryResultFlags vkQueryResultFlags = 0u;
@@ -12892,6 +14632,27 @@ namespace VulkanRhi
 				return (vkGetQueryPoolResults(getVulkanContext().getVkDevice(), vulkanQueryPool.getVkQueryPool(), firstQueryIndex, numberOfQueries, numberOfDataBytes, data, strideInBytes, VK_QUERY_RESULT_64_BIT | vkQueryResultFlags) == VK_SUCCESS);
 			}
 
+			case Rhi::QueryType::TIMESTAMP:
+			{
+				// Get Vulkan query pool results
+				if (vkGetQueryPoolResults(getVulkanContext().getVkDevice(), vulkanQueryPool.getVkQueryPool(), firstQueryIndex, numberOfQueries, numberOfDataBytes, data, strideInBytes, VK_QUERY_RESULT_64_BIT) == VK_SUCCESS)
+				{
+					// Convert time to nanoseconds, see "VkPhysicalDeviceLimits::timestampPeriod" - The number of nanoseconds it takes for a timestamp value to be incremented by 1
+					if (1.0f != mTimestampPeriod)
+					{
+						uint8_t* currentData = data;
+						for (uint32_t i = 0; i < numberOfQueries; ++i)
+						{
+							uint64_t* timestamp = reinterpret_cast<uint64_t*>(currentData);
+							*timestamp = static_cast<uint64_t>(static_cast<double>(*timestamp) * mTimestampPeriod);
+							currentData += strideInBytes;
+						}
+					}
+					return true;
+				}
+				return false;
+			}
+
 			case Rhi::QueryType::PIPELINE_STATISTICS:
 			{
 				// Our setup results in the same structure layout as used by "D3D11_QUERY_DATA_PIPELINE_STATISTICS" which we use for "Rhi::PipelineStatisticsQueryResult"
@@ -12936,6 +14697,13 @@ namespace VulkanRhi
 			// -> "Critical: Vulkan debug report callback: Object type: "VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT" Object: "217049444" Location: "0" Message code: "0" Layer prefix: "Validation" Message: " [ UNASSIGNED-CoreValidation-DrawState-VtxIndexOutOfBounds ] Object: 0xcefe964 (Type = 6) | The Pipeline State Object (0x1b) expects that this Command Buffer's vertex binding Index 0 should be set via vkCmdBindVertexBuffers. This is because VkVertexInputBindingDescription struct at index 0 of pVertexBindingDescriptions has a binding value of 0." "
 			unsetGraphicsVertexArray();
 
+			// Buffers written by compute dispatches which weren't consumed, yet, might be consumed by the next command buffer, and we need to forget about the compute bindings
+			insertComputeWriteBarriers(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT);
+			for (VkBuffers& vkBuffers : mComputeUnorderedAccessVkBuffers)
+			{
+				vkBuffers.clear();
+			}
+
 			// End Vulkan command buffer
 			if (vkEndCommandBuffer(getVulkanContext().getVkCommandBuffer()) != VK_SUCCESS)
 			{
@@ -12951,6 +14719,108 @@ namespace VulkanRhi
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t VulkanRhi::getPipelineCacheData(uint32_t numberOfDataBytes, uint8_t* data)
+	{
+		const VkPipelineCache vkPipelineCache = mVulkanContext->getVkPipelineCache();
+		if (VK_NULL_HANDLE != vkPipelineCache)
+		{
+			// "VK_INCOMPLETE" means the given buffer is too small
+			size_t dataSize = numberOfDataBytes;
+			if (vkGetPipelineCacheData(mVulkanContext->getVkDevice(), vkPipelineCache, &dataSize, data) == VK_SUCCESS)
+			{
+				return static_cast<uint32_t>(dataSize);
+			}
+		}
+
+		// Error!
+		return 0;
+	}
+
+	bool VulkanRhi::setPipelineCacheData(uint32_t numberOfDataBytes, const uint8_t* data)
+	{
+		RHI_ASSERT(mContext, nullptr != data, "Invalid Vulkan pipeline cache data")
+		const VkPipelineCache vkPipelineCache = mVulkanContext->getVkPipelineCache();
+		if (VK_NULL_HANDLE == vkPipelineCache)
+		{
+			return false;
+		}
+
+		{ // Validate the pipeline cache header against the used device and driver
+			// -> Layout as defined by the Vulkan specification as "VkPipelineCacheHeaderVersionOne"
+			// -> Drivers are supposed to reject incompatible data themselves, but there are drivers out there which crash instead
+			struct PipelineCacheHeader final
+			{
+				uint32_t headerSize;
+				uint32_t headerVersion;
+				uint32_t vendorID;
+				uint32_t deviceID;
+				uint8_t  pipelineCacheUUID[VK_UUID_SIZE];
+			};
+			if (numberOfDataBytes < sizeof(PipelineCacheHeader))
+			{
+				return false;
+			}
+			PipelineCacheHeader pipelineCacheHeader;
+			memcpy(&pipelineCacheHeader, data, sizeof(PipelineCacheHeader));
+			VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+			vkGetPhysicalDeviceProperties(mVulkanContext->getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
+			if (pipelineCacheHeader.headerSize < sizeof(PipelineCacheHeader) || pipelineCacheHeader.headerSize > numberOfDataBytes ||
+				VK_PIPELINE_CACHE_HEADER_VERSION_ONE != pipelineCacheHeader.headerVersion ||
+				vkPhysicalDeviceProperties.vendorID != pipelineCacheHeader.vendorID || vkPhysicalDeviceProperties.deviceID != pipelineCacheHeader.deviceID ||
+				memcmp(vkPhysicalDeviceProperties.pipelineCacheUUID, pipelineCacheHeader.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+			{
+				// Not an error, the data was just written by another device or driver version
+				RHI_LOG(mContext, INFORMATION, "Ignoring Vulkan pipeline cache data which was created by another device or driver version")
+				return false;
+			}
+		}
+
+		// Merge the data into the pipeline cache used for all pipelines
+		const VkDevice vkDevice = mVulkanContext->getVkDevice();
+		const VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+		{
+			VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// sType (VkStructureType)
+			nullptr,										// pNext (const void*)
+			0,												// flags (VkPipelineCacheCreateFlags)
+			numberOfDataBytes,								// initialDataSize (size_t)
+			data											// pInitialData (const void*)
+		};
+		VkPipelineCache sourceVkPipelineCache = VK_NULL_HANDLE;
+		if (vkCreatePipelineCache(vkDevice, &vkPipelineCacheCreateInfo, getVkAllocationCallbacks(), &sourceVkPipelineCache) != VK_SUCCESS)
+		{
+			RHI_LOG(mContext, WARNING, "Failed to create a Vulkan pipeline cache from the given data")
+			return false;
+		}
+		const bool result = (vkMergePipelineCaches(vkDevice, vkPipelineCache, 1, &sourceVkPipelineCache) == VK_SUCCESS);
+		vkDestroyPipelineCache(vkDevice, sourceVkPipelineCache, getVkAllocationCallbacks());
+
+		// Done
+		return result;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Memory                                                ]
+	//[-------------------------------------------------------]
+	bool VulkanRhi::getMemoryStatistics(Rhi::MemoryStatistics& memoryStatistics) const
+	{
+		if (!isInitialized())
+		{
+			return false;
+		}
+		const VulkanMemoryAllocator::Statistics statistics = mVulkanContext->getVulkanMemoryAllocator().getTotalStatistics();
+		memoryStatistics.numberOfMemoryBlocks		  = statistics.numberOfBlocks;
+		memoryStatistics.numberOfDedicatedAllocations = statistics.numberOfDedicatedAllocations;
+		memoryStatistics.numberOfSubAllocations		  = statistics.numberOfSubAllocations;
+		memoryStatistics.numberOfAllocatedBytes		  = statistics.numberOfAllocatedBytes;
+		memoryStatistics.numberOfUsedBytes			  = statistics.numberOfUsedBytes;
+		return true;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -12962,6 +14832,9 @@ namespace VulkanRhi
 			const size_t numberOfCharacters = ::detail::countof(mCapabilities.deviceName) - 1;
 			strncpy(mCapabilities.deviceName, vkPhysicalDeviceProperties.deviceName, numberOfCharacters);
 			mCapabilities.deviceName[numberOfCharacters] = '\0';
+
+			// Timestamp query results are in "timestampPeriod" units, we want nanoseconds
+			mTimestampPeriod = vkPhysicalDeviceProperties.limits.timestampPeriod;
 		}
 
 		// Preferred swap chain texture format
@@ -13057,6 +14930,9 @@ namespace VulkanRhi
 		// Is there support for task shaders (TS) and mesh shaders (MS)?
 		mCapabilities.meshShader = (nullptr != vkCmdDrawMeshTasksNV);
 
+		// Draw indirect count supported? ("VK_KHR_draw_indirect_count"-extension, core since Vulkan 1.2, also exposed by Mesa lavapipe)
+		mCapabilities.drawIndirectCount = (nullptr != vkCmdDrawIndexedIndirectCountKHR);
+
 		// Is there support for compute shaders (CS)?
 		mCapabilities.computeShader = true;
 	}
@@ -13081,6 +14957,10 @@ namespace VulkanRhi
 		RHI_ASSERT(mContext, !mInsideVulkanRenderPass, "We're already inside a Vulkan render pass")
 		RHI_ASSERT(mContext, nullptr != mRenderTarget, "Can't begin a Vulkan render pass without a render target set")
 
+		// Buffers written by compute dispatches might be consumed by the draw calls, e.g. indirect draw arguments and draw counts written by GPU culling
+		// -> Pipeline barriers can't be inserted inside a Vulkan render pass without a subpass self-dependency, so do it now
+		insertComputeWriteBarriers(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_SHADER_READ_BIT);
+
 		// Start Vulkan render pass
 		const uint32_t numberOfAttachments = static_cast<const RenderPass&>(mRenderTarget->getRenderPass()).getNumberOfAttachments();
 		RHI_ASSERT(mContext, numberOfAttachments < 9, "Vulkan only supports 8 render pass attachments")
@@ -13137,6 +15017,37 @@ namespace VulkanRhi
 		mInsideVulkanRenderPass = true;
 	}
 
+	void VulkanRhi::insertComputeWriteBarriers(VkPipelineStageFlags dstVkPipelineStageFlags, VkAccessFlags dstVkAccessFlags)
+	{
+		if (!mComputeWrittenVkBuffers.empty())
+		{
+			// Sanity check
+			RHI_ASSERT(mContext, !mInsideVulkanRenderPass, "Can't insert Vulkan buffer memory barriers inside a Vulkan render pass")
+
+			// Insert one Vulkan buffer memory barrier per written buffer
+			Vector<VkBufferMemoryBarrier> vkBufferMemoryBarriers;
+			vkBufferMemoryBarriers.reserve(mComputeWrittenVkBuffers.size());
+			for (VkBuffer vkBuffer : mComputeWrittenVkBuffers)
+			{
+				const VkBufferMemoryBarrier vkBufferMemoryBarrier =
+				{
+					VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,	// sType (VkStructureType)
+					nullptr,									// pNext (const void*)
+					VK_ACCESS_SHADER_WRITE_BIT,					// srcAccessMask (VkAccessFlags)
+					dstVkAccessFlags,							// dstAccessMask (VkAccessFlags)
+					VK_QUEUE_FAMILY_IGNORED,					// srcQueueFamilyIndex (uint32_t)
+					VK_QUEUE_FAMILY_IGNORED,					// dstQueueFamilyIndex (uint32_t)
+					vkBuffer,									// buffer (VkBuffer)
+					0,											// offset (VkDeviceSize)
+					VK_WHOLE_SIZE								// size (VkDeviceSize)
+				};
+				vkBufferMemoryBarriers.push_back(vkBufferMemoryBarrier);
+			}
+			vkCmdPipelineBarrier(getVulkanContext().getVkCommandBuffer(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, dstVkPipelineStageFlags, 0, 0, nullptr, static_cast<uint32_t>(vkBufferMemoryBarriers.size()), vkBufferMemoryBarriers.data(), 0, nullptr);
+			mComputeWrittenVkBuffers.clear();
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -2606,15 +2606,17 @@ namespace Rhi
 	*/
 	enum class VertexAttributeFormat : uint8_t
 	{
-		FLOAT_1			= 0,	///< Float 1 (one component per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		FLOAT_2			= 1,	///< Float 2 (two components per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		FLOAT_3			= 2,	///< Float 3 (three components per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		FLOAT_4			= 3,	///< Float 4 (four components per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		R8G8B8A8_UNORM	= 4,	///< Unsigned byte 4 (four components per element, 8 bit integer per component), will be passed in a normalized form into shaders, supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		R8G8B8A8_UINT	= 5,	///< Unsigned byte 4 (four components per element, 8 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		SHORT_2			= 6,	///< Short 2 (two components per element, 16 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		SHORT_4			= 7,	///< Short 4 (four components per element, 16 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
-		UINT_1			= 8		///< Unsigned integer 1 (one components per element, 32 bit unsigned integer per component), supported by DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		FLOAT_1				= 0,	///< Float 1 (one component per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		FLOAT_2				= 1,	///< Float 2 (two components per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		FLOAT_3				= 2,	///< Float 3 (three components per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		FLOAT_4				= 3,	///< Float 4 (four components per element, 32 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		R8G8B8A8_UNORM		= 4,	///< Unsigned byte 4 (four components per element, 8 bit integer per component), will be passed in a normalized form into shaders, supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		R8G8B8A8_UINT		= 5,	///< Unsigned byte 4 (four components per element, 8 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		SHORT_2				= 6,	///< Short 2 (two components per element, 16 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		SHORT_4				= 7,	///< Short 4 (four components per element, 16 bit integer per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		UINT_1				= 8,	///< Unsigned integer 1 (one components per element, 32 bit unsigned integer per component), supported by DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		R16G16B16A16_UNORM	= 9,	///< Unsigned short 4 (four components per element, 16 bit integer per component), will be passed in a normalized form into shaders, supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
+		HALF_2				= 10	///< Half 2 (two components per element, 16 bit floating point per component), supported by DirectX 9, DirectX 10, DirectX 11, OpenGL and OpenGL ES 3
 	};
 	/**
 	*  @brief
@@ -3803,6 +3805,8 @@ namespace Rhi
 		bool				baseVertex;										///< Base vertex supported for draw calls?
 		bool				nativeMultithreading;							///< Does the RHI support native multithreading? For example Direct3D 11 does meaning we can also create RHI resources asynchronous while for OpenGL we have to create an separate OpenGL context (less efficient, more complex to implement).
 		bool				shaderBytecode;									///< Shader bytecode supported?
+		bool				bindlessTexture;								///< Bindless texture supported? Textures can then be sampled through handles stored inside buffers instead of being bound via resource groups, see "Rhi::IRhi::getBindlessTextureHandle()". Currently only reported by the OpenGL RHI ("GL_ARB_bindless_texture").
+		bool				drawIndirectCount;								///< Draw indirect count supported? The number of multi-draw-indirect draws can then be read from a GPU buffer, e.g. written by a culling compute shader, see "Rhi::Command::DrawIndexedGraphics".
 		// Graphics
 		bool				vertexShader;									///< Is there support for vertex shaders (VS)?
 		uint32_t			maximumNumberOfPatchVertices;					///< Tessellation-control-shader (TCS) stage and tessellation-evaluation-shader (TES) stage: Maximum number of vertices per patch (usually 0 for no tessellation support or 32 which is the maximum number of supported vertices per patch)
@@ -3842,6 +3846,8 @@ namespace Rhi
 			baseVertex(false),
 			nativeMultithreading(false),
 			shaderBytecode(false),
+			bindlessTexture(false),
+			drawIndirectCount(false),
 			vertexShader(false),
 			maximumNumberOfPatchVertices(0),
 			maximumNumberOfGsOutputVertices(0),
@@ -3954,6 +3960,8 @@ namespace Rhi
 			std::atomic<uint32_t> numberOfCreatedMeshShaders;					///< Number of created mesh shader (MS) instances
 			std::atomic<uint32_t> currentNumberOfComputeShaders;				///< Current number of compute shader (CS) instances
 			std::atomic<uint32_t> numberOfCreatedComputeShaders;				///< Number of created compute shader (CS) instances
+			// Command buffer dispatch
+			std::atomic<uint32_t> numberOfSkippedStateChanges;					///< Number of redundant state changes and resource bindings the RHI implementation filtered out instead of passing them to the underlying API
 
 		// Public methods
 		public:
@@ -4030,7 +4038,9 @@ namespace Rhi
 				currentNumberOfMeshShaders(0),
 				numberOfCreatedMeshShaders(0),
 				currentNumberOfComputeShaders(0),
-				numberOfCreatedComputeShaders(0)
+				numberOfCreatedComputeShaders(0),
+				// Command buffer dispatch
+				numberOfSkippedStateChanges(0)
 			{}
 
 			/**
@@ -4167,6 +4177,25 @@ namespace Rhi
 
 
 
+	//[-------------------------------------------------------]
+	//[ Rhi/MemoryStatistics.h                                ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    GPU memory statistics of RHI implementations which manage GPU memory on their own, see "Rhi::IRhi::getMemoryStatistics()"
+	*/
+	struct MemoryStatistics final
+	{
+		uint32_t numberOfMemoryBlocks;			///< Number of currently allocated memory blocks resources are sub-allocated from
+		uint32_t numberOfDedicatedAllocations;	///< Number of current resources with an own memory allocation
+		uint32_t numberOfSubAllocations;		///< Number of current resources which live inside memory blocks
+		uint64_t numberOfAllocatedBytes;		///< Number of bytes allocated from the underlying API
+		uint64_t numberOfUsedBytes;				///< Number of bytes handed out to resources, the difference to "numberOfAllocatedBytes" is unused or lost due to fragmentation
+	};
+
+
+
+
 	//[-------------------------------------------------------]
 	//[ Rhi/IRhi.h                                            ]
 	//[-------------------------------------------------------]
@@ -4632,6 +4661,88 @@ namespace Rhi
 		*/
 		virtual void dispatchCommandBuffer(const CommandBuffer& commandBuffer) = 0;
 
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Get the RHI implementation specific pipeline cache data (e.g. Vulkan "VkPipelineCache") which avoids driver side pipeline compilation when fed back via "setPipelineCacheData()" during the next run
+		*
+		*  @param[in]  numberOfDataBytes
+		*    Number of bytes "data" can receive, ignored if "data" is a null pointer
+		*  @param[out] data
+		*    Receives the pipeline cache data, can be a null pointer to just ask for the number of bytes
+		*
+		*  @return
+		*    Number of pipeline cache data bytes, 0 if the RHI implementation has no pipeline cache or if "numberOfDataBytes" is too small
+		*/
+		[[nodiscard]] virtual uint32_t getPipelineCacheData([[maybe_unused]] uint32_t numberOfDataBytes, [[maybe_unused]] uint8_t* data)
+		{
+			return 0;
+		}
+
+		/**
+		*  @brief
+		*    Set RHI implementation specific pipeline cache data previously received via "getPipelineCacheData()"
+		*
+		*  @param[in] numberOfDataBytes
+		*    Number of data bytes
+		*  @param[in] data
+		*    Pipeline cache data, must be valid
+		*
+		*  @return
+		*    "true" if the data was accepted, "false" if the RHI implementation has no pipeline cache or if the data doesn't match the used driver or device
+		*
+		*  @note
+		*    - Call this before creating pipeline states, pipeline states which were created earlier don't profit from it
+		*/
+		virtual bool setPipelineCacheData([[maybe_unused]] uint32_t numberOfDataBytes, [[maybe_unused]] const uint8_t* data)
+		{
+			return false;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Bindless texture                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the bindless handle of a texture, the texture is made resident so shaders can sample it through the handle
+		*
+		*  @param[in] texture
+		*    Texture to return the bindless handle for, must be owned by this RHI instance
+		*  @param[in] samplerState
+		*    Sampler state to combine with the texture, can be a null pointer (the sampler parameters of the texture are used in this case)
+		*
+		*  @return
+		*    Bindless texture handle, 0 if "Rhi::Capabilities::bindlessTexture" is "false"
+		*
+		*  @note
+		*    - The handle stays valid as long as the texture and sampler state instances stay alive, asking again for the same combination returns the same handle
+		*    - The texture and sampler state parameters are frozen once a bindless handle has been requested for them
+		*/
+		[[nodiscard]] virtual uint64_t getBindlessTextureHandle([[maybe_unused]] ITexture& texture, [[maybe_unused]] ISamplerState* samplerState)
+		{
+			return 0;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Memory                                                ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the GPU memory statistics of the RHI instance
+		*
+		*  @param[out] memoryStatistics
+		*    Receives the GPU memory statistics, left untouched if "false" is returned
+		*
+		*  @return
+		*    "true" if the RHI implementation manages GPU memory on its own and filled the statistics, else "false"
+		*/
+		[[nodiscard]] virtual bool getMemoryStatistics([[maybe_unused]] MemoryStatistics& memoryStatistics) const
+		{
+			return false;
+		}
+
 		//[-------------------------------------------------------]
 		//[ RHI implementation specific                           ]
 		//[-------------------------------------------------------]
@@ -9602,6 +9713,8 @@ namespace Rhi
 		*    - Fails if no index and/or vertex array is set
 		*    - If the multi-draw indirect feature is not supported this parameter, multiple draw calls are emitted
 		*    - If the draw indirect feature is not supported, a software indirect buffer is used and multiple draw calls are emitted
+		*    - The count buffer variant reads the number of draws as "uint32_t" at "countBufferOffset" from the given count buffer and clamps it to "numberOfDraws",
+		*      only supported if "Rhi::Capabilities::drawIndirectCount" is true; count and arguments are usually written by a compute shader (GPU-driven rendering)
 		*/
 		struct DrawIndexedGraphics final
 		{
@@ -9610,6 +9723,13 @@ namespace Rhi
 			{
 				*commandBuffer.addCommand<DrawIndexedGraphics>() = DrawIndexedGraphics(indirectBuffer, indirectBufferOffset, numberOfDraws);
 			}
+			static inline void create(CommandBuffer& commandBuffer, const IIndirectBuffer& indirectBuffer, uint32_t indirectBufferOffset, uint32_t maximumNumberOfDraws, const IIndirectBuffer& countBuffer, uint32_t countBufferOffset)
+			{
+				DrawIndexedGraphics* drawCommand = commandBuffer.addCommand<DrawIndexedGraphics>();
+				*drawCommand = DrawIndexedGraphics(indirectBuffer, indirectBufferOffset, maximumNumberOfDraws);
+				drawCommand->countBuffer	   = &countBuffer;
+				drawCommand->countBufferOffset = countBufferOffset;
+			}
 			static inline void create(CommandBuffer& commandBuffer, uint32_t indexCountPerInstance, uint32_t instanceCount = 1, uint32_t startIndexLocation = 0, int32_t baseVertexLocation = 0, uint32_t startInstanceLocation = 0)
 			{
 				DrawIndexedGraphics* drawCommand = commandBuffer.addCommand<DrawIndexedGraphics>(sizeof(DrawIndexedArguments));
@@ -9622,17 +9742,23 @@ namespace Rhi
 				drawCommand->indirectBuffer		  = nullptr;
 				drawCommand->indirectBufferOffset = 0;
 				drawCommand->numberOfDraws		  = 1;
+				drawCommand->countBuffer		  = nullptr;
+				drawCommand->countBufferOffset	  = 0;
 			}
 			// Constructor
 			inline DrawIndexedGraphics(const IIndirectBuffer& _indirectBuffer, uint32_t _indirectBufferOffset, uint32_t _numberOfDraws) :
 				indirectBuffer(&_indirectBuffer),
 				indirectBufferOffset(_indirectBufferOffset),
-				numberOfDraws(_numberOfDraws)
+				numberOfDraws(_numberOfDraws),
+				countBuffer(nullptr),
+				countBufferOffset(0)
 			{}
 			// Data
 			const IIndirectBuffer* indirectBuffer;	///< If null pointer, command auxiliary memory is used instead
 			uint32_t			   indirectBufferOffset;
-			uint32_t			   numberOfDraws;
+			uint32_t			   numberOfDraws;		///< Maximum number of draws in case a count buffer is used
+			const IIndirectBuffer* countBuffer;			///< Optional draw count buffer, only valid in combination with an indirect buffer and if "Rhi::Capabilities::drawIndirectCount" is true, can be a null pointer
+			uint32_t			   countBufferOffset;
 			// Static data
 			static constexpr CommandDispatchFunctionIndex COMMAND_DISPATCH_FUNCTION_INDEX = CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS;
 		};